@@ -4,14 +4,24 @@
 ///  This file implements a simple automatic gain control. The gain is
 ///  adjusted so that the peaks of the output signal lie between given
 ///  upper and lower thresholds. 
+///
+///  Block() processes an array of samples with one gain update per block.
+///  The block peak is found with a vectorised search and the gain is ramped
+///  linearly from its value at the start of the block to its updated value.
+///
+///  LookAheadAutomaticGainControl delays the signal so that the gain can be
+///  reduced before an attack transient reaches the output.
 
 // StdC++ headers
 #include <iostream>
+#include <algorithm>
+#include <vector>
 
 // StdC headers
 #include <cmath>
 
 // Local headers
+#include "saSampleSimd.h"
 #include "Filter.h"
 
 using namespace SimpleAudio;
@@ -96,6 +106,43 @@ public:
     return U;
   }
 
+  /// Automatic gain control of a block of samples. The peak and gain are
+  /// updated once per block and the gain applied to the block is ramped
+  /// linearly from the previous gain to the updated gain.
+  /// \param u pointer to the input block
+  /// \param y pointer to the output block (may equal u)
+  /// \param n length of the block
+  void Block(const T* const u, T* const y, const std::size_t n)
+  {
+    if (n == 0)
+      {
+        return;
+      }
+
+    // Update peak with the maximum of the block at the current gain
+    saSampleTo<float> conv;
+    const float g0 = conv(gain);
+    const float nf = static_cast<float>(n);
+    const float blockPeak = g0*conv(saSampleMaxAbs(u, n));
+    const float p = std::max(conv(peak)*powf(conv(peakK), nf), blockPeak);
+
+    // Update gain
+    float g1 = g0;
+    if ((p < conv(lowerPeakThreshold)) && (g0 < conv(gainMax)))
+      {
+        g1 = std::min(g0/powf(conv(slowK), nf), conv(gainMax));
+      }
+    else if ((p > conv(upperPeakThreshold)) && (g0 > conv(gainMin)))
+      {
+        g1 = std::max(g0*powf(conv(fastK), nf), conv(gainMin));
+      }
+    peak = p;
+    gain = g1;
+
+    // Ramp the gain across the block
+    saSampleGainRamp(u, y, n, g0, (g1-g0)/nf);
+  }
+
 private:
 
   // AGC parameters
@@ -119,6 +166,154 @@ private:
   AutomaticGainControl& operator=(AutomaticGainControl&);
 };
 
-#endif
+/// \class LookAheadAutomaticGainControl
+/// \brief Implementation of an automatic gain control functor with look-ahead
+///
+/// The output is the input delayed by lookAhead samples. The maximum of the
+/// absolute input over the delay line is found with a monotonic queue. If
+/// that maximum would exceed the upper peak threshold at the current gain
+/// then the gain is reduced so that it meets the threshold. The gain
+/// applied to the output is the average of the gains over the delay line,
+/// so it ramps down across the look-ahead and no sample in the delay line
+/// exceeds the threshold when it reaches the output. The peak estimate
+/// follows the limited maximum so gain reductions do not re-trigger after
+/// the attack has passed.
+/// \tparam T the type of the input and output
+template <typename T>
+class LookAheadAutomaticGainControl : public Filter<T>
+{
+public:
+  /// \brief Constructor for a look-ahead automatic gain control functor
+  /// \param _sampleRate input signal sample rate
+  /// \param _lookAhead delay in samples
+  /// \param _fastTauMs time constant in ms for reducing gain
+  /// \param _slowTauMs time constant in ms for increasing gain
+  /// \param _peakTauMs time constant in ms for reducing gain on peaks
+  /// \param _lowerPeakThreshold lower threshold on peak
+  /// \param _upperPeakThreshold upper threshold on peak
+  /// \param _gainMin minimum gain
+  /// \param _gainMax maximum gain
+  LookAheadAutomaticGainControl (const std::size_t _sampleRate,
+                                 const std::size_t _lookAhead,
+                                 const std::size_t _fastTauMs = 50,
+                                 const std::size_t _slowTauMs = 50,
+                                 const std::size_t _peakTauMs = 50,
+                                 const float _lowerPeakThreshold = 0.4f,
+                                 const float _upperPeakThreshold = 0.6f,
+                                 const float _gainMin = 0.1f,
+                                 const float _gainMax = 10.0f) : 
+    lowerPeakThreshold(_lowerPeakThreshold),
+    upperPeakThreshold(_upperPeakThreshold),
+    gainMin(_gainMin), 
+    gainMax(_gainMax), 
+    fastK( expf(-1000.0f/(float)(_fastTauMs*_sampleRate)) ),
+    slowK( expf(-1000.0f/(float)(_slowTauMs*_sampleRate)) ),
+    peakK( expf(-1000.0f/(float)(_peakTauMs*_sampleRate)) ),
+    gain(1), 
+    peak(0),
+    lookAhead(_lookAhead),
+    delay(_lookAhead+1, 0),
+    delayIndex(0),
+    maxValues(_lookAhead+1, 0.0f),
+    maxPositions(_lookAhead+1, 0),
+    maxFront(0),
+    maxLength(0),
+    gains(_lookAhead+1, 1.0f),
+    gainSum(static_cast<double>(_lookAhead+1)),
+    position(0)
+  {  
+  }
+
+  ~LookAheadAutomaticGainControl () throw() {}
+
+  /// Functor that implements a look-ahead automatic gain control
+  /// \param u the input
+  /// \return the output, delayed by lookAhead samples
+  T operator()(T& u)
+  {
+    saSampleTo<float> conv;
+    const float a = std::abs(conv(u));
+    const std::size_t size = maxValues.size();
+
+    // Push the new input onto the delay line. The oldest sample is output.
+    delay[delayIndex] = u;
+    delayIndex = (delayIndex+1) % size;
+    const float x = conv(delay[delayIndex]);
+
+    // Drop the queue front if it has passed the output
+    if ((maxLength > 0) && (maxPositions[maxFront]+lookAhead < position))
+      {
+        maxFront = (maxFront+1) % size;
+        maxLength--;
+      }
+
+    // Drop queue entries smaller than the new input then push it
+    while ( (maxLength > 0) &&
+            (maxValues[(maxFront+maxLength-1) % size] <= a) )
+      {
+        maxLength--;
+      }
+    maxValues[(maxFront+maxLength) % size] = a;
+    maxPositions[(maxFront+maxLength) % size] = position;
+    maxLength++;
+
+    // Reduce gain so that the window maximum meets the upper threshold
+    const float level = gain*maxValues[maxFront];
+    if ((level > upperPeakThreshold) && (gain > gainMin))
+      {
+        const float limit = upperPeakThreshold/maxValues[maxFront];
+        gain = std::max(std::min(gain*fastK, limit), gainMin);
+      }
 
+    // Update peak of the limited maximum and increase gain if required
+    peak = std::max(peak*peakK, std::min(level, upperPeakThreshold));
+    if ((peak < lowerPeakThreshold) && (gain < gainMax))
+      {
+        gain = std::min(gain/slowK, gainMax);
+      }
+
+    // Average the gains since the output sample entered the delay line.
+    // Each of them meets the threshold for that sample.
+    float& oldest = gains[position % size];
+    gainSum += static_cast<double>(gain) - static_cast<double>(oldest);
+    oldest = gain;
+    const float gainOut = static_cast<float>(gainSum/static_cast<double>(size));
+
+    position++;
+
+    return T(gainOut*x);
+  }
+
+private:
 
+  // AGC parameters
+  float lowerPeakThreshold; ///< Lower threshold of peak value
+  float upperPeakThreshold; ///< Upper threshold of peak value
+  float gainMin;            ///< Minimum gain
+  float gainMax;            ///< Maximum gain
+  float fastK;              ///< Factor for reducing gain
+  float slowK;              ///< Factor for increasing gain
+  float peakK;              ///< Factor for peak decay
+
+  // AGC state 
+  float gain;               ///< Current gain
+  float peak;               ///< Current estimate of the output peak
+
+  // Look-ahead state
+  std::size_t lookAhead;                 ///< Delay in samples
+  std::vector<T> delay;                  ///< Delay line ring
+  std::size_t delayIndex;                ///< Newest sample in delay line
+  std::vector<float> maxValues;          ///< Monotonic queue of |input|
+  std::vector<std::size_t> maxPositions; ///< Input positions of queue
+  std::size_t maxFront;                  ///< Front of the monotonic queue
+  std::size_t maxLength;                 ///< Length of the monotonic queue
+  std::vector<float> gains;              ///< Gains over the delay line
+  double gainSum;                        ///< Sum of gains
+  std::size_t position;                  ///< Input position
+
+  // Prevent copying
+  LookAheadAutomaticGainControl(LookAheadAutomaticGainControl&);
+  LookAheadAutomaticGainControl& operator=(LookAheadAutomaticGainControl&);
+};
+
+#endif
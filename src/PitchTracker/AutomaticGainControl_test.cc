@@ -13,6 +13,10 @@
 #include <iostream>
 #include <sstream>
 #include <algorithm>
+#include <numbers>
+
+// StdC include files
+#include <cmath>
 
 // Local include files
 #include "saSample.h"
@@ -60,6 +64,12 @@ static void Usage()
             <<  std::endl;
   std::cerr << " --gainMax               minimum gain"
             <<  std::endl;
+  std::cerr << " --blockMs               AGC block length in ms"
+            <<  std::endl;
+  std::cerr << " --lookAheadMs           AGC look-ahead delay in ms"
+            <<  std::endl;
+  std::cerr << " --step                  AGC response to a step in amplitude"
+            <<  std::endl;
 }
 
 void ParseOptions(int argc, 
@@ -77,7 +87,10 @@ void ParseOptions(int argc,
                   float& lowerPeakThreshold,
                   float& upperPeakThreshold,
                   float& gainMin,
-                  float& gainMax)
+                  float& gainMax,
+                  std::size_t& blockMs,
+                  std::size_t& lookAheadMs,
+                  bool& stepReq)
 {
   if (argc < 1)
     {
@@ -176,6 +189,101 @@ void ParseOptions(int argc,
     {
       std::istringstream(*(++opt)) >> gainMax;
     }
+
+  opt = std::find(options.begin(), options.end(), "--blockMs");
+  if (opt != options.end())
+    {
+      std::istringstream(*(++opt)) >> blockMs;
+    }
+
+  opt = std::find(options.begin(), options.end(), "--lookAheadMs");
+  if (opt != options.end())
+    {
+      std::istringstream(*(++opt)) >> lookAheadMs;
+    }
+
+  opt = std::find(options.begin(), options.end(), "--step");
+  if (opt != options.end())
+    {
+      stepReq = true;
+    }
+}
+
+/// Print the envelope of the AGC output for a 600Hz sine whose amplitude
+/// steps from 0.05 to 0.5 half way through. Each line holds the end time
+/// in ms of a 10ms window, the input peak and the output peak in that
+/// window. The last line holds the largest change of gain between adjacent
+/// output samples.
+static void StepResponse(AutomaticGainControl<saSample>& agc,
+                         LookAheadAutomaticGainControl<saSample>& lookAheadAgc,
+                         const std::size_t sampleRate,
+                         const std::size_t seconds,
+                         const std::size_t blockMs,
+                         const std::size_t lookAheadMs)
+{
+  // Input step
+  const std::size_t length = seconds*sampleRate;
+  std::vector<saSample> input(length);
+  for (std::size_t k=0; k<length; k++)
+    {
+      const double a = (k < length/2) ? 0.05 : 0.5;
+      const double w = 2*std::numbers::pi*600/static_cast<double>(sampleRate);
+      input[k] = saSample(static_cast<float>(a*sin(w*static_cast<double>(k))));
+    }
+
+  // AGC output
+  std::vector<saSample> output(length);
+  std::size_t delay = 0;
+  if (lookAheadMs > 0)
+    {
+      delay = lookAheadMs*sampleRate/1000;
+      std::transform(input.begin(), input.end(), output.begin(),
+                     updateFilter<saSample>(&lookAheadAgc));
+    }
+  else if (blockMs > 0)
+    {
+      const std::size_t blockSize = blockMs*sampleRate/1000;
+      for (std::size_t k=0; k<length; k+=blockSize)
+        {
+          agc.Block(&input[k], &output[k], std::min(blockSize, length-k));
+        }
+    }
+  else
+    {
+      std::transform(input.begin(), input.end(), output.begin(),
+                     updateFilter<saSample>(&agc));
+    }
+
+  // Envelope in 10ms windows
+  saSampleTo<float> conv;
+  const std::size_t window = sampleRate/100;
+  for (std::size_t k=0; k+window<=length; k+=window)
+    {
+      float peakIn = 0;
+      float peakOut = 0;
+      for (std::size_t j=k; j<k+window; j++)
+        {
+          peakIn = std::max(peakIn, std::abs(conv(input[j])));
+          peakOut = std::max(peakOut, std::abs(conv(output[j])));
+        }
+      std::cout << (k+window)*1000/sampleRate << " " 
+                << peakIn << " " << peakOut << std::endl;
+    }
+
+  // Largest gain change between samples, skipping input zero crossings
+  float maxGainStep = 0;
+  for (std::size_t k=delay+1; k<length; k++)
+    {
+      const float u0 = conv(input[k-delay-1]);
+      const float u1 = conv(input[k-delay]);
+      if ((std::abs(u0) > 0.01f) && (std::abs(u1) > 0.01f))
+        {
+          const float g0 = conv(output[k-1])/u0;
+          const float g1 = conv(output[k])/u1;
+          maxGainStep = std::max(maxGainStep, std::abs(g1-g0));
+        }
+    }
+  std::cout << "maxGainStep " << maxGainStep << std::endl;
 }
 
 using namespace SimpleAudio;
@@ -201,6 +309,9 @@ int main(int argc, char* argv[])
       float upperPeakThreshold = 0.6f;
       float gainMin = 0.1f;
       float gainMax = 10.0f;
+      std::size_t blockMs = 0;
+      std::size_t lookAheadMs = 0;
+      bool stepReq = false;
 
       // Parse arguments
       ParseOptions (argc, argv, helpReq, debugReq,
@@ -208,7 +319,7 @@ int main(int argc, char* argv[])
                     lpFilterCutoff, hpFilterCutoff, 
                     fastTauMs, slowTauMs, peakTauMs,
                     lowerPeakThreshold, upperPeakThreshold,
-                    gainMin, gainMax);
+                    gainMin, gainMax, blockMs, lookAheadMs, stepReq);
 
       // Check for help request
       if (helpReq)
@@ -230,9 +341,22 @@ int main(int argc, char* argv[])
          lowerPeakThreshold, upperPeakThreshold, gainMin, gainMax, 
          debugReq);
 
+      // Define look-ahead AGC
+      LookAheadAutomaticGainControl<saSample> lookAheadAgc
+        (sampleRate, lookAheadMs*sampleRate/1000, fastTauMs, slowTauMs, 
+         peakTauMs, lowerPeakThreshold, upperPeakThreshold, gainMin, gainMax);
+
+      // Step response
+      if (stepReq)
+        {
+          StepResponse(agc, lookAheadAgc, sampleRate, seconds,
+                       blockMs, lookAheadMs);
+          return 0;
+        }
+
       // Register file handlers
       const bool wavInRegistered = saSingletonInputFileSelector::Instance().
-        RegisterFileType(".wav", saInputSourceOpenFileWav);
+        RegisterFileType(".wav", saInputSourceOpenFileWavMmap);
       if (!wavInRegistered)
         {
           std::cerr << "failed to register wav for input!" << std::endl;
@@ -287,6 +411,14 @@ int main(int argc, char* argv[])
      std:: cerr << "Minimum gain " << gainMin
                 << " , maximum gain " << gainMax
                 << std::endl;
+      if (blockMs > 0)
+        {
+          std::cerr << "AGC block length(ms) " << blockMs << std::endl;
+        }
+      if (lookAheadMs > 0)
+        {
+          std::cerr << "AGC look-ahead(ms) " << lookAheadMs << std::endl;
+        }
 
       // Read
       std::size_t samplesToRead = seconds*sampleRate;
@@ -318,11 +450,34 @@ int main(int argc, char* argv[])
                          std::back_inserter(outputHp), 
                          updateFilter<saSample>(&hp));
 
-          outputAgc.resize(0);
-          std::transform(outputHp.begin(), 
-                         outputHp.end(), 
-                         std::back_inserter(outputAgc), 
-                         updateFilter<saSample>(&agc));
+          if (lookAheadMs > 0)
+            {
+              // Look-ahead AGC
+              outputAgc.resize(0);
+              std::transform(outputHp.begin(), 
+                             outputHp.end(), 
+                             std::back_inserter(outputAgc), 
+                             updateFilter<saSample>(&lookAheadAgc));
+            }
+          else if (blockMs > 0)
+            {
+              // Block AGC
+              const std::size_t blockSize = blockMs*sampleRate/1000;
+              outputAgc.resize(outputHp.size());
+              for (std::size_t k=0; k<outputHp.size(); k+=blockSize)
+                {
+                  const std::size_t n = std::min(blockSize, outputHp.size()-k);
+                  agc.Block(&outputHp[k], &outputAgc[k], n);
+                }
+            }
+          else
+            {
+              outputAgc.resize(0);
+              std::transform(outputHp.begin(), 
+                             outputHp.end(), 
+                             std::back_inserter(outputAgc), 
+                             updateFilter<saSample>(&agc));
+            }
           
           std::size_t samplesWritten = os->Write(outputAgc, samplesToWrite);
           samplesWrittenSoFar += samplesWritten;
@@ -152,7 +152,7 @@ int main(int argc, char* argv[])
 
       // Register file handlers
       const bool wavInRegistered = saSingletonInputFileSelector::Instance().
-        RegisterFileType(".wav", saInputSourceOpenFileWav);
+        RegisterFileType(".wav", saInputSourceOpenFileWavMmap);
       if (!wavInRegistered)
         {
           std::cerr << "failed to register wav for input!" << std::endl;
@@ -4,6 +4,8 @@
 #ifndef __FILTER_H__
 #define __FILTER_H__
 
+#include <cstddef>
+
 /// \class Filter
 /// \brief A virtual function object for a filter
 /// \tparam T the type of the input and output
@@ -14,6 +16,18 @@ public:
   Filter() {} ;
   virtual ~Filter() throw() { }
   virtual T operator() (T& u) = 0;
+
+  /// Filter an array of samples
+  /// \param u pointer to the input array
+  /// \param y pointer to the output array (may equal u)
+  /// \param n length of the arrays
+  void Apply(T* const u, T* const y, const std::size_t n)
+  {
+    for (std::size_t k=0; k<n; k++)
+      {
+        y[k] = (*this)(u[k]);
+      }
+  }
 };
 
 /// \class updateFilter
@@ -172,7 +172,6 @@
 #include <memory>
 #include <string>
 #include <vector>
-#include <deque>
 #include <list>
 #include <iterator>
 #include <numeric>
@@ -184,6 +183,8 @@
 
 // Local include files
 #include "saSample.h"
+#include "saSampleFast.h"
+#include "saSampleBuffer.h"
 #include "saInputStream.h"
 #include "PreProcessor.h"
 #include "PitchTracker.h"
@@ -214,12 +215,24 @@ public:
 
   /// Read a single pitch value from the pitch tracker
   ///  \return \c float
-  float EstimatePitch( const std::deque<saSample>& );
+  float EstimatePitch( const saSampleBuffer& );
+
+  /// Read a single pitch value and keep the capture time of the buffer
+  ///  \return \c float
+  float EstimatePitch( const saSampleBuffer& y, const saTimestamp t )
+  {
+    timestamp = t;
+    return EstimatePitch( y );
+  }
 
   /// Read the voiced flag from the pitch tracker
   ///  \return \c bool
   bool Voiced() { return voiced; }
 
+  /// Read the capture time of the newest sample of the last estimate
+  ///  \return \c saTimestamp
+  saTimestamp Timestamp() { return timestamp; }
+
 private:
   /// Disallow assignment to PitchTrackerImpl
   PitchTrackerImpl& operator=( const PitchTrackerImpl& );
@@ -248,6 +261,9 @@ private:
   /// Voiced flag
   bool voiced;
 
+  /// Capture time of the newest sample of the last estimate
+  saTimestamp timestamp;
+
   /// Save pitch estimate for debugging
   std::vector<float> pitchList;
 
@@ -276,7 +292,8 @@ PitchTrackerImpl::PitchTrackerImpl(float _sampleRate,
     threshold( _threshold ),
     removeDC( _removeDC ),
     debug( _debug ),
-    voiced( false )
+    voiced( false ),
+    timestamp( saTimestampNow() )
 {
 }
 
@@ -331,34 +348,31 @@ PitchTrackerImpl::~PitchTrackerImpl() throw()
 }
 
 /// Estimate the pitch from the waveform in y
-/// \param y a list of saSample values
+/// \param y a buffer of saSample values, newest last
 /// \return the pitch estimate
-float PitchTrackerImpl::EstimatePitch(const std::deque<saSample>& y)
+float PitchTrackerImpl::EstimatePitch(const saSampleBuffer& y)
 {
   // Sanity check
   float pitch = 0;
   voiced = false;
-  if (y.size() < WindowLength+MaxLags+1)
+  if (y.Size() < WindowLength+MaxLags+1)
     {
       throw std::runtime_error("Not enough samples");
     }
 
-  // Sample autocorrelation
+  // Sample autocorrelation. The sums are unchecked and the results are
+  // checked on conversion to saSample. Recall that the newest sample is at
+  // the end of y so the window starts at yw.
+  const saSample* const yw = y.Data()+(y.Size()-WindowLength);
   std::vector<saSample> r(MaxLags+1,0);
-  r[0] = std::inner_product(y.rbegin(), 
-                            y.rbegin()+static_cast<long>(WindowLength), 
-                            y.rbegin(), 
-                            saSample(0));
+  r[0] = saSampleSumOfSquares(yw, WindowLength).Checked();
   if ( r[0] < threshold )
     {
       return pitch;
     }
 
   // Loop calculating autocorrelations 
-  saSample dDC0 = 
-    std::accumulate( y.rbegin(),
-                     y.rbegin()+static_cast<long>(WindowLength),
-                     saSample(0) );
+  saSample dDC0 = saSampleSum(yw, WindowLength).Checked();
   saSample dDC = 0;
   saSample dT = 0;
   saSample dTsum = 0;
@@ -374,18 +388,11 @@ float PitchTrackerImpl::EstimatePitch(const std::deque<saSample>& y)
     {
       saSample t = static_cast<saSample>(T);
       
-      // Calculate this lag. Recall that the newest sample is at y.end()
-      r[T] = std::inner_product(y.rbegin(),
-                                y.rbegin()+static_cast<long>(WindowLength), 
-                                y.rbegin()+static_cast<long>(T),
-                                saSample(0));
+      // Calculate this lag
+      r[T] = saSampleDot(yw, yw-T, WindowLength).Checked();
 
       // Calculate autocorrelation at this lag
-      saSample r0T = std::inner_product(y.rbegin()+T, 
-                                        y.rbegin()+T+
-                                        static_cast<long>(WindowLength), 
-                                        y.rbegin()+T, 
-                                        saSample(0));
+      saSample r0T = saSampleSumOfSquares(yw-T, WindowLength).Checked();
 
       // Difference function
       dT = r[0] + r0T - (2*r[T]);
@@ -397,10 +404,7 @@ float PitchTrackerImpl::EstimatePitch(const std::deque<saSample>& y)
       // audiowrite("sin480HzDC.wav",t,fs);
       if (removeDC)
         {
-          dDC = dDC0 - std::accumulate(y.rbegin()+T,
-                                       y.rbegin()+T+
-                                       static_cast<long>(WindowLength),
-                                       saSample(0));
+          dDC = dDC0 - saSampleSum(yw-T, WindowLength).Checked();
           dDC *= dDC;
           dDC /= static_cast<saSample>(WindowLength);
           dT -= dDC;
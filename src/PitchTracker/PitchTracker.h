@@ -1,9 +1,9 @@
 /// \file PitchTracker.h
 /// \brief Public interface for a pitch estimator
 
-#include <deque>
-
 #include "saSample.h"
+#include "saSampleBuffer.h"
+#include "saTimestamp.h"
 
 #ifndef __PITCHTRACKER_H__
 #define __PITCHTRACKER_H__
@@ -22,7 +22,18 @@ public:
   /// Read a single pitch value from the pitch tracker
   ///
   ///  \return \c float
-  virtual float EstimatePitch( const std::deque<saSample>& ) = 0;
+  virtual float EstimatePitch( const saSampleBuffer& ) = 0;
+
+  /// Read a single pitch value from the pitch tracker and keep the
+  /// capture time of the newest sample of the buffer
+  ///
+  ///  \return \c float
+  virtual float EstimatePitch( const saSampleBuffer&, const saTimestamp ) = 0;
+
+  /// Read the capture time of the newest sample of the last estimate
+  ///
+  ///  \return \c saTimestamp
+  virtual saTimestamp Timestamp() = 0;
 
   /// Read the voiced flag from the pitch tracker
   ///
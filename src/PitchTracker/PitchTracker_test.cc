@@ -10,12 +10,16 @@
 #include <memory>
 #include <list>
 #include <iterator>
+#include <stdexcept>
+#include <future>
+#include <utility>
 
 // Local include files
 #include "saSample.h"
 #include "saInputSource.h"
 #include "saInputFileWav.h"
 #include "saInputStream.h"
+#include "saInputStreamResample.h"
 #include "PreProcessor.h"
 #include "PitchTracker.h"
 
@@ -33,11 +37,19 @@
 //   --baseLineHpFilterCutoff int  pre-filter high-pass in Hz
 //   --disableHpFilter bool        disable the high-pass filter
 //   --disableAgc      bool        disable Automatic Gain Control
+//   --blockAgc        bool        AGC gain update once per pitch sample
+//   --msAgcLookAhead int          AGC look-ahead delay in ms
 //   --subSampledInput int         sub-sampling ratio on the input
 //   --threshold float             cumulative difference threshold
 //   --removeDC bool               remove slowly varying DC
+//   --resampleRate int            resample the input to this rate in Hz
 //   --file name
 //   --device name
+//   --mmap bool                   map the device buffer or WAV file
+//   --periods int                 device periods per buffer
+//   --format name                 device sample format
+//   --threads int                 analyse a file in parallel segments
+//   --msWarmUp int                segment warm-up in ms
 //
 void Usage()
 {
@@ -71,14 +83,30 @@ void Usage()
             << std::endl;
   std::cerr << "  --disableAgc bool             disable AGC" 
             << std::endl;
+  std::cerr << "  --blockAgc bool               AGC gain update per pitch sample" 
+            << std::endl;
+  std::cerr << "  --msAgcLookAhead arg          AGC look-ahead delay in ms" 
+            << std::endl;
   std::cerr << "  --threshold arg               cumulative difference threshold" 
             << std::endl ;
   std::cerr << "  --removeDC bool               remove slowly varying DC" 
             << std::endl ;
+  std::cerr << "  --resampleRate arg            resample the input to arg Hz" 
+            << std::endl ;
   std::cerr << "  --file arg                    read from file" 
             << std::endl;
   std::cerr << "  --device arg                  read from device" 
             << std::endl;
+  std::cerr << "  --mmap bool                   map the device buffer or WAV file" 
+            << std::endl;
+  std::cerr << "  --periods arg                 device periods per buffer" 
+            << std::endl;
+  std::cerr << "  --format arg                  S16, S24_3LE, S32, FLOAT or FLOAT64" 
+            << std::endl;
+  std::cerr << "  --threads arg                 analyse a file in arg segments" 
+            << std::endl;
+  std::cerr << "  --msWarmUp arg                segment warm-up in ms" 
+            << std::endl;
   std::cerr << std::endl;
 }
 
@@ -98,11 +126,19 @@ void ParseOptions(int argc,
                   float& baseLineHpFilterCutoff,
                   bool& disableHpFilter,
                   bool& disableAgc,
+                  bool& blockAgc,
+                  std::size_t& msAgcLookAhead,
                   float& threshold,
                   bool& removeDC,
+                  std::size_t& resampleRate,
                   std::string& sourceName,
                   bool& fileReq,
-                  bool& maxPitchSamplesSet)
+                  bool& maxPitchSamplesSet,
+                  bool& mmapReq,
+                  std::size_t& periods,
+                  std::string& format,
+                  std::size_t& threads,
+                  std::size_t& msWarmUp)
 {
   if (argc < 1)
     {
@@ -212,6 +248,19 @@ void ParseOptions(int argc,
       disableAgc = true;
     } 
 
+  opt = std::find(options.begin(), options.end(), "--blockAgc");
+  if (opt != options.end())
+    {
+      blockAgc = true;
+    } 
+
+  opt = std::find(options.begin(), options.end(), "--msAgcLookAhead");
+  if (opt != options.end())
+    {
+      std::istringstream sstr(*(++opt));
+      sstr >> msAgcLookAhead;
+    } 
+
   opt = std::find(options.begin(), options.end(), "--threshold");
   if (opt != options.end())
     {
@@ -225,6 +274,13 @@ void ParseOptions(int argc,
       removeDC = true;
     } 
 
+  opt = std::find(options.begin(), options.end(), "--resampleRate");
+  if (opt != options.end())
+    {
+      std::istringstream sstr(*(++opt));
+      sstr >> resampleRate;
+    } 
+
   opt = std::find(options.begin(), options.end(), "--file");
   if (opt != options.end())
     {
@@ -238,24 +294,149 @@ void ParseOptions(int argc,
       sourceName = *(++opt);
       fileReq = false;
     }
+
+  opt = std::find(options.begin(), options.end(), "--mmap");
+  if (opt != options.end())
+    {
+      mmapReq = true;
+    } 
+
+  opt = std::find(options.begin(), options.end(), "--periods");
+  if (opt != options.end())
+    {
+      std::istringstream sstr(*(++opt));
+      sstr >> periods;
+    } 
+
+  opt = std::find(options.begin(), options.end(), "--format");
+  if (opt != options.end())
+    {
+      format = *(++opt);
+    } 
+
+  opt = std::find(options.begin(), options.end(), "--threads");
+  if (opt != options.end())
+    {
+      std::istringstream sstr(*(++opt));
+      sstr >> threads;
+    } 
+
+  opt = std::find(options.begin(), options.end(), "--msWarmUp");
+  if (opt != options.end())
+    {
+      std::istringstream sstr(*(++opt));
+      sstr >> msWarmUp;
+    } 
 }
 
 using namespace SimpleAudio;
 
-int main(int argc, char* argv[])
+/// Write percentiles of the latencies of the pitch estimates
+/// \param latencies milliseconds from capture to estimate, reordered
+void LatencyPercentiles(std::vector<double>& latencies)
 {
-  try
+  if (latencies.empty())
     {
-      // Register file handlers
-      const bool wavRegistered = 
-        saSingletonInputFileSelector::Instance().
-        RegisterFileType(".wav", saInputSourceOpenFileWav);
-      if (!wavRegistered)
+      return;
+    }
+  std::cerr << "capture to estimate latency ms:";
+  saTimestampWritePercentiles(std::cerr, latencies);
+  std::cerr << std::endl;
+}
+
+/// Open a file stream at a frame. Sources that can't seek are read from
+/// the start and the frames before discarded, as are resampled streams,
+/// whose frames depend on the filter state.
+/// \param name file name
+/// \param frame first frame of the stream
+/// \param resampleRate if non-zero, resample the file to this rate
+/// \return the stream
+saInputStream* OpenFileAt(const std::string& name,
+                          const std::size_t frame,
+                          const std::size_t resampleRate)
+{
+  std::unique_ptr<saInputSource> source(saInputSourceOpenFile(name));
+  const bool isSeeked = (resampleRate == 0) && source->Seek(frame);
+  std::unique_ptr<saInputStream> is(saInputStreamOpenSource(source.get()));
+  source.release();
+  if ( resampleRate > 0 )
+    {
+      is.reset(saInputStreamOpenResample(is.release(), resampleRate));
+    }
+  for (std::size_t skipped = isSeeked ? frame : 0; skipped < frame; )
+    {
+      const saInputSpan view = is->Acquire(frame - skipped);
+      if (view.frames == 0)
         {
-          std::cerr << "register wav failed!" << std::endl;
-          return -1;
+          break;
+        }
+      is->Release(view.frames);
+      skipped += view.frames;
+    }
+  return is.release();
+}
+
+/// Pitch track of a segment of a stream
+struct PitchTrackSegment
+{
+  PitchTrackSegment();
+  PitchTrackSegment(PitchTrackSegment&&);
+  PitchTrackSegment& operator=(PitchTrackSegment&&);
+  ~PitchTrackSegment();
+
+  /// Pitch estimates
+  std::vector<float> pitches;
+
+  /// Milliseconds from capture to estimate of each pitch estimate
+  std::vector<double> latencies;
+
+  /// The segment was cut short at the end of the source
+  bool isEnded = false;
+};
+
+// Out of line, so that -Winline does not reject the vector destructors
+PitchTrackSegment::PitchTrackSegment() = default;
+PitchTrackSegment::PitchTrackSegment(PitchTrackSegment&&) = default;
+PitchTrackSegment& PitchTrackSegment::operator=(PitchTrackSegment&&) = default;
+PitchTrackSegment::~PitchTrackSegment() = default;
+
+/// Track pitch samples [first,last) of a stream. The pipeline starts at
+/// pitch sample start, so the estimates from start to first only settle
+/// the filter and AGC state. The track is cut short at the end of the
+/// source, which is flagged.
+/// \param is the stream
+/// \param pre PreProcessor reading the stream
+/// \param pt PitchTracker of the PreProcessor output
+/// \param start pitch sample at the start of the stream
+/// \param first first pitch sample of the track
+/// \param last pitch sample after the track
+/// \return the track
+PitchTrackSegment TrackSegment(saInputStream& is,
+                               PreProcessor& pre,
+                               PitchTracker& pt,
+                               const std::size_t start,
+                               const std::size_t first,
+                               const std::size_t last)
+{
+  PitchTrackSegment track;
+  for (std::size_t k=start; k<last && !is.EndOfSource(); k++)
+    {
+      const float pitch = pt.EstimatePitch( pre.Read(), pre.Timestamp() );
+      if (k >= first)
+        {
+          track.pitches.push_back(pitch);
+          track.latencies.push_back(saTimestampMs(saTimestampNow()-
+                                                  pt.Timestamp()));
         }
+    }
+  track.isEnded = is.EndOfSource();
+  return track;
+}
 
+int main(int argc, char* argv[])
+{
+  try
+    {
       // Default arguments
       bool helpReq = false;
       bool debugReq = false;
@@ -271,19 +452,40 @@ int main(int argc, char* argv[])
       float baseLineHpFilterCutoff = 200;
       bool disableHpFilter = false;
       bool disableAgc = false;
+      bool blockAgc = false;
+      std::size_t msAgcLookAhead = 0;
       bool removeDC = false;
+      std::size_t resampleRate = 0;
       float threshold = 0.1f;
       std::string sourceName("default");
       bool fileReq = false;
       bool maxPitchSamplesSet = false;
+      bool mmapReq = false;
+      std::size_t periods = 2;
+      std::string format("S16");
+      std::size_t threads = 1;
+      std::size_t msWarmUp = 500;
 
       // Parse arguments
       ParseOptions(argc, argv, helpReq, debugReq,
                    maxPitchSamples, channel, sampleRate,
                    msDeviceLatency, msWindow, msTmax, msTsample, subSample, 
                    inputLpFilterCutoff, baseLineHpFilterCutoff,
-                   disableHpFilter, disableAgc,
-                   threshold, removeDC, sourceName, fileReq, maxPitchSamplesSet);
+                   disableHpFilter, disableAgc, blockAgc, msAgcLookAhead,
+                   threshold, removeDC, resampleRate, sourceName, fileReq,
+                   maxPitchSamplesSet, mmapReq, periods, format,
+                   threads, msWarmUp);
+
+      // Register file handlers
+      const bool wavRegistered = 
+        saSingletonInputFileSelector::Instance().
+        RegisterFileType(".wav", mmapReq ? saInputSourceOpenFileWavMmap :
+                                           saInputSourceOpenFileWav);
+      if (!wavRegistered)
+        {
+          std::cerr << "register wav failed!" << std::endl;
+          return -1;
+        }
 
       // Echo PitchTracker arguments
       if (debugReq)
@@ -303,9 +505,17 @@ int main(int argc, char* argv[])
                                      << baseLineHpFilterCutoff << std::endl; 
           std::cerr << "disableHpFilter= "  << disableHpFilter << std::endl; 
           std::cerr << "disableAgcFilter= " << disableAgc      << std::endl; 
+          std::cerr << "blockAgc= "         << blockAgc        << std::endl; 
+          std::cerr << "msAgcLookAhead= "   << msAgcLookAhead  << std::endl; 
           std::cerr << "removeDC= "         << removeDC        << std::endl; 
+          std::cerr << "resampleRate= "     << resampleRate    << std::endl; 
           std::cerr << "threshold= "        << threshold       << std::endl; 
           std::cerr << "sourceName= "       << sourceName      << std::endl; 
+          std::cerr << "mmap= "             << mmapReq         << std::endl; 
+          std::cerr << "periods= "          << periods         << std::endl; 
+          std::cerr << "format= "           << format          << std::endl; 
+          std::cerr << "threads= "          << threads         << std::endl; 
+          std::cerr << "msWarmUp= "         << msWarmUp        << std::endl; 
         }
       
       // Check for help request
@@ -314,12 +524,39 @@ int main(int argc, char* argv[])
           return 0;
         }
 
+      // Only files are tracked in segments
+      if ( (threads > 1) && !fileReq )
+        {
+          throw std::runtime_error("--threads requires --file");
+        }
+
+      // Device sample format
+      saSampleFormat sampleFormat = saSampleFormat::S16;
+      if (!saSampleFormatFromName(format, sampleFormat))
+        {
+          throw std::runtime_error("unknown sample format " + format);
+        }
+
       // Open the input stream
       std::string name(sourceName.begin(), sourceName.end());
       std::unique_ptr<saInputStream> 
         is( fileReq == true ? saInputStreamOpenFile(name) :
             saInputStreamOpenDevice
-            (name, sampleRate, msDeviceLatency, 1, debugReq) );
+            (name, sampleRate, msDeviceLatency, 1, debugReq, 0, 0, mmapReq,
+             periods, sampleFormat) );
+      if ( debugReq && !fileReq )
+        {
+          std::cerr << "granted framesPerPeriod= "
+                    << is->GetFramesPerPeriod() << std::endl;
+          std::cerr << "granted periodsPerBuffer= "
+                    << is->GetPeriodsPerBuffer() << std::endl;
+          std::cerr << "granted framesPerBuffer= "
+                    << is->GetFramesPerBuffer() << std::endl;
+        }
+      if ( resampleRate > 0 )
+        {
+          is.reset(saInputStreamOpenResample(is.release(), resampleRate));
+        }
       if ( fileReq )
         {
           sampleRate = is->GetFramesPerSecond();
@@ -331,12 +568,14 @@ int main(int argc, char* argv[])
             }
         }
 
-      // Create PreProcessor
+      // Create PreProcessor. When a file is tracked in segments this
+      // pipeline tracks the first.
       std::unique_ptr<PreProcessor> 
         pre(PreProcessorCreate(is.get(), channel, 
                                msWindow, msTmax, msTsample, subSample,
                                inputLpFilterCutoff, baseLineHpFilterCutoff,
-                               disableHpFilter, disableAgc, debugReq));
+                               disableHpFilter, disableAgc, debugReq,
+                               blockAgc, msAgcLookAhead));
 
       // Create PitchTracker
       std::unique_ptr<PitchTracker> 
@@ -344,17 +583,80 @@ int main(int argc, char* argv[])
             ( pre->SubSampleRate(), pre->WindowLength(), pre->MaxLags(),
               threshold, removeDC, debugReq ) );
       
-      std::vector<float> pitchList;
-      std::size_t samplesSoFar = 0;
-      while( samplesSoFar++ < maxPitchSamples && !is->EndOfSource() )
+      PitchTrackSegment track;
+      if ( threads > 1 )
+        {
+          // Track pitch samples [first,last) of the file with a pipeline
+          // of its own, started early by the warm-up so the filter and
+          // AGC state has settled by the first. The first segment starts
+          // at the start of the file and is tracked by the pipeline above.
+          // The segments run concurrently, so opening and tracking must not
+          // share unsynchronised library state.
+          const std::size_t frameInterval = pre->SampleInterval();
+          const std::size_t warmUpSamples = (msWarmUp+msTsample-1)/msTsample;
+          auto trackSegment = [&](const std::size_t first,
+                                  const std::size_t last)
+            {
+              if (first == 0)
+                {
+                  return TrackSegment(*is, *pre, *pt, 0, 0, last);
+                }
+              const std::size_t start = first-std::min(first, warmUpSamples);
+              std::unique_ptr<saInputStream>
+                ss(OpenFileAt(name, start*frameInterval, resampleRate));
+              std::unique_ptr<PreProcessor>
+                sp(PreProcessorCreate(ss.get(), channel,
+                                      msWindow, msTmax, msTsample, subSample,
+                                      inputLpFilterCutoff,
+                                      baseLineHpFilterCutoff,
+                                      disableHpFilter, disableAgc, false,
+                                      blockAgc, msAgcLookAhead));
+              std::unique_ptr<PitchTracker>
+                st(PitchTrackerCreate
+                   (sp->SubSampleRate(), sp->WindowLength(), sp->MaxLags(),
+                    threshold, removeDC, false));
+              return TrackSegment(*ss, *sp, *st, start, first, last);
+            };
+
+          // One segment per thread
+          std::vector< std::future<PitchTrackSegment> > segments;
+          for (std::size_t k=0; k<threads; k++)
+            {
+              segments.push_back
+                (std::async(std::launch::async, trackSegment,
+                            (k*maxPitchSamples)/threads,
+                            ((k+1)*maxPitchSamples)/threads));
+            }
+
+          // Stitch the tracks in order. Segments after the one that
+          // reached the end of the file are past the end of a serial run.
+          for (auto& segment : segments)
+            {
+              const PitchTrackSegment next = segment.get();
+              if (!track.isEnded)
+                {
+                  track.pitches.insert(track.pitches.end(),
+                                       next.pitches.begin(),
+                                       next.pitches.end());
+                  track.latencies.insert(track.latencies.end(),
+                                         next.latencies.begin(),
+                                         next.latencies.end());
+                  track.isEnded = next.isEnded;
+                }
+            }
+        }
+      else
+        {
+          track = TrackSegment(*is, *pre, *pt, 0, 0, maxPitchSamples);
+        }
+      if ( debugReq )
         {
-          float pitch = pt->EstimatePitch( pre->Read() );
-          pitchList.push_back(pitch);
+          LatencyPercentiles(track.latencies);
         }
 
       // Echo pitch results
       std::cout.precision(4);
-      std::copy(pitchList.begin(), pitchList.end(), 
+      std::copy(track.pitches.begin(), track.pitches.end(), 
                 std::ostream_iterator<float>(std::cout, "\n"));
 
       // Done. Assume destructor closes stream
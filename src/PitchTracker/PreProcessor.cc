@@ -10,7 +10,6 @@
 #include <string>
 #include <vector>
 #include <list>
-#include <deque>
 #include <iterator>
 
 // StdC headers
@@ -20,6 +19,8 @@
 
 // Local include files
 #include "saSample.h"
+#include "saSampleFast.h"
+#include "saSampleBuffer.h"
 #include "saInputStream.h"
 #include "PreProcessor.h"
 #include "ButterworthFilter.h"
@@ -27,34 +28,6 @@
 
 using namespace SimpleAudio;
 
-/// \struct DecimationFilter
-/// Functor that filters then decimates the input signal
-/// \tparam T typename of the input samples
-template <typename T>
-struct DecimationFilter
-{
-  DecimationFilter(std::vector<T>& _u, Filter<T>& _f, std::size_t _dec) 
-    : u(_u), f(_f), dec(_dec), base(0) { }
-
-  /// Filter and then decimate the input signal
-  /// \return the filter output value
-  T operator() ()
-  { 
-    T val = 0; 
-    for(std::size_t i=0; i<dec; i++) 
-      { 
-        val = f(u[base++]); 
-      } 
-    return val;
-  }
-
-private:
-  std::vector<T>& u;
-  Filter<T>& f;
-  std::size_t dec;
-  std::size_t base;
-};
-
 class PreProcessorImpl : public PreProcessor
 {
 public:
@@ -75,6 +48,8 @@ public:
   //  \param \e disableHpFilter disable the high-pass filter
   //  \param \e disableAgc disable Automatic Gain Control
   //  \param \e enable debug messages
+  //  \param \e blockAgc apply AGC once per pitch sample interval
+  //  \param \e msAgcLookAhead AGC look-ahead delay in ms (0 disables)
   //  \return Nil
   PreProcessorImpl( saInputStream* inputStream, 
                     std::size_t channel, 
@@ -86,7 +61,9 @@ public:
                     float baseLineHpCutoff,
                     bool disableHpFilter,
                     bool disableAgc,
-                    bool debug );
+                    bool debug,
+                    bool blockAgc,
+                    std::size_t msAgcLookAhead );
   
   /// Destructor for PreProcessor
   ///
@@ -117,13 +94,25 @@ public:
   // \return Sub-sampled max. correlation length in samples
   std::size_t MaxLags() { return subSampledTmax; }
 
-  /// Read a deque of preprocessed input values
+  /// Input frames read for each pitch sample
+  ///
+  //  Input frames read for each pitch sample, a multiple of subSample
+  //
+  // \return frames per pitch sample before sub-sampling
+  std::size_t SampleInterval() { return sampleInterval; }
+
+  /// Read a buffer of preprocessed input values
   ///
-  //  Read a deque of preprocessed samples. 
-  //  Reader can't modify the returned deque.
+  //  Read a buffer of preprocessed samples. 
+  //  Reader can't modify the returned buffer.
   //
-  //  \return \c std::deque of preprocessed samples
-  const std::deque<saSample>& Read( );
+  //  \return \c saSampleBuffer of preprocessed samples
+  const saSampleBuffer& Read( );
+
+  /// Capture time of the newest sample read
+  ///
+  // \return timestamp of the newest sample
+  saTimestamp Timestamp() { return timestamp; }
 
 private:
   /// Disallow assignment to PreProcessorImpl
@@ -132,6 +121,24 @@ private:
   /// Disallow copy constructor of PreProcessorImpl
   PreProcessorImpl( const PreProcessorImpl& );
 
+  /// Apply AGC to the samples in place
+  /// \param u the samples
+  void DoAgc(saSampleBuffer& u);
+
+  /// Low-pass filter and decimate one input sample
+  /// \param u the input sample
+  /// \param y the decimated output
+  /// \param n index of the next decimated output, updated
+  void LowPass(saSampleFast u, saSampleFast* const y, std::size_t& n)
+  {
+    const saSampleFast v = lpFilter(u);
+    if (++decimationPhase == subSample)
+      {
+        decimationPhase = 0;
+        y[n++] = v;
+      }
+  }
+
   // Input stream
   saInputStream* inputStream;
 
@@ -145,6 +152,7 @@ private:
   bool debug;
   bool disableHpFilter;
   bool disableAgc;
+  bool blockAgc;
 
   /// Sample rate in Hz
   std::size_t sampleRate;
@@ -168,28 +176,37 @@ private:
   /// Length of output sequence supplied by Read()
   std::size_t subSampledOutputSize; 
 
-  /// Low-pass filter
-  ButterworthLowPass4thOrderFilter<saSample> lpFilter;
+  /// Low-pass filter, unchecked
+  ButterworthLowPass4thOrderFilter<saSampleFast> lpFilter;
 
-  /// High-pass baseline filter
-  ButterworthHighPass3rdOrderFilter<saSample> hpFilter;
+  /// High-pass baseline filter, unchecked
+  ButterworthHighPass3rdOrderFilter<saSampleFast> hpFilter;
 
   /// AGC
   AutomaticGainControl<saSample> agc;
 
-  /// Buffer for samples from stream
-  std::vector<saSample> y;
+  /// Look-ahead AGC
+  std::unique_ptr<LookAheadAutomaticGainControl<saSample>> lookAheadAgc;
+
+  /// Input samples since the last decimated output
+  std::size_t decimationPhase;
 
-  // Subsequent storage
-  std::vector<saSample> ylp;
-  std::vector<saSample> yhp;
-  std::vector<saSample> yagc;
-  std::deque<saSample> outputDeque;
+  /// Delay of the look-ahead AGC in samples before sub-sampling
+  std::size_t lookAheadFrames;
+
+  /// Capture time of the newest sample of the last Read
+  saTimestamp timestamp;
+
+  /// Sub-sampled samples, filtered and AGC'd in place
+  saSampleBuffer yfilt;
+
+  /// Preprocessed output
+  saSampleBuffer outputBuffer;
 
   /// Storage for debugging
   std::vector<saSample> yList;
-  std::vector<saSample> ylpList;
-  std::vector<saSample> yhpList;
+  std::vector<saSampleFast> ylpList;
+  std::vector<saSampleFast> yhpList;
   std::vector<saSample> yagcList;
 };
 
@@ -203,13 +220,16 @@ PreProcessorImpl::PreProcessorImpl( saInputStream* _inputStream,
                                     float _baseLineHpCutoff,
                                     bool _disableHpFilter,
                                     bool _disableAgc,
-                                    bool _debug = false)
+                                    bool _debug,
+                                    bool _blockAgc,
+                                    std::size_t _msAgcLookAhead )
   : inputStream( _inputStream ),
     channel( _channel ),
     subSample( _subSample ),
     debug( _debug ),
     disableHpFilter( _disableHpFilter ),
     disableAgc( _disableAgc ),
+    blockAgc( _blockAgc ),
     sampleRate( inputStream->GetFramesPerSecond() ),
     samplesPerFrame( inputStream->GetSamplesPerFrame() ),
     subSampledInterval( (_msTsample*sampleRate)/(1000*subSample) ),
@@ -219,13 +239,29 @@ PreProcessorImpl::PreProcessorImpl( saInputStream* _inputStream,
     subSampledOutputSize( subSampledWindow+subSampledTmax+1 ),
     lpFilter( _subSampleLpCutoff, sampleRate ),
     hpFilter( _baseLineHpCutoff, sampleRate/subSample ),
-    agc( sampleRate/subSample )
+    agc( sampleRate/subSample ),
+    decimationPhase( 0 ),
+    lookAheadFrames( 0 ),
+    timestamp( saTimestampNow() )
 {
-  // Reserve space in vectors
-  y.reserve( sampleInterval*samplesPerFrame );
-  ylp.reserve( sampleInterval );
-  yhp.reserve( subSampledInterval );
-  yagc.reserve( subSampledInterval );
+  // Sanity check (channel is zero-based)
+  if (channel >= samplesPerFrame)
+    {
+      throw std::runtime_error("Illegal channel");
+    }
+
+  // Reserve space in buffers
+  yfilt.Reserve( subSampledInterval );
+  outputBuffer.Reserve( subSampledOutputSize );
+
+  if (_msAgcLookAhead > 0)
+    {
+      lookAheadAgc.reset( new LookAheadAutomaticGainControl<saSample>
+                          ( sampleRate/subSample, 
+                            (_msAgcLookAhead*sampleRate)/(1000*subSample) ) );
+      lookAheadFrames = 
+        subSample*((_msAgcLookAhead*sampleRate)/(1000*subSample));
+    }
 }
 
 PreProcessorImpl::~PreProcessorImpl() throw()
@@ -240,12 +276,12 @@ PreProcessorImpl::~PreProcessorImpl() throw()
       {
         std::ofstream of("ylp.txt");
         copy(ylpList.begin(), ylpList.end(), 
-             std::ostream_iterator<saSample>(of, "\n"));
+             std::ostream_iterator<saSampleFast>(of, "\n"));
       }
       {
         std::ofstream of("yhp.txt");
         copy(yhpList.begin(), yhpList.end(), 
-             std::ostream_iterator<saSample>(of, "\n"));
+             std::ostream_iterator<saSampleFast>(of, "\n"));
       }
       {
         std::ofstream of("yagc.txt");
@@ -255,14 +291,32 @@ PreProcessorImpl::~PreProcessorImpl() throw()
     }
 }
 
-const std::deque<saSample>& PreProcessorImpl::Read( )
+void PreProcessorImpl::DoAgc(saSampleBuffer& u)
+{
+  if (lookAheadAgc)
+    {
+      std::transform(u.begin(), u.end(), u.begin(),
+                     updateFilter<saSample>(lookAheadAgc.get()));
+    }
+  else if (blockAgc)
+    {
+      agc.Block(u.Data(), u.Data(), u.Size());
+    }
+  else
+    {
+      std::transform(u.begin(), u.end(), u.begin(),
+                     updateFilter<saSample>(&agc));
+    }
+}
+
+const saSampleBuffer& PreProcessorImpl::Read( )
 {
   // Check for over-run
   if ( inputStream->OverRun() )
     {
       // Clear
       inputStream->Clear();
-      outputDeque.assign(subSampledOutputSize, 0);
+      outputBuffer.Assign(subSampledOutputSize, 0);
       if (debug)
         {
           std::cerr << "Stream reset after overrun\n";
@@ -270,106 +324,110 @@ const std::deque<saSample>& PreProcessorImpl::Read( )
     }
 
   // Discard oldest elements
-  if (outputDeque.size() >= subSampledInterval)
+  if (outputBuffer.Size() >= subSampledInterval)
     {
-      outputDeque.erase(outputDeque.begin(), 
-                        outputDeque.begin()+
-                        static_cast<long>(subSampledInterval));
+      outputBuffer.Discard(subSampledInterval);
     }
-  else if ( outputDeque.size() > 0)
+  else if ( outputBuffer.Size() > 0)
     {
       // Should not get here!
-      outputDeque.resize(0);
+      outputBuffer.Clear();
     }
 
-  // Loop filling the deque
-  while (outputDeque.size() < subSampledOutputSize)
+  // Loop filling the output buffer
+  while (outputBuffer.Size() < subSampledOutputSize)
     {
-      // Read from stream
-      y.resize(0);
-      std::size_t numRead = inputStream->Read( y, sampleInterval, channel );
-      if (numRead != sampleInterval)
+      // Do low-pass filter with unchecked arithmetic into yfilt from views
+      // of the stream's source fragments converted in bulk to saSample
+      yfilt.Resize(subSampledInterval);
+      saSampleFast* const yfiltFast = saSampleFastView(yfilt.Data());
+      std::size_t framesFiltered = 0;
+      std::size_t n = 0;
+      decimationPhase = 0;
+      while (framesFiltered < sampleInterval)
+        {
+          const saInputSampleSpan view = 
+            inputStream->AcquireSamples( sampleInterval-framesFiltered );
+          if (view.frames == 0)
+            {
+              break;
+            }
+          const saSample* u = view.samples.data()+channel;
+          for (std::size_t k=0; k<view.frames; k++, u+=samplesPerFrame)
+            {
+              LowPass(saSampleFast(*u), yfiltFast, n);
+              if (debug)
+                {
+                  yList.push_back(*u);
+                }
+            }
+          inputStream->Release( view.frames );
+          framesFiltered += view.frames;
+        }
+      if (framesFiltered != sampleInterval)
         {
           // Sanity check
           if ( !inputStream->EndOfSource() )
             {
               inputStream->Clear();
-              outputDeque.assign(subSampledOutputSize, 0);
+              outputBuffer.Assign(subSampledOutputSize, 0);
               if (debug)
                 {
                   std::cerr << "Stream reset after under-run\n";
                 }
-              return outputDeque;
+              timestamp = inputStream->GetTimestamp();
+              return outputBuffer;
+            }
+          // Pad input to required size
+          for (; framesFiltered<sampleInterval; framesFiltered++)
+            {
+              LowPass(saSampleFast(0), yfiltFast, n);
+              if (debug)
+                {
+                  yList.push_back(0);
+                }
             }
-          // Pad outputDeque to required size
-          y.insert(y.end(), sampleInterval-y.size(), 0);
-        }
-
-      // Do low-pass filter
-      ylp.resize(0);
-      if (subSample > 1)
-        {
-          std::generate_n(std::back_inserter(ylp), subSampledInterval, 
-                          DecimationFilter<saSample>(y, lpFilter, subSample));
         }
-      else
+      if ( debug )
         {
-          std::transform(y.begin(), y.end(), std::back_inserter(ylp), 
-                         updateFilter<saSample>(&lpFilter));
+          ylpList.insert(ylpList.end(), yfiltFast, 
+                         yfiltFast+subSampledInterval);
         }
 
-      if ( disableHpFilter && disableAgc )
+      // Do high-pass filter with unchecked arithmetic in place
+      if ( !disableHpFilter )
         {
-          // Copy to deque
-          outputDeque.insert(outputDeque.end(), ylp.begin(), ylp.end());
+          hpFilter.Apply(yfiltFast, yfiltFast, subSampledInterval);
+          if ( debug )
+            {
+              yhpList.insert(yhpList.end(), yfiltFast, 
+                             yfiltFast+subSampledInterval);
+            }
         }
-      else if ( (!disableHpFilter) && disableAgc )
-        {
-          // Do high-pass filter
-          yhp.resize(0);
-          std::transform(ylp.begin(), ylp.end(), std::back_inserter(yhp), 
-                         updateFilter<saSample>(&hpFilter));
 
-          // Copy to deque
-          outputDeque.insert(outputDeque.end(), yhp.begin(), yhp.end());
-        }
-      else if ( disableHpFilter && (!disableAgc) )
-        {
-          // Do AGC
-          yagc.resize(0);
-          std::transform(ylp.begin(), ylp.end(), std::back_inserter(yagc),
-                         updateFilter<saSample>(&agc));
-          
-          // Copy to deque
-          outputDeque.insert(outputDeque.end(), yagc.begin(), yagc.end());
-        }
-      else
-        {
-          // Do high-pass filter
-          yhp.resize(0);
-          std::transform(ylp.begin(), ylp.end(), std::back_inserter(yhp), 
-                         updateFilter<saSample>(&hpFilter));
-
-          // Do AGC
-          yagc.resize(0);
-          std::transform(yhp.begin(), yhp.end(), std::back_inserter(yagc),
-                         updateFilter<saSample>(&agc));
-          
-          // Copy to deque
-          outputDeque.insert(outputDeque.end(), yagc.begin(), yagc.end());
-        }
-               
-      // Save
-      if ( debug )
+      // Checked conversion of the filter output in place
+      std::transform(yfiltFast, yfiltFast+subSampledInterval, yfilt.begin(),
+                     saSampleFastChecked());
+
+      // Do AGC in place
+      if ( !disableAgc )
         {
-          yList.insert(yList.end(), y.begin(), y.end());
-          ylpList.insert( ylpList.end(), ylp.begin(), ylp.end() );
-          yhpList.insert( yhpList.end(), yhp.begin(), yhp.end() );
-          yagcList.insert( yagcList.end(), yagc.begin(), yagc.end() );
+          DoAgc(yfilt);
+          if ( debug )
+            {
+              yagcList.insert(yagcList.end(), yfilt.begin(), yfilt.end());
+            }
         }
+
+      // Copy to output
+      outputBuffer.Append(yfilt.Data(), yfilt.Size());
     }
 
-  return outputDeque;
+  // The newest output sample lags the newest input by the AGC look-ahead
+  timestamp = inputStream->GetTimestamp() -
+    saTimestampFrames(lookAheadFrames, sampleRate);
+
+  return outputBuffer;
 }
 
 PreProcessor* PreProcessorCreate( saInputStream* inputStream, 
@@ -382,10 +440,13 @@ PreProcessor* PreProcessorCreate( saInputStream* inputStream,
                                   float baseLineHpCutoff,
                                   bool disableHpFilter,
                                   bool disableAgc,
-                                  bool debug)
+                                  bool debug,
+                                  bool blockAgc,
+                                  std::size_t msAgcLookAhead)
 {
   return new PreProcessorImpl( inputStream, channel,
                                msWindow, msTmax, msTsample, 
                                subSample, subSampleLpCutoff, baseLineHpCutoff, 
-                               disableHpFilter, disableAgc, debug );
+                               disableHpFilter, disableAgc, debug, blockAgc,
+                               msAgcLookAhead );
 }
@@ -7,10 +7,11 @@
 ///   - apply AGC 
 
 #include <vector>
-#include <deque>
 #include <string>
 
 #include "saSample.h"
+#include "saSampleBuffer.h"
+#include "saTimestamp.h"
 
 #ifndef __PREPROCESSOR_H__
 #define __PREPROCESSOR_H__
@@ -20,8 +21,8 @@ using namespace SimpleAudio;
 /// \class PreProcessorImpl
 /// \brief Implementation of preprocessing of the input signal
 /// Low-pass filter the input audio waveform and then as required, decimate,
-/// high-pass filter and apply AGC. The preprocessed waveform is stored in a
-/// double ended queue.
+/// high-pass filter and apply AGC. The preprocessed waveform is stored in an
+/// aligned saSampleBuffer.
 class PreProcessor
 {
 public:
@@ -43,9 +44,19 @@ public:
   /// \return sub-sampled window length in samples
   virtual std::size_t MaxLags() = 0;
 
+  /// Input frames read for each pitch sample
+  /// \return frames per pitch sample before sub-sampling
+  virtual std::size_t SampleInterval() = 0;
+
   /// Read a vector of preprocessed input values
   /// \return samples 
-  virtual const std::deque<saSample>& Read( ) = 0;
+  virtual const saSampleBuffer& Read( ) = 0;
+
+  /// Capture time of the newest sample in the buffer returned by the last
+  /// Read. The AGC look-ahead delay is allowed for, the filter group delay
+  /// is not.
+  /// \return timestamp of the newest sample
+  virtual saTimestamp Timestamp() = 0;
 
 protected:
   /// Disallow assignment to PreProcessor
@@ -65,6 +76,8 @@ PreProcessor* PreProcessorCreate( saInputStream* inputStream,
                                   float baseLineHpCutoff,
                                   bool disableHpFilter,
                                   bool disableAgc,
-                                  bool debug );
+                                  bool debug,
+                                  bool blockAgc = false,
+                                  std::size_t msAgcLookAhead = 0 );
 
 #endif
@@ -44,8 +44,10 @@ typedef struct optionsPitchTuner_t {
   long optionSampleRate = 48000;
   /// Audio device channel
   long optionChannel = 0;
-  /// Audio device input buffer storage
+  /// Audio device input period
   long optionMsLatency = 100;
+  /// Audio device input periods per buffer
+  long optionPeriods = 2;
   /// Pre-processor options
   /// Subsample the audio waveform after lowpass filtering
   long optionSubSample = 2;
@@ -101,7 +103,7 @@ IMPLEMENT_APP(PitchTuner)
 bool PitchTuner::OnInit()
 {
   saSingletonInputFileSelector::Instance().
-    RegisterFileType(".wav", saInputSourceOpenFileWav);
+    RegisterFileType(".wav", saInputSourceOpenFileWavMmap);
 
   optionsPitchTuner_t optionsPitchTuner;
   
@@ -116,6 +118,7 @@ bool PitchTuner::OnInit()
                          optionsPitchTuner.optionSampleRate,
                          optionsPitchTuner.optionChannel,
                          optionsPitchTuner.optionMsLatency,
+                         optionsPitchTuner.optionPeriods,
                          optionsPitchTuner.optionSubSample,
                          optionsPitchTuner.optionInputLpFilterCutoff,
                          optionsPitchTuner.optionBaseLineHpFilterCutoff,
@@ -151,7 +154,9 @@ bool PitchTuner::ParseOptions( optionsPitchTuner_t &options )
         wxCMD_LINE_VAL_NUMBER, wxCMD_LINE_PARAM_OPTIONAL},
       { wxCMD_LINE_OPTION, NULL, "channel", "input device channel", 
         wxCMD_LINE_VAL_NUMBER, wxCMD_LINE_PARAM_OPTIONAL},
-      { wxCMD_LINE_OPTION, NULL, "latency_ms", "device storage latency (ms)", 
+      { wxCMD_LINE_OPTION, NULL, "latency_ms", "device period latency (ms)", 
+        wxCMD_LINE_VAL_NUMBER, wxCMD_LINE_PARAM_OPTIONAL},
+      { wxCMD_LINE_OPTION, NULL, "periods", "device periods per buffer", 
         wxCMD_LINE_VAL_NUMBER, wxCMD_LINE_PARAM_OPTIONAL},
       { wxCMD_LINE_OPTION, NULL, "subsample", "waveform subsample ratio", 
         wxCMD_LINE_VAL_NUMBER, wxCMD_LINE_PARAM_OPTIONAL},
@@ -199,6 +204,7 @@ bool PitchTuner::ParseOptions( optionsPitchTuner_t &options )
   parser.Found("sample_rate", &(options.optionSampleRate));
   parser.Found("channel", &(options.optionChannel));
   parser.Found("latency_ms", &(options.optionMsLatency));
+  parser.Found("periods", &(options.optionPeriods));
   parser.Found("lpcutoff", &(options.optionInputLpFilterCutoff));
   parser.Found("hpcutoff", &(options.optionBaseLineHpFilterCutoff));
   options.optionDisableHpFilter = parser.Found("disable_hp_filter");
@@ -224,6 +230,8 @@ bool PitchTuner::ParseOptions( optionsPitchTuner_t &options )
                 << options.optionChannel << std::endl;
       std::cerr << "optionMsLatency "
                 << options.optionMsLatency << std::endl;
+      std::cerr << "optionPeriods "
+                << options.optionPeriods << std::endl;
       std::cerr << "optionSubSample "
                 << options.optionSubSample << std::endl;
       std::cerr << "optionInputLpFilterCutoff "
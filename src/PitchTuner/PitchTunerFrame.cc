@@ -89,6 +89,7 @@ PitchTunerFrame::PitchTunerFrame( wxString fileName,
                                   float sampleRate,
                                   std::size_t channel,
                                   std::size_t msLatency,
+                                  std::size_t periods,
                                   std::size_t subSample,
                                   float inputLpFilterCutoff,
                                   float baseLineHpFilterCutoff,
@@ -112,6 +113,7 @@ PitchTunerFrame::PitchTunerFrame( wxString fileName,
   m_deviceName(deviceName),
   m_sampleRate(sampleRate),
   m_deviceLatencyMs(msLatency),
+  m_devicePeriods(periods),
   m_channel(channel),
   m_subSample(subSample),
   m_inputLpFilterCutoff(inputLpFilterCutoff),
@@ -133,11 +135,14 @@ PitchTunerFrame::PitchTunerFrame( wxString fileName,
   m_units(wxString(wxT("cents"))),
   m_noteNames(m_numNotes, m_noteCharStrings),
   m_noteNameIndex(m_A4NoteNameIndex),
+  m_saDeviceInfo(),
   m_deviceInfo(),
   m_deviceInfoIndex(0),
   m_deviceSampleRateIndex(0),
   m_pitchSample(0.0),
   m_voiced(false),
+  m_pitchTimestamp(saTimestampNow()),
+  m_latencyCount(0),
   m_meter(0),
   m_runThread(false),
   m_guiMutex(),
@@ -148,6 +153,9 @@ PitchTunerFrame::PitchTunerFrame( wxString fileName,
   m_guiTestTimerIntervalMs(2000),
   m_guiTestTimer()
 {
+  // Probe the audio devices while the Gui is created
+  m_saDeviceInfo.queryInputDevicesAsync();
+
   // Define an event used to trigger Gui updates
   m_guiEvent.SetEventObject(this);
   m_threadEvent.SetEventObject(this);
@@ -191,10 +199,10 @@ void PitchTunerFrame::HandleError(const wxString errStr)
 
 bool PitchTunerFrame::FindAudioDevices()
 {
-  // Query devices
-  SimpleAudio::saDeviceInfo saDeviceInfo;
-  saDeviceInfo.queryInputDevices();
-  if (saDeviceInfo.Empty())
+  // Query devices. Probes cached from earlier runs are used, so this
+  // only waits for devices not seen before.
+  m_saDeviceInfo.queryInputDevices();
+  if (m_saDeviceInfo.Empty())
     {
       // Can't call Destroy() in constructor!
       return false;
@@ -202,7 +210,7 @@ bool PitchTunerFrame::FindAudioDevices()
 
   // Number of devices?
   SimpleAudio::saDeviceInfoDeviceNameList saDeviceNameList;
-  saDeviceInfo.getDeviceNames(saDeviceNameList);  
+  m_saDeviceInfo.getDeviceNames(saDeviceNameList);  
   std::size_t numDevices = saDeviceNameList.size();
   m_deviceInfo.Alloc(numDevices);
 
@@ -210,8 +218,8 @@ bool PitchTunerFrame::FindAudioDevices()
   for (std::size_t deviceNum=0; deviceNum<numDevices; deviceNum++)
     {
       SimpleAudio::saDeviceInfoSampleRateList saSampleRateList;
-      saDeviceInfo.getDeviceSampleRateList(saDeviceNameList[deviceNum], 
-                                           saSampleRateList);
+      m_saDeviceInfo.getDeviceSampleRateList(saDeviceNameList[deviceNum], 
+                                             saSampleRateList);
       m_deviceInfo.AddDevice(saDeviceNameList[deviceNum], saSampleRateList);
     }
 
@@ -375,6 +383,7 @@ void PitchTunerFrame::OnThreadError(wxCommandEvent& WXUNUSED(event))
 void PitchTunerFrame::OnClose(wxCloseEvent& WXUNUSED(event))
 {
   StopThread();
+  ReportLatency();
   Destroy();
 
   // Needed to send a GUI event?
@@ -385,12 +394,39 @@ void PitchTunerFrame::OnPitch(wxCommandEvent& WXUNUSED(event))
 {
   UpdateGui();
 
+  // The pitch sample is on screen
+  {
+    wxMutexLocker lock(m_guiMutex);
+    const double latencyMs = saTimestampMs(saTimestampNow()-m_pitchTimestamp);
+    if (m_latencyMs.size() < m_latencyHistory)
+      {
+        m_latencyMs.push_back(latencyMs);
+      }
+    else
+      {
+        m_latencyMs[m_latencyCount%m_latencyHistory] = latencyMs;
+      }
+    m_latencyCount++;
+  }
+
   if ( m_debug && m_voiced )
     {
       std::cerr << m_pitchSample << std::endl;
     }
 }
 
+void PitchTunerFrame::ReportLatency()
+{
+  if (m_latencyMs.empty())
+    {
+      return;
+    }
+  std::cerr << "Capture to display latency ms:";
+  saTimestampWritePercentiles(std::cerr, m_latencyMs);
+  std::cerr << " (latest " << m_latencyMs.size() << " of " << m_latencyCount
+            << " pitch samples)" << std::endl;
+}
+
 void PitchTunerFrame::OnGuiTest(wxTimerEvent& WXUNUSED(event))
 {
   typedef struct _TestSamples_t
@@ -514,7 +550,8 @@ wxThread::ExitCode PitchTunerFrame::Entry()
       if ( m_fileName.IsEmpty() )
         {
           inputStreamPtr = SimpleAudio::saInputStreamOpenDevice
-            (name, sampleRate, m_deviceLatencyMs);
+            (name, sampleRate, m_deviceLatencyMs, 1, false, 0, 0, false,
+             m_devicePeriods);
         }
       else
         {
@@ -527,6 +564,11 @@ wxThread::ExitCode PitchTunerFrame::Entry()
         {
           std::cerr << wxString::Format(wxT("Opening %s, sample rate %ld\n"), 
                                         sourceName.c_str(), sampleRate);
+          std::cerr << wxString::Format
+            (wxT("Granted period %ld, periods %ld, buffer %ld frames\n"),
+             inputStream->GetFramesPerPeriod(),
+             inputStream->GetPeriodsPerBuffer(),
+             inputStream->GetFramesPerBuffer());
         }
 
       sampleRate = inputStream->GetFramesPerSecond();
@@ -565,7 +607,8 @@ wxThread::ExitCode PitchTunerFrame::Entry()
             }
 
           // Get pitch sample
-          float sample = tracker->EstimatePitch( pre->Read() );
+          const saSampleBuffer& y = pre->Read();
+          float sample = tracker->EstimatePitch( y, pre->Timestamp() );
 
           // Set pitch sample
           {
@@ -573,6 +616,7 @@ wxThread::ExitCode PitchTunerFrame::Entry()
             wxMutexLocker lock(m_guiMutex);
             m_pitchSample = sample;
             m_voiced = tracker->Voiced();
+            m_pitchTimestamp = tracker->Timestamp();
           }
 
           // Send pitch event to Gui thread. 
@@ -9,6 +9,7 @@
 #include <cmath>
 #include <ctime>
 #include <cstdlib>
+#include <vector>
 
 // wxWidgets include files
 #include <wx/wx.h>
@@ -46,7 +47,8 @@ public:
   /// \param deviceName Read audio waveform from this device
   /// \param sampleRate Sample rate
   /// \param channel Audio input device channel
-  /// \param msLatency Audio device input buffer storage
+  /// \param msLatency Audio device input period
+  /// \param periods Audio device input periods per buffer
   /// \param subSample Subsample the audio waveform after lowpass filtering
   /// \param inputLpFilterCutoff Low pass filter cutoff frequency 
   /// \param baseLineHpFilterCutoff High pass filter cutoff frequency 
@@ -66,6 +68,7 @@ public:
                    float sampleRate,
                    std::size_t channel,
                    std::size_t msLatency,
+                   std::size_t periods,
                    std::size_t subSample,
                    float inputLpFilterCutoff,
                    float baseLineHpFilterCutoff,
@@ -93,9 +96,12 @@ private:
   /// Audio input device sample rate
   float m_sampleRate;
 
-  /// Audio device input buffer storage in ms
+  /// Audio device input period in ms
   std::size_t m_deviceLatencyMs;
 
+  /// Audio device input periods per buffer
+  std::size_t m_devicePeriods;
+
   /// Audio input device channel
   std::size_t m_channel;
 
@@ -160,6 +166,9 @@ private:
   /// Timer to update meter
   wxTimer m_timer;
 
+  /// Audio device query, started when the frame is created
+  SimpleAudio::saDeviceInfo m_saDeviceInfo;
+
   /// Device info lists
   guiDeviceInfo m_deviceInfo;
 
@@ -175,6 +184,22 @@ private:
   /// Voiced?
   bool m_voiced;
 
+  /// Capture time of the newest sample of the pitch sample
+  saTimestamp m_pitchTimestamp;
+
+  /// Milliseconds from capture to display of the latest pitch samples,
+  /// a ring of at most m_latencyHistory
+  std::vector<double> m_latencyMs;
+
+  /// Number of pitch samples displayed
+  std::size_t m_latencyCount;
+
+  /// Number of latencies kept, a minute at the default pitch interval
+  static const std::size_t m_latencyHistory = 6000;
+
+  /// Write percentiles of the capture to display latency to std::cerr
+  void ReportLatency();
+
   /// Meter
   guiMeter* m_meter;
 
@@ -7,7 +7,9 @@ saSampleStdInt_test \
 saSample_test \
 saSampleTo_test \
 saSampleTest_test \
-saSampleTestTo_test
+saSampleTestTo_test \
+saSampleFast_test \
+saSampleBuffer_test
 
 libSimpleAudio_PROGRAMS= \
 saCircBuff_test \
@@ -15,7 +17,8 @@ saInputDeviceInfo_test \
 saInputFileSelector_test \
 saOutputFileSelector_test \
 saInputStreamFile_test \
-saOutputStreamFile_test 
+saOutputStreamFile_test \
+saSampleConvert_test
 
 SimpleAudio_PROGRAMS= \
 $(saSample_PROGRAMS) \
@@ -36,11 +39,18 @@ libSimpleAudio_CXX_SOURCES:=\
   saInputFileAscii.cc \
   saInputFileWav.cc \
   saInputFileSelector.cc \
+  saInputCapture.cc \
+  saInputReadAhead.cc \
   saInputStream.cc \
+  saInputStreamResample.cc \
+  saInputSynth.cc \
   saOutputDevice.cc \
   saOutputStream.cc \
   saOutputFileWav.cc \
   saOutputFileSelector.cc \
+  saSampleConvert.cc \
+  saSampleSimd.cc \
+  saSampleBuffer.cc \
   saWavHeader.cc
 
 saSampleStdInt_test_CXX_SOURCES := saSampleStdInt_test.cc 
@@ -53,6 +63,11 @@ saSampleTest_test_CXX_SOURCES := saSampleTest_test.cc saSampleTest.cc
 
 saSampleTestTo_test_CXX_SOURCES := saSampleTestTo_test.cc saSampleTest.cc
 
+saSampleFast_test_CXX_SOURCES := saSampleFast_test.cc saSample.cc
+
+saSampleBuffer_test_CXX_SOURCES := saSampleBuffer_test.cc saSample.cc \
+  saSampleSimd.cc saSampleBuffer.cc
+
 saCircBuff_test_CXX_SOURCES := saCircBuff_test.cc 
 
 saInputDeviceInfo_test_CXX_SOURCES := saInputDeviceInfo_test.cc 
@@ -65,11 +80,14 @@ saInputStreamFile_test_CXX_SOURCES := saInputStreamFile_test.cc
 
 saOutputStreamFile_test_CXX_SOURCES := saOutputStreamFile_test.cc 
 
+saSampleConvert_test_CXX_SOURCES := saSampleConvert_test.cc
+
 $(call add_extra_CXXFLAGS_macro, $(libSimpleAudio_CXX_SOURCES), \
 -Isrc/SimpleAudio -Isrc/SimpleAudio/include)
 
 $(call add_extra_CXXFLAGS_macro, \
-saOutputStreamFile_test.cc saCircBuff_test.cc, -Wno-unused-but-set-variable)
+saOutputStreamFile_test.cc saCircBuff_test.cc saSampleBuffer_test.cc, \
+-Wno-unused-but-set-variable)
 
 $(foreach test, $(SimpleAudio_PROGRAMS), \
 $(eval $(call add_extra_CXXFLAGS_macro, $(${test}_CXX_SOURCES), \
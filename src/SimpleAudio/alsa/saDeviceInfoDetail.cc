@@ -1,40 +1,223 @@
 // saDeviceInfoDetail.cc
 // Implementation of simple audio interface device query.
-// This version is for ALSA and simply returns default values.
+// This version is for ALSA. The capture devices are found with
+// snd_device_name_hint, so the direct hw: and plughw: devices are listed
+// as well as the mixing and resampling default device. Each device is
+// opened to probe its sample rates, channels and formats. The probes of
+// devices on a sound card are cached keyed by the card ID, so a card is
+// only opened the first time it is seen. Delete the cache to probe again.
 
 // StdC++ headers
 #include <iostream>
 #include <iomanip>
 #include <iosfwd>
 #include <iterator>
+#include <algorithm>
+#include <set>
+#include <string>
 #include <stdexcept>
 
 // C library headers
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <cerrno>
-#include <fcntl.h>
 
 // C system headers
-#include <sys/ioctl.h>
-#include <sys/soundcard.h>
+#include <alsa/asoundlib.h>
 
 // Local headers
 #include "saDeviceInfo.h"
 
 namespace SimpleAudio
 {
-  void 
-  saDeviceInfo::queryInputDevices()
+  // Sample rates probed
+  static const saSampleRate saDeviceInfoProbeRates[] =
+    { 8000, 11025, 16000, 22050, 32000, 44100, 48000, 88200, 96000, 192000 };
+
+  // Sample formats probed and the matching ALSA formats
+  static const std::pair<saSampleFormat, snd_pcm_format_t>
+  saDeviceInfoProbeFormats[] =
+    { { saSampleFormat::S16, SND_PCM_FORMAT_S16_LE },
+      { saSampleFormat::S24_3LE, SND_PCM_FORMAT_S24_3LE },
+      { saSampleFormat::S32, SND_PCM_FORMAT_S32_LE },
+      { saSampleFormat::FLOAT, SND_PCM_FORMAT_FLOAT_LE },
+      { saSampleFormat::FLOAT64, SND_PCM_FORMAT_FLOAT64_LE } };
+
+  // Copy and free a hint string
+  static std::string saDeviceInfoHint(const void* hint, const char* id)
+  {
+    char* value = snd_device_name_get_hint(hint, id);
+    if (value == 0)
+      {
+        return std::string();
+      }
+    std::string str(value);
+    std::free(value);
+    return str;
+  }
+
+  // Card ID of a device name such as "hw:CARD=PCH,DEV=0", "-" if the name
+  // does not name a card
+  static std::string saDeviceInfoCardId(const std::string& name)
+  {
+    const std::string::size_type card = name.find("CARD=");
+    if (card == std::string::npos)
+      {
+        return std::string("-");
+      }
+    const std::string::size_type first = card + std::strlen("CARD=");
+    return name.substr(first, name.find(',', first) - first);
+  }
+
+  bool
+  saDeviceInfo::probeDevice(saDeviceInfoListEntry& entry)
+  {
+    // Don't wait for a device in use
+    snd_pcm_t* handle = 0;
+    if (snd_pcm_open(&handle, entry.name.c_str(), SND_PCM_STREAM_CAPTURE,
+                     SND_PCM_NONBLOCK) < 0)
+      {
+        return false;
+      }
+
+    snd_pcm_hw_params_t* hw_params = 0;
+    if (snd_pcm_hw_params_malloc(&hw_params) < 0)
+      {
+        snd_pcm_close(handle);
+        return false;
+      }
+    if (snd_pcm_hw_params_any(handle, hw_params) >= 0)
+      {
+        for (const saSampleRate rate : saDeviceInfoProbeRates)
+          {
+            if (snd_pcm_hw_params_test_rate
+                (handle, hw_params, static_cast<unsigned int>(rate), 0) == 0)
+              {
+                entry.sampleRates.push_back(rate);
+              }
+          }
+        for (const auto& format : saDeviceInfoProbeFormats)
+          {
+            if (snd_pcm_hw_params_test_format
+                (handle, hw_params, format.second) == 0)
+              {
+                entry.sampleFormats.push_back(format.first);
+              }
+          }
+        unsigned int minChannels = 0;
+        unsigned int maxChannels = 0;
+        if ((snd_pcm_hw_params_get_channels_min(hw_params, &minChannels) >= 0)
+            && (snd_pcm_hw_params_get_channels_max(hw_params, &maxChannels) >= 0))
+          {
+            entry.minChannels = minChannels;
+            entry.maxChannels = maxChannels;
+          }
+      }
+    snd_pcm_hw_params_free(hw_params);
+    snd_pcm_close(handle);
+
+    return !entry.sampleRates.empty() && !entry.sampleFormats.empty() &&
+      (entry.maxChannels > 0);
+  }
+
+  saDeviceInfo::saDeviceInfoList
+  saDeviceInfo::queryDevices()
   {
-    saDeviceInfoSampleRateList sampleRatesList;
-    sampleRatesList.push_back(48000);
-    sampleRatesList.push_back(44100);
-    sampleRatesList.push_back(22050);
-    sampleRatesList.push_back(11025);
-
-    std::string deviceName("default");
-    deviceInfoList.clear();
-    deviceInfoList.push_back(make_pair(deviceName, sampleRatesList));
+    // Cards present
+    std::set<std::string> cardIds;
+    int card = -1;
+    while ((snd_card_next(&card) >= 0) && (card >= 0))
+      {
+        char* id = 0;
+        if ((snd_card_get_id(card, &id) >= 0) && (id != 0))
+          {
+            cardIds.insert(id);
+            std::free(id);
+          }
+      }
+
+    // Probes of the cards seen before
+    const std::string cacheFile = cacheFileName();
+    saDeviceInfoList cache = readCache(cacheFile);
+
+    // Forget the cards that are no longer present
+    const std::size_t cacheSize = cache.size();
+    std::erase_if(cache, [&cardIds](const saDeviceInfoListEntry& c)
+                  { return cardIds.count(c.cardId) == 0; });
+    bool isCacheChanged = (cache.size() != cacheSize);
+
+    // Capture devices. Devices that are not on one card, such as the
+    // default device, are probed every time since their configuration
+    // can change.
+    saDeviceInfoList devices;
+    void** hints = 0;
+    if (snd_device_name_hint(-1, "pcm", &hints) >= 0)
+      {
+        for (void** hint = hints; *hint != 0; hint++)
+          {
+            const std::string ioid = saDeviceInfoHint(*hint, "IOID");
+            saDeviceInfoListEntry entry;
+            entry.name = saDeviceInfoHint(*hint, "NAME");
+            if (entry.name.empty() || (entry.name == "null") ||
+                (!ioid.empty() && (ioid != "Input")))
+              {
+                continue;
+              }
+            entry.cardId = saDeviceInfoCardId(entry.name);
+            entry.description = saDeviceInfoHint(*hint, "DESC");
+            std::replace_if(entry.description.begin(),
+                            entry.description.end(),
+                            [](const char c){ return (c=='\n') || (c=='\t'); },
+                            ' ');
+
+            saDeviceInfoList::const_iterator cached =
+              std::find_if(cache.begin(), cache.end(),
+                           [&entry](const saDeviceInfoListEntry& c)
+                           { return (c.cardId == entry.cardId) &&
+                               (c.name == entry.name); });
+            if ((entry.cardId != "-") && (cardIds.count(entry.cardId) > 0) &&
+                (cached != cache.end()))
+              {
+                devices.push_back(*cached);
+                devices.back().description = entry.description;
+              }
+            else if (probeDevice(entry))
+              {
+                devices.push_back(entry);
+                if (entry.cardId != "-")
+                  {
+                    cache.push_back(entry);
+                    isCacheChanged = true;
+                  }
+              }
+          }
+        snd_device_name_free_hint(hints);
+      }
+    if (isCacheChanged)
+      {
+        writeCache(cacheFile, cache);
+      }
+
+    // The default device is listed first
+    std::stable_partition(devices.begin(), devices.end(),
+                          [](const saDeviceInfoListEntry& entry)
+                          { return entry.name == "default"; });
+
+    // Assume the default device if none were found
+    if (devices.empty())
+      {
+        saDeviceInfoListEntry entry;
+        entry.cardId = std::string("-");
+        entry.name = std::string("default");
+        entry.sampleRates = { 48000, 44100, 22050, 11025 };
+        entry.minChannels = 1;
+        entry.maxChannels = 1;
+        entry.sampleFormats.push_back(saSampleFormat::S16);
+        devices.push_back(entry);
+      }
+
+    return devices;
   }
 
 }
@@ -9,6 +9,7 @@
 #include <iomanip>
 #include <stdexcept>
 #include <type_traits>
+#include <algorithm>
 
 // StdC headers
 #include <cstdio>
@@ -19,9 +20,31 @@
 #include <alsa/asoundlib.h>
 
 #include "saInputSource.h"
+#include "saInputCapture.h"
+#include "saInputSynth.h"
 
 namespace SimpleAudio
 {
+  /// ALSA format of a sample format
+  /// \param format sample format
+  /// \return ALSA sample format
+  static snd_pcm_format_t saInputDeviceFormat(const saSampleFormat format)
+  {
+    switch (format)
+      {
+      case saSampleFormat::S24_3LE:
+        return SND_PCM_FORMAT_S24_3LE;
+      case saSampleFormat::S32:
+        return SND_PCM_FORMAT_S32_LE;
+      case saSampleFormat::FLOAT:
+        return SND_PCM_FORMAT_FLOAT_LE;
+      case saSampleFormat::FLOAT64:
+        return SND_PCM_FORMAT_FLOAT64_LE;
+      default:
+        return SND_PCM_FORMAT_S16_LE;
+      }
+  }
+
   class saInputDevice : public saInputSource
   {
   public:
@@ -29,18 +52,26 @@ namespace SimpleAudio
                    const std::size_t fps, 
                    const std::size_t ms,
                    const std::size_t channels,
-                   const bool debug);
+                   const bool debug,
+                   const bool mmapAccess,
+                   const std::size_t periods,
+                   const saSampleFormat format);
 
     ~saInputDevice() throw();
 
     // \brief Read a fragment from a simple audio input
+    //
+    // With mmap access the fragment is the device buffer itself. It holds
+    // fewer frames than a fragment where it wraps around the end of the
+    // device buffer.
     // \param numValid number of valid frames in the fragment
     // \return saInputFragment 
     saInputFragment Collect(std::size_t& numValid);
 
-    /// \brief Release fragment storage
+    /// \brief Release fragment storage. With mmap access the fragment is
+    /// returned to the device.
     /// \param fragment 
-    void Release([[maybe_unused]] const saInputFragment fragment) { }
+    void Release([[maybe_unused]] const saInputFragment fragment);
 
     /// \brief Clear the source. Assumes only one stream opens the device.
     void Clear( ) { isOverRun = false; }
@@ -61,6 +92,15 @@ namespace SimpleAudio
     /// \brief Get samples per frame
     /// \return samples per frame
     std::size_t GetSamplesPerFrame( ) const { return samplesPerFrame; }
+
+    /// \brief Get the sample format granted by the device
+    /// \return sample format
+    saSampleFormat GetSampleFormat( ) const { return sampleFormat; }
+
+    /// \brief Get the capture time of the newest frame of the last
+    ///        fragment, from the device timestamp if there is one
+    /// \return timestamp of the newest frame
+    saTimestamp GetTimestamp( ) const { return timestamp; }
     
     /// \brief Get device frames per fragment
     /// \return frames per fragment
@@ -78,6 +118,32 @@ namespace SimpleAudio
     /// \return device latency
     std::size_t GetMsDeviceLatency( ) const { return msDeviceLatency; }
 
+    /// \brief Get the period size granted by the device
+    /// \return frames per period
+    std::size_t GetFramesPerPeriod( ) const { return framesPerFragment; }
+
+    /// \brief Get the number of periods granted by the device
+    /// \return periods per buffer
+    std::size_t GetPeriodsPerBuffer( ) const { return periodsPerBuffer; }
+
+    /// \brief Get the buffer size granted by the device
+    /// \return frames per buffer
+    std::size_t GetFramesPerBuffer( ) const { return framesPerBuffer; }
+
+    /// \brief Make Collect return the frames available, possibly none
+    /// \return true
+    bool SetNonBlocking( );
+
+    /// \brief Get the descriptors to poll before a non-blocking Collect
+    /// \return poll descriptors of the device
+    std::vector<pollfd> GetPollDescriptors( );
+
+    /// \brief Check the events returned by poll
+    /// \param fds the descriptors after poll
+    /// \param nfds number of descriptors
+    /// \return frames or an error are ready
+    bool PollReady( pollfd* fds, const std::size_t nfds );
+
   private:
     /// Source device name
     std::string sourceName;
@@ -94,6 +160,9 @@ namespace SimpleAudio
     /// Device handle
     snd_pcm_t *handle;
 
+    /// Sample format granted by the device
+    saSampleFormat sampleFormat;
+
     /// Number of bytes in a sample
     std::size_t bytesPerSample;
 
@@ -115,40 +184,80 @@ namespace SimpleAudio
     /// Number of frames stored in the source
     std::size_t framesPerSource;
 
+    /// Periods in the device buffer
+    std::size_t periodsPerBuffer;
+
+    /// Frames in the device buffer
+    std::size_t framesPerBuffer;
+
     /// Frames read from device 
     std::size_t framesReadFromDevice;
 
-    /// Array of samples sub-divided into fragments
-    std::vector<saSourceType> sourceBuffer;
+    /// Bytes of the samples of a fragment
+    std::vector<uint8_t> sourceBuffer;
 
     /// Use this to access source buffer 
     saInputFragment sourcePtr;
 
     /// For debugging
     bool debug;
+
+    /// The device buffer is mapped
+    bool isMmap;
+
+    /// Frames available before a mapped fragment is collected
+    std::size_t mmapMinFrames;
+
+    /// Offset of the mapped fragment in the device buffer
+    snd_pcm_uframes_t mmapOffset;
+
+    /// Frames in the mapped fragment not yet returned to the device
+    snd_pcm_uframes_t mmapFrames;
+
+    /// Collect returns without waiting
+    bool isNonBlocking;
+
+    /// The device timestamps on the monotonic clock
+    bool isTimestamped;
+
+    /// Capture time of the newest frame of the last fragment collected
+    saTimestamp timestamp;
   };
 
   saInputDevice::saInputDevice(const std::string name, 
                                const std::size_t fps,
                                const std::size_t ms,
                                const std::size_t channels,
-                               const bool _debug)
+                               const bool _debug,
+                               const bool mmapAccess,
+                               const std::size_t periods,
+                               const saSampleFormat format)
     : sourceName( name ), 
       isOverRun( false ),
       framesPerSecond( fps ),
       msDeviceLatency( ms ),
       handle( 0 ),
-      bytesPerSample( sizeof(saInputSource::saSourceType) ),
+      sampleFormat( format ),
+      bytesPerSample( saSampleFormatBytes(format) ),
       samplesPerFrame( channels ),
       framesPerFragment( ms*fps/1000 ),
       bytesPerFragment( bytesPerSample*samplesPerFrame*framesPerFragment ),
       bytesPerFrame( bytesPerSample*samplesPerFrame ),
       samplesPerFragment( samplesPerFrame*framesPerFragment ),
       framesPerSource( framesPerFragment ),
+      periodsPerBuffer( periods ),
+      framesPerBuffer( periods*framesPerFragment ),
       framesReadFromDevice( 0 ),
-      sourceBuffer( samplesPerFragment, 0 ),
-      sourcePtr( &(sourceBuffer[0]) ),
-      debug( _debug )
+      sourceBuffer( bytesPerFragment, 0 ),
+      sourcePtr( reinterpret_cast<saInputFragment>(sourceBuffer.data()) ),
+      debug( _debug ),
+      isMmap( false ),
+      mmapMinFrames( framesPerFragment ),
+      mmapOffset( 0 ),
+      mmapFrames( 0 ),
+      isNonBlocking( false ),
+      isTimestamped( false ),
+      timestamp( saTimestampNow() )
   {
     // Open the input device
     int err = snd_pcm_open(&handle, 
@@ -181,8 +290,20 @@ namespace SimpleAudio
            std::string(snd_strerror(err)));
       }
         
-    if ((err = snd_pcm_hw_params_set_access 
-         (handle, hw_params, SND_PCM_ACCESS_RW_INTERLEAVED)) < 0) 
+    // Map the device buffer if requested and supported by the plugin
+    if (mmapAccess)
+      {
+        isMmap = (snd_pcm_hw_params_set_access
+                  (handle, hw_params, SND_PCM_ACCESS_MMAP_INTERLEAVED) >= 0);
+        if (debug && !isMmap)
+          {
+            std::cerr << "mmap access not supported by " << sourceName
+                      << ", using read access" << std::endl;
+          }
+      }
+    if (!isMmap &&
+        ((err = snd_pcm_hw_params_set_access
+          (handle, hw_params, SND_PCM_ACCESS_RW_INTERLEAVED)) < 0))
       {
         snd_pcm_hw_params_free (hw_params);
         snd_pcm_close(handle);
@@ -191,16 +312,31 @@ namespace SimpleAudio
                                  std::string(snd_strerror(err))); 
       }
 
-    if ( (bytesPerSample != sizeof(int16_t)) ||
-         std::is_unsigned<saSourceType>() )
+    // Try the requested sample format and then the others, widest first.
+    // The samples are converted to saSample by the stream.
+    const saSampleFormat formats[] = { format,
+                                       saSampleFormat::S32,
+                                       saSampleFormat::S24_3LE,
+                                       saSampleFormat::FLOAT,
+                                       saSampleFormat::S16 };
+    for (const saSampleFormat tryFormat : formats)
       {
-        snd_pcm_hw_params_free (hw_params);
-        snd_pcm_close(handle);
-        snd_config_update_free_global();
-        throw std::runtime_error("source sample inconsistent");
+        if ((err = snd_pcm_hw_params_set_format
+             (handle, hw_params, saInputDeviceFormat(tryFormat))) >= 0)
+          {
+            sampleFormat = tryFormat;
+            bytesPerSample = saSampleFormatBytes(sampleFormat);
+            break;
+          }
+      }
+    if (debug && (err >= 0) && (sampleFormat != format))
+      {
+        std::cerr << "requested sample format not supported by "
+                  << sourceName << ", using "
+                  << snd_pcm_format_name(saInputDeviceFormat(sampleFormat))
+                  << std::endl;
       }
-    if ((err = snd_pcm_hw_params_set_format
-         (handle, hw_params, SND_PCM_FORMAT_S16_LE)) < 0) 
+    if (err < 0)
       {
         snd_pcm_hw_params_free (hw_params);
         snd_pcm_close(handle);
@@ -230,6 +366,42 @@ namespace SimpleAudio
         throw std::runtime_error(std::string("cannot set channel count: ") +
                                  std::string(snd_strerror(err))); 
       }
+
+    // Ask for a period of one fragment so that each read wakes once per
+    // fragment, and a buffer of a few periods. Otherwise the driver
+    // defaults, which may be many times larger, set the latency.
+    snd_pcm_uframes_t snd_framesPerPeriod = framesPerFragment;
+    unsigned int snd_periodsPerBuffer = (unsigned int) periodsPerBuffer;
+    snd_pcm_uframes_t snd_framesPerBuffer = framesPerBuffer;
+    int dir = 0;
+    if ((err = snd_pcm_hw_params_set_period_size_near 
+         (handle, hw_params, &snd_framesPerPeriod, &dir)) < 0) 
+      {
+        snd_pcm_hw_params_free (hw_params);
+        snd_pcm_close(handle);
+        snd_config_update_free_global();
+        throw std::runtime_error(std::string("cannot set period size: ") +
+                                 std::string(snd_strerror(err))); 
+      }
+    if ((err = snd_pcm_hw_params_set_periods_near 
+         (handle, hw_params, &snd_periodsPerBuffer, &dir)) < 0) 
+      {
+        snd_pcm_hw_params_free (hw_params);
+        snd_pcm_close(handle);
+        snd_config_update_free_global();
+        throw std::runtime_error(std::string("cannot set period count: ") +
+                                 std::string(snd_strerror(err))); 
+      }
+    snd_framesPerBuffer = snd_framesPerPeriod*snd_periodsPerBuffer;
+    if ((err = snd_pcm_hw_params_set_buffer_size_near 
+         (handle, hw_params, &snd_framesPerBuffer)) < 0) 
+      {
+        snd_pcm_hw_params_free (hw_params);
+        snd_pcm_close(handle);
+        snd_config_update_free_global();
+        throw std::runtime_error(std::string("cannot set buffer size: ") +
+                                 std::string(snd_strerror(err))); 
+      }
         
     if ((err = snd_pcm_hw_params (handle, hw_params)) < 0) 
       {
@@ -239,7 +411,80 @@ namespace SimpleAudio
         throw std::runtime_error(std::string("cannot set parameters: ") +
                                  std::string(snd_strerror(err))); 
       }
+
+    // Read back the granted period and buffer sizes. A fragment is one
+    // granted period.
+    if (((err = snd_pcm_hw_params_get_period_size
+          (hw_params, &snd_framesPerPeriod, &dir)) < 0) ||
+        ((err = snd_pcm_hw_params_get_periods
+          (hw_params, &snd_periodsPerBuffer, &dir)) < 0) ||
+        ((err = snd_pcm_hw_params_get_buffer_size
+          (hw_params, &snd_framesPerBuffer)) < 0))
+      {
+        snd_pcm_hw_params_free (hw_params);
+        snd_pcm_close(handle);
+        snd_config_update_free_global();
+        throw std::runtime_error(std::string("cannot get parameters: ") +
+                                 std::string(snd_strerror(err))); 
+      }
     snd_pcm_hw_params_free (hw_params);
+    framesPerSecond = snd_framesPerSecond;
+    framesPerFragment = snd_framesPerPeriod;
+    periodsPerBuffer = snd_periodsPerBuffer;
+    framesPerBuffer = snd_framesPerBuffer;
+    bytesPerFragment = bytesPerSample*samplesPerFrame*framesPerFragment;
+    bytesPerFrame = bytesPerSample*samplesPerFrame;
+    samplesPerFragment = samplesPerFrame*framesPerFragment;
+    framesPerSource = framesPerFragment;
+    msDeviceLatency = (framesPerSecond > 0) ?
+      (framesPerBuffer*1000)/framesPerSecond : 0;
+    sourceBuffer.assign(bytesPerFragment, 0);
+    sourcePtr = reinterpret_cast<saInputFragment>(sourceBuffer.data());
+
+    // A mapped fragment can be no larger than the device buffer
+    mmapMinFrames = std::min(framesPerFragment, framesPerBuffer);
+
+    // Wake the reader when a period is available and start capture on the
+    // first read
+    snd_pcm_sw_params_t *sw_params;
+    if ((err = snd_pcm_sw_params_malloc (&sw_params)) < 0) 
+      {
+        snd_pcm_close(handle);
+        snd_config_update_free_global();
+        throw std::runtime_error
+          (std::string("can't alloc. software parameters structure: ") +
+           std::string(snd_strerror(err)));
+      }
+    if (((err = snd_pcm_sw_params_current (handle, sw_params)) >= 0) &&
+        ((err = snd_pcm_sw_params_set_avail_min
+          (handle, sw_params, snd_framesPerPeriod)) >= 0) &&
+        ((err = snd_pcm_sw_params_set_start_threshold
+          (handle, sw_params, 1)) >= 0))
+      {
+        // Timestamp on the monotonic clock if the device can. Otherwise
+        // fragments are timed when they are collected.
+        isTimestamped =
+          (snd_pcm_sw_params_set_tstamp_mode
+           (handle, sw_params, SND_PCM_TSTAMP_ENABLE) >= 0) &&
+          (snd_pcm_sw_params_set_tstamp_type
+           (handle, sw_params, SND_PCM_TSTAMP_TYPE_MONOTONIC) >= 0);
+        if (!isTimestamped)
+          {
+            snd_pcm_sw_params_set_tstamp_mode
+              (handle, sw_params, SND_PCM_TSTAMP_NONE);
+          }
+        err = snd_pcm_sw_params (handle, sw_params);
+      }
+    if (err < 0)
+      {
+        snd_pcm_sw_params_free (sw_params);
+        snd_pcm_close(handle);
+        snd_config_update_free_global();
+        throw std::runtime_error
+          (std::string("cannot set software parameters: ") +
+           std::string(snd_strerror(err)));
+      }
+    snd_pcm_sw_params_free (sw_params);
     
     if ((err = snd_pcm_prepare (handle)) < 0) 
       {
@@ -265,64 +510,251 @@ namespace SimpleAudio
       }
   }
 
-  static std::size_t saInputDeviceRead(snd_pcm_t* handle,
-                                       saInputSource::saSourceType* buffer, 
-                                       const std::size_t framesToRead,
-                                       bool& isOverRun)
+  /// Capture time of the newest frame of a fragment
+  /// \param handle device
+  /// \param framesPerSecond frame rate of the device
+  /// \param framesHeld frames of the fragment not yet returned to the
+  /// device, which the device counts as available
+  /// \return timestamp of the newest frame
+  static saTimestamp saInputDeviceTimestamp(snd_pcm_t* handle,
+                                            const std::size_t framesPerSecond,
+                                            const std::size_t framesHeld)
   {
-    long numRead = snd_pcm_readi(handle, buffer, framesToRead);
+    // The timestamp is the time the frames available were counted. The
+    // newest frame of the fragment precedes the frames captured after it.
+    snd_pcm_uframes_t avail = 0;
+    snd_htimestamp_t tstamp;
+    std::memset(&tstamp, 0, sizeof(tstamp));
+    if ((snd_pcm_htimestamp(handle, &avail, &tstamp) < 0) ||
+        ((tstamp.tv_sec == 0) && (tstamp.tv_nsec == 0)))
+      {
+        return saTimestampNow();
+      }
+    const std::size_t framesAfter =
+      (avail > framesHeld) ? avail - framesHeld : 0;
+    return saTimestampFromTimespec(tstamp) -
+      saTimestampFrames(framesAfter, framesPerSecond);
+  }
 
-    int err = (int)numRead;
+  static void saInputDeviceRecover(snd_pcm_t* handle,
+                                   int err,
+                                   bool& isOverRun)
+  {
     if (err == -EPIPE) 
       {
-        numRead = 0;
+        // Restart capture after the over-run
         isOverRun = true;
+        if ((err = snd_pcm_prepare(handle)) < 0)
+          {
+            throw std::runtime_error
+              ( std::string("audio input device recovery failed: ") + 
+                std::string(snd_strerror(err))); 
+          }
+      }
+    else if (err == -EAGAIN)
+      {
+        // No frames are available yet in non-blocking mode
       }
     else if (err == -EBADFD) 
       {
-        numRead = 0;
         throw std::runtime_error
           ( std::string("audio input device read failed: ") + 
             std::string("PCM is not in the right state") );
       }
     else if (err == -ESTRPIPE) 
       {
-        numRead = 0;
         throw std::runtime_error
           ( std::string("audio input device read failed: ") + 
             std::string("a suspend event occurred") );
       }
     else if (err < 0)
       {
-        numRead = 0;
         throw std::runtime_error
           ( std::string("audio input device read failed: ") + 
             std::string(snd_strerror(err))); 
       }
+  }
+
+  static std::size_t saInputDeviceRead(snd_pcm_t* handle,
+                                       saInputSource::saSourceType* buffer, 
+                                       const std::size_t framesToRead,
+                                       bool& isOverRun)
+  {
+    long numRead = snd_pcm_readi(handle, buffer, framesToRead);
+    if (numRead < 0)
+      {
+        saInputDeviceRecover(handle, (int)numRead, isOverRun);
+        numRead = 0;
+      }
 
     return static_cast<std::size_t>(numRead);
   }
 
   saInputSource::saInputFragment saInputDevice::Collect(std::size_t& numValid)
   {
-    // Read from device into this fragment
-    std::size_t framesRead = 
-      saInputDeviceRead(handle, sourcePtr, framesPerFragment, isOverRun);
+    if (!isMmap)
+      {
+        // Read from device into this fragment
+        std::size_t framesRead = 
+          saInputDeviceRead(handle, sourcePtr, framesPerFragment, isOverRun);
     
-    // Done
-    numValid = framesRead;
+        // Done
+        numValid = framesRead;
+        framesReadFromDevice += numValid;
+        timestamp = isTimestamped ?
+          saInputDeviceTimestamp(handle, framesPerSecond, 0) : saTimestampNow();
+        return sourcePtr;
+      }
+
+    // Return any mapped fragment still held
+    Release(sourcePtr);
+
+    // Start the device, which is stopped after preparing, and wait for a
+    // fragment of frames
+    int err = 0;
+    while (true)
+      {
+        if (snd_pcm_state(handle) == SND_PCM_STATE_PREPARED)
+          {
+            if ((err = snd_pcm_start(handle)) < 0)
+              {
+                saInputDeviceRecover(handle, err, isOverRun);
+                continue;
+              }
+          }
+        const snd_pcm_sframes_t avail = snd_pcm_avail_update(handle);
+        if (avail < 0)
+          {
+            saInputDeviceRecover(handle, (int)avail, isOverRun);
+          }
+        else if (static_cast<std::size_t>(avail) >= mmapMinFrames)
+          {
+            break;
+          }
+        else if (isNonBlocking)
+          {
+            numValid = 0;
+            return sourcePtr;
+          }
+        else if ((err = snd_pcm_wait(handle, -1)) < 0)
+          {
+            saInputDeviceRecover(handle, err, isOverRun);
+          }
+      }
+
+    // Map the fragment. It ends early at the end of the device buffer.
+    const snd_pcm_channel_area_t* areas = 0;
+    mmapFrames = framesPerFragment;
+    if ((err = snd_pcm_mmap_begin(handle, &areas, &mmapOffset, &mmapFrames))<0)
+      {
+        mmapFrames = 0;
+        saInputDeviceRecover(handle, err, isOverRun);
+        numValid = 0;
+        return sourcePtr;
+      }
+    if ((areas[0].first != 0) || (areas[0].step != 8*bytesPerFrame))
+      {
+        throw std::runtime_error("audio input device mmap area not interleaved");
+      }
+
+    numValid = mmapFrames;
     framesReadFromDevice += numValid;
-    return sourcePtr;
+    timestamp = isTimestamped ?
+      saInputDeviceTimestamp(handle, framesPerSecond, mmapFrames) :
+      saTimestampNow();
+    return reinterpret_cast<saInputFragment>
+      (static_cast<char*>(areas[0].addr) + mmapOffset*bytesPerFrame);
+  }
+
+  void saInputDevice::Release([[maybe_unused]] const saInputFragment fragment)
+  {
+    if (mmapFrames == 0)
+      {
+        return;
+      }
+
+    // The frames were over-written if the device over-ran while mapped
+    const snd_pcm_sframes_t committed =
+      snd_pcm_mmap_commit(handle, mmapOffset, mmapFrames);
+    if (committed < 0)
+      {
+        saInputDeviceRecover(handle, (int)committed, isOverRun);
+      }
+    else if (static_cast<snd_pcm_uframes_t>(committed) != mmapFrames)
+      {
+        saInputDeviceRecover(handle, -EPIPE, isOverRun);
+      }
+    mmapFrames = 0;
+  }
+
+  bool saInputDevice::SetNonBlocking( )
+  {
+    const int err = snd_pcm_nonblock(handle, 1);
+    if (err < 0)
+      {
+        throw std::runtime_error
+          ( std::string("cannot set non-blocking mode: ") + 
+            std::string(snd_strerror(err))); 
+      }
+    isNonBlocking = true;
+    return true;
+  }
+
+  std::vector<pollfd> saInputDevice::GetPollDescriptors( )
+  {
+    int err = snd_pcm_poll_descriptors_count(handle);
+    if (err > 0)
+      {
+        std::vector<pollfd> fds(static_cast<std::size_t>(err));
+        err = snd_pcm_poll_descriptors(handle, fds.data(), 
+                                       static_cast<unsigned int>(fds.size()));
+        if (err >= 0)
+          {
+            fds.resize(static_cast<std::size_t>(err));
+            return fds;
+          }
+      }
+    throw std::runtime_error
+      ( std::string("cannot get poll descriptors: ") + 
+        std::string(snd_strerror(err < 0 ? err : -EINVAL))); 
+  }
+
+  bool saInputDevice::PollReady( pollfd* fds, const std::size_t nfds )
+  {
+    // Errors are reported by the next Collect
+    unsigned short revents = 0;
+    if (snd_pcm_poll_descriptors_revents
+        (handle, fds, static_cast<unsigned int>(nfds), &revents) < 0)
+      {
+        return true;
+      }
+    return (revents & (POLLIN | POLLERR)) != 0;
   }
 
   saInputSource* saInputSourceOpenDevice(const std::string& deviceName, 
                                          const std::size_t framesPerSecond,
                                          const std::size_t msDeviceLatency,
                                          const std::size_t channels,
-                                         const bool debug)
+                                         const bool debug,
+                                         const std::size_t captureFragments,
+                                         const int realTimePriority,
+                                         const bool mmapAccess,
+                                         const std::size_t periodsPerBuffer,
+                                         const saSampleFormat sampleFormat)
   {
-    return new saInputDevice
-      (deviceName, framesPerSecond, msDeviceLatency, channels, debug);
+    // Synthetic sources are paced like a device but need no hardware
+    saInputSource* device = saInputSynthName(deviceName) ?
+      saInputSourceOpenSynth(deviceName, framesPerSecond, msDeviceLatency,
+                             channels, periodsPerBuffer, sampleFormat) :
+      new saInputDevice(deviceName, framesPerSecond, msDeviceLatency,
+                        channels, debug, mmapAccess, periodsPerBuffer,
+                        sampleFormat);
+    if (captureFragments > 0)
+      {
+        device = saInputSourceOpenCapture(device, captureFragments,
+                                          realTimePriority);
+      }
+    return device;
   }
 
 }
@@ -1,7 +1,11 @@
 /// \file saCircBuff.h
 
 #include <iosfwd>
+#include <chrono>
 #include <vector>
+#include <array>
+#include <span>
+#include <bit>
 #include <algorithm>
 #include <stdexcept>
 #include <atomic>
@@ -125,6 +129,29 @@ namespace SimpleAudio
     }
   };
 
+  /// \struct saCircBuffRegions
+  /// \brief Up to two contiguous regions of circular buffer storage
+  ///
+  /// The second region is empty unless the storage wraps around the end of
+  /// the buffer memory.
+  template <typename T>
+  struct saCircBuffRegions
+  {
+    /// Region starting at the current index
+    std::span<T> first;
+
+    /// Region starting at the start of the buffer memory
+    std::span<T> second;
+
+    /// Total number of samples in the regions
+    /// \return number of samples
+    std::size_t Size() const { return first.size() + second.size(); }
+  };
+
+  /// Size of a cache line in bytes. The producer and consumer indices of
+  /// an saCircBuff are kept on separate cache lines.
+  constexpr std::size_t saCircBuffCacheLine = 64;
+
   /// \class saCircBuff
   /// \brief SimpleAudio circular buffer class
   ///
@@ -147,6 +174,38 @@ namespace SimpleAudio
   ///   - if \c m_front == \c m_back then the buffer is empty.
   ///   - \c Clear() sets both \c m_front and \c m_back to 0. You should
   ///     \e not call \c Clear() from a producer or consumer thread!
+  ///   - \c m_back and \c m_front are on separate cache lines so that the
+  ///     producer and consumer do not invalidate each other's line on
+  ///     every update.
+  ///
+  /// If \c SPSC is true the buffer is a wait-free single-producer,
+  /// single-consumer queue with the minimum of synchronisation:
+  ///   - each thread loads its own index with relaxed ordering, loads the
+  ///     other thread's index with acquire ordering and stores its own
+  ///     index with release ordering, so that the copy of the samples
+  ///     happens-before the other thread sees the updated index.
+  ///   - \c Insert() keeps a cached copy of \c m_front, and \c Extract() a
+  ///     cached copy of \c m_back, on its own cache line. The other
+  ///     thread's index is loaded only if the cached copy shows too little
+  ///     space or too few samples.
+  ///
+  /// Otherwise all accesses to the indices are sequentially consistent.
+  ///
+  /// A producer that can write directly into the buffer storage calls
+  /// \c Reserve() to get the free storage as up to two contiguous regions,
+  /// writes the samples and then calls \c Commit() to publish them. A
+  /// consumer calls \c Peek() and \c Consume() in the same way. These
+  /// bypass the copy functors so \c StoredType is both read and written.
+  ///
+  /// A consumer can sleep in \c WaitForData() until enough samples have
+  /// been inserted, and a producer in \c WaitForSpace() until enough
+  /// samples have been extracted. The waiting thread sets a flag and
+  /// blocks on a semaphore. \c Insert() and \c Extract() release the
+  /// semaphore only if the flag is set, so they make no system call when
+  /// nobody is waiting. Both threads take the flag with an atomic exchange,
+  /// so whichever exchange comes second sees the index update or the wait
+  /// of the other thread. No fence is needed, which also keeps the class
+  /// usable with ThreadSanitizer. Each flag is on its own cache line.
   ///
   /// See: "Writing Lock-Free Code: A Corrected Queue", H. Sutter,
   /// Dr Dobb's Journal, September 29, 2008.
@@ -158,15 +217,29 @@ namespace SimpleAudio
   /// \tparam OC output copy functor from \c StoredType to \c OutputType
   /// \tparam DoOverRunException allow overrun exceptions (default is true)
   /// \tparam DoUnderRunException allow underrun exceptions (default is true)
+  /// \tparam SPSC single-producer, single-consumer ordering (default is false)
   template <typename StoredType,
             typename InputType=StoredType,
             typename OutputType=StoredType,
             typename IC=saCircBuffCopyByteWise<StoredType>,
             typename OC=IC,
             bool DoOverRunException = true,
-            bool DoUnderRunException = true> 
+            bool DoUnderRunException = true,
+            bool SPSC = false> 
   class saCircBuff
   {
+    /// Memory order of loads of the other thread's index
+    static constexpr std::memory_order LoadOrder =
+      SPSC ? std::memory_order_acquire : std::memory_order_seq_cst;
+
+    /// Memory order of loads of a thread's own index
+    static constexpr std::memory_order OwnLoadOrder =
+      SPSC ? std::memory_order_relaxed : std::memory_order_seq_cst;
+
+    /// Memory order of stores of a thread's own index
+    static constexpr std::memory_order StoreOrder =
+      SPSC ? std::memory_order_release : std::memory_order_seq_cst;
+
   public:
 
     /// Constructor
@@ -174,7 +247,15 @@ namespace SimpleAudio
     saCircBuff(std::size_t numSamples) : 
       m_array(numSamples+1, 0),
       m_back(0),
-      m_front(0)
+      m_front_cache(0),
+      m_reserved(0),
+      m_front(0),
+      m_back_cache(0),
+      m_peeked(0),
+      m_data_waiting(false),
+      m_data_event(0),
+      m_space_waiting(false),
+      m_space_event(0)
     {
       // Make this a compile-time error!
       bool noCopy = std::is_trivially_copyable<StoredType>();
@@ -191,11 +272,20 @@ namespace SimpleAudio
     /// \return the maximum number of samples in the circular buffer
     std::size_t Capacity() const { return m_array.size() - 1; }
 
+    /// Number of samples available for reading.
+    /// \return the number of samples in the circular buffer
+    std::size_t Available() const
+    {
+      return SamplesAvailable(m_front.load(LoadOrder), m_back.load(LoadOrder));
+    }
+
     /// Clear the circular buffer.
     /// You should \e not call this function from a producer or consumer thread!
     void Clear() 
     { 
       m_back = m_front = 0; 
+      m_back_cache = m_front_cache = 0;
+      m_reserved = m_peeked = 0;
     }
 
     /// Insert samples into the circular buffer.
@@ -232,17 +322,17 @@ namespace SimpleAudio
             }
         }
 
-      // Find the actual the space available in the circular buffer
-      std::size_t first = m_front;
-      std::size_t space_available_to_write, num_written;
-      if (first <= m_back)
+      // Find the actual the space available in the circular buffer. In
+      // SPSC mode try the cached copy of m_front first.
+      const std::size_t back = m_back.load(OwnLoadOrder);
+      std::size_t first = SPSC ? m_front_cache : m_front.load(LoadOrder);
+      std::size_t space_available_to_write = SpaceAvailable(first, back);
+      if (SPSC && (space_available_to_write < num_to_write))
         {
-          space_available_to_write = first + (m_array.size() - 1) - m_back;
-        }
-      else
-        {
-          space_available_to_write = first - m_back - 1;
+          first = m_front_cache = m_front.load(LoadOrder);
+          space_available_to_write = SpaceAvailable(first, back);
         }
+      std::size_t num_written;
 
       // Sanity check (prevents g++ static analyser warning!)
       if (space_available_to_write >= m_array.size())
@@ -273,31 +363,34 @@ namespace SimpleAudio
         }
 
       // Do the copy. Split it if needed. Update m_back when done.
-      if ( (m_back + num_written) > m_array.size())
+      if ( (back + num_written) > m_array.size())
         {
-          std::size_t first_write = m_array.size() - m_back;
+          std::size_t first_write = m_array.size() - back;
           if (first_write > 0)
             {
-              InputCopy(&(m_array[m_back]), buf, first_write);
+              InputCopy(&(m_array[back]), buf, first_write);
             }
           std::size_t second_write = num_written - first_write;
           if (second_write > 0)
             {
               InputCopy(&(m_array[0]), &(buf[first_write]), second_write);
             }
-          m_back = second_write;
+          m_back.store(second_write, StoreOrder);
         }
       else
         {
-          InputCopy(&(m_array[m_back]), buf, num_written);
-          std::size_t last = m_back + num_written;
+          InputCopy(&(m_array[back]), buf, num_written);
+          std::size_t last = back + num_written;
           if (last == m_array.size())
             {
               last = 0;
             }
-          m_back = last;
+          m_back.store(last, StoreOrder);
         }
 
+      // Wake a consumer waiting for data
+      Notify(m_data_waiting, m_data_event);
+
       // Done
       return num_written;
     }
@@ -336,17 +429,17 @@ namespace SimpleAudio
             }
         }
       
-      // Find the actual the number of samples available in the circular buffer
-      std::size_t last = m_back;
-      std::size_t samples_available_to_read, num_read;
-      if (m_front <= last)
+      // Find the actual the number of samples available in the circular
+      // buffer. In SPSC mode try the cached copy of m_back first.
+      const std::size_t front = m_front.load(OwnLoadOrder);
+      std::size_t last = SPSC ? m_back_cache : m_back.load(LoadOrder);
+      std::size_t samples_available_to_read = SamplesAvailable(front, last);
+      if (SPSC && (samples_available_to_read < num_to_read))
         {
-          samples_available_to_read = last - m_front;
-        }
-      else
-        {
-          samples_available_to_read = last + m_array.size() - m_front;
+          last = m_back_cache = m_back.load(LoadOrder);
+          samples_available_to_read = SamplesAvailable(front, last);
         }
+      std::size_t num_read;
 
       // Sanity check (prevents g++ static analyser warning!)
       if (samples_available_to_read >= m_array.size())
@@ -377,55 +470,564 @@ namespace SimpleAudio
         }
 
       // Do the copy. Split it if needed. Update m_front when done.
-      if ((m_front + num_read) > m_array.size())
+      if ((front + num_read) > m_array.size())
         {
-          std::size_t first_read = m_array.size() - m_front;
+          std::size_t first_read = m_array.size() - front;
           if (first_read > 0)
             {
-              OutputCopy(&(buf[0]), &(m_array[m_front]), first_read);
+              OutputCopy(&(buf[0]), &(m_array[front]), first_read);
             }
           std::size_t second_read = num_read - first_read;
           if (second_read > 0)
             {
               OutputCopy(&(buf[first_read]), &(m_array[0]), second_read);
             }
-          m_front = second_read;
+          m_front.store(second_read, StoreOrder);
         }
       else
         {
-          OutputCopy(&(buf[0]), &(m_array[m_front]), num_read);
-          std::size_t first = m_front + num_read;
+          OutputCopy(&(buf[0]), &(m_array[front]), num_read);
+          std::size_t first = front + num_read;
           if (first == m_array.size())
             {
               first = 0;
             }
-          m_front = first;
+          m_front.store(first, StoreOrder);
         }
+
+      // Wake a producer waiting for space
+      Notify(m_space_waiting, m_space_event);
     
       // Done
       return num_read;
     }
 
+    /// Reserve storage for writing samples in place.
+    /// The storage is not visible to the consumer until \c Commit().
+    ///
+    /// \param num_to_write number of samples to reserve
+    /// \return regions of storage for the samples actually reserved
+    saCircBuffRegions<StoredType> Reserve(const std::size_t num_to_write)
+    {
+      // Find the actual the space available in the circular buffer
+      const std::size_t back = m_back.load(OwnLoadOrder);
+      std::size_t first = SPSC ? m_front_cache : m_front.load(LoadOrder);
+      std::size_t space_available_to_write = SpaceAvailable(first, back);
+      if (SPSC && (space_available_to_write < num_to_write))
+        {
+          first = m_front_cache = m_front.load(LoadOrder);
+          space_available_to_write = SpaceAvailable(first, back);
+        }
+
+      if (num_to_write > space_available_to_write)
+        {
+          if (DoOverRunException)
+            {
+              throw ( saCircBuffOverRun("Reserve() overrun") );
+            }
+          m_reserved = space_available_to_write;
+        }
+      else
+        {
+          m_reserved = num_to_write;
+        }
+
+      return Regions<StoredType>(back, m_reserved);
+    }
+
+    /// Publish samples written in place to the consumer.
+    ///
+    /// \param num_written number of samples written from the start of the
+    /// regions returned by the last \c Reserve()
+    void Commit(const std::size_t num_written)
+    {
+      if (num_written > m_reserved)
+        {
+          throw ( saCircBuffCantCopy("Commit() more than reserved") );
+        }
+      m_reserved = 0;
+      m_back.store(Advance(m_back.load(OwnLoadOrder), num_written),
+                   StoreOrder);
+
+      // Wake a consumer waiting for data
+      Notify(m_data_waiting, m_data_event);
+    }
+
+    /// Get samples for reading in place.
+    /// The storage is not released to the producer until \c Consume().
+    ///
+    /// \param num_to_read number of samples to get
+    /// \return regions of storage holding the samples actually available
+    saCircBuffRegions<const StoredType> Peek(const std::size_t num_to_read)
+    {
+      // Find the actual the number of samples available in the circular
+      // buffer
+      const std::size_t front = m_front.load(OwnLoadOrder);
+      std::size_t last = SPSC ? m_back_cache : m_back.load(LoadOrder);
+      std::size_t samples_available_to_read = SamplesAvailable(front, last);
+      if (SPSC && (samples_available_to_read < num_to_read))
+        {
+          last = m_back_cache = m_back.load(LoadOrder);
+          samples_available_to_read = SamplesAvailable(front, last);
+        }
+
+      if (num_to_read > samples_available_to_read)
+        {
+          if (DoUnderRunException)
+            {
+              throw ( saCircBuffUnderRun("Peek() underrun") );
+            }
+          m_peeked = samples_available_to_read;
+        }
+      else
+        {
+          m_peeked = num_to_read;
+        }
+
+      return Regions<const StoredType>(front, m_peeked);
+    }
+
+    /// Release samples read in place to the producer.
+    ///
+    /// \param num_read number of samples read from the start of the regions
+    /// returned by the last \c Peek()
+    void Consume(const std::size_t num_read)
+    {
+      if (num_read > m_peeked)
+        {
+          throw ( saCircBuffCantCopy("Consume() more than peeked") );
+        }
+      m_peeked = 0;
+      m_front.store(Advance(m_front.load(OwnLoadOrder), num_read),
+                    StoreOrder);
+
+      // Wake a producer waiting for space
+      Notify(m_space_waiting, m_space_event);
+    }
+
+    /// Wait until samples are available for reading.
+    /// Call this only from the consumer thread.
+    ///
+    /// \param num_to_read number of samples to wait for
+    /// \param timeout maximum time to wait
+    /// \return true if at least \c num_to_read samples are available
+    template <typename Rep, typename Period>
+    bool WaitForData(const std::size_t num_to_read,
+                     const std::chrono::duration<Rep, Period>& timeout)
+    {
+      if (num_to_read > Capacity())
+        {
+          if (DoUnderRunException)
+            {
+              throw ( saCircBuffUnderRun("WaitForData() exceeds capacity") );
+            }
+          else
+            {
+              return false;
+            }
+        }
+
+      return Wait(m_data_waiting, m_data_event,
+                  std::chrono::steady_clock::now() + timeout,
+                  [this, num_to_read]()
+                  {
+                    return SamplesAvailable(m_front.load(OwnLoadOrder),
+                                            m_back.load(LoadOrder))
+                      >= num_to_read;
+                  });
+    }
+
+    /// Wait until space is available for writing.
+    /// Call this only from the producer thread.
+    ///
+    /// \param num_to_write number of samples to wait for space for
+    /// \param timeout maximum time to wait
+    /// \return true if there is space for at least \c num_to_write samples
+    template <typename Rep, typename Period>
+    bool WaitForSpace(const std::size_t num_to_write,
+                      const std::chrono::duration<Rep, Period>& timeout)
+    {
+      if (num_to_write > Capacity())
+        {
+          if (DoOverRunException)
+            {
+              throw ( saCircBuffOverRun("WaitForSpace() exceeds capacity") );
+            }
+          else
+            {
+              return false;
+            }
+        }
+
+      return Wait(m_space_waiting, m_space_event,
+                  std::chrono::steady_clock::now() + timeout,
+                  [this, num_to_write]()
+                  {
+                    return SpaceAvailable(m_front.load(LoadOrder),
+                                          m_back.load(OwnLoadOrder))
+                      >= num_to_write;
+                  });
+    }
+
   private:
     /// \privatesection
 
+    /// Advance an index around the buffer
+    /// \param index index to advance
+    /// \param num number of samples to advance by
+    /// \return advanced index
+    std::size_t Advance(const std::size_t index, const std::size_t num) const
+    {
+      const std::size_t next = index + num;
+      return next >= m_array.size() ? next - m_array.size() : next;
+    }
+
+    /// Storage regions of samples starting at an index
+    /// \param index index of the first sample
+    /// \param num number of samples
+    /// \return one or two regions
+    template <typename T>
+    saCircBuffRegions<T> Regions(const std::size_t index, const std::size_t num)
+    {
+      const std::size_t first_num = std::min(num, m_array.size() - index);
+      return { std::span<T>(m_array.data() + index, first_num),
+               std::span<T>(m_array.data(), num - first_num) };
+    }
+
+    /// Wake a thread waiting on an event
+    /// \param waiting flag set by the waiting thread
+    /// \param event semaphore the waiting thread blocks on
+    void Notify(std::atomic<bool>& waiting, std::counting_semaphore<>& event)
+    {
+      // The exchange orders the index update before the flag is read
+      if (waiting.exchange(false, std::memory_order_seq_cst))
+        {
+          event.release();
+        }
+    }
+
+    /// Wait on an event until a condition is true
+    /// \param waiting flag set by the waiting thread
+    /// \param event semaphore to block on
+    /// \param deadline time to stop waiting
+    /// \param ready condition to wait for
+    /// \return the condition
+    template <typename Clock, typename Duration, typename Ready>
+    bool Wait(std::atomic<bool>& waiting,
+              std::counting_semaphore<>& event,
+              const std::chrono::time_point<Clock, Duration>& deadline,
+              const Ready& ready)
+    {
+      while (!ready())
+        {
+          // Announce the wait then check again, in case the other thread
+          // updated its index before it could see the flag
+          waiting.exchange(true, std::memory_order_seq_cst);
+          const bool isReady = ready();
+          if (isReady || !event.try_acquire_until(deadline))
+            {
+              // Take back the flag. If the other thread has already taken
+              // it, drain its release.
+              if (!waiting.exchange(false, std::memory_order_seq_cst))
+                {
+                  [[maybe_unused]] const bool isDrained = event.try_acquire();
+                }
+              return isReady || ready();
+            }
+        }
+      return true;
+    }
+
+    /// Space available for writing
+    /// \param first index of the oldest sample
+    /// \param back index of the next free storage location
+    /// \return number of samples that can be written
+    std::size_t SpaceAvailable(const std::size_t first,
+                               const std::size_t back) const
+    {
+      if (first <= back)
+        {
+          return first + (m_array.size() - 1) - back;
+        }
+      else
+        {
+          return first - back - 1;
+        }
+    }
+
+    /// Samples available for reading
+    /// \param front index of the oldest sample
+    /// \param last index of the next free storage location
+    /// \return number of samples that can be read
+    std::size_t SamplesAvailable(const std::size_t front,
+                                 const std::size_t last) const
+    {
+      if (front <= last)
+        {
+          return last - front;
+        }
+      else
+        {
+          return last + m_array.size() - front;
+        }
+    }
+
     std::vector<StoredType> m_array;
     ///< circular buffer storage
     
-    std::atomic<std::size_t> m_back;
+    IC InputCopy;
+    ///< Input copy functor for \c InputType to \c StoredType
+
+    OC OutputCopy;
+    ///< Output copy functor for \c StoredType to \c OutputType
+
+    alignas(saCircBuffCacheLine) std::atomic<std::size_t> m_back;
     ///< m_back is to the next available storage location, owned by Insert()
     ///< Other than within Insert(), m_array[m_back] never contains a valid 
     ///< sample
     
-    std::atomic<std::size_t> m_front;
+    std::size_t m_front_cache;
+    ///< Copy of m_front used by Insert() in SPSC mode
+
+    std::size_t m_reserved;
+    ///< Number of samples reserved by the last Reserve()
+
+    alignas(saCircBuffCacheLine) std::atomic<std::size_t> m_front;
     ///< m_front is the oldest value in the circular buffer, owned by Extract()
-    
+
+    std::size_t m_back_cache;
+    ///< Copy of m_back used by Extract() in SPSC mode
+
+    std::size_t m_peeked;
+    ///< Number of samples available from the last Peek()
+
+    alignas(saCircBuffCacheLine) std::atomic<bool> m_data_waiting;
+    ///< The consumer is waiting in WaitForData()
+
+    std::counting_semaphore<> m_data_event;
+    ///< Released by Insert() when the consumer is waiting
+
+    alignas(saCircBuffCacheLine) std::atomic<bool> m_space_waiting;
+    ///< The producer is waiting in WaitForSpace()
+
+    std::counting_semaphore<> m_space_event;
+    ///< Released by Extract() when the producer is waiting
+  }; 
+
+  /// \class saCircBuffPow2
+  /// \brief SimpleAudio circular buffer class with a power-of-two capacity
+  ///
+  /// The same as saCircBuff with a capacity fixed at compile time:
+  ///   - the storage is a \c std::array of \c Size samples.
+  ///   - \c m_back and \c m_front count the samples inserted and extracted
+  ///     and wrap around only at the end of \c std::size_t. The storage
+  ///     index of a count is found by masking with \c Size-1 and the
+  ///     number of samples in the buffer is \c m_back - \c m_front, so all
+  ///     \c Size locations can be used and the indices need no
+  ///     compare-and-wrap.
+  ///   - a \c StoredType that cannot be copied bit-wise is a compile-time
+  ///     error.
+  ///
+  /// \tparam StoredType
+  /// \tparam Size capacity, a power of two
+  /// \tparam InputType (defaults to \c StoredType)
+  /// \tparam OutputType (defaults to \c StoredType)
+  /// \tparam IC input copy functor from \c InputType to \c StoredType
+  /// \tparam OC output copy functor from \c StoredType to \c OutputType
+  /// \tparam DoOverRunException allow overrun exceptions (default is true)
+  /// \tparam DoUnderRunException allow underrun exceptions (default is true)
+  /// \tparam SPSC single-producer, single-consumer ordering (default is false)
+  template <typename StoredType,
+            std::size_t Size,
+            typename InputType=StoredType,
+            typename OutputType=StoredType,
+            typename IC=saCircBuffCopyByteWise<StoredType>,
+            typename OC=IC,
+            bool DoOverRunException = true,
+            bool DoUnderRunException = true,
+            bool SPSC = false>
+  requires (std::has_single_bit(Size))
+  class saCircBuffPow2
+  {
+    static_assert(std::is_trivially_copyable<StoredType>(),
+                  "saCircBuffPow2 needs a bit-wise copyable type");
+
+    /// Mask from a count to a storage index
+    static constexpr std::size_t Mask = Size - 1;
+
+    /// Memory order of loads of the other thread's index
+    static constexpr std::memory_order LoadOrder =
+      SPSC ? std::memory_order_acquire : std::memory_order_seq_cst;
+
+    /// Memory order of loads of a thread's own index
+    static constexpr std::memory_order OwnLoadOrder =
+      SPSC ? std::memory_order_relaxed : std::memory_order_seq_cst;
+
+    /// Memory order of stores of a thread's own index
+    static constexpr std::memory_order StoreOrder =
+      SPSC ? std::memory_order_release : std::memory_order_seq_cst;
+
+  public:
+
+    /// Constructor
+    saCircBuffPow2() :
+      m_array{},
+      m_back(0),
+      m_front_cache(0),
+      m_front(0),
+      m_back_cache(0)
+    { }
+
+    /// Destructor
+    ~saCircBuffPow2() throw() { }
+
+    /// Maximum number of samples in the circular buffer.
+    /// \return the maximum number of samples in the circular buffer
+    static constexpr std::size_t Capacity() { return Size; }
+
+    /// Clear the circular buffer.
+    /// You should \e not call this function from a producer or consumer thread!
+    void Clear()
+    {
+      m_back = m_front = 0;
+      m_back_cache = m_front_cache = 0;
+    }
+
+    /// Insert samples into the circular buffer.
+    /// Two separate copies may be required.
+    ///
+    /// \param num_to_write number of samples to copy
+    /// \param buf buffer to copy from
+    /// \return number of samples actually copied
+    std::size_t Insert( const std::size_t num_to_write,
+                        const InputType * const buf = nullptr)
+    {
+      if (buf == nullptr)
+        {
+          if (DoOverRunException)
+            {
+              throw ( saCircBuffOverRun("Insert() from nullptr") );
+            }
+          else
+            {
+              return 0;
+            }
+        }
+
+      // Find the space available. In SPSC mode try the cached copy of
+      // m_front first.
+      const std::size_t back = m_back.load(OwnLoadOrder);
+      std::size_t first = SPSC ? m_front_cache : m_front.load(LoadOrder);
+      if (SPSC && ((Size - (back - first)) < num_to_write))
+        {
+          first = m_front_cache = m_front.load(LoadOrder);
+        }
+      const std::size_t space_available_to_write = Size - (back - first);
+
+      std::size_t num_written = num_to_write;
+      if (num_to_write > space_available_to_write)
+        {
+          if (DoOverRunException)
+            {
+              throw ( saCircBuffOverRun("Insert() overrun") );
+            }
+          num_written = space_available_to_write;
+        }
+
+      // Do the copy. Split it if needed. Update m_back when done.
+      const std::size_t index = back & Mask;
+      const std::size_t first_write = std::min(num_written, Size - index);
+      InputCopy(&(m_array[index]), buf, first_write);
+      if (num_written > first_write)
+        {
+          InputCopy(&(m_array[0]), &(buf[first_write]),
+                    num_written - first_write);
+        }
+      m_back.store(back + num_written, StoreOrder);
+
+      // Done
+      return num_written;
+    }
+
+    /// Extract samples from the circular buffer.
+    /// Two separate copies may be required.
+    ///
+    /// \param num_to_read number of samples to copy
+    /// \param buf buffer to copy into
+    /// \return number of samples actually copied
+    std::size_t Extract(OutputType * const buf = nullptr,
+                        const std::size_t num_to_read = 1)
+    {
+      if (buf == nullptr)
+        {
+          if (DoUnderRunException)
+            {
+              throw ( saCircBuffUnderRun("Extract() from nullptr") );
+            }
+          else
+            {
+              return 0;
+            }
+        }
+
+      // Find the number of samples available. In SPSC mode try the cached
+      // copy of m_back first.
+      const std::size_t front = m_front.load(OwnLoadOrder);
+      std::size_t last = SPSC ? m_back_cache : m_back.load(LoadOrder);
+      if (SPSC && ((last - front) < num_to_read))
+        {
+          last = m_back_cache = m_back.load(LoadOrder);
+        }
+      const std::size_t samples_available_to_read = last - front;
+
+      std::size_t num_read = num_to_read;
+      if (num_to_read > samples_available_to_read)
+        {
+          if (DoUnderRunException)
+            {
+              throw ( saCircBuffUnderRun("Extract() underrun") );
+            }
+          num_read = samples_available_to_read;
+        }
+
+      // Do the copy. Split it if needed. Update m_front when done.
+      const std::size_t index = front & Mask;
+      const std::size_t first_read = std::min(num_read, Size - index);
+      OutputCopy(&(buf[0]), &(m_array[index]), first_read);
+      if (num_read > first_read)
+        {
+          OutputCopy(&(buf[first_read]), &(m_array[0]), num_read - first_read);
+        }
+      m_front.store(front + num_read, StoreOrder);
+
+      // Done
+      return num_read;
+    }
+
+  private:
+    /// \privatesection
+
+    std::array<StoredType, Size> m_array;
+    ///< circular buffer storage
+
     IC InputCopy;
     ///< Input copy functor for \c InputType to \c StoredType
 
     OC OutputCopy;
     ///< Output copy functor for \c StoredType to \c OutputType
-  }; 
+
+    alignas(saCircBuffCacheLine) std::atomic<std::size_t> m_back;
+    ///< Number of samples inserted, owned by Insert()
+
+    std::size_t m_front_cache;
+    ///< Copy of m_front used by Insert() in SPSC mode
+
+    alignas(saCircBuffCacheLine) std::atomic<std::size_t> m_front;
+    ///< Number of samples extracted, owned by Extract()
+
+    std::size_t m_back_cache;
+    ///< Copy of m_back used by Extract() in SPSC mode
+  };
 
 } // namespace SimpleAudio
 
@@ -0,0 +1,329 @@
+/// \file saCircBuffBroadcast.h
+/// \brief Single-producer, multi-reader broadcast circular buffer
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "saCircBuff.h"
+
+#ifndef __SACIRCBUFFBROADCAST_H__
+#define __SACIRCBUFFBROADCAST_H__
+
+namespace SimpleAudio
+{
+  /// \class saCircBuffBroadcast
+  /// \brief SimpleAudio broadcast circular buffer class
+  ///
+  /// One producer writes samples that every registered reader reads at its
+  /// own pace. The samples are stored once and each reader reads them in
+  /// place, so no data is copied per reader.
+  ///   - \c m_written counts the samples committed by the producer and
+  ///     each reader has a cursor counting the samples it has consumed.
+  ///     The counts are 64 bits wide and never wrap. The storage index of
+  ///     a count is the count modulo the capacity.
+  ///   - the samples available to a reader lie between its cursor and
+  ///     \c m_written.
+  ///   - the producer may overwrite storage behind the cursor of every
+  ///     active reader. If \c DropSlowReaders is false the space available
+  ///     for writing is bounded by the slowest active reader. Otherwise
+  ///     the producer never waits and instead drops any reader that would
+  ///     be overrun. A dropped reader gets an saCircBuffOverRun exception
+  ///     from \c Peek() or \c Consume() and must call \c Resync() to
+  ///     continue from the newest sample. Samples peeked by a dropped
+  ///     reader may have been overwritten.
+  ///   - readers are added and removed with \c AddReader() and
+  ///     \c RemoveReader() from any thread. A new reader starts at the
+  ///     newest sample.
+  ///   - each reader cursor is on its own cache line.
+  ///
+  /// \tparam StoredType
+  /// \tparam DropSlowReaders drop readers rather than bound the producer
+  /// (default is false)
+  template <typename StoredType, bool DropSlowReaders = false>
+  class saCircBuffBroadcast
+  {
+    static_assert(std::is_trivially_copyable<StoredType>(),
+                  "saCircBuffBroadcast needs a bit-wise copyable type");
+
+  public:
+
+    /// Constructor
+    /// \param numSamples capacity of the circular buffer
+    /// \param maxReaders maximum number of registered readers
+    saCircBuffBroadcast(const std::size_t numSamples,
+                        const std::size_t maxReaders) :
+      m_array(numSamples, 0),
+      m_readers(new Reader[maxReaders]),
+      m_maxReaders(maxReaders),
+      m_written(0),
+      m_reserved(0)
+    { }
+
+    /// Destructor
+    ~saCircBuffBroadcast() throw() { }
+
+    /// Maximum number of samples in the circular buffer.
+    /// \return the maximum number of samples in the circular buffer
+    std::size_t Capacity() const { return m_array.size(); }
+
+    /// Register a reader starting at the newest sample.
+    /// \return reader identifier
+    std::size_t AddReader()
+    {
+      for (std::size_t r=0; r<m_maxReaders; r++)
+        {
+          ReaderState expected = ReaderState::Free;
+          if (m_readers[r].state.compare_exchange_strong
+              (expected, ReaderState::Claimed))
+            {
+              // The producer ignores the reader until it is active. Read
+              // m_written again once active in case the producer has
+              // overwritten samples it has not yet seen the reader for.
+              m_readers[r].cursor.store(m_written.load());
+              m_readers[r].state.store(ReaderState::Active);
+              m_readers[r].cursor.store(m_written.load());
+              m_readers[r].peeked = 0;
+              return r;
+            }
+        }
+      throw ( saCircBuffOverRun("AddReader() too many readers") );
+    }
+
+    /// Unregister a reader.
+    /// \param reader reader identifier
+    void RemoveReader(const std::size_t reader)
+    {
+      CheckReader(reader).state.store(ReaderState::Free);
+    }
+
+    /// Continue a dropped reader from the newest sample.
+    /// \param reader reader identifier
+    void Resync(const std::size_t reader)
+    {
+      Reader& rd = CheckReader(reader);
+      rd.cursor.store(m_written.load());
+      rd.peeked = 0;
+      rd.state.store(ReaderState::Active);
+      rd.cursor.store(m_written.load());
+    }
+
+    /// Check if a reader has been dropped.
+    /// \param reader reader identifier
+    /// \return the reader was dropped
+    bool Dropped(const std::size_t reader)
+    {
+      return CheckReader(reader).state.load() == ReaderState::Dropped;
+    }
+
+    /// Reserve storage for writing samples in place.
+    /// The storage is not visible to the readers until \c Commit().
+    ///
+    /// \param num_to_write number of samples to reserve
+    /// \return regions of storage for the samples actually reserved
+    saCircBuffRegions<StoredType> Reserve(const std::size_t num_to_write)
+    {
+      const uint64_t written = m_written.load(std::memory_order_relaxed);
+      m_reserved = std::min(num_to_write, SpaceAvailable(written,
+                                                         num_to_write));
+      return Regions<StoredType>(written, m_reserved);
+    }
+
+    /// Publish samples written in place to the readers.
+    ///
+    /// \param num_written number of samples written from the start of the
+    /// regions returned by the last \c Reserve()
+    void Commit(const std::size_t num_written)
+    {
+      if (num_written > m_reserved)
+        {
+          throw ( saCircBuffCantCopy("Commit() more than reserved") );
+        }
+      m_reserved = 0;
+      m_written.store(m_written.load(std::memory_order_relaxed) + num_written);
+    }
+
+    /// Insert samples into the circular buffer.
+    ///
+    /// \param num_to_write number of samples to copy
+    /// \param buf buffer to copy from
+    /// \return number of samples actually copied
+    std::size_t Insert(const std::size_t num_to_write,
+                       const StoredType* const buf)
+    {
+      const saCircBuffRegions<StoredType> w = Reserve(num_to_write);
+      std::copy(buf, buf + w.first.size(), w.first.begin());
+      std::copy(buf + w.first.size(), buf + w.Size(), w.second.begin());
+      Commit(w.Size());
+      return w.Size();
+    }
+
+    /// Get samples for reading in place.
+    /// The storage is not released to the producer until \c Consume().
+    ///
+    /// \param reader reader identifier
+    /// \param num_to_read number of samples to get
+    /// \return regions of storage holding the samples actually available
+    saCircBuffRegions<const StoredType> Peek(const std::size_t reader,
+                                             const std::size_t num_to_read)
+    {
+      Reader& rd = CheckActive(reader, "Peek() reader dropped");
+      const uint64_t cursor = rd.cursor.load(std::memory_order_relaxed);
+      const uint64_t available =
+        m_written.load(std::memory_order_acquire) - cursor;
+      rd.peeked = static_cast<std::size_t>
+        (std::min(static_cast<uint64_t>(num_to_read), available));
+      return Regions<const StoredType>(cursor, rd.peeked);
+    }
+
+    /// Release samples read in place to the producer.
+    ///
+    /// \param reader reader identifier
+    /// \param num_read number of samples read from the start of the regions
+    /// returned by the last \c Peek()
+    void Consume(const std::size_t reader, const std::size_t num_read)
+    {
+      Reader& rd = CheckActive(reader, "Consume() reader dropped");
+      if (num_read > rd.peeked)
+        {
+          throw ( saCircBuffCantCopy("Consume() more than peeked") );
+        }
+      rd.peeked = 0;
+      rd.cursor.store(rd.cursor.load(std::memory_order_relaxed) + num_read,
+                      std::memory_order_release);
+    }
+
+    /// Extract samples from the circular buffer.
+    ///
+    /// \param reader reader identifier
+    /// \param buf buffer to copy into
+    /// \param num_to_read number of samples to copy
+    /// \return number of samples actually copied
+    std::size_t Extract(const std::size_t reader,
+                        StoredType* const buf,
+                        const std::size_t num_to_read)
+    {
+      const saCircBuffRegions<const StoredType> r = Peek(reader, num_to_read);
+      std::copy(r.first.begin(), r.first.end(), buf);
+      std::copy(r.second.begin(), r.second.end(), buf + r.first.size());
+      Consume(reader, r.Size());
+      return r.Size();
+    }
+
+  private:
+    /// \privatesection
+
+    /// State of a reader slot
+    enum class ReaderState { Free, Claimed, Active, Dropped };
+
+    /// Reader slot
+    struct Reader
+    {
+      alignas(saCircBuffCacheLine) std::atomic<uint64_t> cursor{0};
+      ///< Number of samples consumed by the reader, owned by Consume()
+
+      std::atomic<ReaderState> state{ReaderState::Free};
+      ///< Reader state
+
+      std::size_t peeked{0};
+      ///< Number of samples available from the last Peek()
+    };
+
+    /// Check a reader identifier
+    /// \param reader reader identifier
+    /// \return reader slot
+    Reader& CheckReader(const std::size_t reader)
+    {
+      if ((reader >= m_maxReaders) ||
+          (m_readers[reader].state.load() == ReaderState::Free))
+        {
+          throw ( saCircBuffCantCopy("Illegal reader") );
+        }
+      return m_readers[reader];
+    }
+
+    /// Check that a reader has not been dropped
+    /// \param reader reader identifier
+    /// \param what exception string
+    /// \return reader slot
+    Reader& CheckActive(const std::size_t reader, const char* const what)
+    {
+      Reader& rd = CheckReader(reader);
+      if (rd.state.load() == ReaderState::Dropped)
+        {
+          throw ( saCircBuffOverRun(what) );
+        }
+      return rd;
+    }
+
+    /// Space available for writing. Drops slow readers if allowed.
+    /// \param written number of samples written
+    /// \param num_to_write number of samples to be written
+    /// \return number of samples that can be written
+    std::size_t SpaceAvailable(const uint64_t written,
+                               const std::size_t num_to_write)
+    {
+      uint64_t space = Capacity();
+      for (std::size_t r=0; r<m_maxReaders; r++)
+        {
+          Reader& rd = m_readers[r];
+          if (rd.state.load() != ReaderState::Active)
+            {
+              continue;
+            }
+          const uint64_t unread =
+            written - rd.cursor.load(std::memory_order_acquire);
+          const uint64_t reader_space =
+            unread < Capacity() ? Capacity() - unread : 0;
+          if (DropSlowReaders && (reader_space < num_to_write))
+            {
+              ReaderState expected = ReaderState::Active;
+              rd.state.compare_exchange_strong(expected, ReaderState::Dropped);
+            }
+          else
+            {
+              space = std::min(space, reader_space);
+            }
+        }
+      return static_cast<std::size_t>(space);
+    }
+
+    /// Storage regions of samples starting at a count
+    /// \param count count of the first sample
+    /// \param num number of samples
+    /// \return one or two regions
+    template <typename T>
+    saCircBuffRegions<T> Regions(const uint64_t count, const std::size_t num)
+    {
+      if (m_array.empty())
+        {
+          return {};
+        }
+      const std::size_t index = static_cast<std::size_t>(count % m_array.size());
+      const std::size_t first_num = std::min(num, m_array.size() - index);
+      return { std::span<T>(m_array.data() + index, first_num),
+               std::span<T>(m_array.data(), num - first_num) };
+    }
+
+    std::vector<StoredType> m_array;
+    ///< circular buffer storage
+
+    std::unique_ptr<Reader[]> m_readers;
+    ///< reader slots
+
+    std::size_t m_maxReaders;
+    ///< number of reader slots
+
+    alignas(saCircBuffCacheLine) std::atomic<uint64_t> m_written;
+    ///< Number of samples committed, owned by Commit()
+
+    std::size_t m_reserved;
+    ///< Number of samples reserved by the last Reserve()
+  };
+}
+
+#endif
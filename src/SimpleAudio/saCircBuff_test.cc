@@ -11,6 +11,8 @@
 #include <stdexcept>
 #include <cstdint>
 #include <cstring>
+#include <string>
+#include <algorithm>
 
 using namespace std::chrono_literals;
 using binary_semaphore = std::counting_semaphore<1>;
@@ -18,6 +20,7 @@ using binary_semaphore = std::counting_semaphore<1>;
 // Local include files
 #include "saSample.h"
 #include "saCircBuff.h"
+#include "saCircBuffBroadcast.h"
 
 using namespace SimpleAudio;
 
@@ -57,6 +60,35 @@ typedef saCircBuff<int16_t,
                    true>
 saCircBuff_16_saSample_32_Exp_F_T;
 
+typedef saCircBuff<uint32_t,
+                   uint32_t,
+                   uint32_t,
+                   saCircBuffCopyByteWise<uint32_t>,
+                   saCircBuffCopyByteWise<uint32_t>,
+                   false,
+                   false,
+                   true>
+saCircBuff_32_32_Def_F_F_SPSC;
+
+typedef saCircBuff<uint32_t,
+                   uint32_t,
+                   uint32_t,
+                   saCircBuffCopyByteWise<uint32_t>,
+                   saCircBuffCopyByteWise<uint32_t>,
+                   true,
+                   true>
+saCircBuff_32_32_Def_T_T;
+
+typedef saCircBuff<uint32_t,
+                   uint32_t,
+                   uint32_t,
+                   saCircBuffCopyByteWise<uint32_t>,
+                   saCircBuffCopyByteWise<uint32_t>,
+                   true,
+                   true,
+                   true>
+saCircBuff_32_32_Def_T_T_SPSC;
+
 template < typename C, typename T>
 void producer_fn(C& cbuf, binary_semaphore& bs, std::size_t sz, T * inbuf)
 {
@@ -539,8 +571,588 @@ void test_threaded_saSample_write_and_int32_read(void)
   consumer.join();
 }
 
+// Stress test of the SPSC ordering. The producer inserts a sequence of
+// integers in chunks of varying length and the consumer checks that it
+// extracts the same sequence. Run under ThreadSanitizer (make PORT=thread)
+// to check that the copies are ordered by the index updates.
+void test_threaded_spsc_stress(void)
+{
+  std::cout << "Testing threaded SPSC stress " << std::endl;
+  constexpr std::size_t num_samples=1<<22;
+  constexpr std::size_t max_chunk=97;
+  saCircBuff_32_32_Def_F_F_SPSC cbuf(251);
+
+  std::thread producer([&cbuf]()
+    {
+      uint32_t inbuf[max_chunk];
+      std::size_t n=0, chunk=1;
+      while (n < num_samples)
+        {
+          const std::size_t num=std::min(chunk, num_samples-n);
+          for (std::size_t k=0; k<num; k++)
+            {
+              inbuf[k] = static_cast<uint32_t>(n+k);
+            }
+          std::size_t written=0;
+          while (written < num)
+            {
+              const std::size_t w=cbuf.Insert(num-written, inbuf+written);
+              if (w == 0)
+                {
+                  std::this_thread::yield();
+                }
+              written+=w;
+            }
+          n+=num;
+          chunk=(chunk*7)%max_chunk + 1;
+        }
+    });
+
+  std::size_t errors=0;
+  std::thread consumer([&cbuf, &errors]()
+    {
+      uint32_t outbuf[max_chunk];
+      std::size_t n=0, chunk=1;
+      while (n < num_samples)
+        {
+          const std::size_t r=cbuf.Extract(outbuf, chunk);
+          if (r == 0)
+            {
+              std::this_thread::yield();
+            }
+          for (std::size_t k=0; k<r; k++)
+            {
+              if (outbuf[k] != static_cast<uint32_t>(n+k))
+                {
+                  errors++;
+                }
+            }
+          n+=r;
+          chunk=(chunk*5)%max_chunk + 1;
+        }
+    });
+
+  producer.join();
+  consumer.join();
+
+  uint32_t last;
+  if (errors || (cbuf.Extract(&last, 1) != 0))
+    {
+      std::cout << "SPSC stress failed: " << errors << " errors" << std::endl;
+    }
+  else
+    {
+      std::cout << "SPSC stress success!" << std::endl;
+    }
+}
+
+// The consumer waits for exactly one hop of samples and the producer waits
+// for space for exactly one chunk, so neither polls.
+template <typename C>
+void test_threaded_wait(void)
+{
+  constexpr std::size_t num_samples=1<<20;
+  constexpr std::size_t chunk=61;
+  constexpr std::size_t hop=89;
+  // Needs a capacity of at least chunk+hop-1 to avoid a deadlock
+  C cbuf(160);
+
+  // Nothing to wait for
+  if (cbuf.WaitForData(1, 1ms) || !cbuf.WaitForSpace(160, 0ms))
+    {
+      std::cout << "Wait on empty buffer failed" << std::endl;
+    }
+  try
+    {
+      cbuf.WaitForData(161, 0ms);
+      std::cout << "Wait for more than capacity failed" << std::endl;
+    }
+  catch (saCircBuffUnderRun& e)
+    {
+      std::cout << "Caught " << e.what() << std::endl;
+    }
+
+  std::thread producer([&cbuf]()
+    {
+      uint32_t inbuf[chunk];
+      std::size_t n=0;
+      while (n < num_samples)
+        {
+          for (std::size_t k=0; k<chunk; k++)
+            {
+              inbuf[k] = static_cast<uint32_t>(n+k);
+            }
+          while (!cbuf.WaitForSpace(chunk, 1s)) { }
+          n+=cbuf.Insert(chunk, inbuf);
+        }
+    });
+
+  std::size_t errors=0, hops=0;
+  std::thread consumer([&cbuf, &errors, &hops]()
+    {
+      uint32_t outbuf[hop];
+      std::size_t n=0;
+      while ((n+hop) <= num_samples)
+        {
+          while (!cbuf.WaitForData(hop, 1s)) { }
+          if (cbuf.Extract(outbuf, hop) != hop)
+            {
+              errors++;
+            }
+          for (std::size_t k=0; k<hop; k++)
+            {
+              if (outbuf[k] != static_cast<uint32_t>(n+k))
+                {
+                  errors++;
+                }
+            }
+          n+=hop;
+          hops++;
+        }
+    });
+
+  producer.join();
+  consumer.join();
+
+  if (errors)
+    {
+      std::cout << "Wait failed: " << errors << " errors" << std::endl;
+    }
+  else
+    {
+      std::cout << "Wait success! " << hops << " hops" << std::endl;
+    }
+}
+
+// Write and read in place. The regions wrap around the end of the buffer
+// storage after the first pass.
+void test_reserve_and_peek(void)
+{
+  std::cout << "Testing reserve and peek " << std::endl;
+  saCircBuff_32_32_Def_T_T cbuf(10);
+  uint32_t n=0, m=0;
+  std::size_t errors=0;
+  for (std::size_t pass=0; pass<3; pass++)
+    {
+      auto w = cbuf.Reserve(7);
+      std::cout << "Reserved " << w.first.size() << "+" << w.second.size()
+                << std::endl;
+      for (auto& x : w.first) { x = n++; }
+      for (auto& x : w.second) { x = n++; }
+      cbuf.Commit(w.Size());
+
+      auto r = cbuf.Peek(7);
+      std::cout << "Peeked " << r.first.size() << "+" << r.second.size()
+                << std::endl;
+      for (const auto& x : r.first) { errors += (x != m++); }
+      for (const auto& x : r.second) { errors += (x != m++); }
+      cbuf.Consume(r.Size());
+    }
+
+  try
+    {
+      cbuf.Reserve(11);
+    }
+  catch (saCircBuffOverRun& e)
+    {
+      std::cout << "Caught " << e.what() << std::endl;
+    }
+  try
+    {
+      cbuf.Peek(1);
+    }
+  catch (saCircBuffUnderRun& e)
+    {
+      std::cout << "Caught " << e.what() << std::endl;
+    }
+  try
+    {
+      cbuf.Reserve(2);
+      cbuf.Commit(3);
+    }
+  catch (saCircBuffCantCopy& e)
+    {
+      std::cout << "Caught " << e.what() << std::endl;
+    }
+
+  if (errors)
+    {
+      std::cout << "Reserve and peek failed: " << errors << " errors"
+                << std::endl;
+    }
+  else
+    {
+      std::cout << "Reserve and peek success!" << std::endl;
+    }
+}
+
+// The producer writes and the consumer reads in place with SPSC ordering
+void test_threaded_reserve_and_peek(void)
+{
+  std::cout << "Testing threaded SPSC reserve and peek " << std::endl;
+  constexpr std::size_t num_samples=1<<22;
+  saCircBuff_32_32_Def_F_F_SPSC cbuf(251);
+
+  std::thread producer([&cbuf]()
+    {
+      std::size_t n=0, chunk=1;
+      while (n < num_samples)
+        {
+          auto w = cbuf.Reserve(std::min(chunk, num_samples-n));
+          if (w.Size() == 0)
+            {
+              cbuf.WaitForSpace(1, 1ms);
+            }
+          for (auto& x : w.first) { x = static_cast<uint32_t>(n++); }
+          for (auto& x : w.second) { x = static_cast<uint32_t>(n++); }
+          cbuf.Commit(w.Size());
+          chunk=(chunk*7)%97 + 1;
+        }
+    });
+
+  std::size_t errors=0;
+  std::thread consumer([&cbuf, &errors]()
+    {
+      std::size_t n=0, chunk=1;
+      while (n < num_samples)
+        {
+          auto r = cbuf.Peek(chunk);
+          if (r.Size() == 0)
+            {
+              cbuf.WaitForData(1, 1ms);
+            }
+          for (const auto& x : r.first)
+            {
+              errors += (x != static_cast<uint32_t>(n++));
+            }
+          for (const auto& x : r.second)
+            {
+              errors += (x != static_cast<uint32_t>(n++));
+            }
+          cbuf.Consume(r.Size());
+          chunk=(chunk*5)%97 + 1;
+        }
+    });
+
+  producer.join();
+  consumer.join();
+
+  if (errors)
+    {
+      std::cout << "Threaded reserve and peek failed: " << errors << " errors"
+                << std::endl;
+    }
+  else
+    {
+      std::cout << "Threaded reserve and peek success!" << std::endl;
+    }
+}
+
+// Three readers of a broadcast buffer. The producer is bounded by the
+// slowest reader, or drops it.
+void test_broadcast(void)
+{
+  std::cout << "Testing broadcast " << std::endl;
+  saCircBuffBroadcast<uint32_t> bcbuf(10, 3);
+  uint32_t inbuf[10], outbuf[10];
+  for (uint32_t k=0; k<10; k++)
+    {
+      inbuf[k] = k;
+    }
+
+  const std::size_t fast = bcbuf.AddReader();
+  const std::size_t slow = bcbuf.AddReader();
+  std::cout << "Readers " << fast << " " << slow << std::endl;
+  std::cout << "Inserted " << bcbuf.Insert(7, inbuf) << std::endl;
+  std::cout << "Fast extracted " << bcbuf.Extract(fast, outbuf, 10)
+            << " last " << outbuf[6] << std::endl;
+  std::cout << "Slow extracted " << bcbuf.Extract(slow, outbuf, 2)
+            << " last " << outbuf[1] << std::endl;
+  std::cout << "Inserted " << bcbuf.Insert(10, inbuf) << std::endl;
+  auto r = bcbuf.Peek(slow, 10);
+  std::cout << "Slow peeked " << r.first.size() << "+" << r.second.size()
+            << " first " << r.first[0] << " last " << r.second.back()
+            << std::endl;
+  bcbuf.Consume(slow, r.Size());
+  const std::size_t late = bcbuf.AddReader();
+  std::cout << "Late reader " << late << " extracted "
+            << bcbuf.Extract(late, outbuf, 10) << std::endl;
+  try
+    {
+      bcbuf.AddReader();
+    }
+  catch (saCircBuffOverRun& e)
+    {
+      std::cout << "Caught " << e.what() << std::endl;
+    }
+  bcbuf.RemoveReader(fast);
+  std::cout << "Inserted " << bcbuf.Insert(10, inbuf) << std::endl;
+  try
+    {
+      bcbuf.Peek(fast, 1);
+    }
+  catch (saCircBuffCantCopy& e)
+    {
+      std::cout << "Caught " << e.what() << std::endl;
+    }
+
+  saCircBuffBroadcast<uint32_t, true> dropbuf(10, 2);
+  const std::size_t keen = dropbuf.AddReader();
+  const std::size_t lazy = dropbuf.AddReader();
+  std::cout << "Inserted " << dropbuf.Insert(8, inbuf) << std::endl;
+  dropbuf.Extract(keen, outbuf, 8);
+  std::cout << "Inserted " << dropbuf.Insert(8, inbuf) << std::endl;
+  std::cout << "Dropped " << dropbuf.Dropped(keen) << " "
+            << dropbuf.Dropped(lazy) << std::endl;
+  try
+    {
+      dropbuf.Extract(lazy, outbuf, 1);
+    }
+  catch (saCircBuffOverRun& e)
+    {
+      std::cout << "Caught " << e.what() << std::endl;
+    }
+  dropbuf.Resync(lazy);
+  std::cout << "Inserted " << dropbuf.Insert(3, inbuf+5) << std::endl;
+  std::cout << "Resynced extracted " << dropbuf.Extract(lazy, outbuf, 10)
+            << " first " << outbuf[0] << std::endl;
+}
+
+// A producer and three readers at different paces
+void test_threaded_broadcast(void)
+{
+  std::cout << "Testing threaded broadcast " << std::endl;
+  constexpr std::size_t num_samples=1<<20;
+  constexpr std::size_t num_readers=3;
+  saCircBuffBroadcast<uint32_t> bcbuf(251, num_readers);
+  std::size_t ids[num_readers];
+  for (std::size_t r=0; r<num_readers; r++)
+    {
+      ids[r] = bcbuf.AddReader();
+    }
+
+  std::thread producer([&bcbuf]()
+    {
+      std::size_t n=0, chunk=1;
+      while (n < num_samples)
+        {
+          auto w = bcbuf.Reserve(std::min(chunk, num_samples-n));
+          if (w.Size() == 0)
+            {
+              std::this_thread::yield();
+            }
+          for (auto& x : w.first) { x = static_cast<uint32_t>(n++); }
+          for (auto& x : w.second) { x = static_cast<uint32_t>(n++); }
+          bcbuf.Commit(w.Size());
+          chunk=(chunk*7)%97 + 1;
+        }
+    });
+
+  std::size_t errors[num_readers] = { 0 };
+  std::vector<std::thread> readers;
+  for (std::size_t r=0; r<num_readers; r++)
+    {
+      readers.emplace_back([&bcbuf, &ids, &errors, r]()
+        {
+          std::size_t n=0, chunk=1;
+          while (n < num_samples)
+            {
+              auto v = bcbuf.Peek(ids[r], chunk);
+              if (v.Size() == 0)
+                {
+                  std::this_thread::yield();
+                }
+              for (const auto& x : v.first)
+                {
+                  errors[r] += (x != static_cast<uint32_t>(n++));
+                }
+              for (const auto& x : v.second)
+                {
+                  errors[r] += (x != static_cast<uint32_t>(n++));
+                }
+              bcbuf.Consume(ids[r], v.Size());
+              chunk=(chunk*(r+3))%(31*(r+1)) + 1;
+            }
+        });
+    }
+
+  producer.join();
+  for (auto& t : readers)
+    {
+      t.join();
+    }
+
+  if (errors[0] || errors[1] || errors[2])
+    {
+      std::cout << "Threaded broadcast failed" << std::endl;
+    }
+  else
+    {
+      std::cout << "Threaded broadcast success!" << std::endl;
+    }
+}
+
+// Fixed power-of-two capacity. Check wrapping of the storage index and
+// of the counts.
+void test_pow2(void)
+{
+  std::cout << "Testing saCircBuffPow2<uint32_t,8>" << std::endl;
+  saCircBuffPow2<uint32_t,8> cbuf;
+  uint32_t inbuf[8], outbuf[8];
+  uint32_t n=0, m=0;
+  std::size_t errors=0;
+  std::cout << "Capacity " << cbuf.Capacity() << std::endl;
+  for (std::size_t pass=0; pass<5; pass++)
+    {
+      for (std::size_t k=0; k<5; k++)
+        {
+          inbuf[k] = n++;
+        }
+      cbuf.Insert(5, inbuf);
+      cbuf.Extract(outbuf, 5);
+      for (std::size_t k=0; k<5; k++)
+        {
+          errors += (outbuf[k] != m++);
+        }
+    }
+  cbuf.Insert(8, inbuf);
+  try
+    {
+      cbuf.Insert(1, inbuf);
+    }
+  catch (saCircBuffOverRun& e)
+    {
+      std::cout << "Caught " << e.what() << std::endl;
+    }
+  cbuf.Extract(outbuf, 8);
+  try
+    {
+      cbuf.Extract(outbuf, 1);
+    }
+  catch (saCircBuffUnderRun& e)
+    {
+      std::cout << "Caught " << e.what() << std::endl;
+    }
+  if (errors || (std::memcmp(inbuf, outbuf, sizeof(inbuf)) != 0))
+    {
+      std::cout << "saCircBuffPow2 failed" << std::endl;
+    }
+  else
+    {
+      std::cout << "saCircBuffPow2 success!" << std::endl;
+    }
+}
+
+// SPSC stress test of the fixed power-of-two capacity
+void test_threaded_pow2(void)
+{
+  std::cout << "Testing threaded SPSC saCircBuffPow2 " << std::endl;
+  constexpr std::size_t num_samples=1<<22;
+  typedef saCircBuffPow2<uint32_t, 256,
+                         uint32_t, uint32_t,
+                         saCircBuffCopyByteWise<uint32_t>,
+                         saCircBuffCopyByteWise<uint32_t>,
+                         false, false, true> Pow2SPSC;
+  Pow2SPSC cbuf;
+
+  std::thread producer([&cbuf]()
+    {
+      uint32_t inbuf[97];
+      std::size_t n=0, chunk=1;
+      while (n < num_samples)
+        {
+          const std::size_t num=std::min(chunk, num_samples-n);
+          for (std::size_t k=0; k<num; k++)
+            {
+              inbuf[k] = static_cast<uint32_t>(n+k);
+            }
+          std::size_t written=0;
+          while (written < num)
+            {
+              const std::size_t w=cbuf.Insert(num-written, inbuf+written);
+              if (w == 0)
+                {
+                  std::this_thread::yield();
+                }
+              written+=w;
+            }
+          n+=num;
+          chunk=(chunk*7)%97 + 1;
+        }
+    });
+
+  std::size_t errors=0;
+  std::thread consumer([&cbuf, &errors]()
+    {
+      uint32_t outbuf[97];
+      std::size_t n=0, chunk=1;
+      while (n < num_samples)
+        {
+          const std::size_t r=cbuf.Extract(outbuf, chunk);
+          if (r == 0)
+            {
+              std::this_thread::yield();
+            }
+          for (std::size_t k=0; k<r; k++)
+            {
+              errors += (outbuf[k] != static_cast<uint32_t>(n+k));
+            }
+          n+=r;
+          chunk=(chunk*5)%97 + 1;
+        }
+    });
+
+  producer.join();
+  consumer.join();
+
+  if (errors)
+    {
+      std::cout << "Threaded saCircBuffPow2 failed" << std::endl;
+    }
+  else
+    {
+      std::cout << "Threaded saCircBuffPow2 success!" << std::endl;
+    }
+}
+
+// Time Insert() and Extract() of blocks through a buffer
+template <typename C>
+double bench_insert_and_extract(C& cbuf, const std::size_t block)
+{
+  constexpr std::size_t repeats=1<<22;
+  int16_t inbuf[64], outbuf[64];
+  for (std::size_t k=0; k<64; k++)
+    {
+      inbuf[k] = static_cast<int16_t>(k);
+    }
+  volatile int16_t sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t r=0; r<repeats; r++)
+    {
+      cbuf.Insert(block, inbuf);
+      cbuf.Extract(outbuf, block);
+      sink = outbuf[0];
+    }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end-start).count();
+}
+
+template <typename C, typename P>
+void bench_pow2(const char* const name, C& cbuf, P& pbuf)
+{
+  for (const std::size_t block : { 1, 61 })
+    {
+      const double tCirc = bench_insert_and_extract(cbuf, block);
+      const double tPow2 = bench_insert_and_extract(pbuf, block);
+      std::cout << std::setprecision(4)
+                << name << " insert and extract of " << block
+                << " saCircBuff " << tCirc << "ms, saCircBuffPow2 " << tPow2
+                << "ms, ratio " << tCirc/tPow2 << std::endl;
+    }
+}
+
 int
-main(void)
+main(int argc, char* argv[])
 {
   test_instantiation();
   test_nullptr();
@@ -548,6 +1160,37 @@ main(void)
   test_threaded_int16_write_and_int16_read(); 
   test_threaded_int16_write_and_int32_read();
   test_threaded_saSample_write_and_int32_read();
+  test_threaded_spsc_stress();
+  std::cout << "Testing threaded wait " << std::endl;
+  test_threaded_wait<saCircBuff_32_32_Def_T_T>();
+  std::cout << "Testing threaded SPSC wait " << std::endl;
+  test_threaded_wait<saCircBuff_32_32_Def_T_T_SPSC>();
+  test_reserve_and_peek();
+  test_threaded_reserve_and_peek();
+  test_broadcast();
+  test_threaded_broadcast();
+  test_pow2();
+  test_threaded_pow2();
+
+  // Benchmark
+  const bool bench = (argc > 1) && (std::string(argv[1]) == "--bench");
+  if (bench)
+    {
+      saCircBuff_16_16_Def_T_T cbuf(1024);
+      auto pbuf = std::make_unique<saCircBuffPow2<int16_t, 1024>>();
+      bench_pow2("Default", cbuf, *pbuf);
+
+      saCircBuff<int16_t, int16_t, int16_t,
+                 saCircBuffCopyByteWise<int16_t>,
+                 saCircBuffCopyByteWise<int16_t>,
+                 true, true, true> sbuf(1024);
+      using Pow2SPSC = saCircBuffPow2<int16_t, 1024, int16_t, int16_t,
+                                      saCircBuffCopyByteWise<int16_t>,
+                                      saCircBuffCopyByteWise<int16_t>,
+                                      true, true, true>;
+      auto psbuf = std::make_unique<Pow2SPSC>();
+      bench_pow2("SPSC", sbuf, *psbuf);
+    }
   
   return 0;
 }
@@ -7,11 +7,196 @@
 #include <algorithm>
 #include <utility>
 #include <stdexcept>
+#include <future>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <system_error>
+#include <cstdlib>
+
+#include <unistd.h>
 
 #include "saDeviceInfo.h"
 
 namespace SimpleAudio
 {
+  void
+  saDeviceInfo::queryInputDevices()
+  {
+    deviceInfoList = pendingQuery.valid() ? pendingQuery.get() : queryDevices();
+  }
+
+  void
+  saDeviceInfo::queryInputDevicesAsync()
+  {
+    if (!pendingQuery.valid())
+      {
+        pendingQuery = std::async(std::launch::async, &saDeviceInfo::queryDevices);
+      }
+  }
+
+  saDeviceInfo::saDeviceInfoListEntry::saDeviceInfoListEntry() = default;
+
+  saDeviceInfo::saDeviceInfoListEntry::saDeviceInfoListEntry
+  (const saDeviceInfoListEntry&) = default;
+
+  saDeviceInfo::saDeviceInfoListEntry&
+  saDeviceInfo::saDeviceInfoListEntry::operator=
+  (const saDeviceInfoListEntry&) = default;
+
+  saDeviceInfo::saDeviceInfoListEntry::~saDeviceInfoListEntry() = default;
+
+  // The cache has a line for each device. The fields are separated by tabs:
+  // card ID, name, minimum and maximum channels, sample formats and rates
+  // separated by commas, and description.
+  static const char* const saDeviceInfoCacheHeader =
+    "SimpleAudio capture devices 1";
+
+  std::string
+  saDeviceInfo::cacheFileName()
+  {
+    const char* const cacheHome = std::getenv("XDG_CACHE_HOME");
+    const char* const home = std::getenv("HOME");
+    if ((cacheHome != 0) && (*cacheHome != 0))
+      {
+        return std::string(cacheHome) + "/SimpleAudio/capture-devices";
+      }
+    if ((home != 0) && (*home != 0))
+      {
+        return std::string(home) + "/.cache/SimpleAudio/capture-devices";
+      }
+    return std::string();
+  }
+
+  saDeviceInfo::saDeviceInfoList
+  saDeviceInfo::readCache(const std::string& fileName)
+  {
+    saDeviceInfoList list;
+    std::ifstream cache(fileName);
+    std::string line;
+    if (!std::getline(cache, line) || (line != saDeviceInfoCacheHeader))
+      {
+        return list;
+      }
+
+    // Malformed lines are skipped
+    while (std::getline(cache, line))
+      {
+        std::istringstream fields(line);
+        std::string minChannels, maxChannels, formats, rates;
+        saDeviceInfoListEntry entry;
+        if (!std::getline(fields, entry.cardId, '\t') ||
+            !std::getline(fields, entry.name, '\t') ||
+            !std::getline(fields, minChannels, '\t') ||
+            !std::getline(fields, maxChannels, '\t') ||
+            !std::getline(fields, formats, '\t') ||
+            !std::getline(fields, rates, '\t'))
+          {
+            continue;
+          }
+        std::getline(fields, entry.description);
+        std::istringstream(minChannels) >> entry.minChannels;
+        std::istringstream(maxChannels) >> entry.maxChannels;
+        std::istringstream formatList(formats);
+        std::string format;
+        saSampleFormat sampleFormat = saSampleFormat::S16;
+        while (std::getline(formatList, format, ','))
+          {
+            if (saSampleFormatFromName(format, sampleFormat))
+              {
+                entry.sampleFormats.push_back(sampleFormat);
+              }
+          }
+        std::istringstream rateList(rates);
+        std::string rate;
+        while (std::getline(rateList, rate, ','))
+          {
+            saSampleRate sampleRate = 0;
+            if (std::istringstream(rate) >> sampleRate)
+              {
+                entry.sampleRates.push_back(sampleRate);
+              }
+          }
+        if (!entry.sampleRates.empty() && !entry.sampleFormats.empty())
+          {
+            list.push_back(entry);
+          }
+      }
+    return list;
+  }
+
+  void
+  saDeviceInfo::writeCache(const std::string& fileName,
+                           const saDeviceInfoList& list)
+  {
+    if (fileName.empty())
+      {
+        return;
+      }
+    std::error_code err;
+    std::filesystem::create_directories
+      (std::filesystem::path(fileName).parent_path(), err);
+
+    // Write a uniquely named file and replace the cache in one step so
+    // that readers never see a part and concurrent writers don't collide
+    std::ostringstream cache;
+    cache << saDeviceInfoCacheHeader << "\n";
+    for (const saDeviceInfoListEntry& entry : list)
+      {
+        cache << entry.cardId << "\t" << entry.name << "\t"
+              << entry.minChannels << "\t" << entry.maxChannels << "\t";
+        for (std::size_t f=0; f<entry.sampleFormats.size(); f++)
+          {
+            cache << (f ? "," : "")
+                  << saSampleFormatName(entry.sampleFormats[f]);
+          }
+        cache << "\t";
+        for (std::size_t r=0; r<entry.sampleRates.size(); r++)
+          {
+            cache << (r ? "," : "") << entry.sampleRates[r];
+          }
+        cache << "\t" << entry.description << "\n";
+      }
+    const std::string text = cache.str();
+
+    std::string tmpName = fileName + ".XXXXXX";
+    const int fd = mkstemp(tmpName.data());
+    if (fd < 0)
+      {
+        return;
+      }
+    std::size_t written = 0;
+    while (written < text.size())
+      {
+        const ssize_t n = write(fd, text.data()+written, text.size()-written);
+        if (n <= 0)
+          {
+            break;
+          }
+        written += static_cast<std::size_t>(n);
+      }
+    if ((close(fd) != 0) || (written < text.size()))
+      {
+        std::filesystem::remove(tmpName, err);
+        return;
+      }
+    std::filesystem::rename(tmpName, fileName, err);
+    if (err)
+      {
+        std::filesystem::remove(tmpName, err);
+      }
+  }
+
+  const saDeviceInfo::saDeviceInfoListEntry*
+  saDeviceInfo::findDevice(const saDeviceInfoDeviceName& deviceName) const
+  {
+    saDeviceInfoList::const_iterator info =
+      std::find_if(deviceInfoList.begin(), deviceInfoList.end(),
+                   [&deviceName](const saDeviceInfoListEntry& entry)
+                   { return entry.name == deviceName; });
+    return (info == deviceInfoList.end()) ? 0 : &(*info);
+  }
+
   void 
   saDeviceInfo::getDeviceNames(saDeviceInfoDeviceNameList& deviceNameList)
   {
@@ -19,8 +204,7 @@ namespace SimpleAudio
     saDeviceInfoList::iterator info;
     for( info = deviceInfoList.begin(); info != deviceInfoList.end(); info++)
       {
-        saDeviceInfoListEntry entry = *info;
-        deviceNameList.push_back(entry.first);
+        deviceNameList.push_back(info->name);
       }
   }
 
@@ -29,17 +213,42 @@ namespace SimpleAudio
                                          saDeviceInfoSampleRateList& 
                                          sampleRateList)
   {
-    saDeviceInfoList::iterator info;
-    for(info = deviceInfoList.begin(); info != deviceInfoList.end(); info++)
+    const saDeviceInfoListEntry* entry = findDevice(deviceName);
+    if (entry != 0)
       {
-        saDeviceInfoListEntry entry = *info;
+        sampleRateList = entry->sampleRates;
+      }
+  }
 
-        if (entry.first == deviceName)
-          {
-            sampleRateList.clear();
-            sampleRateList = entry.second;
-            break;
-          }
+  std::string
+  saDeviceInfo::getDeviceDescription(const saDeviceInfoDeviceName& deviceName)
+  {
+    const saDeviceInfoListEntry* entry = findDevice(deviceName);
+    return (entry != 0) ? entry->description : std::string();
+  }
+
+  void
+  saDeviceInfo::getDeviceChannels(const saDeviceInfoDeviceName& deviceName,
+                                  std::size_t& minChannels,
+                                  std::size_t& maxChannels)
+  {
+    const saDeviceInfoListEntry* entry = findDevice(deviceName);
+    if (entry != 0)
+      {
+        minChannels = entry->minChannels;
+        maxChannels = entry->maxChannels;
+      }
+  }
+
+  void
+  saDeviceInfo::getDeviceSampleFormatList
+  (const saDeviceInfoDeviceName& deviceName,
+   saDeviceInfoSampleFormatList& sampleFormatList)
+  {
+    const saDeviceInfoListEntry* entry = findDevice(deviceName);
+    if (entry != 0)
+      {
+        sampleFormatList = entry->sampleFormats;
       }
   }
 
@@ -48,13 +257,26 @@ namespace SimpleAudio
   {
     void operator() (const saDeviceInfoListEntry& entry)
     {
-      // Device name
-      std::cerr << entry.first << std::endl;
+      // Device name and description
+      std::cerr << entry.name;
+      if (!entry.description.empty())
+        {
+          std::cerr << " (" << entry.description << ")";
+        }
+      std::cerr << std::endl;
         
       // Device sample rates
-      saDeviceInfoSampleRateList sampleRates = entry.second;
       std::ostream_iterator<saSampleRate> output(std::cerr, " ");
-      std::copy(sampleRates.begin(), sampleRates.end(), output);
+      std::copy(entry.sampleRates.begin(), entry.sampleRates.end(), output);
+      std::cerr << std::endl;
+
+      // Device channels and sample formats
+      std::cerr << "channels " << entry.minChannels << "-"
+                << entry.maxChannels << " formats";
+      for (const saSampleFormat format : entry.sampleFormats)
+        {
+          std::cerr << " " << saSampleFormatName(format);
+        }
         
       // Done
       std::cerr << std::endl;
@@ -2,14 +2,20 @@
 /// \brief Find available audio devices
 ///
 ///  Public interface for finding out about available system audio
-///  devices. The only devices SimpleAudio is interested in are mono, 
-///  16-bit devices supporting the sample rates 11.025kHz, 22.05kHz, 
-///  44.1kHz and/or 48kHz.
+///  devices. Each capture device is probed for the sample rates, channels
+///  and sample formats it supports. Probing opens the devices, which can
+///  be slow, so the results are cached on disk keyed by the ID of the
+///  sound card and the query can run on a background thread. If no device
+///  is found the "default" device is listed with the sample rates
+///  11.025kHz, 22.05kHz, 44.1kHz and 48kHz.
 
 #include <stdexcept>
 #include <utility>
 #include <vector>
 #include <string>
+#include <future>
+
+#include "saDeviceType.h"
 
 #ifndef __SADEVICEINFO_H__
 #define __SADEVICEINFO_H__
@@ -32,19 +38,30 @@ namespace SimpleAudio
   /// List (vector for random access) of sample rates 
   typedef std::vector< saSampleRate > saDeviceInfoSampleRateList;
 
+  /// \typedef saDeviceInfoSampleFormatList
+  /// List of sample formats
+  typedef std::vector< saSampleFormat > saDeviceInfoSampleFormatList;
+
   /// \class saDeviceInfo
   /// \brief A class for obtaining information about an audio device
   class saDeviceInfo
   {
   public:
 
-    saDeviceInfo() : deviceInfoList() { } // Stops a compiler warning!
+    // Stops a compiler warning!
+    saDeviceInfo() : deviceInfoList(), pendingQuery() { }
 
     ~saDeviceInfo() { }
 
-    /// \brief Query simple audio input device info
+    /// \brief Query simple audio input device info. Waits for a query
+    ///        started by queryInputDevicesAsync.
     void queryInputDevices();
 
+    /// \brief Start querying simple audio input device info on a
+    ///        background thread. The results are available after the
+    ///        next call to queryInputDevices.
+    void queryInputDevicesAsync();
+
     /// \brief Get device names
     /// \param deviceNameList reference to a vector of device names
     void getDeviceNames(saDeviceInfoDeviceNameList& deviceNameList);
@@ -55,6 +72,26 @@ namespace SimpleAudio
     void getDeviceSampleRateList(saDeviceInfoDeviceName& deviceName, 
                                  saDeviceInfoSampleRateList& sampleRateList);
 
+    /// \brief Get device description
+    /// \param deviceName
+    /// \return description of the device, empty if there is none
+    std::string getDeviceDescription(const saDeviceInfoDeviceName& deviceName);
+
+    /// \brief Get the range of device channels
+    /// \param deviceName
+    /// \param minChannels minimum channels per frame
+    /// \param maxChannels maximum channels per frame
+    void getDeviceChannels(const saDeviceInfoDeviceName& deviceName,
+                           std::size_t& minChannels,
+                           std::size_t& maxChannels);
+
+    /// \brief Get device sample formats
+    /// \param deviceName
+    /// \param sampleFormatList reference to a vector of sample formats
+    void getDeviceSampleFormatList(const saDeviceInfoDeviceName& deviceName,
+                                   saDeviceInfoSampleFormatList&
+                                   sampleFormatList);
+
     /// \brief Device info list empty?
     ///  \return Device list is empty
     bool Empty();
@@ -70,19 +107,80 @@ namespace SimpleAudio
     /// Disallow copy constructor of saDeviceInfo
     saDeviceInfo( const saDeviceInfo& );
 
-    /// \typedef saDeviceInfoListEntry
-    /// Pair of device name and vector of sample rates
-    typedef 
-      std::pair< saDeviceInfoDeviceName, saDeviceInfoSampleRateList > 
-        saDeviceInfoListEntry;
+    /// \struct saDeviceInfoListEntry
+    /// Device name and capabilities
+    struct saDeviceInfoListEntry
+    {
+      // Not inline, they are too large
+      saDeviceInfoListEntry();
+      saDeviceInfoListEntry(const saDeviceInfoListEntry&);
+      saDeviceInfoListEntry& operator=(const saDeviceInfoListEntry&);
+      ~saDeviceInfoListEntry();
+
+      /// Name of the sound card, "-" if the device is not on one card
+      std::string cardId;
+
+      /// Device name
+      saDeviceInfoDeviceName name;
+
+      /// Sample rates
+      saDeviceInfoSampleRateList sampleRates;
+
+      /// Device description
+      std::string description;
+
+      /// Minimum channels per frame
+      std::size_t minChannels = 0;
+
+      /// Maximum channels per frame
+      std::size_t maxChannels = 0;
+
+      /// Sample formats
+      saDeviceInfoSampleFormatList sampleFormats;
+    };
 
     /// \typedef saDeviceInfoList
-    /// List (vector) of pairs of device name and vector of sample rates
+    /// List (vector) of device names and capabilities
     typedef std::vector< saDeviceInfoListEntry > saDeviceInfoList;
 
+    /// \brief Find and probe the devices, using cached probes of the
+    ///        cards found
+    /// \return list of available devices
+    static saDeviceInfoList queryDevices();
+
+    /// \brief Probe the capabilities of a device
+    /// \param entry device to probe, by name
+    /// \return the device opened and supports a rate and a format
+    static bool probeDevice(saDeviceInfoListEntry& entry);
+
+    /// \brief Get the name of the cache of probed devices. The cache is
+    ///        in $XDG_CACHE_HOME or $HOME/.cache.
+    /// \return file name, empty if there is no cache directory
+    static std::string cacheFileName();
+
+    /// \brief Read the cache of probed devices
+    /// \param fileName cache file
+    /// \return devices in the cache, none if there is no cache
+    static saDeviceInfoList readCache(const std::string& fileName);
+
+    /// \brief Write the cache of probed devices. Errors are ignored.
+    /// \param fileName cache file
+    /// \param list devices to cache
+    static void writeCache(const std::string& fileName,
+                           const saDeviceInfoList& list);
+
+    /// \brief Find a device in the list
+    /// \param deviceName
+    /// \return pointer to the entry, null if the device is not listed
+    const saDeviceInfoListEntry*
+    findDevice(const saDeviceInfoDeviceName& deviceName) const;
+
     /// Internal list of available devices
     saDeviceInfoList deviceInfoList;
 
+    /// Query running on a background thread
+    std::future< saDeviceInfoList > pendingQuery;
+
     /// \struct showListEntry
     /// Show helper function object
     struct showListEntry;
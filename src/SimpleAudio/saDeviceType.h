@@ -2,6 +2,8 @@
 /// \brief Device data format
 
 #include <cstdint>
+#include <cstddef>
+#include <string>
 
 #ifndef __SADEVICETYPE_H__
 #define __SADEVICETYPE_H__
@@ -11,6 +13,41 @@ namespace SimpleAudio
   /// \typedef saDeviceType
   /// The audio device waveform data type
   typedef int16_t saDeviceType;
+
+  /// \enum saSampleFormat
+  /// The format of the samples in an input source fragment. S16 samples
+  /// are saDeviceType. S24_3LE samples are packed 3 byte little-endian
+  /// integers. S32, FLOAT and FLOAT64 samples are native int32_t, float
+  /// and double with full scale at the limits of int32_t and at 1.
+  enum class saSampleFormat { S16, S24_3LE, S32, FLOAT, FLOAT64 };
+
+  /// Size of a sample in a format
+  /// \param format sample format
+  /// \return bytes per sample
+  constexpr std::size_t saSampleFormatBytes(const saSampleFormat format)
+  {
+    return (format == saSampleFormat::S16) ? 2 :
+      (format == saSampleFormat::S24_3LE) ? 3 :
+      (format == saSampleFormat::FLOAT64) ? 8 : 4;
+  }
+
+  /// Name of a format
+  /// \param format sample format
+  /// \return "S16", "S24_3LE", "S32", "FLOAT" or "FLOAT64"
+  constexpr const char* saSampleFormatName(const saSampleFormat format)
+  {
+    return (format == saSampleFormat::S16) ? "S16" :
+      (format == saSampleFormat::S24_3LE) ? "S24_3LE" :
+      (format == saSampleFormat::S32) ? "S32" :
+      (format == saSampleFormat::FLOAT) ? "FLOAT" : "FLOAT64";
+  }
+
+  /// Format of a name
+  /// \param name "S16", "S24_3LE", "S32", "FLOAT" or "FLOAT64"
+  /// \param format sample format named
+  /// \return the name is a format
+  bool saSampleFormatFromName(const std::string& name,
+                              saSampleFormat& format);
 }
 
 #endif
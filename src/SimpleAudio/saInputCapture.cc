@@ -0,0 +1,740 @@
+/// \file saInputCapture.cc
+/// \brief Capture saInputSources on dedicated threads
+
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <exception>
+#include <stdexcept>
+#include <algorithm>
+#include <iostream>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <pthread.h>
+#include <sched.h>
+#include <poll.h>
+#include <sys/mman.h>
+
+#include "saCircBuff.h"
+#include "saInputSource.h"
+#include "saInputCapture.h"
+
+namespace SimpleAudio
+{
+  /// Keep the process in memory for a real-time capture thread
+  /// \param realTimePriority SCHED_FIFO priority of the capture thread
+  static void saInputCaptureLockMemory(const int realTimePriority)
+  {
+    if ((realTimePriority != 0) && (mlockall(MCL_CURRENT | MCL_FUTURE) != 0))
+      {
+        std::cerr << "capture memory not locked: "
+                  << std::strerror(errno) << std::endl;
+      }
+  }
+
+  /// Set the priority of the calling capture thread
+  /// \param realTimePriority SCHED_FIFO priority of the capture thread
+  static void saInputCaptureSetPriority(const int realTimePriority)
+  {
+    if (realTimePriority != 0)
+      {
+        sched_param param;
+        std::memset(&param, 0, sizeof(param));
+        param.sched_priority = realTimePriority;
+        const int err =
+          pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+        if (err != 0)
+          {
+            std::cerr << "capture thread priority not set: "
+                      << std::strerror(err) << std::endl;
+          }
+      }
+  }
+
+  /// \class saInputCaptureRing
+  /// \brief Ring of whole frames captured from a source
+  ///
+  /// A capture thread calls Fill and the reader calls the saInputSource
+  /// functions of an saInputCaptureSource. The ring holds the bytes of the
+  /// frames so that sources of any sample format are captured unconverted.
+  /// The capture thread publishes the capture time of the first frame ever
+  /// committed to the ring, extrapolated back from the timestamp of the
+  /// latest fragment, and the reader times its frames from it.
+  class saInputCaptureRing
+  {
+  public:
+    /// \brief Create a ring for a source
+    /// \param source the source to capture
+    /// \param ringFragments capacity of the ring in fragments
+    saInputCaptureRing(saInputSource* source,
+                       const std::size_t ringFragments);
+
+    /// \brief Collect a fragment from the source into the ring. Called by
+    ///        the capture thread.
+    /// \param isBlocking the source waits for frames, so a Collect with no
+    ///        frames and no over-run is the end of the source
+    /// \return the source has not ended
+    bool Fill(const bool isBlocking);
+
+    /// \brief Mark the end of capture. Called by the capture thread.
+    void Stop() { isEndOfSource.store(true, std::memory_order_release); }
+
+    /// \brief Get the captured source
+    /// \return source
+    saInputSource& Source() { return *inputSource; }
+
+    // Reader functions of saInputSource
+    saInputSource::saInputFragment Collect(std::size_t& validFrames);
+    void Release();
+    void Clear();
+    bool OverRun();
+    bool EndOfSource();
+
+    // Properties of the source
+    const std::size_t framesPerSecond;
+    const std::size_t samplesPerFrame;
+    const saSampleFormat sampleFormat;
+    const std::size_t bytesPerFrame;
+    const std::size_t framesPerFragment;
+    const std::size_t framesPerSource;
+    const std::size_t msDeviceLatency;
+    const std::size_t framesPerPeriod;
+    const std::size_t periodsPerBuffer;
+    const std::size_t framesPerBuffer;
+
+    /// Frames collected by the reader
+    std::size_t framesCollected;
+
+    /// Capture time of the newest frame collected by the reader
+    saTimestamp timestamp;
+
+    /// Number of times Collect waited for frames
+    std::size_t stalls;
+
+  private:
+    /// Discard the frames in the ring
+    /// \param maxFrames maximum number of frames discarded
+    void Discard(const std::size_t maxFrames);
+
+    /// Ring of the bytes of interleaved samples written by the capture
+    /// thread
+    typedef saCircBuff<uint8_t,
+                       uint8_t,
+                       uint8_t,
+                       saCircBuffCopyByteWise<uint8_t>,
+                       saCircBuffCopyByteWise<uint8_t>,
+                       false,
+                       false,
+                       true> saCaptureRing;
+
+    /// Source read by the capture thread
+    std::unique_ptr<saInputSource> inputSource;
+
+    /// Ring of whole frames
+    saCaptureRing ring;
+
+    /// Bytes held by the reader since the last Collect
+    std::size_t bytesHeld;
+
+    /// Frames committed to the ring. Written only by the capture thread.
+    uint64_t framesCommitted;
+
+    /// Frames consumed from the ring, including those discarded by Clear.
+    /// Written only by the reader.
+    uint64_t framesConsumed;
+
+    /// Capture time of the first frame committed to the ring as a count
+    /// of the monotonic clock
+    std::atomic<saTimestamp::rep> originTicks;
+
+    /// Capture has stopped
+    std::atomic<bool> isEndOfSource;
+
+    /// Number of calls to Clear. Written only by the reader.
+    std::atomic<uint64_t> clears;
+
+    /// Number of calls to Clear seen by the capture thread when it last
+    /// cleared the source. Written only by the capture thread.
+    uint64_t sourceClears;
+
+    /// Value of clears when the capture thread last cleared the source.
+    /// Frames collected before then are dropped by the reader.
+    std::atomic<uint64_t> clearsAcknowledged;
+
+    /// Frames committed to the ring before the capture thread last
+    /// cleared the source
+    std::atomic<uint64_t> framesBeforeClear;
+
+    /// Value of clears when a ring or source over-run was seen, so that
+    /// over-runs seen before a Clear are ignored
+    std::atomic<uint64_t> overRunClears;
+
+    /// Exception thrown by the source during capture
+    std::exception_ptr captureError;
+
+    /// Empty fragment returned at the end of the source
+    saInputSource::saSourceType emptyFragment;
+  };
+
+  saInputCaptureRing::saInputCaptureRing(saInputSource* source,
+                                         const std::size_t ringFragments)
+    : framesPerSecond( source->GetFramesPerSecond() ),
+      samplesPerFrame( source->GetSamplesPerFrame() ),
+      sampleFormat( source->GetSampleFormat() ),
+      bytesPerFrame( source->GetBytesPerFrame() ),
+      framesPerFragment( source->GetFramesPerFragment() ),
+      framesPerSource( source->GetFramesPerSource() ),
+      msDeviceLatency( source->GetMsDeviceLatency() ),
+      framesPerPeriod( source->GetFramesPerPeriod() ),
+      periodsPerBuffer( source->GetPeriodsPerBuffer() ),
+      framesPerBuffer( source->GetFramesPerBuffer() ),
+      framesCollected( 0 ),
+      timestamp( saTimestampNow() ),
+      stalls( 0 ),
+      inputSource( source ),
+      ring( (ringFragments*framesPerFragment + 1)*bytesPerFrame - 1 ),
+      bytesHeld( 0 ),
+      framesCommitted( 0 ),
+      framesConsumed( 0 ),
+      originTicks( 0 ),
+      isEndOfSource( false ),
+      clears( 0 ),
+      sourceClears( 0 ),
+      clearsAcknowledged( 0 ),
+      framesBeforeClear( 0 ),
+      overRunClears( UINT64_MAX ),
+      emptyFragment( 0 )
+  {
+    // The ring stores one byte more than its capacity. With this
+    // capacity the storage is a whole number of frames, so frames never
+    // wrap around the end of the ring.
+    if ((ringFragments == 0) || (bytesPerFrame == 0))
+      {
+        throw std::runtime_error("Illegal capture ring size");
+      }
+  }
+
+  bool saInputCaptureRing::Fill(const bool isBlocking)
+  {
+    try
+      {
+        // Clear the source once for any number of Clears since the last
+        // Fill. Frames committed before then were captured before a Clear
+        // and are dropped by the reader, as are those of this Fill if
+        // the reader clears the ring before they are committed.
+        const uint64_t fillClears = clears.load(std::memory_order_acquire);
+        if (fillClears != sourceClears)
+          {
+            inputSource->Clear();
+            sourceClears = fillClears;
+            framesBeforeClear.store(framesCommitted,
+                                    std::memory_order_relaxed);
+            clearsAcknowledged.store(fillClears, std::memory_order_release);
+          }
+
+        // Copy the whole frames that fit into the ring
+        std::size_t validFrames = 0;
+        const saInputSource::saInputFragment fragment =
+          inputSource->Collect(validFrames);
+        const uint8_t* const bytes =
+          reinterpret_cast<const uint8_t*>(fragment);
+        const std::size_t numBytes = validFrames*bytesPerFrame;
+        const saCircBuffRegions<uint8_t> regions = ring.Reserve(numBytes);
+        const std::size_t bytesFit =
+          (regions.Size()/bytesPerFrame)*bytesPerFrame;
+        const std::size_t firstFit = std::min(bytesFit, regions.first.size());
+        std::copy(bytes, bytes+firstFit, regions.first.begin());
+        std::copy(bytes+firstFit, bytes+bytesFit, regions.second.begin());
+        ring.Commit(bytesFit);
+
+        // Time the frames in the ring. The frames dropped are the newest.
+        const std::size_t framesFit = bytesFit/bytesPerFrame;
+        if (framesFit > 0)
+          {
+            framesCommitted += framesFit;
+            const saTimestamp newest = inputSource->GetTimestamp() -
+              saTimestampFrames(validFrames-framesFit, framesPerSecond);
+            const saTimestamp origin = newest -
+              saTimestampFrames(framesCommitted-1, framesPerSecond);
+            originTicks.store(origin.time_since_epoch().count(),
+                              std::memory_order_release);
+          }
+        inputSource->Release(fragment);
+
+        // A blocking source with no frames and no over-run has ended
+        const bool sourceOverRun = inputSource->OverRun();
+        if ((bytesFit < numBytes) || sourceOverRun)
+          {
+            overRunClears.store(fillClears, std::memory_order_release);
+          }
+        if (inputSource->EndOfSource() ||
+            (isBlocking && (validFrames == 0) && !sourceOverRun))
+          {
+            Stop();
+            return false;
+          }
+      }
+    catch(...)
+      {
+        captureError = std::current_exception();
+        Stop();
+        return false;
+      }
+
+    return true;
+  }
+
+  saInputSource::saInputFragment
+  saInputCaptureRing::Collect(std::size_t& validFrames)
+  {
+    // Return any frames still held
+    Release();
+
+    // Wait for frames. Check for the end of capture before looking in
+    // the ring so that frames captured just before the end are not lost.
+    saCircBuffRegions<const uint8_t> regions;
+    bool isWaiting = false;
+    while (true)
+      {
+        const bool ended = isEndOfSource.load(std::memory_order_acquire);
+        regions = ring.Peek(framesPerFragment*bytesPerFrame);
+
+        // Drop the frames captured before the last Clear. Until the
+        // capture thread acknowledges the Clear every frame in the ring
+        // was captured before it. The acknowledgement is loaded after the
+        // Peek, so frames committed after it are never dropped.
+        if ((regions.Size() > 0) &&
+            (clearsAcknowledged.load(std::memory_order_acquire) !=
+             clears.load(std::memory_order_relaxed)))
+          {
+            Discard(regions.Size()/bytesPerFrame);
+            continue;
+          }
+        const uint64_t framesBefore =
+          framesBeforeClear.load(std::memory_order_relaxed);
+        if ((regions.Size() > 0) && (framesConsumed < framesBefore))
+          {
+            Discard(static_cast<std::size_t>(framesBefore - framesConsumed));
+            continue;
+          }
+        if (regions.Size() > 0)
+          {
+            break;
+          }
+        if (ended)
+          {
+            if (captureError)
+              {
+                std::rethrow_exception(captureError);
+              }
+            validFrames = 0;
+            return &emptyFragment;
+          }
+        if (!isWaiting)
+          {
+            isWaiting = true;
+            stalls++;
+          }
+        ring.WaitForData(bytesPerFrame, std::chrono::milliseconds(10));
+      }
+
+    // Hand over the frames before the end of the ring
+    bytesHeld = regions.first.size();
+    validFrames = bytesHeld/bytesPerFrame;
+    framesCollected += validFrames;
+    const saTimestamp origin
+      (saTimestamp::duration(originTicks.load(std::memory_order_acquire)));
+    timestamp = origin +
+      saTimestampFrames(framesConsumed+validFrames-1, framesPerSecond);
+    return reinterpret_cast<saInputSource::saInputFragment>
+      (const_cast<uint8_t*>(regions.first.data()));
+  }
+
+  void saInputCaptureRing::Release()
+  {
+    if (bytesHeld > 0)
+      {
+        ring.Consume(bytesHeld);
+        framesConsumed += bytesHeld/bytesPerFrame;
+        bytesHeld = 0;
+      }
+  }
+
+  void saInputCaptureRing::Discard(const std::size_t maxFrames)
+  {
+    const std::size_t bytesDiscarded =
+      ring.Peek(std::min(ring.Capacity(), maxFrames*bytesPerFrame)).Size();
+    ring.Consume(bytesDiscarded);
+    framesConsumed += bytesDiscarded/bytesPerFrame;
+  }
+
+  void saInputCaptureRing::Clear( )
+  {
+    Release();
+
+    // Every frame in the ring was captured before the Clear. The frames
+    // of a Collect in progress are dropped in Collect.
+    clears.fetch_add(1, std::memory_order_acq_rel);
+    Discard(ring.Capacity()/bytesPerFrame);
+  }
+
+  bool saInputCaptureRing::OverRun( )
+  {
+    return overRunClears.load(std::memory_order_acquire) ==
+      clears.load(std::memory_order_relaxed);
+  }
+
+  bool saInputCaptureRing::EndOfSource()
+  {
+    return isEndOfSource.load(std::memory_order_acquire) &&
+      (ring.Available() == 0);
+  }
+
+  /// \class saInputCaptureSource
+  /// \brief Source reading the ring of a captured source
+  class saInputCaptureSource : public saInputSource
+  {
+  public:
+    /// \brief Create a source reading a ring
+    /// \param _ring ring filled by a capture thread
+    saInputCaptureSource(std::shared_ptr<saInputCaptureRing> _ring)
+      : ring( _ring ) { }
+
+    ~saInputCaptureSource() throw() { }
+
+    /// \brief Collect the frames captured since the last Collect
+    ///
+    /// Waits if no frames have been captured. At most a fragment of frames
+    /// is returned. Fewer are returned if the frames wrap around the end
+    /// of the ring. An empty fragment is returned after the end of the
+    /// source.
+    /// \param validFrames number of valid frames in the fragment
+    /// \return saInputFragment
+    saInputFragment Collect(std::size_t& validFrames)
+    { return ring->Collect(validFrames); }
+
+    /// \brief Return the frames of the last Collect to the ring
+    /// \param fragment
+    void Release([[maybe_unused]] const saInputFragment fragment)
+    { ring->Release(); }
+
+    /// \brief Discard the frames in the ring and clear the source flags
+    ///
+    /// The source flags are cleared by the capture thread before its next
+    /// Collect.
+    void Clear( ) { ring->Clear(); }
+
+    /// \brief Check for ring or source over-runs
+    /// \return over run occurred
+    bool OverRun( ) { return ring->OverRun(); }
+
+    /// \brief Check for the end of the source
+    /// \return the source has ended and all frames have been collected
+    bool EndOfSource() { return ring->EndOfSource(); }
+
+    /// \brief Get device frame rate
+    /// \return frames per second
+    std::size_t GetFramesPerSecond() const { return ring->framesPerSecond; }
+
+    /// \brief Get samples per frame
+    /// \return samples per frame
+    std::size_t GetSamplesPerFrame() const { return ring->samplesPerFrame; }
+
+    /// \brief Get the sample format of the captured source
+    /// \return sample format
+    saSampleFormat GetSampleFormat() const { return ring->sampleFormat; }
+
+    /// \brief Get device frames per fragment
+    /// \return frames per fragment
+    std::size_t GetFramesPerFragment() const
+    { return ring->framesPerFragment; }
+
+    /// \brief Get device frames per source
+    /// \return frames per source
+    std::size_t GetFramesPerSource() const { return ring->framesPerSource; }
+
+    /// \brief Get frames collected from the capture source
+    /// \return frames read from source
+    std::size_t GetFramesReadFromSource() const
+    { return ring->framesCollected; }
+
+    /// \brief Get device latency in milliseconds
+    /// \return device latency
+    std::size_t GetMsDeviceLatency() const { return ring->msDeviceLatency; }
+
+    /// \brief Get the number of times Collect waited for frames
+    /// \return number of stalls
+    std::size_t GetStalls() const { return ring->stalls; }
+
+    /// \brief Get the capture time of the newest frame collected
+    /// \return timestamp of the newest frame
+    saTimestamp GetTimestamp() const { return ring->timestamp; }
+
+    /// \brief Get the period size of the captured source
+    /// \return frames per period
+    std::size_t GetFramesPerPeriod() const { return ring->framesPerPeriod; }
+
+    /// \brief Get the number of periods of the captured source
+    /// \return periods per buffer
+    std::size_t GetPeriodsPerBuffer() const { return ring->periodsPerBuffer; }
+
+    /// \brief Get the buffer size of the captured source
+    /// \return frames per buffer
+    std::size_t GetFramesPerBuffer() const { return ring->framesPerBuffer; }
+
+  protected:
+    /// Ring shared with the capture thread
+    std::shared_ptr<saInputCaptureRing> ring;
+  };
+
+  /// \class saInputCapture
+  /// \brief Source captured on its own thread
+  class saInputCapture : public saInputCaptureSource
+  {
+  public:
+    /// \brief Create a capture source and start the capture thread
+    /// \param source the source to capture
+    /// \param ringFragments capacity of the ring in fragments
+    /// \param realTimePriority SCHED_FIFO priority of the capture thread
+    saInputCapture(saInputSource* source,
+                   const std::size_t ringFragments,
+                   const int realTimePriority);
+
+    /// \brief Stop the capture thread
+    ~saInputCapture() throw();
+
+  private:
+    /// Capture thread. Fill the ring until the end of the source or the
+    /// destructor is called.
+    void Capture();
+
+    /// SCHED_FIFO priority of the capture thread
+    int realTimePriority;
+
+    /// Stop the capture thread
+    std::atomic<bool> isStopRequested;
+
+    /// Capture thread
+    std::thread captureThread;
+  };
+
+  saInputCapture::saInputCapture(saInputSource* source,
+                                 const std::size_t ringFragments,
+                                 const int _realTimePriority)
+    : saInputCaptureSource
+      ( std::make_shared<saInputCaptureRing>(source, ringFragments) ),
+      realTimePriority( _realTimePriority ),
+      isStopRequested( false )
+  {
+    saInputCaptureLockMemory(realTimePriority);
+    captureThread = std::thread(&saInputCapture::Capture, this);
+  }
+
+  saInputCapture::~saInputCapture( ) throw()
+  {
+    // The capture thread stops after its current Collect
+    isStopRequested.store(true, std::memory_order_release);
+    captureThread.join();
+  }
+
+  void saInputCapture::Capture()
+  {
+    saInputCaptureSetPriority(realTimePriority);
+    while (!isStopRequested.load(std::memory_order_acquire) &&
+           ring->Fill(true))
+      { }
+    ring->Stop();
+  }
+
+  /// \class saInputPollImpl
+  /// \brief Capture many sources on one polling thread
+  class saInputPollImpl : public saInputPoll
+  {
+  public:
+    /// \brief Create a polling thread
+    /// \param realTimePriority SCHED_FIFO priority of the polling thread
+    saInputPollImpl(const int realTimePriority);
+
+    /// \brief Stop the polling thread
+    ~saInputPollImpl() throw();
+
+    /// \brief Add a source to be captured
+    /// \param source the source to capture
+    /// \param ringFragments capacity of the ring in fragments
+    /// \return a source reading the ring
+    saInputSource* Add(saInputSource* source, const std::size_t ringFragments);
+
+    /// \brief Start the polling thread
+    void Start();
+
+  private:
+    /// Polling thread. Fill the rings of the ready sources until every
+    /// source has ended or the destructor is called.
+    void Poll();
+
+    /// Rings of the captured sources
+    std::vector< std::shared_ptr<saInputCaptureRing> > rings;
+
+    /// SCHED_FIFO priority of the polling thread
+    int realTimePriority;
+
+    /// Stop the polling thread
+    std::atomic<bool> isStopRequested;
+
+    /// Polling thread
+    std::thread pollThread;
+  };
+
+  saInputPollImpl::saInputPollImpl(const int _realTimePriority)
+    : realTimePriority( _realTimePriority ),
+      isStopRequested( false )
+  {
+    saInputCaptureLockMemory(realTimePriority);
+  }
+
+  saInputPollImpl::~saInputPollImpl( ) throw()
+  {
+    isStopRequested.store(true, std::memory_order_release);
+    if (pollThread.joinable())
+      {
+        pollThread.join();
+      }
+    for (std::size_t r=0; r<rings.size(); r++)
+      {
+        rings[r]->Stop();
+      }
+  }
+
+  saInputSource* saInputPollImpl::Add(saInputSource* source,
+                                      const std::size_t ringFragments)
+  {
+    if (pollThread.joinable())
+      {
+        delete source;
+        throw std::runtime_error("saInputPoll source added after Start");
+      }
+    bool isNonBlocking = false;
+    try
+      {
+        isNonBlocking = source->SetNonBlocking();
+      }
+    catch(...)
+      {
+        delete source;
+        throw;
+      }
+    if (!isNonBlocking)
+      {
+        delete source;
+        throw std::runtime_error("saInputPoll source would block");
+      }
+    std::shared_ptr<saInputCaptureRing> ring =
+      std::make_shared<saInputCaptureRing>(source, ringFragments);
+    rings.push_back(ring);
+    return new saInputCaptureSource(ring);
+  }
+
+  void saInputPollImpl::Start( )
+  {
+    if (!pollThread.joinable())
+      {
+        pollThread = std::thread(&saInputPollImpl::Poll, this);
+      }
+  }
+
+  void saInputPollImpl::Poll()
+  {
+    saInputCaptureSetPriority(realTimePriority);
+
+    // Gather the descriptors of every source. The sources were made
+    // non-blocking when they were added. A source with no descriptors never
+    // waits in Collect and is always ready.
+    const std::size_t numRings = rings.size();
+    std::vector<pollfd> fds;
+    std::vector<std::size_t> firstFd(numRings, 0);
+    std::vector<std::size_t> numFds(numRings, 0);
+    std::vector<bool> isActive(numRings, true);
+    std::vector<bool> isReady(numRings, true);
+    std::size_t numActive = numRings;
+    for (std::size_t r=0; r<numRings; r++)
+      {
+        try
+          {
+            const std::vector<pollfd> sourceFds =
+              rings[r]->Source().GetPollDescriptors();
+            firstFd[r] = fds.size();
+            numFds[r] = sourceFds.size();
+            fds.insert(fds.end(), sourceFds.begin(), sourceFds.end());
+          }
+        catch(std::exception& excpt)
+          {
+            std::cerr << "capture source not polled: "
+                      << excpt.what() << std::endl;
+            isActive[r] = false;
+            rings[r]->Stop();
+            numActive--;
+          }
+      }
+
+    // Every source is collected from once, which starts the devices, and
+    // then whenever poll finds it ready. A source whose reader has been
+    // destroyed is dropped. Its descriptors are ignored by poll from then
+    // on, since an unserviced device over-runs and would wake poll at once
+    // on every pass.
+    while ((numActive > 0) && !isStopRequested.load(std::memory_order_acquire))
+      {
+        bool isAlwaysReady = false;
+        for (std::size_t r=0; r<numRings; r++)
+          {
+            if (isActive[r] && isReady[r] &&
+                ((rings[r].use_count() == 1) || !rings[r]->Fill(numFds[r]==0)))
+              {
+                isActive[r] = false;
+                rings[r]->Stop();
+                numActive--;
+                for (std::size_t f=firstFd[r]; f<firstFd[r]+numFds[r]; f++)
+                  {
+                    fds[f].fd = -1;
+                  }
+              }
+            isAlwaysReady = isAlwaysReady || (isActive[r] && (numFds[r]==0));
+          }
+
+        // Wake at least every 10ms to check for a stop request
+        const int err = poll(fds.data(), fds.size(), isAlwaysReady ? 0 : 10);
+        if ((err < 0) && (errno != EINTR))
+          {
+            std::cerr << "capture poll failed: "
+                      << std::strerror(errno) << std::endl;
+            break;
+          }
+        for (std::size_t r=0; r<numRings; r++)
+          {
+            isReady[r] = (numFds[r] == 0) ||
+              ((err > 0) && isActive[r] &&
+               rings[r]->Source().PollReady(fds.data()+firstFd[r], numFds[r]));
+          }
+      }
+
+    for (std::size_t r=0; r<numRings; r++)
+      {
+        rings[r]->Stop();
+      }
+  }
+
+  saInputSource* saInputSourceOpenCapture(saInputSource* source,
+                                          const std::size_t ringFragments,
+                                          const int realTimePriority)
+  {
+    return new saInputCapture(source, ringFragments, realTimePriority);
+  }
+
+  saInputPoll* saInputPollCreate(const int realTimePriority)
+  {
+    return new saInputPollImpl(realTimePriority);
+  }
+}
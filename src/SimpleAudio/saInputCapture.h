@@ -0,0 +1,77 @@
+/// \file saInputCapture.h
+/// \brief Capture saInputSources on dedicated threads
+///
+/// The capture source runs the Collect function of another source, usually
+/// an audio device, on a dedicated thread and copies the frames into a
+/// lock-free single-producer, single-consumer ring. Collect and Release
+/// are served from the ring, so the capture thread never waits for the
+/// reader. The capture thread never waits for space in the ring either:
+/// if the ring is full the frames that do not fit are dropped and OverRun
+/// is set. The capture thread can be given SCHED_FIFO real-time priority,
+/// in which case the process memory is also locked with mlockall so that
+/// capture does not page fault.
+///
+/// An saInputPoll captures many sources on one thread. Each source is made
+/// non-blocking and has its own ring. The thread polls the descriptors of
+/// all the sources and collects a fragment from each source that is ready,
+/// so one thread can serve many devices.
+
+#include <cstddef>
+
+#include "saInputSource.h"
+
+#ifndef __SAINPUTCAPTURE_H__
+#define __SAINPUTCAPTURE_H__
+
+namespace SimpleAudio
+{
+  /// \brief Open a capture source
+  /// \param source the source to capture. The capture source takes
+  /// ownership of the source.
+  /// \param ringFragments capacity of the ring in fragments of the source
+  /// \param realTimePriority if non-zero, the SCHED_FIFO priority of the
+  /// capture thread. If the priority or the memory lock is not permitted a
+  /// warning is written to std::cerr and capture continues.
+  /// \return A pointer to an saInputSource to read from
+  saInputSource* saInputSourceOpenCapture(saInputSource* source,
+                                          const std::size_t ringFragments,
+                                          const int realTimePriority=0);
+
+  /// \class saInputPoll
+  /// \brief Capture many sources on one polling thread
+  class saInputPoll
+  {
+  public:
+    virtual ~saInputPoll() throw() {}
+
+    /// \brief Add a source to be captured by the polling thread. Sources
+    ///        must be added before Start. The source is made non-blocking.
+    ///        A source that would still wait in Collect, and so stall the
+    ///        other sources, is rejected with an exception.
+    /// \param source the source to capture. The polling thread takes
+    /// ownership of the source, and deletes it if it is rejected.
+    /// \param ringFragments capacity of the ring in fragments of the source
+    /// \return A pointer to an saInputSource reading the ring
+    virtual saInputSource* Add(saInputSource* source,
+                               const std::size_t ringFragments) = 0;
+
+    /// \brief Start the polling thread. The thread stops when every source
+    ///        has ended or the saInputPoll is destroyed.
+    virtual void Start() = 0;
+
+  protected:
+    saInputPoll() {}
+
+  private:
+    saInputPoll(const saInputPoll&);
+    saInputPoll& operator=(const saInputPoll&);
+  };
+
+  /// \brief Create a polling thread
+  /// \param realTimePriority if non-zero, the SCHED_FIFO priority of the
+  /// polling thread
+  /// \return A pointer to an saInputPoll
+  saInputPoll* saInputPollCreate(const int realTimePriority=0);
+}
+
+#endif
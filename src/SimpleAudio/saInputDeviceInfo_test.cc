@@ -15,6 +15,7 @@ main(void)
   saDeviceInfo deviceInfo;
   try
     {
+      deviceInfo.queryInputDevicesAsync();
       deviceInfo.queryInputDevices();
     }
   catch(std::exception& excp)
@@ -48,6 +49,19 @@ main(void)
           std::cerr << *rate << " " ;
         }
       std::cerr << std::endl ;
+      std::size_t minChannels = 0;
+      std::size_t maxChannels = 0;
+      deviceInfo.getDeviceChannels(*name, minChannels, maxChannels);
+      std::cerr << "Channels: " << minChannels << " to " << maxChannels
+                << std::endl ;
+      saDeviceInfoSampleFormatList sampleFormatList;
+      deviceInfo.getDeviceSampleFormatList(*name, sampleFormatList);
+      std::cerr << "Sample formats: " ;
+      for (const saSampleFormat format : sampleFormatList)
+        {
+          std::cerr << saSampleFormatName(format) << " " ;
+        }
+      std::cerr << std::endl ;
     }
 
   return 0;
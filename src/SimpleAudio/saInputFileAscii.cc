@@ -121,6 +121,10 @@ namespace SimpleAudio
     std::size_t GetMsDeviceLatency() const 
     { return (1000*framesPerFragment)/framesPerSecond; }
 
+    /// \brief A file never waits in Collect
+    /// \return true
+    bool SetNonBlocking( ) { return true; }
+
   private:
 
     /// Source device name
@@ -1,5 +1,11 @@
 /// \file saInputFileWav.cc
 /// \brief WAV file input
+///
+/// The Format and Data chunks are found by walking the chunks of the file.
+/// 16, 24 and 32 bit PCM and 32 and 64 bit IEEE float samples, in plain or
+/// extensible Format chunks, are passed on in their own sample format, so
+/// they are converted to saSample directly by the vectorised
+/// saSampleArrayFromSource.
 
 #include <iostream>
 #include <fstream>
@@ -11,16 +17,22 @@
 
 #include <cstring>
 #include <cstdint>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "saWavHeader.h"
 #include "saInputSource.h"
+#include "saInputFileWav.h"
 
 namespace SimpleAudio
 {
   class saInputFileWav : public saInputSource
   {
   public:
-    saInputFileWav(const std::string& FileName, saWavHeader * const wavHeader);
+    saInputFileWav(const std::string& FileName, const saWavFormat& wavFormat);
 
     ~saInputFileWav() throw();
 
@@ -43,7 +55,14 @@ namespace SimpleAudio
     /// \brief Check a simple audio input file for end-of-data
     ///  (Only makes sense for files).
     /// \return end of source occurred
-    bool EndOfSource() { return inputFile.eof(); }
+    bool EndOfSource()
+    { return (dataBytesLeft < bytesPerSample*samplesPerFrame) ||
+        inputFile.eof(); }
+
+    /// \brief Move to a frame of the data chunk
+    /// \param frame frame number
+    /// \return true
+    bool Seek(const std::size_t frame);
 
     /// \brief Get device frame rate
     /// \return frames per second
@@ -70,6 +89,14 @@ namespace SimpleAudio
     std::size_t GetMsDeviceLatency() const 
     { return (1000*framesPerFragment)/framesPerSecond; }
 
+    /// \brief Get the format of the samples in a fragment
+    /// \return sample format of the file
+    saSampleFormat GetSampleFormat() const { return sampleFormat; }
+
+    /// \brief A file never waits in Collect
+    /// \return true
+    bool SetNonBlocking( ) { return true; }
+
   private:
     /// Source device name
     std::string sourceName;
@@ -77,6 +104,9 @@ namespace SimpleAudio
     /// Input file stream
     std::ifstream inputFile;
 
+    /// Sample format
+    saSampleFormat sampleFormat;
+
     /// Frames per second
     std::size_t framesPerSecond;
     
@@ -104,30 +134,43 @@ namespace SimpleAudio
     /// Frames read from source 
     std::size_t framesReadFromSource;
 
-    /// Array of samples 
-    std::vector< saInputSource::saSourceType > sourceBuffer;
+    /// Offset of the data chunk in the file
+    std::size_t dataOffset;
+
+    /// Bytes in the data chunk
+    std::size_t dataBytes;
+
+    /// Bytes of the data chunk not yet read
+    std::size_t dataBytesLeft;
+
+    /// Array of samples, aligned for any sample format
+    std::vector<double> sourceBuffer;
   };
 
   saInputFileWav::saInputFileWav(const std::string& fileName,
-                                 saWavHeader * const wavHeader)
+                                 const saWavFormat& wavFormat)
     : sourceName( fileName.begin(), fileName.end() ), 
       inputFile(sourceName.c_str(), std::ios::binary),
-      framesPerSecond( wavHeader->FormatSamplesPerSec ),
-      bytesPerSample( wavHeader->FormatBitsPerSample/8 ),
-      samplesPerFrame( wavHeader->FormatChannels ),
+      sampleFormat( saWavSampleFormat(wavFormat) ),
+      framesPerSecond( wavFormat.FormatSamplesPerSec ),
+      bytesPerSample( saSampleFormatBytes(sampleFormat) ),
+      samplesPerFrame( wavFormat.FormatChannels ),
       framesPerFragment( 16384 ), // Arbitrary size!
       samplesPerFragment( samplesPerFrame*framesPerFragment ),
       bytesPerFragment( bytesPerSample*samplesPerFragment ),
-      framesPerSource( static_cast<std::size_t>(wavHeader->DataChunkSize) /
+      framesPerSource( wavFormat.DataChunkSize /
                        (bytesPerSample*samplesPerFrame) ),
       framesReadFromSource( 0 ),
-      sourceBuffer( samplesPerFragment, 0 )
+      dataOffset( wavFormat.DataOffset ),
+      dataBytes( wavFormat.DataChunkSize ),
+      dataBytesLeft( dataBytes ),
+      sourceBuffer( (bytesPerFragment+sizeof(double)-1)/sizeof(double), 0 )
   {
-    // Read the header
-    inputFile.read((char *)wavHeader, sizeof(saWavHeader));
+    // Skip to the samples
+    inputFile.seekg(static_cast<std::streamoff>(dataOffset));
     if ( !inputFile.good() ) 
       {
-        throw std::runtime_error(" failed read wav header from source file");
+        throw std::runtime_error(" failed seek to wav data in source file");
       }
   }
 
@@ -140,9 +183,10 @@ namespace SimpleAudio
   saInputSource::saInputFragment 
   saInputFileWav::Collect(std::size_t& framesRead)
   { 
-    // Read
+    // Read no further than the data chunk
     char* buf = reinterpret_cast<char*>(&(sourceBuffer[0]));
-    inputFile.read(buf, static_cast<long>(bytesPerFragment));
+    inputFile.read(buf, static_cast<long>(std::min(bytesPerFragment,
+                                                   dataBytesLeft)));
     if ( !inputFile.good() && !inputFile.eof() ) 
       {
         throw std::runtime_error("read from file failed");
@@ -151,17 +195,27 @@ namespace SimpleAudio
     // Zero out bytes in fragment not filled
     std::size_t bytesRead = static_cast<std::size_t>(inputFile.gcount());
     std::size_t samplesRead = bytesRead/static_cast<std::size_t>(bytesPerSample);
-    if ( samplesRead < samplesPerFragment )
+    dataBytesLeft -= bytesRead;
+    if ( bytesRead < bytesPerFragment )
       {
-        memset(&(sourceBuffer[samplesRead]), 0, bytesPerFragment-bytesRead);
+        memset(buf+bytesRead, 0, bytesPerFragment-bytesRead);
       }
   
-    // Swap bytes for big-endian
+    // Swap bytes for big-endian. Packed 24 bit samples stay little-endian.
     if ( !saIsLittleEndian() )
       {
-        std::for_each(sourceBuffer.begin(), 
-                      sourceBuffer.begin()+static_cast<long>(samplesRead), 
-                      saSwapSample<saInputSource::saSourceType>());
+        if ( sampleFormat == saSampleFormat::S16 )
+          {
+            saSwapShort(reinterpret_cast<int16_t*>(buf), samplesRead);
+          }
+        else if ( sampleFormat != saSampleFormat::S24_3LE )
+          {
+            for (std::size_t k=0; k<samplesRead; k++)
+              {
+                std::reverse(buf+(k*bytesPerSample),
+                             buf+((k+1)*bytesPerSample));
+              }
+          }
       }
 
     // Set frames read
@@ -169,10 +223,213 @@ namespace SimpleAudio
     framesReadFromSource += framesRead;
 
     // Done
-    return &(sourceBuffer[0]);
+    return reinterpret_cast<saInputFragment>(buf);
   }
 
-  saInputSource* saInputSourceOpenFileWav(const std::string& fileName)
+  bool saInputFileWav::Seek(const std::size_t frame)
+  {
+    const std::size_t bytesPerFrame = bytesPerSample*samplesPerFrame;
+    framesReadFromSource = std::min(frame, framesPerSource);
+    dataBytesLeft = dataBytes - framesReadFromSource*bytesPerFrame;
+    inputFile.clear();
+    inputFile.seekg(static_cast<std::streamoff>
+                    (dataOffset + framesReadFromSource*bytesPerFrame));
+    if ( !inputFile.good() ) 
+      {
+        throw std::runtime_error("seek in file failed");
+      }
+    return true;
+  }
+
+  /// \class saInputFileWavMmap
+  /// \brief WAV file input from a read-only mapping of the file. Fragments
+  /// point into the mapped data chunk, so no frames are read or copied.
+  class saInputFileWavMmap : public saInputSource
+  {
+  public:
+    saInputFileWavMmap(const std::string& FileName,
+                       const saWavFormat& wavFormat,
+                       const int fd,
+                       const std::size_t fileBytes);
+
+    ~saInputFileWavMmap() throw();
+
+    /// \brief Point a fragment at the next frames of the mapping
+    /// \param validFrames number of valid frames in the fragment
+    /// \return saFragment
+    saInputFragment Collect(std::size_t& validFrames);
+
+    /// \brief Release fragment storage
+    /// \param fragment
+    void Release([[maybe_unused]] saInputFragment fragment) { }
+
+    /// \brief Clear the source
+    void Clear( ) {};
+
+    /// \brief Check for source over-runs
+    /// \return source over run occurred
+    bool OverRun( ) { return false; }
+
+    /// \brief Check a simple audio input file for end-of-data
+    /// \return end of source occurred
+    bool EndOfSource() { return framesReadFromSource >= framesPerSource; }
+
+    /// \brief Move to a frame of the mapping
+    /// \param frame frame number
+    /// \return true
+    bool Seek(const std::size_t frame)
+    {
+      framesReadFromSource = std::min(frame, framesPerSource);
+      adviseOffset = 0;
+      return true;
+    }
+
+    /// \brief Get device frame rate
+    /// \return frames per second
+    std::size_t GetFramesPerSecond() const { return framesPerSecond; }
+
+    /// \brief Get samples per frame
+    ///\return samples per frame
+    std::size_t GetSamplesPerFrame() const { return samplesPerFrame; }
+
+    /// \brief Get device frames per fragment
+    /// \return frames per fragment
+    std::size_t GetFramesPerFragment() const { return framesPerFragment; }
+
+    /// \brief Get device frames per source
+    /// \return frames per source
+    std::size_t GetFramesPerSource() const { return framesPerSource; }
+
+    /// \brief Get device frames read from source
+    /// \return frames read from source
+    std::size_t GetFramesReadFromSource() const { return framesReadFromSource; }
+
+    /// \brief Get device latency in milliseconds
+    /// \return device latency
+    std::size_t GetMsDeviceLatency() const
+    { return (1000*framesPerFragment)/framesPerSecond; }
+
+    /// \brief Get the format of the samples in a fragment
+    /// \return sample format of the file
+    saSampleFormat GetSampleFormat() const { return sampleFormat; }
+
+    /// \brief A file never waits in Collect
+    /// \return true
+    bool SetNonBlocking( ) { return true; }
+
+  private:
+    /// Bytes advised to be read ahead of the fragment collected
+    static const std::size_t readAheadBytes = 64*1024*1024;
+
+    /// Source device name
+    std::string sourceName;
+
+    /// Sample format
+    saSampleFormat sampleFormat;
+
+    /// Frames per second
+    std::size_t framesPerSecond;
+
+    /// Samples per frame
+    std::size_t samplesPerFrame;
+
+    /// Bytes per frame
+    std::size_t bytesPerFrame;
+
+    /// Frames per fragment
+    std::size_t framesPerFragment;
+
+    /// Frames per source
+    std::size_t framesPerSource;
+
+    /// Frames read from source
+    std::size_t framesReadFromSource;
+
+    /// Mapping of the whole file
+    uint8_t* mapping;
+
+    /// Bytes mapped
+    std::size_t mappingBytes;
+
+    /// Offset of the data chunk in the mapping
+    std::size_t dataOffset;
+
+    /// End of the bytes advised to be read ahead
+    std::size_t adviseOffset;
+  };
+
+  saInputFileWavMmap::saInputFileWavMmap(const std::string& fileName,
+                                         const saWavFormat& wavFormat,
+                                         const int fd,
+                                         const std::size_t fileBytes)
+    : sourceName( fileName ),
+      sampleFormat( saWavSampleFormat(wavFormat) ),
+      framesPerSecond( wavFormat.FormatSamplesPerSec ),
+      samplesPerFrame( wavFormat.FormatChannels ),
+      bytesPerFrame( samplesPerFrame*saSampleFormatBytes(sampleFormat) ),
+      framesPerFragment( 16384 ),
+      framesPerSource( 0 ),
+      framesReadFromSource( 0 ),
+      mapping( 0 ),
+      mappingBytes( fileBytes ),
+      dataOffset( wavFormat.DataOffset ),
+      adviseOffset( 0 )
+  {
+    // A data chunk longer than the file was truncated
+    const std::size_t dataBytes =
+      std::min(wavFormat.DataChunkSize, mappingBytes - dataOffset);
+    framesPerSource = dataBytes/bytesPerFrame;
+
+    void* const addr = mmap(0, mappingBytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED)
+      {
+        throw std::runtime_error(std::string("can't map source file: ") +
+                                 std::strerror(errno));
+      }
+    mapping = static_cast<uint8_t*>(addr);
+
+    // The frames are read once, in order. Errors only lose the hint.
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    madvise(mapping, mappingBytes, MADV_SEQUENTIAL);
+  }
+
+  saInputFileWavMmap::~saInputFileWavMmap( ) throw()
+  {
+    munmap(mapping, mappingBytes);
+  }
+
+  saInputSource::saInputFragment
+  saInputFileWavMmap::Collect(std::size_t& framesRead)
+  {
+    const std::size_t offset =
+      dataOffset + framesReadFromSource*bytesPerFrame;
+    framesRead =
+      std::min(framesPerFragment, framesPerSource - framesReadFromSource);
+    framesReadFromSource += framesRead;
+
+    // Keep the kernel reading well ahead of the fragment, a window at a
+    // time so that the hint is not given for every fragment
+    if (offset + readAheadBytes/2 > adviseOffset)
+      {
+        const std::size_t pageBytes =
+          static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        const std::size_t first =
+          std::max(adviseOffset, (offset/pageBytes)*pageBytes);
+        adviseOffset = std::min(offset + readAheadBytes, mappingBytes);
+        if (adviseOffset > first)
+          {
+            madvise(mapping + first, adviseOffset - first, MADV_WILLNEED);
+          }
+      }
+
+    return reinterpret_cast<saInputFragment>(mapping + offset);
+  }
+
+  /// Read and check the chunks of a WAV file
+  /// \param fileName file name
+  /// \param wavFormat Format chunk and position of the samples
+  static void saInputFileWavReadFormat(const std::string& fileName,
+                                       saWavFormat& wavFormat)
   {
     // Open the input file
     std::string name(fileName.begin(), fileName.end());
@@ -182,60 +439,75 @@ namespace SimpleAudio
         throw std::runtime_error("can't open source file");
       }
 
-    // Read the header
-    saWavHeader wavHeader;
-    inputFile.read((char*)&wavHeader, sizeof(saWavHeader));
-    if ( !inputFile.good() ) 
-      {
-        throw std::runtime_error(" failed read wav header from source file");
-      }
-    if ( !saIsLittleEndian() )
-      {
-        saSwapWavHeader(&wavHeader);
-      }
+    // Find the Format and Data chunks
+    saWavReadFormat(inputFile, wavFormat);
 
     // Close the file
     inputFile.close();
 
-    // Sanity check on IDs
-    if ( ! (saCompareID(wavHeader.RiffChunkID, "RIFF") &&
-            saCompareID(wavHeader.RiffFormat, "WAVE") &&
-            saCompareID(wavHeader.FormatChunkID, "fmt ") &&
-            saCompareID(wavHeader.DataChunkID, "data")))
-      {
-        throw std::runtime_error("id failed in source file");
-      }
-    
     // Sanity check on content
-    if (wavHeader.FormatTag != 1)
-      {
-        throw std::runtime_error("compression not supported");
-      }
+    const saSampleFormat sampleFormat = saWavSampleFormat(wavFormat);
 
     // Sanity check
-    if ((wavHeader.FormatChannels*wavHeader.FormatBitsPerSample/8) >= 
-        wavHeader.DataChunkSize/2)
+    if ((wavFormat.FormatChannels*saSampleFormatBytes(sampleFormat)) >= 
+        wavFormat.DataChunkSize/2)
       {
         std::cerr << "Sanity check: Did you expect "
-                  << wavHeader.FormatChannels 
+                  << wavFormat.FormatChannels 
                   << " channels per frame?" 
                   << std::endl;
       }
+  }
 
-    // Select source type
-    switch (wavHeader.FormatBitsPerSample)
-      {
-      case 16:
-        return new saInputFileWav(fileName, &wavHeader);
-        break;
+  saInputSource* saInputSourceOpenFileWav(const std::string& fileName)
+  {
+    saWavFormat wavFormat;
+    saInputFileWavReadFormat(fileName, wavFormat);
+    return new saInputFileWav(fileName, wavFormat);
+  }
 
-      default:
-        throw std::runtime_error("source bits per sample not supported");
-        break;
+  saInputSource* saInputSourceOpenFileWavMmap(const std::string& fileName)
+  {
+    saWavFormat wavFormat;
+    saInputFileWavReadFormat(fileName, wavFormat);
+
+    // Samples in the mapping are used in place, so they must be in host
+    // byte order and aligned for their type. Packed 24 bit samples need
+    // no alignment. Other files, and files that can't be mapped such as
+    // pipes, are read.
+    const saSampleFormat sampleFormat = saWavSampleFormat(wavFormat);
+    const std::size_t sampleAlign = (sampleFormat == saSampleFormat::S24_3LE)
+      ? 1 : saSampleFormatBytes(sampleFormat);
+    if ( !saIsLittleEndian() || ((wavFormat.DataOffset % sampleAlign) != 0) )
+      {
+        return saInputSourceOpenFileWav(fileName);
+      }
+    const int fd = open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+      {
+        throw std::runtime_error("can't open source file");
+      }
+    struct stat fileStat;
+    if ((fstat(fd, &fileStat) < 0) || !S_ISREG(fileStat.st_mode) ||
+        (static_cast<std::size_t>(fileStat.st_size) <= wavFormat.DataOffset))
+      {
+        close(fd);
+        return saInputSourceOpenFileWav(fileName);
       }
 
-    // Done
-    return 0;
+    // The mapping holds the file open
+    try
+      {
+        saInputSource* const source = new saInputFileWavMmap
+          (fileName, wavFormat, fd, static_cast<std::size_t>(fileStat.st_size));
+        close(fd);
+        return source;
+      }
+    catch(...)
+      {
+        close(fd);
+        throw;
+      }
   }
 
 }
@@ -12,6 +12,14 @@ namespace SimpleAudio
   /// \param fileName file name
   /// \return A pointer to an saInputSource to read from
   saInputSource* saInputSourceOpenFileWav(const std::string& fileName);
+
+  /// \brief Open input WAV file mapped into memory. Fragments point into
+  /// the mapped data chunk, and the kernel is advised to read the file
+  /// sequentially and well ahead, so long files are read without copies.
+  /// Files that can't be mapped are read with saInputSourceOpenFileWav.
+  /// \param fileName file name
+  /// \return A pointer to an saInputSource to read from
+  saInputSource* saInputSourceOpenFileWavMmap(const std::string& fileName);
 }
 
 #endif
@@ -0,0 +1,377 @@
+/// \file saInputReadAhead.cc
+/// \brief Background read-ahead of an saInputSource
+
+#include <memory>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <semaphore>
+#include <exception>
+#include <stdexcept>
+#include <algorithm>
+#include <cstdint>
+
+#include "saInputSource.h"
+#include "saInputReadAhead.h"
+
+namespace SimpleAudio
+{
+  class saInputReadAhead : public saInputSource
+  {
+  public:
+    /// \brief Create a read-ahead source and start the background thread
+    /// \param source the source to read ahead
+    /// \param depth number of fragments in the pool
+    saInputReadAhead(saInputSource* source, const std::size_t depth);
+
+    /// \brief Stop the background thread
+    ~saInputReadAhead() throw();
+
+    /// \brief Collect the next fragment read ahead
+    ///
+    /// Waits if the background thread has not yet read the fragment. An
+    /// empty fragment is returned after the last fragment of the source.
+    /// \param validFrames number of valid frames in the fragment
+    /// \return saInputFragment
+    saInputFragment Collect(std::size_t& validFrames);
+
+    /// \brief Return a fragment to the pool
+    /// \param fragment
+    void Release(const saInputFragment fragment);
+
+    /// \brief Clear the source
+    ///
+    /// Any fragment held by the reader is returned to the pool and the
+    /// fragments read ahead before the Clear are dropped by the next
+    /// Collect. The source is cleared by the background thread before its
+    /// next Collect.
+    void Clear( );
+
+    /// \brief Check for source over-runs
+    /// \return source over run occurred
+    bool OverRun( ) { return isOverRun.load(std::memory_order_acquire); }
+
+    /// \brief Check for the end of the source
+    /// \return the source has ended and all fragments have been collected
+    bool EndOfSource();
+
+    /// \brief Get device frame rate
+    /// \return frames per second
+    std::size_t GetFramesPerSecond() const { return framesPerSecond; }
+
+    /// \brief Get samples per frame
+    /// \return samples per frame
+    std::size_t GetSamplesPerFrame() const { return samplesPerFrame; }
+
+    /// \brief Get the sample format of the source read ahead
+    /// \return sample format
+    saSampleFormat GetSampleFormat() const { return sampleFormat; }
+
+    /// \brief Get device frames per fragment
+    /// \return frames per fragment
+    std::size_t GetFramesPerFragment() const { return framesPerFragment; }
+
+    /// \brief Get device frames per source
+    /// \return frames per source
+    std::size_t GetFramesPerSource() const { return framesPerSource; }
+
+    /// \brief Get frames collected from the read-ahead source
+    /// \return frames read from source
+    std::size_t GetFramesReadFromSource() const { return framesCollected; }
+
+    /// \brief Get device latency in milliseconds
+    /// \return device latency
+    std::size_t GetMsDeviceLatency() const { return msDeviceLatency; }
+
+    /// \brief Get the number of times Collect waited for a fragment
+    /// \return number of stalls
+    std::size_t GetStalls() const { return stalls; }
+
+    /// \brief Get the capture time of the newest frame of the fragment
+    ///        collected, taken when the background thread read it
+    /// \return timestamp of the newest frame
+    saTimestamp GetTimestamp() const { return timestamp; }
+
+    /// \brief Get the period size of the source read ahead
+    /// \return frames per period
+    std::size_t GetFramesPerPeriod() const
+    { return inputSource->GetFramesPerPeriod(); }
+
+    /// \brief Get the number of periods of the source read ahead
+    /// \return periods per buffer
+    std::size_t GetPeriodsPerBuffer() const
+    { return inputSource->GetPeriodsPerBuffer(); }
+
+    /// \brief Get the buffer size of the source read ahead
+    /// \return frames per buffer
+    std::size_t GetFramesPerBuffer() const
+    { return inputSource->GetFramesPerBuffer(); }
+
+  private:
+    /// Background thread. Collect fragments from the source into the pool
+    /// until the end of the source or the destructor is called.
+    void ReadAhead();
+
+    /// Source read by the background thread
+    std::unique_ptr<saInputSource> inputSource;
+
+    /// Number of fragments in the pool
+    std::size_t depth;
+
+    // Properties of the source
+    std::size_t framesPerSecond;
+    std::size_t samplesPerFrame;
+    saSampleFormat sampleFormat;
+    std::size_t bytesPerFrame;
+    std::size_t framesPerFragment;
+    std::size_t framesPerSource;
+    std::size_t msDeviceLatency;
+
+    /// Pool of fragments holding the bytes of the samples of the source.
+    /// Fragment k%depth is the k-th fragment read.
+    std::vector< std::vector< uint8_t > > pool;
+
+    /// Valid frames in each fragment of the pool
+    std::vector< std::size_t > poolFrames;
+
+    /// Capture time of the newest frame of each fragment of the pool
+    std::vector< saTimestamp > poolTimestamps;
+
+    /// Number of Clears before each fragment of the pool was read
+    std::vector< std::size_t > poolClears;
+
+    /// Capture time of the newest frame of the fragment collected
+    saTimestamp timestamp;
+
+    /// Number of fragments read by the background thread. The tail of the
+    /// queue, written only by the background thread.
+    std::atomic<std::size_t> fragmentsRead;
+
+    /// Number of fragments collected. The head of the queue, written only
+    /// by the reader.
+    std::size_t fragmentsCollected;
+
+    /// The reader holds fragment fragmentsCollected-1
+    bool isHeld;
+
+    /// Free fragments in the pool
+    std::counting_semaphore<> freeFragments;
+
+    /// Fragments read ahead and not yet collected. Also released once at
+    /// the end of the source.
+    std::counting_semaphore<> readFragments;
+
+    /// The background thread has read the last fragment
+    std::atomic<bool> isEndOfSource;
+
+    /// Source over-run flag copied by the background thread
+    std::atomic<bool> isOverRun;
+
+    /// Number of Clears requested, written only by the reader. The source
+    /// is cleared before the next read when this changes.
+    std::atomic<std::size_t> clears;
+
+    /// Stop the background thread
+    std::atomic<bool> isStopRequested;
+
+    /// Exception thrown by the background thread
+    std::exception_ptr readError;
+
+    /// Frames collected by the reader
+    std::size_t framesCollected;
+
+    /// Number of times Collect waited for a fragment
+    std::size_t stalls;
+
+    /// Empty fragment returned at the end of the source
+    saSourceType emptyFragment;
+
+    /// Background thread
+    std::thread readThread;
+  };
+
+  saInputReadAhead::saInputReadAhead(saInputSource* source,
+                                     const std::size_t _depth)
+    : inputSource( source ),
+      depth( _depth ),
+      framesPerSecond( inputSource->GetFramesPerSecond() ),
+      samplesPerFrame( inputSource->GetSamplesPerFrame() ),
+      sampleFormat( inputSource->GetSampleFormat() ),
+      bytesPerFrame( inputSource->GetBytesPerFrame() ),
+      framesPerFragment( inputSource->GetFramesPerFragment() ),
+      framesPerSource( inputSource->GetFramesPerSource() ),
+      msDeviceLatency( inputSource->GetMsDeviceLatency() ),
+      pool( depth, std::vector< uint8_t >
+            (bytesPerFrame*framesPerFragment, 0) ),
+      poolFrames( depth, 0 ),
+      poolTimestamps( depth ),
+      poolClears( depth, 0 ),
+      timestamp( saTimestampNow() ),
+      fragmentsRead( 0 ),
+      fragmentsCollected( 0 ),
+      isHeld( false ),
+      freeFragments( static_cast<std::ptrdiff_t>(depth) ),
+      readFragments( 0 ),
+      isEndOfSource( false ),
+      isOverRun( false ),
+      clears( 0 ),
+      isStopRequested( false ),
+      framesCollected( 0 ),
+      stalls( 0 ),
+      emptyFragment( 0 )
+  {
+    if (depth == 0)
+      {
+        throw std::runtime_error("Illegal read-ahead depth");
+      }
+    readThread = std::thread(&saInputReadAhead::ReadAhead, this);
+  }
+
+  saInputReadAhead::~saInputReadAhead( ) throw()
+  {
+    // Wake the background thread if it is waiting for a free fragment
+    isStopRequested.store(true, std::memory_order_release);
+    freeFragments.release();
+    readThread.join();
+  }
+
+  void saInputReadAhead::ReadAhead()
+  {
+    try
+      {
+        std::size_t k = 0;
+        std::size_t sourceClears = 0;
+        while (true)
+          {
+            freeFragments.acquire();
+            if (isStopRequested.load(std::memory_order_acquire))
+              {
+                return;
+              }
+            const std::size_t clearsNow = clears.load(std::memory_order_acquire);
+            if (clearsNow != sourceClears)
+              {
+                inputSource->Clear();
+                sourceClears = clearsNow;
+              }
+
+            // A source with no frames has ended
+            std::size_t validFrames = 0;
+            const saInputFragment fragment = inputSource->Collect(validFrames);
+            if (validFrames > 0)
+              {
+                const uint8_t* const bytes =
+                  reinterpret_cast<const uint8_t*>(fragment);
+                std::copy(bytes, bytes+(bytesPerFrame*validFrames),
+                          pool[k%depth].begin());
+                poolFrames[k%depth] = validFrames;
+                poolTimestamps[k%depth] = inputSource->GetTimestamp();
+                poolClears[k%depth] = sourceClears;
+                k++;
+              }
+            inputSource->Release(fragment);
+            isOverRun.store(inputSource->OverRun(), std::memory_order_release);
+            const bool endOfSource =
+              inputSource->EndOfSource() || (validFrames == 0);
+            if (validFrames > 0)
+              {
+                fragmentsRead.store(k, std::memory_order_release);
+                readFragments.release();
+              }
+            else
+              {
+                freeFragments.release();
+              }
+            if (endOfSource)
+              {
+                break;
+              }
+          }
+      }
+    catch(...)
+      {
+        readError = std::current_exception();
+      }
+
+    // Wake the reader
+    isEndOfSource.store(true, std::memory_order_release);
+    readFragments.release();
+  }
+
+  saInputSource::saInputFragment
+  saInputReadAhead::Collect(std::size_t& validFrames)
+  {
+    // Return any fragment still held
+    Release(0);
+
+    // Wait for the next fragment. Drop fragments read before the last Clear.
+    const std::size_t clearsNow = clears.load(std::memory_order_relaxed);
+    std::size_t k = 0;
+    bool isCleared = true;
+    do
+      {
+        if (!readFragments.try_acquire())
+          {
+            stalls++;
+            readFragments.acquire();
+          }
+
+        // The end of the source. Keep the semaphore released for later calls.
+        if (fragmentsCollected == fragmentsRead.load(std::memory_order_acquire))
+          {
+            readFragments.release();
+            if (readError)
+              {
+                std::rethrow_exception(readError);
+              }
+            validFrames = 0;
+            return &emptyFragment;
+          }
+
+        k = fragmentsCollected%depth;
+        fragmentsCollected++;
+        isCleared = (poolClears[k] != clearsNow);
+        if (isCleared)
+          {
+            freeFragments.release();
+          }
+      }
+    while (isCleared);
+
+    // Hand over the next fragment
+    isHeld = true;
+    validFrames = poolFrames[k];
+    timestamp = poolTimestamps[k];
+    framesCollected += validFrames;
+    return reinterpret_cast<saInputFragment>(pool[k].data());
+  }
+
+  void saInputReadAhead::Release([[maybe_unused]] const saInputFragment fragment)
+  {
+    if (isHeld)
+      {
+        isHeld = false;
+        freeFragments.release();
+      }
+  }
+
+  void saInputReadAhead::Clear( )
+  {
+    // Count the Clear before the background thread can read into the
+    // fragment returned to the pool
+    clears.fetch_add(1, std::memory_order_release);
+    Release(0);
+  }
+
+  bool saInputReadAhead::EndOfSource()
+  {
+    return isEndOfSource.load(std::memory_order_acquire) &&
+      (fragmentsCollected == fragmentsRead.load(std::memory_order_acquire));
+  }
+
+  saInputSource* saInputSourceOpenReadAhead(saInputSource* source,
+                                            const std::size_t depth)
+  {
+    return new saInputReadAhead(source, depth);
+  }
+}
@@ -0,0 +1,28 @@
+/// \file saInputReadAhead.h
+/// \brief Background read-ahead of an saInputSource
+///
+/// The read-ahead source runs the Collect function of another source on a
+/// background thread. Fragments are copied into a pool of depth fragments
+/// and handed to the reader through a lock-free queue, so a reader that
+/// keeps up never waits for file I/O. The reader waits only when the pool
+/// is empty. These waits are counted by GetStalls().
+
+#include <cstddef>
+
+#include "saInputSource.h"
+
+#ifndef __SAINPUTREADAHEAD_H__
+#define __SAINPUTREADAHEAD_H__
+
+namespace SimpleAudio
+{
+  /// \brief Open a read-ahead source
+  /// \param source the source to read ahead. The read-ahead source takes
+  /// ownership of the source.
+  /// \param depth number of fragments in the pool
+  /// \return A pointer to an saInputSource to read from
+  saInputSource* saInputSourceOpenReadAhead(saInputSource* source,
+                                            const std::size_t depth);
+}
+
+#endif
@@ -2,8 +2,11 @@
 /// \brief Abstract base class for a simple audio input. 
 
 #include <cstdint>
+#include <vector>
+#include <poll.h>
 
 #include "saDeviceType.h"
+#include "saTimestamp.h"
 
 #ifndef __SAINPUTSOURCE_H__
 #define __SAINPUTSOURCE_H__
@@ -20,7 +23,9 @@ namespace SimpleAudio
     /// The basic type of the input source
     typedef saDeviceType saSourceType;
 
-    /// Pointer to an array of values from the input source.
+    /// Pointer to an array of values from the input source. The values
+    /// are samples of GetSampleFormat. For formats other than S16 the
+    /// pointer addresses the bytes of the samples.
     typedef saSourceType* saInputFragment;
 
     saInputSource() { } ;
@@ -76,6 +81,69 @@ namespace SimpleAudio
     /// \return device latency
     virtual std::size_t GetMsDeviceLatency() const = 0;
 
+    /// \brief Get the format of the samples in a fragment
+    /// \return sample format
+    virtual saSampleFormat GetSampleFormat() const
+    { return saSampleFormat::S16; }
+
+    /// \brief Get the capture time of the newest frame of the last
+    ///        collected fragment. Sources without a capture clock, such as
+    ///        files, return the current time, so a reader that calls this
+    ///        just after Collect gets the time the fragment was collected.
+    /// \return timestamp of the newest frame
+    virtual saTimestamp GetTimestamp() const { return saTimestampNow(); }
+
+    /// \brief Move to a frame of the source, so that the next fragment
+    ///        collected starts there. Only files can seek.
+    /// \param frame frame number from the start of the source. Frames
+    ///        past the end leave the source at its end.
+    /// \return the source moved. Sources that can't seek are not moved.
+    virtual bool Seek([[maybe_unused]] const std::size_t frame)
+    { return false; }
+
+    /// \brief Get the bytes in a frame of a fragment
+    /// \return bytes per frame
+    std::size_t GetBytesPerFrame() const
+    { return saSampleFormatBytes(GetSampleFormat())*GetSamplesPerFrame(); }
+
+    /// \brief Get the number of times Collect waited for data that a
+    ///        read-ahead source had not yet read
+    /// \return number of stalls
+    virtual std::size_t GetStalls() const { return 0; }
+
+    /// \brief Get the period size granted by the device. Sources that are
+    ///        not devices have a period of one fragment.
+    /// \return frames per period
+    virtual std::size_t GetFramesPerPeriod() const
+    { return GetFramesPerFragment(); }
+
+    /// \brief Get the number of periods granted by the device
+    /// \return periods per buffer
+    virtual std::size_t GetPeriodsPerBuffer() const { return 1; }
+
+    /// \brief Get the buffer size granted by the device
+    /// \return frames per buffer
+    virtual std::size_t GetFramesPerBuffer() const
+    { return GetFramesPerPeriod()*GetPeriodsPerBuffer(); }
+
+    /// \brief Make Collect return the frames available, possibly none,
+    ///        rather than wait for a fragment
+    /// \return Collect will not wait. Sources that cannot avoid waiting,
+    /// such as a read-ahead source, return false.
+    virtual bool SetNonBlocking() { return false; }
+
+    /// \brief Get the descriptors to poll before a non-blocking Collect
+    /// \return poll descriptors. None if Collect never waits.
+    virtual std::vector<pollfd> GetPollDescriptors() { return {}; }
+
+    /// \brief Check the events returned by poll
+    /// \param fds the descriptors from GetPollDescriptors after poll
+    /// \param nfds number of descriptors
+    /// \return Collect will return frames or an error without waiting
+    virtual bool PollReady([[maybe_unused]] pollfd* fds,
+                           [[maybe_unused]] const std::size_t nfds)
+    { return true; }
+
   protected:
 
     saInputSource(const saInputSource&);
@@ -84,17 +152,37 @@ namespace SimpleAudio
   };
   
   /// saInputSourceOpenDevice
-  /// \param deviceName Name of audio input device to open
+  /// \param deviceName Name of audio input device to open. Names starting
+  /// with "synth:" open a synthetic source, see saInputSynth.h.
   /// \param framesPerSecond Sample rate to set in the audio device
-  /// \param msLatency Size of buffer of the device data in milliseconds
+  /// \param msLatency Period of the device in milliseconds. The device
+  /// buffer holds periodsPerBuffer periods.
   /// \param channels Channels per frame of the device
   /// \param debug Enable debugging output
+  /// \param captureFragments if non-zero, the device is read on a dedicated
+  /// capture thread into a ring of captureFragments fragments
+  /// \param realTimePriority if non-zero, the SCHED_FIFO priority of the
+  /// capture thread
+  /// \param mmapAccess map the device buffer and collect fragments from it
+  /// in place. Read access is used if the device does not support mmap.
+  /// \param periodsPerBuffer number of periods in the device buffer. The
+  /// granted values are returned by GetFramesPerPeriod, GetPeriodsPerBuffer
+  /// and GetFramesPerBuffer.
+  /// \param sampleFormat preferred sample format. If the device does not
+  /// support it the other formats are tried, widest first. The granted
+  /// format is returned by GetSampleFormat.
   /// \return A pointer to an saInputSource
   saInputSource* saInputSourceOpenDevice(const std::string& deviceName, 
                                          const std::size_t framesPerSecond,
                                          const std::size_t msLatency,
                                          const std::size_t channels = 1,
-                                         const bool debug = false);
+                                         const bool debug = false,
+                                         const std::size_t captureFragments = 0,
+                                         const int realTimePriority = 0,
+                                         const bool mmapAccess = false,
+                                         const std::size_t periodsPerBuffer = 2,
+                                         const saSampleFormat sampleFormat =
+                                         saSampleFormat::S16);
 
   saInputSource* saInputSourceOpenFile(const std::string& fileName); 
 
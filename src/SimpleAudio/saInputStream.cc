@@ -11,10 +11,14 @@
 #include <memory>
 
 #include <cassert>
+#include <cstdint>
 
 #include "saSample.h"
+#include "saSampleConvert.h"
 #include "saInputStream.h"
 #include "saInputSource.h"
+#include "saInputReadAhead.h"
+#include "saInputCapture.h"
 
 namespace SimpleAudio
 {
@@ -74,6 +78,27 @@ namespace SimpleAudio
                       const std::size_t framesToRead,
                       const std::size_t sampleInFrame);
 
+    /// \brief Read frames into one buffer per sample in frame
+    /// \param buffers vector of vectors of saSample
+    /// \param framesToRead frames to read from the stream
+    /// \return number of frames read
+    std::size_t Read( std::vector< std::vector< saSample > >& buffers,
+                      const std::size_t framesToRead);
+
+    /// \brief Acquire a view of frames in the current fragment
+    /// \param maxFrames maximum number of frames in the view
+    /// \return view of at most maxFrames frames
+    saInputSpan Acquire( const std::size_t maxFrames );
+
+    /// \brief Acquire a view of frames converted to saSample
+    /// \param maxFrames maximum number of frames in the view
+    /// \return view of at most maxFrames frames
+    saInputSampleSpan AcquireSamples( const std::size_t maxFrames );
+
+    /// \brief Release frames from the last acquired view
+    /// \param frames number of frames consumed
+    void Release( const std::size_t frames );
+
     /// \brief Clear the stream
     void Clear( );
 
@@ -105,8 +130,53 @@ namespace SimpleAudio
     /// \return frames read from the stream
     std::size_t GetFramesReadFromStream() const { return framesReadFromStream; }
 
+    /// \brief Get the number of times the stream waited for read-ahead
+    /// \return number of stalls
+    std::size_t GetStalls() const { return inputSource->GetStalls(); }
+
+    /// \brief Get the period size granted by the device
+    /// \return frames per period
+    std::size_t GetFramesPerPeriod() const
+    { return inputSource->GetFramesPerPeriod(); }
+
+    /// \brief Get the number of periods granted by the device
+    /// \return periods per buffer
+    std::size_t GetPeriodsPerBuffer() const
+    { return inputSource->GetPeriodsPerBuffer(); }
+
+    /// \brief Get the buffer size granted by the device
+    /// \return frames per buffer
+    std::size_t GetFramesPerBuffer() const
+    { return inputSource->GetFramesPerBuffer(); }
+
+    /// \brief Get the capture time of the newest frame read
+    /// \return timestamp of the newest frame
+    saTimestamp GetTimestamp() const
+    {
+      return fragmentTimestamp -
+        saTimestampFrames(framesRemainingInFragment, framesPerSecond);
+    }
+
   private:
 
+    /// \brief Get the bytes of the next frame in the current fragment
+    /// \return pointer to the first byte of the frame
+    const uint8_t* FragmentBytes() const
+    {
+      return reinterpret_cast<const uint8_t*>(currentFragment) +
+        bytesPerFrame*framesReadFromFragment;
+    }
+
+    /// \brief Collect a fragment if the current one has been consumed and
+    ///        set the frames acquired
+    /// \param maxFrames maximum number of frames to acquire
+    void AcquireFrames(const std::size_t maxFrames);
+
+    /// \brief Convert frames of the current fragment to saSample
+    /// \param frames number of frames from the next frame
+    /// \return pointer to the interleaved converted samples
+    const saSample* ConvertFrames(const std::size_t frames);
+
     /// Read source
     std::unique_ptr<saInputSource> inputSource;
 
@@ -119,6 +189,12 @@ namespace SimpleAudio
     /// Number of samples in a frame
     std::size_t samplesPerFrame;
 
+    /// Format of the samples in a fragment
+    saSampleFormat sampleFormat;
+
+    /// Number of bytes in a frame of a fragment
+    std::size_t bytesPerFrame;
+
     /// Number of frames in a fragment
     std::size_t framesPerFragment;
 
@@ -143,6 +219,22 @@ namespace SimpleAudio
     /// Current fragment
     saInputSource::saSourceType* currentFragment;
 
+    /// Capture time of the newest frame of the current fragment
+    saTimestamp fragmentTimestamp;
+
+    /// Frames in the last acquired view
+    std::size_t framesAcquired;
+
+    /// Output pointers for de-interleaving, one per sample in frame
+    std::vector< saSample* > channelOutputs;
+
+    /// Samples converted from a fragment to saSample, for AcquireSamples
+    /// and reads of formats other than S16
+    std::vector< saSample > convertedSamples;
+
+    /// Acquired view of samples in a format other than S16, for Acquire
+    std::vector< saDeviceType > stagedSamples;
+
     /// Disallow assignment to saInputStreamImpl
     saInputStreamImpl& operator=( const saInputStreamImpl& );
 
@@ -155,6 +247,8 @@ namespace SimpleAudio
       isOverRun( false ), 
       framesPerSecond( inputSource->GetFramesPerSecond() ),
       samplesPerFrame( inputSource->GetSamplesPerFrame() ),
+      sampleFormat( inputSource->GetSampleFormat() ),
+      bytesPerFrame( inputSource->GetBytesPerFrame() ),
       framesPerFragment( inputSource->GetFramesPerFragment() ),
       samplesPerFragment( samplesPerFrame*framesPerFragment ),
       framesPerStream( inputSource->GetFramesPerSource() ),
@@ -162,58 +256,60 @@ namespace SimpleAudio
       framesThisFragment( 0 ),
       framesReadFromFragment( 0 ),
       framesRemainingInFragment( 0 ),
-      currentFragment( 0 )
+      currentFragment( 0 ),
+      fragmentTimestamp( saTimestampNow() ),
+      framesAcquired( 0 ),
+      channelOutputs( samplesPerFrame ),
+      convertedSamples( samplesPerFragment )
   {
+    if (sampleFormat != saSampleFormat::S16)
+      {
+        stagedSamples.resize(samplesPerFragment);
+      }
   }
 
   saInputStreamImpl::~saInputStreamImpl( ) throw()
   { 
   }
+
+  const saSample* saInputStreamImpl::ConvertFrames(const std::size_t frames)
+  {
+    const std::size_t n = samplesPerFrame*frames;
+    if (convertedSamples.size() < n)
+      {
+        convertedSamples.resize(n);
+      }
+    saSampleArrayFromSource(sampleFormat, FragmentBytes(),
+                            convertedSamples.data(), n);
+    return convertedSamples.data();
+  }
   
   std::size_t saInputStreamImpl::Read( std::vector< saSample >& buffer,
                                        const std::size_t framesToRead )
   {
-    // Data available? Try to fulfill a request
-    std::size_t samplesRemainingInFragment = 0; 
-    std::size_t samplesReadFromFragment = 0;
-    saInputSource::saSourceType* nextSourceInput = 0;
-    if (currentFragment != 0)
-      {
-        samplesRemainingInFragment = samplesPerFrame*framesRemainingInFragment;
-        samplesReadFromFragment = samplesPerFrame*framesReadFromFragment;
-        nextSourceInput = &(currentFragment[samplesReadFromFragment]);
-      }
+    // Any acquired view is invalidated
+    framesAcquired = 0;
 
-    // Read. Collect a fragment from the device. Copy samples from the fragment
-    // into the buffer. As the samples are copied they are are transformed
-    // from saSourceType to saSample. Release the fragment and Collect another.
-    std::size_t samplesRead = 0;
-    std::size_t samplesToRead = samplesPerFrame*framesToRead;
-    while (samplesToRead > 0)
+    // Read. Collect a fragment from the device. Copy frames from the
+    // fragment into the buffer. As the frames are copied they are converted
+    // in bulk from the sample format of the source to saSample. Release the
+    // fragment and Collect another.
+    std::size_t framesRead = 0;
+    std::size_t framesLeftToRead = framesToRead;
+    while (framesLeftToRead > 0)
       {
-        if (samplesRemainingInFragment >= samplesToRead)
-          {
-            std::transform(nextSourceInput, 
-                           nextSourceInput+samplesToRead, 
-                           std::back_inserter(buffer),
-                           saSampleFromSource<saInputSource::saSourceType>());
-            nextSourceInput += samplesToRead;
-            samplesReadFromFragment += samplesToRead;
-            samplesRead += samplesToRead;
-            samplesRemainingInFragment -= samplesToRead;
-            samplesToRead = 0; 
-          }
-        else if (samplesRemainingInFragment > 0)
+        if (framesRemainingInFragment > 0)
           {
-            std::transform(nextSourceInput, 
-                           nextSourceInput+samplesRemainingInFragment,
-                           std::back_inserter(buffer),
-                           saSampleFromSource<saInputSource::saSourceType>());
-            nextSourceInput += samplesRemainingInFragment;
-            samplesReadFromFragment += samplesRemainingInFragment;
-            samplesRead += samplesRemainingInFragment;
-            samplesToRead -= samplesRemainingInFragment; 
-            samplesRemainingInFragment = 0;
+            const std::size_t n =
+              std::min(framesLeftToRead, framesRemainingInFragment);
+            const std::size_t bufferSize = buffer.size();
+            buffer.resize(bufferSize+samplesPerFrame*n);
+            saSampleArrayFromSource(sampleFormat, FragmentBytes(),
+                                    &(buffer[bufferSize]), samplesPerFrame*n);
+            framesReadFromFragment += n;
+            framesRead += n;
+            framesRemainingInFragment -= n;
+            framesLeftToRead -= n;
           }
         else if ( EndOfSource() )
           {
@@ -221,29 +317,22 @@ namespace SimpleAudio
           }
         else
           {
+            framesReadFromFragment = 0;
             if (currentFragment != 0)
               {
                 inputSource->Release(currentFragment);
               }
             currentFragment = inputSource->Collect(framesThisFragment);
-            nextSourceInput = currentFragment;
-            samplesReadFromFragment = 0;
+            fragmentTimestamp = inputSource->GetTimestamp();
             framesRemainingInFragment = framesThisFragment;
-            samplesRemainingInFragment = 
-              samplesPerFrame*framesRemainingInFragment;
           }
 
-        // Sanity checks
-        assert( (samplesRemainingInFragment+samplesReadFromFragment) 
-                == samplesPerFrame*framesThisFragment );
-        assert( static_cast<std::size_t>(nextSourceInput-currentFragment)
-                == samplesReadFromFragment );
+        // Sanity check
+        assert( (framesRemainingInFragment+framesReadFromFragment)
+                == framesThisFragment );
       }
-    
+
     // Done
-    framesRemainingInFragment = samplesRemainingInFragment/samplesPerFrame;
-    framesReadFromFragment = samplesReadFromFragment/samplesPerFrame;
-    std::size_t framesRead = samplesRead/samplesPerFrame;
     framesReadFromStream += framesRead;
     return framesRead;
   }
@@ -264,43 +353,117 @@ namespace SimpleAudio
         return Read( buffer, framesToRead );
       }
 
-    // Data available? Try to fulfill a request
-    saInputSource::saSourceType* nextSourceInput = 0;
-    if (currentFragment != 0)
-      {
-        nextSourceInput = 
-          &(currentFragment[samplesPerFrame*framesReadFromFragment]);
-      }
+    // Any acquired view is invalidated
+    framesAcquired = 0;
 
+    // Read. Each pass picks the sample from the frames wanted from the
+    // remainder of the current fragment. S16 samples are converted as they
+    // are picked. Other formats are converted in bulk first. Release the
+    // fragment and Collect another.
     std::size_t framesRead = 0;
     std::size_t framesLeftToRead = framesToRead;
     while (framesLeftToRead>0)
       {
-        if (framesRemainingInFragment > framesLeftToRead)
+        if (framesRemainingInFragment > 0)
           {
-            std::generate_n(std::back_inserter(buffer),
-                            framesLeftToRead, 
-                            DecimateSource<saInputSource::saSourceType>
-                            (nextSourceInput+sampleInFrame, samplesPerFrame));
-
-            nextSourceInput += samplesPerFrame*framesLeftToRead;
-            framesReadFromFragment += framesLeftToRead;
-            framesRead += framesLeftToRead;
-            framesRemainingInFragment -= framesLeftToRead;
-            framesLeftToRead = 0; 
+            const std::size_t n =
+              std::min(framesLeftToRead, framesRemainingInFragment);
+            if (sampleFormat == saSampleFormat::S16)
+              {
+                std::generate_n(std::back_inserter(buffer), n,
+                                DecimateSource<saInputSource::saSourceType>
+                                (&(currentFragment
+                                   [samplesPerFrame*framesReadFromFragment +
+                                    sampleInFrame]), samplesPerFrame));
+              }
+            else
+              {
+                const saSample* const converted = ConvertFrames(n);
+                for (std::size_t k=0; k<n; k++)
+                  {
+                    buffer.push_back
+                      (converted[samplesPerFrame*k + sampleInFrame]);
+                  }
+              }
+            framesReadFromFragment += n;
+            framesRead += n;
+            framesRemainingInFragment -= n;
+            framesLeftToRead -= n;
           }
-        else if (framesRemainingInFragment > 0)
+        else if ( EndOfSource() )
+          {
+            break;
+          }
+        else
+          {
+            framesReadFromFragment = 0;
+            if ( currentFragment != 0 )
+              {
+                inputSource->Release(currentFragment);
+              }
+            currentFragment = inputSource->Collect(framesThisFragment);
+            fragmentTimestamp = inputSource->GetTimestamp();
+            framesRemainingInFragment = framesThisFragment;
+          }
+
+        // Sanity check
+        assert( (framesRemainingInFragment+framesReadFromFragment) 
+                == framesThisFragment );
+      }
+
+    // Done
+    framesReadFromStream += framesRead;
+    return framesRead;
+  }
+
+  std::size_t 
+  saInputStreamImpl::Read( std::vector< std::vector< saSample > >& buffers,
+                           const std::size_t framesToRead )
+  {
+    // Any acquired view is invalidated
+    framesAcquired = 0;
+
+    // One buffer per sample in frame
+    buffers.resize(samplesPerFrame);
+
+    // Read. Each pass de-interleaves the frames wanted from the remainder
+    // of the current fragment into the buffers. Release the fragment and
+    // Collect another. Stop early if the source returns no frames.
+    std::size_t framesRead = 0;
+    std::size_t framesLeftToRead = framesToRead;
+    while (framesLeftToRead > 0)
+      {
+        if (framesRemainingInFragment > 0)
           {
-            std::generate_n(std::back_inserter(buffer),
-                            framesRemainingInFragment, 
-                            DecimateSource<saInputSource::saSourceType>
-                            (nextSourceInput+sampleInFrame, samplesPerFrame));
-
-            nextSourceInput += samplesPerFrame*framesRemainingInFragment;
-            framesReadFromFragment += framesRemainingInFragment;
-            framesRead += framesRemainingInFragment;
-            framesLeftToRead -= framesRemainingInFragment; 
-            framesRemainingInFragment = 0;
+            const std::size_t n = 
+              std::min(framesLeftToRead, framesRemainingInFragment);
+            for (std::size_t c=0; c<samplesPerFrame; c++)
+              {
+                const std::size_t bufferSize = buffers[c].size();
+                buffers[c].resize(bufferSize+n);
+                channelOutputs[c] = &(buffers[c][bufferSize]);
+              }
+            if (sampleFormat == saSampleFormat::S16)
+              {
+                saSampleArrayDeinterleave
+                  (&(currentFragment[samplesPerFrame*framesReadFromFragment]),
+                   samplesPerFrame, channelOutputs.data(), n);
+              }
+            else
+              {
+                const saSample* const converted = ConvertFrames(n);
+                for (std::size_t k=0; k<n; k++)
+                  {
+                    for (std::size_t c=0; c<samplesPerFrame; c++)
+                      {
+                        channelOutputs[c][k] = converted[samplesPerFrame*k + c];
+                      }
+                  }
+              }
+            framesReadFromFragment += n;
+            framesRead += n;
+            framesRemainingInFragment -= n;
+            framesLeftToRead -= n; 
           }
         else if ( EndOfSource() )
           {
@@ -314,15 +477,19 @@ namespace SimpleAudio
                 inputSource->Release(currentFragment);
               }
             currentFragment = inputSource->Collect(framesThisFragment);
+            fragmentTimestamp = inputSource->GetTimestamp();
             framesRemainingInFragment = framesThisFragment;
-            nextSourceInput = currentFragment;
+
+            // The source has no frames
+            if (framesThisFragment == 0)
+              {
+                break;
+              }
           }
 
-        // Sanity checks
+        // Sanity check
         assert( (framesRemainingInFragment+framesReadFromFragment) 
                 == framesThisFragment );
-        assert( static_cast<std::size_t>(nextSourceInput-currentFragment)
-                == samplesPerFrame*framesReadFromFragment );
       }
 
     // Done
@@ -330,6 +497,79 @@ namespace SimpleAudio
     return framesRead;
   }
 
+  void saInputStreamImpl::AcquireFrames( const std::size_t maxFrames )
+  {
+    // Collect another fragment if this one has been consumed. If the source
+    // has no frames nothing is acquired.
+    if ( (framesRemainingInFragment == 0) && !EndOfSource() )
+      {
+        if (currentFragment != 0)
+          {
+            inputSource->Release(currentFragment);
+          }
+        currentFragment = inputSource->Collect(framesThisFragment);
+        fragmentTimestamp = inputSource->GetTimestamp();
+        framesReadFromFragment = 0;
+        framesRemainingInFragment = framesThisFragment;
+      }
+    framesAcquired = std::min(maxFrames, framesRemainingInFragment);
+  }
+
+  saInputSpan saInputStreamImpl::Acquire( const std::size_t maxFrames )
+  {
+    // View the remaining frames in the fragment. Samples in formats other
+    // than S16 are converted to a staged copy.
+    AcquireFrames(maxFrames);
+    saInputSpan view;
+    view.frames = framesAcquired;
+    if ((framesAcquired > 0) && (sampleFormat == saSampleFormat::S16))
+      {
+        view.samples = 
+          std::span<const saDeviceType>
+          (&(currentFragment[samplesPerFrame*framesReadFromFragment]), 
+           samplesPerFrame*framesAcquired);
+      }
+    else if (framesAcquired > 0)
+      {
+        const std::size_t n = samplesPerFrame*framesAcquired;
+        if (stagedSamples.size() < n)
+          {
+            stagedSamples.resize(n);
+          }
+        saSampleArrayToSink(ConvertFrames(framesAcquired),
+                            stagedSamples.data(), n);
+        view.samples = std::span<const saDeviceType>(stagedSamples.data(), n);
+      }
+    return view;
+  }
+
+  saInputSampleSpan 
+  saInputStreamImpl::AcquireSamples( const std::size_t maxFrames )
+  {
+    // View the remaining frames in the fragment converted in bulk
+    AcquireFrames(maxFrames);
+    saInputSampleSpan view;
+    view.frames = framesAcquired;
+    if (framesAcquired > 0)
+      {
+        view.samples = std::span<const saSample>
+          (ConvertFrames(framesAcquired), samplesPerFrame*framesAcquired);
+      }
+    return view;
+  }
+
+  void saInputStreamImpl::Release( const std::size_t frames )
+  {
+    if (frames > framesAcquired)
+      {
+        throw std::runtime_error("Release() more frames than acquired");
+      }
+    framesAcquired -= frames;
+    framesReadFromFragment += frames;
+    framesRemainingInFragment -= frames;
+    framesReadFromStream += frames;
+  }
+
   inline bool saInputStreamImpl::OverRun( ) 
   { 
     return isOverRun || inputSource->OverRun(); 
@@ -345,6 +585,7 @@ namespace SimpleAudio
   {
     // Abandon this fragment
     framesRemainingInFragment = 0;
+    framesAcquired = 0;
     currentFragment = 0;
 
     // Clear the input source
@@ -359,19 +600,42 @@ namespace SimpleAudio
                            const std::size_t framesPerSecond,
                            const std::size_t msDeviceLatency,
                            const std::size_t channels,
-                           const bool debug )
+                           const bool debug,
+                           const std::size_t captureFragments,
+                           const int realTimePriority,
+                           const bool mmapAccess,
+                           const std::size_t periodsPerBuffer,
+                           const saSampleFormat sampleFormat )
   {
     saInputSource* deviceSource = 
       saInputSourceOpenDevice(deviceName, framesPerSecond, msDeviceLatency, 
-                              channels, debug);
+                              channels, debug, captureFragments,
+                              realTimePriority, mmapAccess, periodsPerBuffer,
+                              sampleFormat);
 
     return new saInputStreamImpl( deviceSource );
   }
 
   saInputStream*
-  saInputStreamOpenFile( const std::string& fileName )
+  saInputStreamOpenSource( saInputSource* source )
+  {
+    return new saInputStreamImpl( source );
+  }
+
+  saInputStream*
+  saInputStreamOpenFile( const std::string& fileName,
+                         const std::size_t readAheadDepth,
+                         const std::size_t captureFragments )
   {
     saInputSource* fileSource = saInputSourceOpenFile(fileName);
+    if (readAheadDepth > 0)
+      {
+        fileSource = saInputSourceOpenReadAhead(fileSource, readAheadDepth);
+      }
+    if (captureFragments > 0)
+      {
+        fileSource = saInputSourceOpenCapture(fileSource, captureFragments);
+      }
 
     return new saInputStreamImpl( fileSource );
   }
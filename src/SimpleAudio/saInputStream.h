@@ -2,14 +2,39 @@
 /// \brief Abstract class for a simple audio input stream
 
 #include <vector>
+#include <span>
 
 #include "saSample.h"
+#include "saDeviceType.h"
+#include "saInputSource.h"
 
 #ifndef __SAINPUTSTREAM_H__
 #define __SAINPUTSTREAM_H__
 
 namespace SimpleAudio
 {
+  /// \struct saInputSpan
+  /// \brief A read-only view of interleaved frames in a source fragment
+  struct saInputSpan
+  {
+    /// Interleaved samples of the frames
+    std::span<const saDeviceType> samples;
+
+    /// Number of frames in the view
+    std::size_t frames;
+  };
+
+  /// \struct saInputSampleSpan
+  /// \brief A read-only view of interleaved frames converted to saSample
+  struct saInputSampleSpan
+  {
+    /// Interleaved samples of the frames
+    std::span<const saSample> samples;
+
+    /// Number of frames in the view
+    std::size_t frames;
+  };
+
   /// \class saInputStream
   /// \brief A class for audio input streams from a file, audio device etc.
   class saInputStream
@@ -36,6 +61,45 @@ namespace SimpleAudio
                               const std::size_t framesToRead,
                               const std::size_t sampleInFrame) = 0;
 
+    /// \brief Read frames into one buffer per sample in frame
+    ///
+    /// Each fragment is traversed once and de-interleaved, so reading all
+    /// the channels costs no more than reading one of them.
+    /// \param buffers resized to GetSamplesPerFrame() buffers of saSample.
+    /// The samples are appended to each buffer.
+    /// \param framesToRead frames to read
+    /// \return number of frames read
+    virtual std::size_t Read( std::vector< std::vector< saSample > >& buffers,
+                              const std::size_t framesToRead) = 0;
+
+    /// \brief Acquire a view of frames without copying
+    ///
+    /// The view points directly into the current source fragment. If the
+    /// source samples are not S16 the view points to a copy of the frames
+    /// converted to saDeviceType instead, which loses the precision of wider
+    /// formats. Use AcquireSamples to process saSample. The view is
+    /// valid until the next call to Acquire, Read or Clear. If the current
+    /// fragment has been consumed the next fragment is collected, so the
+    /// view never spans a fragment boundary. An empty view is returned at
+    /// the end of the source or if the source returned no frames.
+    /// \param maxFrames maximum number of frames in the view
+    /// \return view of at most maxFrames frames
+    virtual saInputSpan Acquire( const std::size_t maxFrames ) = 0;
+
+    /// \brief Acquire a view of frames converted to saSample
+    ///
+    /// As Acquire, but the frames are converted in bulk from the sample
+    /// format of the source to saSample, so every format keeps its
+    /// precision. The frames are released with Release. The view is valid
+    /// until the next call to Acquire, AcquireSamples, Read or Clear.
+    /// \param maxFrames maximum number of frames in the view
+    /// \return view of at most maxFrames frames
+    virtual saInputSampleSpan AcquireSamples( const std::size_t maxFrames ) = 0;
+
+    /// \brief Release frames from the front of the last acquired view
+    /// \param frames number of frames consumed
+    virtual void Release( const std::size_t frames ) = 0;
+
     /// \brief Clear the stream
     virtual void Clear( ) = 0;
 
@@ -67,6 +131,27 @@ namespace SimpleAudio
     /// \return frames read from stream
     virtual std::size_t GetFramesReadFromStream() const = 0;
 
+    /// \brief Get the number of times the stream waited for read-ahead
+    /// \return number of stalls
+    virtual std::size_t GetStalls() const = 0;
+
+    /// \brief Get the period size granted by the device
+    /// \return frames per period
+    virtual std::size_t GetFramesPerPeriod() const = 0;
+
+    /// \brief Get the number of periods granted by the device
+    /// \return periods per buffer
+    virtual std::size_t GetPeriodsPerBuffer() const = 0;
+
+    /// \brief Get the buffer size granted by the device
+    /// \return frames per buffer
+    virtual std::size_t GetFramesPerBuffer() const = 0;
+
+    /// \brief Get the capture time of the newest frame read or released
+    ///        from the stream. See saInputSource::GetTimestamp.
+    /// \return timestamp of the newest frame
+    virtual saTimestamp GetTimestamp() const = 0;
+
   protected:
     /// Disallow assignment to saInputStream
     saInputStream& operator=( const saInputStream& );
@@ -81,17 +166,46 @@ namespace SimpleAudio
   /// \param msDeviceLatency device fragment buffer size (stream latency in ms)
   /// \param channels number of channels on device
   /// \param debug
+  /// \param captureFragments if non-zero, the device is read on a dedicated
+  /// capture thread into a ring of captureFragments fragments
+  /// \param realTimePriority if non-zero, the SCHED_FIFO priority of the
+  /// capture thread
+  /// \param mmapAccess collect fragments in place from the mapped device
+  /// buffer if the device supports it
+  /// \param periodsPerBuffer number of periods of msDeviceLatency in the
+  /// device buffer
+  /// \param sampleFormat preferred device sample format. The samples are
+  /// converted to saSample by the stream.
   /// \return pointer to saInputStream
   saInputStream* saInputStreamOpenDevice( const std::string& deviceName, 
                                           const std::size_t framesPerSecond,
                                           const std::size_t msDeviceLatency,
                                           const std::size_t channels=1,
-                                          const bool debug=false );
+                                          const bool debug=false,
+                                          const std::size_t captureFragments=0,
+                                          const int realTimePriority=0,
+                                          const bool mmapAccess=false,
+                                          const std::size_t periodsPerBuffer=2,
+                                          const saSampleFormat sampleFormat=
+                                          saSampleFormat::S16 );
+
+  /// \brief Open a simple audio input stream from a source
+  /// \param source the source to read. The stream takes ownership of the
+  /// source.
+  /// \return pointer to saInputStream
+  saInputStream* saInputStreamOpenSource( saInputSource* source );
 
   /// \brief Open a simple audio input stream from a file
   /// \param fileName file name
+  /// \param readAheadDepth if non-zero, fragments are read from the file on
+  /// a background thread into a pool of readAheadDepth fragments
+  /// \param captureFragments if non-zero, the file is read on a capture
+  /// thread into a ring of captureFragments fragments as if it were a
+  /// device. Frames that do not fit in the ring are dropped.
   /// \return pointer to saInputStream 
-  saInputStream* saInputStreamOpenFile( const std::string& fileName );
+  saInputStream* saInputStreamOpenFile( const std::string& fileName,
+                                        const std::size_t readAheadDepth=0,
+                                        const std::size_t captureFragments=0 );
 
 }
 
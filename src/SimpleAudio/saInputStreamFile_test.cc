@@ -8,15 +8,189 @@
 #include <memory>
 #include <algorithm>
 #include <iterator>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <vector>
+#include <stdexcept>
+#include <ctime>
+
+// C library include files
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
 
 // Local include files
 #include "saInputFileSelector.h"
 #include "saInputFileWav.h"
 #include "saInputFileAscii.h"
 #include "saInputStream.h"
+#include "saInputStreamResample.h"
+#include "saInputCapture.h"
+#include "saInputReadAhead.h"
+#include "saTimestamp.h"
 
 using namespace SimpleAudio;
 
+/// \class saPacedPipeSource
+/// \brief Source paced like a capture device
+///
+/// A thread writes a byte to a pipe every period and Collect returns a
+/// fragment for each byte it reads. Like an unserviced device, the pipe
+/// stays ready for poll when the source is not collected from. Collect
+/// waits for a period unless the source is non-blocking. The samples are
+/// the number of calls to Clear, and the source reports an over-run from
+/// the start until it is cleared.
+class saPacedPipeSource : public saInputSource
+{
+public:
+  saPacedPipeSource() :
+    fragment(framesPerFragment*maxFragments, 0),
+    framesRead(0),
+    clears(0),
+    isNonBlocking(false),
+    isStopRequested(false)
+  {
+    if (pipe2(pipeFds, O_NONBLOCK | O_CLOEXEC) != 0)
+      {
+        throw std::runtime_error("cannot create pipe");
+      }
+    pacer = std::thread([this]()
+      {
+        while (!isStopRequested.load(std::memory_order_acquire))
+          {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            const char period = 0;
+            [[maybe_unused]] const ssize_t err = write(pipeFds[1], &period, 1);
+          }
+      });
+  }
+
+  ~saPacedPipeSource() throw()
+  {
+    isStopRequested.store(true, std::memory_order_release);
+    pacer.join();
+    close(pipeFds[0]);
+    close(pipeFds[1]);
+  }
+
+  saInputFragment Collect(std::size_t& numValid)
+  {
+    pollfd fd;
+    fd.fd = pipeFds[0];
+    fd.events = POLLIN;
+    fd.revents = 0;
+    while (!isNonBlocking && (poll(&fd, 1, 100) == 0))
+      { }
+    std::fill(fragment.begin(), fragment.end(),
+              static_cast<saSourceType>(clears));
+    char periods[maxFragments];
+    const ssize_t n = read(pipeFds[0], periods, sizeof(periods));
+    numValid = (n > 0) ? static_cast<std::size_t>(n)*framesPerFragment : 0;
+    framesRead += numValid;
+    return fragment.data();
+  }
+  void Release([[maybe_unused]] const saInputFragment f) { }
+  void Clear( ) { clears++; }
+  bool OverRun( ) { return clears == 0; }
+  bool EndOfSource() { return false; }
+  std::size_t GetFramesPerSecond() const { return 8000; }
+  std::size_t GetSamplesPerFrame() const { return 1; }
+  std::size_t GetFramesPerFragment() const { return framesPerFragment; }
+  std::size_t GetFramesPerSource() const { return 0; }
+  std::size_t GetFramesReadFromSource() const { return framesRead; }
+  std::size_t GetMsDeviceLatency() const { return 10; }
+  bool SetNonBlocking( ) { isNonBlocking = true; return true; }
+  std::vector<pollfd> GetPollDescriptors( )
+  {
+    pollfd fd;
+    fd.fd = pipeFds[0];
+    fd.events = POLLIN;
+    fd.revents = 0;
+    return std::vector<pollfd>(1, fd);
+  }
+  bool PollReady(pollfd* fds, const std::size_t nfds)
+  { return (nfds > 0) && ((fds[0].revents & POLLIN) != 0); }
+
+private:
+  static constexpr std::size_t framesPerFragment = 80;
+  static constexpr std::size_t maxFragments = 8;
+  std::vector<saSourceType> fragment;
+  std::size_t framesRead;
+  std::size_t clears;
+  bool isNonBlocking;
+  int pipeFds[2];
+  std::atomic<bool> isStopRequested;
+  std::thread pacer;
+};
+
+/// Poll two paced sources, drop the reader of one and measure the CPU time
+/// used while the other is read. The polling thread should sleep between
+/// periods rather than spin on the descriptor of the dropped source.
+static void PollDropTest()
+{
+  std::unique_ptr<saInputPoll> poll(saInputPollCreate());
+  std::unique_ptr<saInputStream>
+    kept(saInputStreamOpenSource(poll->Add(new saPacedPipeSource, 8)));
+  std::unique_ptr<saInputStream>
+    dropped(saInputStreamOpenSource(poll->Add(new saPacedPipeSource, 8)));
+  poll->Start();
+
+  auto readFrames = [&kept](const std::size_t frames)
+    {
+      for (std::size_t n=0; n<frames; )
+        {
+          const saInputSpan view = kept->Acquire(frames-n);
+          kept->Release(view.frames);
+          n += view.frames;
+        }
+    };
+  readFrames(800);
+  dropped.reset();
+
+  const std::clock_t cpuStart = std::clock();
+  const saTimestamp wallStart = saTimestampNow();
+  readFrames(4000);
+  const double cpuMs = (1000.0*static_cast<double>(std::clock()-cpuStart))/
+    CLOCKS_PER_SEC;
+  const double wallMs = saTimestampMs(saTimestampNow()-wallStart);
+  std::cerr << "Polling thread sleeps after drop " << (cpuMs < wallMs/4)
+            << "\n";
+}
+
+/// Clear a captured paced source while the capture thread waits in
+/// Collect. The frames and over-run of that Collect were captured before
+/// the Clear, so they must not be read after it.
+static void CaptureClearTest()
+{
+  std::unique_ptr<saInputStream>
+    is(saInputStreamOpenSource
+       (saInputSourceOpenCapture(new saPacedPipeSource, 4)));
+  std::size_t framesStale = 0;
+  auto readFrames = [&is, &framesStale](const std::size_t frames)
+    {
+      for (std::size_t n=0; n<frames; )
+        {
+          const saInputSpan view = is->Acquire(frames-n);
+          for (std::size_t k=0; k<view.frames; k++)
+            {
+              framesStale += (view.samples[k] == 0) ? 1 : 0;
+            }
+          is->Release(view.frames);
+          n += view.frames;
+        }
+    };
+  readFrames(160);
+  std::cerr << "OverRun before Clear " << is->OverRun() << "\n";
+  // Clear while the capture thread waits in Collect for the next period
+  std::this_thread::sleep_for(std::chrono::milliseconds(25));
+  is->Clear();
+  framesStale = 0;
+  readFrames(800);
+  std::cerr << "OverRun after Clear " << is->OverRun() << "\n";
+  std::cerr << "Frames captured before Clear " << framesStale << "\n";
+}
+
 static void Usage()
 {
   std::cerr << "Allowed options:\n";
@@ -25,8 +199,18 @@ static void Usage()
   std::cerr << "  --clear_test          test clear function\n";
   std::cerr << "  --eos_test            test end-of-source function\n";
   std::cerr << "  --frames_read_test    test number of frames read function\n";
+  std::cerr << "  --acquire_test        test zero-copy acquire and release\n";
+  std::cerr << "  --deinterleave_test   test reading all channels in one pass\n";
+  std::cerr << "  --poll_drop_test      test polling after a reader is dropped\n";
+  std::cerr << "  --capture_clear_test  test clearing a capture thread ring\n";
   std::cerr << "  --frames arg          frames to read from source\n";
   std::cerr << "  --channel arg         channel to read from frame\n";
+  std::cerr << "  --read_ahead arg      fragments to read ahead on a thread\n";
+  std::cerr << "  --capture arg         fragments in a capture thread ring\n";
+  std::cerr << "  --poll arg            copies of the file on one capture thread\n";
+  std::cerr << "  --resample arg        resample to arg frames per second\n";
+  std::cerr << "  --mmap                map WAV files into memory\n";
+  std::cerr << "  --samples             acquire views converted to saSample\n";
   std::cerr << "  --file arg            read from file\n";
 }
 static void ParseOptions(int argc, 
@@ -36,11 +220,21 @@ static void ParseOptions(int argc,
                          bool& readSize_set,
                          std::size_t& channel,
                          bool& channel_set,
+                         std::size_t& readAhead,
+                         std::size_t& captureFragments,
+                         std::size_t& pollSources,
+                         std::size_t& resampleRate,
+                         bool& mmapReq,
+                         bool& samplesReq,
                          bool& helpReq,
                          bool& read_test,
                          bool& clear_test,
                          bool& eos_test,
-                         bool& frames_read_test)
+                         bool& frames_read_test,
+                         bool& acquire_test,
+                         bool& deinterleave_test,
+                         bool& poll_drop_test,
+                         bool& capture_clear_test)
 {
   if (argc < 1)
     {
@@ -108,6 +302,40 @@ static void ParseOptions(int argc,
       frames_read_test = true;
     } 
 
+  // Test acquire and release
+  acquire_test = false;
+  opt = std::find(options.begin(), options.end(), "--acquire_test");
+  if (opt != options.end())
+    {
+      std::cerr << "Testing acquire and release" << "\n";
+      acquire_test = true;
+    } 
+
+  // Test reading all channels in one pass
+  deinterleave_test = false;
+  opt = std::find(options.begin(), options.end(), "--deinterleave_test");
+  if (opt != options.end())
+    {
+      std::cerr << "Testing de-interleaved read" << "\n";
+      deinterleave_test = true;
+    } 
+
+  poll_drop_test = false;
+  opt = std::find(options.begin(), options.end(), "--poll_drop_test");
+  if (opt != options.end())
+    {
+      std::cerr << "Testing polling after a reader is dropped" << "\n";
+      poll_drop_test = true;
+    } 
+
+  capture_clear_test = false;
+  opt = std::find(options.begin(), options.end(), "--capture_clear_test");
+  if (opt != options.end())
+    {
+      std::cerr << "Testing clear of a capture thread ring" << "\n";
+      capture_clear_test = true;
+    } 
+
   // Number of frames to read
   readSize = 0;
   readSize_set = false;
@@ -130,6 +358,50 @@ static void ParseOptions(int argc,
       channel_set = true;
     } 
 
+  // Fragments to read ahead
+  readAhead = 0;
+  opt = std::find(options.begin(), options.end(), "--read_ahead");
+  if (opt != options.end())
+    {
+      std::istringstream sstr(*(++opt));
+      sstr >> readAhead;
+    } 
+
+  // Fragments in the capture ring
+  captureFragments = 0;
+  opt = std::find(options.begin(), options.end(), "--capture");
+  if (opt != options.end())
+    {
+      std::istringstream sstr(*(++opt));
+      sstr >> captureFragments;
+    } 
+
+  // Sources polled on one capture thread
+  pollSources = 0;
+  opt = std::find(options.begin(), options.end(), "--poll");
+  if (opt != options.end())
+    {
+      std::istringstream sstr(*(++opt));
+      sstr >> pollSources;
+    } 
+
+  // Frame rate to resample to
+  resampleRate = 0;
+  opt = std::find(options.begin(), options.end(), "--resample");
+  if (opt != options.end())
+    {
+      std::istringstream sstr(*(++opt));
+      sstr >> resampleRate;
+    } 
+
+  // Map WAV files
+  mmapReq = (std::find(options.begin(), options.end(), "--mmap") !=
+             options.end());
+
+  // Acquire views of saSample
+  samplesReq = (std::find(options.begin(), options.end(), "--samples") !=
+                options.end());
+
   // Read from device or file
   sourceName = "";
   opt = std::find(options.begin(), options.end(), "--file");
@@ -139,6 +411,33 @@ static void ParseOptions(int argc,
     } 
 }
 
+/// Write the frames of an acquired view, or the selected channel
+/// \param samples interleaved samples of the view
+/// \param frames frames in the view
+/// \param samplesPerFrame samples per frame
+/// \param channel_set write only the selected channel
+/// \param channel the selected channel
+/// \param conv converts a sample for writing
+template<typename Samples, typename Conv>
+static void WriteView(const Samples& samples,
+                      const std::size_t frames,
+                      const std::size_t samplesPerFrame,
+                      const bool channel_set,
+                      const std::size_t channel,
+                      Conv conv)
+{
+  for (std::size_t k=0; k<frames; k++)
+    {
+      for (std::size_t c=0; c<samplesPerFrame; c++)
+        {
+          if (!channel_set || (c == channel))
+            {
+              std::cout << conv(samples[(k*samplesPerFrame)+c]) << "\n";
+            }
+        }
+    }
+}
+
 int main(int argc, char* argv[])
 {
   try
@@ -149,22 +448,47 @@ int main(int argc, char* argv[])
       bool readSize_set = false;
       std::size_t channel = 0;
       bool channel_set = false;
+      std::size_t readAhead = 0;
+      std::size_t captureFragments = 0;
+      std::size_t pollSources = 0;
+      std::size_t resampleRate = 0;
+      bool mmapReq = false;
+      bool samplesReq = false;
       bool helpReq = false;
       bool read_test = false;
       bool clear_test = false;
       bool eos_test = false;
       bool frames_read_test = false;
+      bool acquire_test = false;
+      bool deinterleave_test = false;
+      bool poll_drop_test = false;
+      bool capture_clear_test = false;
 
       // Parse arguments
       ParseOptions(argc, argv, fileName, 
-                   readSize, readSize_set, channel, channel_set,
-                   helpReq, read_test, clear_test, eos_test, frames_read_test);
+                   readSize, readSize_set, channel, channel_set, readAhead,
+                   captureFragments, pollSources, resampleRate, mmapReq,
+                   samplesReq, helpReq, read_test, clear_test, eos_test, frames_read_test,
+                   acquire_test, deinterleave_test, poll_drop_test,
+                   capture_clear_test);
 
       if (helpReq)
         {
           return 0;
         }
 
+      // Tests of paced sources, which need no file
+      if (poll_drop_test)
+        {
+          PollDropTest();
+          return 0;
+        }
+      if (capture_clear_test)
+        {
+          CaptureClearTest();
+          return 0;
+        }
+
       // Sanity check
       if (fileName.length() == 0)
         {
@@ -174,7 +498,8 @@ int main(int argc, char* argv[])
 
       // Register file handlers
       const bool wavRegistered = saSingletonInputFileSelector::Instance().
-        RegisterFileType(".wav", saInputSourceOpenFileWav);
+        RegisterFileType(".wav", mmapReq ? saInputSourceOpenFileWavMmap :
+                         saInputSourceOpenFileWav);
       if (!wavRegistered)
         {
           std::cerr << "failed to register wav!" << "\n";
@@ -191,9 +516,43 @@ int main(int argc, char* argv[])
       // Useful conversion functor
       saSampleToSink<saInputSource::saSourceType> conv;
 
-      // Open the input stream
+      // Open the input stream. Polled copies of the file share one
+      // capture thread and the first copy is tested.
       std::string name(fileName.begin(), fileName.end());
-      std::unique_ptr<saInputStream> is(saInputStreamOpenFile(name.c_str()));
+      std::unique_ptr<saInputPoll> poll;
+      std::vector< std::unique_ptr<saInputStream> > polled;
+      std::unique_ptr<saInputStream> is;
+      if (pollSources > 0)
+        {
+          if (captureFragments == 0)
+            {
+              std::cerr << "--poll needs --capture" << "\n";
+              return -1;
+            }
+          poll.reset(saInputPollCreate());
+          for (std::size_t k=0; k<pollSources; k++)
+            {
+              saInputSource* source = saInputSourceOpenFile(name);
+              if (readAhead > 0)
+                {
+                  source = saInputSourceOpenReadAhead(source, readAhead);
+                }
+              polled.emplace_back
+                (saInputStreamOpenSource
+                 (poll->Add(source, captureFragments)));
+            }
+          poll->Start();
+          is = std::move(polled[0]);
+        }
+      else
+        {
+          is.reset
+            (saInputStreamOpenFile(name.c_str(), readAhead, captureFragments));
+        }
+      if (resampleRate > 0)
+        {
+          is.reset(saInputStreamOpenResample(is.release(), resampleRate));
+        }
       if ( (readSize_set == true) && (readSize > is->GetFramesPerStream()) )
         {
           readSize = is->GetFramesPerStream();
@@ -255,6 +614,11 @@ int main(int argc, char* argv[])
           std::cerr << "Frames read from stream " 
                     << is->GetFramesReadFromStream() 
 		    << " : " << framesSoFar << "\n" ;
+          if (readAhead > 0)
+            {
+              // Let the read-ahead fill its pool so that Clear drops it
+              std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
           is->Clear();
           buf.clear();
           framesSoFar = is->Read(buf, is->GetFramesPerFragment());
@@ -315,6 +679,124 @@ int main(int argc, char* argv[])
 		    << " : " << framesSoFar << "\n" ;
         }
 
+      // Test acquire and release. Views of at most readSize frames are
+      // acquired until the end of the source. Views of saSample are written
+      // as for the read test.
+      if ( acquire_test )
+        {
+          std::cerr << "Test acquire" << "\n";
+
+          std::size_t views = 0;
+          std::size_t framesSoFar = 0;
+          std::size_t frames = 0;
+          do
+            {
+              if (samplesReq)
+                {
+                  const saInputSampleSpan view = is->AcquireSamples(readSize);
+                  WriteView(view.samples, view.frames, is->GetSamplesPerFrame(),
+                            channel_set, channel, conv);
+                  frames = view.frames;
+                }
+              else
+                {
+                  const saInputSpan view = is->Acquire(readSize);
+                  WriteView(view.samples, view.frames, is->GetSamplesPerFrame(),
+                            channel_set, channel,
+                            [](const saDeviceType s) { return s; });
+                  frames = view.frames;
+                }
+              if (frames > 0)
+                {
+                  is->Release(frames);
+                  framesSoFar += frames;
+                  views++;
+                }
+            }
+          while (frames > 0);
+          std::cerr << "Acquired " << framesSoFar << " frames in "
+                    << views << " views\n";
+          std::cerr << "EndOfSource() " << is->EndOfSource() << "\n";
+          std::cerr << "Frames read from stream " 
+                    << is->GetFramesReadFromStream() << "\n" ;
+        }
+
+      // Test reading all channels in one pass. Frames are read readSize at
+      // a time until the end of the source and written out interleaved,
+      // or for the selected channel, as for the read test. The capture
+      // time of the newest frame read is never in the future.
+      if ( deinterleave_test )
+        {
+          std::cerr << "Test de-interleaved read" << "\n";
+
+          std::size_t framesSoFar = 0;
+          std::size_t framesThisRead = 0;
+          std::size_t futureTimestamps = 0;
+          std::vector< std::vector< saSample > > bufs;
+          do
+            {
+              for (std::size_t c=0; c<bufs.size(); c++)
+                {
+                  bufs[c].clear();
+                }
+              framesThisRead = is->Read(bufs, readSize);
+              if (is->GetTimestamp() > saTimestampNow())
+                {
+                  futureTimestamps++;
+                }
+              for (std::size_t k=0; k<framesThisRead; k++)
+                {
+                  for (std::size_t c=0; c<bufs.size(); c++)
+                    {
+                      if (!channel_set || (c == channel))
+                        {
+                          std::cout << conv(bufs[c][k]) << "\n";
+                        }
+                    }
+                }
+              framesSoFar += framesThisRead;
+            }
+          while (framesThisRead > 0);
+          std::cerr << "Buffers " << bufs.size() << "\n";
+          std::cerr << "EndOfSource() " << is->EndOfSource() << "\n";
+          std::cerr << "Frames read from stream " 
+                    << is->GetFramesReadFromStream()
+                    << " : " << framesSoFar << "\n" ;
+          std::cerr << "Future timestamps " << futureTimestamps << "\n";
+        }
+
+      // Stalls waiting for read-ahead or capture
+      if ((readAhead > 0) || (captureFragments > 0))
+        {
+          std::cerr << "Stalls " << is->GetStalls() << "\n";
+        }
+
+      // Frames dropped by the capture thread
+      if (captureFragments > 0)
+        {
+          std::cerr << "OverRun " << is->OverRun() << "\n";
+        }
+
+      // Read the other polled copies to the end
+      for (std::size_t k=1; k<polled.size(); k++)
+        {
+          std::size_t framesSoFar = 0;
+          std::size_t framesThisRead = 0;
+          std::vector< std::vector< saSample > > bufs;
+          do
+            {
+              for (std::size_t c=0; c<bufs.size(); c++)
+                {
+                  bufs[c].clear();
+                }
+              framesThisRead = polled[k]->Read(bufs, is->GetFramesPerFragment());
+              framesSoFar += framesThisRead;
+            }
+          while (framesThisRead > 0);
+          std::cerr << "Polled " << k << " frames " << framesSoFar
+                    << " OverRun " << polled[k]->OverRun() << "\n";
+        }
+
       // Done. Assume destructor closes stream
     }
   catch(std::exception& excpt)
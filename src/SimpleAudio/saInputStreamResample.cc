@@ -0,0 +1,593 @@
+/// \file saInputStreamResample.cc
+/// \brief Resample an saInputStream to a canonical frame rate
+
+#include <vector>
+#include <memory>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
+#include <numbers>
+
+#include "saSample.h"
+#include "saSampleFast.h"
+#include "saSampleSimd.h"
+#include "saSampleBuffer.h"
+#include "saSampleConvert.h"
+#include "saInputStream.h"
+#include "saInputStreamResample.h"
+
+namespace SimpleAudio
+{
+  // Cut-off frequency of the filter relative to the lower frame rate
+  constexpr double saResampleCutoff = 0.42;
+
+  // Kaiser window parameter for about 80dB stop-band attenuation
+  constexpr double saResampleKaiserBeta = 8.0;
+
+  /// Modified Bessel function of the first kind of order zero, summed as
+  /// the power series of ((x/2)^k/k!)^2. std::cyl_bessel_i is not used
+  /// because libstdc++ computes it with lgamma, which writes the global
+  /// signgam, so resamplers built on different threads would race.
+  /// \param x argument
+  /// \return I0(x)
+  static double saResampleBesselI0(const double x)
+  {
+    double sum = 1;
+    double term = 1;
+    for (std::size_t k=1; term > 1e-17*sum; k++)
+      {
+        const double a = x/(2*static_cast<double>(k));
+        term *= a*a;
+        sum += term;
+      }
+    return sum;
+  }
+
+  class saInputStreamResample : public saInputStream
+  {
+  public:
+    /// \brief Create a resampling stream
+    /// \param stream the stream to resample
+    /// \param framesPerSecond output frame rate
+    /// \param halfLength half the number of taps in each phase when
+    /// upsampling
+    saInputStreamResample( saInputStream* stream,
+                           const std::size_t framesPerSecond,
+                           const std::size_t halfLength );
+
+    ~saInputStreamResample( ) throw() { }
+
+    /// \brief Read a buffer of frames from the saInputStream
+    /// \param buffer vector of saSample
+    /// \param framesToRead frames to read from the stream
+    /// \return number of frames read
+    std::size_t Read( std::vector< saSample >& buffer,
+                      const std::size_t framesToRead);
+
+    /// \brief Read a buffer of samples from the saInputStream
+    /// \param buffer vector of saSample
+    /// \param framesToRead frames to read from the stream
+    /// \param sampleInFrame sample in frame to read
+    /// \return number of frames read
+    std::size_t Read( std::vector< saSample >& buffer,
+                      const std::size_t framesToRead,
+                      const std::size_t sampleInFrame);
+
+    /// \brief Read frames into one buffer per sample in frame
+    /// \param buffers vector of vectors of saSample
+    /// \param framesToRead frames to read from the stream
+    /// \return number of frames read
+    std::size_t Read( std::vector< std::vector< saSample > >& buffers,
+                      const std::size_t framesToRead);
+
+    /// \brief Acquire a view of resampled frames
+    ///
+    /// A fragment of frames is resampled. The view is converted to
+    /// saDeviceType.
+    /// \param maxFrames maximum number of frames in the view
+    /// \return view of at most maxFrames frames
+    saInputSpan Acquire( const std::size_t maxFrames );
+
+    /// \brief Acquire a view of resampled frames as saSample
+    ///
+    /// A fragment of frames is resampled. The view points into it.
+    /// \param maxFrames maximum number of frames in the view
+    /// \return view of at most maxFrames frames
+    saInputSampleSpan AcquireSamples( const std::size_t maxFrames );
+
+    /// \brief Release frames from the last acquired view
+    /// \param frames number of frames consumed
+    void Release( const std::size_t frames );
+
+    /// \brief Clear the stream and the filter history
+    void Clear( );
+
+    /// \brief Check for stream over-runs
+    /// \return stream over run occurred
+    bool OverRun( ) { return inputStream->OverRun(); }
+
+    /// \brief Check for stream end-of-source
+    /// \return the input has ended and no more frames can be resampled
+    bool EndOfSource( );
+
+    /// \brief Get frame rate
+    /// \return frames per second
+    std::size_t GetFramesPerSecond() const { return framesPerSecond; }
+
+    /// \brief Get samples per frame
+    /// \return samples per frame
+    std::size_t GetSamplesPerFrame() const { return samplesPerFrame; }
+
+    /// \brief Get frames per fragment
+    /// \return resampled frames per input fragment, rounded up
+    std::size_t GetFramesPerFragment() const { return framesPerFragment; }
+
+    /// \brief Get capacity of the stream
+    /// \return resampled frames per stream
+    std::size_t GetFramesPerStream() const { return framesPerStream; }
+
+    /// \brief Get frames read from the stream
+    /// \return frames read from the stream
+    std::size_t GetFramesReadFromStream() const { return framesReadFromStream; }
+
+    /// \brief Get the number of times the input waited for read-ahead
+    /// \return number of stalls
+    std::size_t GetStalls() const { return inputStream->GetStalls(); }
+
+    /// \brief Get the period size granted to the input device
+    /// \return input frames per period
+    std::size_t GetFramesPerPeriod() const
+    { return inputStream->GetFramesPerPeriod(); }
+
+    /// \brief Get the number of periods granted to the input device
+    /// \return periods per buffer
+    std::size_t GetPeriodsPerBuffer() const
+    { return inputStream->GetPeriodsPerBuffer(); }
+
+    /// \brief Get the buffer size granted to the input device
+    /// \return input frames per buffer
+    std::size_t GetFramesPerBuffer() const
+    { return inputStream->GetFramesPerBuffer(); }
+
+    /// \brief Get the capture time of the newest input frame read
+    /// \return timestamp of the newest frame
+    saTimestamp GetTimestamp() const { return inputStream->GetTimestamp(); }
+
+  private:
+    /// Read frames into one buffer per channel. Frames remaining in the
+    /// acquired fragment are read first.
+    /// \param buffers vector of vectors of saSample
+    /// \param framesToRead frames to read
+    /// \param first first channel to read
+    /// \param last one past the last channel to read
+    /// \return number of frames read
+    std::size_t ReadChannels( std::vector< std::vector< saSample > >& buffers,
+                              const std::size_t framesToRead,
+                              const std::size_t first,
+                              const std::size_t last );
+
+    /// Resample frames into one buffer per channel. The inputs of all the
+    /// channels are consumed, but only the channels read are filtered.
+    /// \param buffers vector of vectors of saSample
+    /// \param framesToRead frames to resample
+    /// \param first first channel to resample
+    /// \param last one past the last channel to resample
+    /// \return number of frames resampled
+    std::size_t Resample( std::vector< std::vector< saSample > >& buffers,
+                          const std::size_t framesToRead,
+                          const std::size_t first,
+                          const std::size_t last );
+
+    /// Resample a fragment if the acquired one has been consumed and set
+    /// the frames acquired
+    /// \param maxFrames maximum number of frames to acquire
+    void AcquireFrames( const std::size_t maxFrames );
+
+    /// Read a fragment from the input into the filter history
+    /// \return false if no frames were read
+    bool Fill( );
+
+    /// Stream to resample
+    std::unique_ptr<saInputStream> inputStream;
+
+    /// Output frame rate
+    std::size_t framesPerSecond;
+
+    /// Number of samples in a frame
+    std::size_t samplesPerFrame;
+
+    /// Upsampling factor L
+    std::size_t upSample;
+
+    /// Downsampling factor M
+    std::size_t downSample;
+
+    /// Number of taps in each phase K
+    std::size_t tapsPerPhase;
+
+    /// Output frames per input fragment
+    std::size_t framesPerFragment;
+
+    /// Output frames per stream
+    std::size_t framesPerStream;
+
+    /// Frames read from stream
+    std::size_t framesReadFromStream;
+
+    /// Filter phases. The taps are reversed so that each output is the
+    /// inner product of a phase with consecutive input samples.
+    std::vector< saSampleBuffer > phases;
+
+    /// Input samples of each channel preceded by K-1 zeros
+    std::vector< saSampleBuffer > history;
+
+    /// Phase of the next output
+    std::size_t phase;
+
+    /// Index in the history of the first input to the next output
+    std::size_t offset;
+
+    /// Frames read from the input
+    std::vector< std::vector< saSample > > inputs;
+
+    /// Frames resampled for the interleaved reads and Acquire
+    std::vector< std::vector< saSample > > outputs;
+
+    /// Interleaved resampled frames of the acquired fragment
+    std::vector< saSample > fragment;
+
+    /// Acquired view converted to saDeviceType
+    std::vector< saDeviceType > stagedSamples;
+
+    /// Frames in the acquired fragment
+    std::size_t fragmentFrames;
+
+    /// Frames read from the acquired fragment
+    std::size_t framesReadFromFragment;
+
+    /// Frames in the last acquired view
+    std::size_t framesAcquired;
+
+    /// Disallow assignment to saInputStreamResample
+    saInputStreamResample& operator=( const saInputStreamResample& );
+
+    /// Disallow copy constructor of saInputStreamResample
+    saInputStreamResample( const saInputStreamResample& );
+  };
+
+  saInputStreamResample::saInputStreamResample
+  ( saInputStream* stream,
+    const std::size_t _framesPerSecond,
+    const std::size_t halfLength )
+    : inputStream( stream ),
+      framesPerSecond( _framesPerSecond ),
+      samplesPerFrame( inputStream->GetSamplesPerFrame() ),
+      upSample( 1 ),
+      downSample( 1 ),
+      tapsPerPhase( 0 ),
+      framesPerFragment( 0 ),
+      framesPerStream( 0 ),
+      framesReadFromStream( 0 ),
+      history( samplesPerFrame ),
+      phase( 0 ),
+      offset( 0 ),
+      inputs( samplesPerFrame ),
+      outputs( samplesPerFrame ),
+      fragmentFrames( 0 ),
+      framesReadFromFragment( 0 ),
+      framesAcquired( 0 )
+  {
+    // Sanity checks
+    const std::size_t inputFramesPerSecond = inputStream->GetFramesPerSecond();
+    if ( (framesPerSecond == 0) || (inputFramesPerSecond == 0) )
+      {
+        throw std::runtime_error("Illegal resampling frame rate");
+      }
+    if (halfLength == 0)
+      {
+        throw std::runtime_error("Illegal resampling filter length");
+      }
+
+    // Rational ratio L/M of the frame rates
+    const std::size_t g = std::gcd(framesPerSecond, inputFramesPerSecond);
+    upSample = framesPerSecond/g;
+    downSample = inputFramesPerSecond/g;
+
+    // When downsampling the filter is longer by the ratio of the rates to
+    // keep the transition band narrow at the output rate
+    tapsPerPhase = 2*halfLength*((downSample+upSample-1)/upSample);
+
+    // Stream sizes. Output n is made from input n*M/L.
+    const std::size_t inputFramesPerFragment =
+      inputStream->GetFramesPerFragment();
+    framesPerFragment =
+      ((inputFramesPerFragment*upSample)+downSample-1)/downSample;
+    const std::size_t inputFramesPerStream = inputStream->GetFramesPerStream();
+    framesPerStream = inputFramesPerStream == 0 ? 0 :
+      (((inputFramesPerStream-1)*upSample)/downSample)+1;
+
+    // Windowed-sinc prototype filter at the upsampled rate with a gain of
+    // L. Tap m of the prototype is tap m/L of phase m%L.
+    const std::size_t N = tapsPerPhase*upSample;
+    const double centre = static_cast<double>(N-1)/2;
+    const double fc = saResampleCutoff*
+      std::min(1.0, static_cast<double>(upSample)/
+               static_cast<double>(downSample))/
+      static_cast<double>(upSample);
+    const double pi = std::numbers::pi_v<double>;
+    const double i0Beta = saResampleBesselI0(saResampleKaiserBeta);
+    std::vector<double> prototype(N);
+    for (std::size_t m=0; m<N; m++)
+      {
+        const double t = static_cast<double>(m)-centre;
+        const double x = 2*fc*t;
+        const double sinc =
+          t == 0 ? 1 : std::sin(pi*x)/(pi*x);
+        const double r = N == 1 ? 0 : t/centre;
+        const double w = saResampleBesselI0
+          (saResampleKaiserBeta*std::sqrt(std::max(0.0, 1-(r*r))))/i0Beta;
+        prototype[m] = 2*fc*sinc*w*static_cast<double>(upSample);
+      }
+
+    // Reverse the taps of each phase and normalise each phase to unit gain
+    phases.resize(upSample);
+    for (std::size_t p=0; p<upSample; p++)
+      {
+        double sum = 0;
+        for (std::size_t k=0; k<tapsPerPhase; k++)
+          {
+            sum += prototype[p+(k*upSample)];
+          }
+        phases[p].Resize(tapsPerPhase);
+        for (std::size_t k=0; k<tapsPerPhase; k++)
+          {
+            phases[p][tapsPerPhase-1-k] =
+              saSample(static_cast<float>(prototype[p+(k*upSample)]/sum));
+          }
+      }
+
+    // Start with an empty history
+    for (std::size_t c=0; c<samplesPerFrame; c++)
+      {
+        history[c].Assign(tapsPerPhase-1, 0);
+      }
+  }
+
+  bool saInputStreamResample::Fill( )
+  {
+    for (std::size_t c=0; c<samplesPerFrame; c++)
+      {
+        inputs[c].clear();
+      }
+    const std::size_t n =
+      inputStream->Read(inputs, inputStream->GetFramesPerFragment());
+    if (n == 0)
+      {
+        return false;
+      }
+
+    // Discard inputs that no output needs
+    for (std::size_t c=0; c<samplesPerFrame; c++)
+      {
+        history[c].Discard(offset);
+        history[c].Append(inputs[c].data(), n);
+      }
+    offset = 0;
+    return true;
+  }
+
+  std::size_t
+  saInputStreamResample::Resample
+  ( std::vector< std::vector< saSample > >& buffers,
+    const std::size_t framesToRead,
+    const std::size_t first,
+    const std::size_t last )
+  {
+    std::size_t framesRead = 0;
+    while (framesRead < framesToRead)
+      {
+        // Each output needs K inputs
+        if ( ((offset+tapsPerPhase) > history[0].Size()) && !Fill() )
+          {
+            break;
+          }
+
+        // Resample the frames available
+        while ( (framesRead < framesToRead) &&
+                ((offset+tapsPerPhase) <= history[0].Size()) )
+          {
+            const saSample* const h = phases[phase].Data();
+            for (std::size_t c=first; c<last; c++)
+              {
+                buffers[c].push_back
+                  (saSampleDot(history[c].Data()+offset, h, tapsPerPhase).
+                   Checked());
+              }
+            phase += downSample;
+            offset += phase/upSample;
+            phase %= upSample;
+            framesRead++;
+          }
+      }
+    return framesRead;
+  }
+
+  std::size_t
+  saInputStreamResample::ReadChannels
+  ( std::vector< std::vector< saSample > >& buffers,
+    const std::size_t framesToRead,
+    const std::size_t first,
+    const std::size_t last )
+  {
+    // Any acquired view is invalidated
+    framesAcquired = 0;
+
+    // One buffer per sample in frame
+    buffers.resize(samplesPerFrame);
+
+    // Frames remaining in the acquired fragment
+    const std::size_t n =
+      std::min(framesToRead, fragmentFrames-framesReadFromFragment);
+    if (n > 0)
+      {
+        for (std::size_t c=first; c<last; c++)
+          {
+            const saSample* u =
+              &(fragment[(samplesPerFrame*framesReadFromFragment)+c]);
+            for (std::size_t k=0; k<n; k++, u+=samplesPerFrame)
+              {
+                buffers[c].push_back(*u);
+              }
+          }
+        framesReadFromFragment += n;
+      }
+
+    // Resample the rest
+    const std::size_t framesRead =
+      n+Resample(buffers, framesToRead-n, first, last);
+    framesReadFromStream += framesRead;
+    return framesRead;
+  }
+
+  std::size_t saInputStreamResample::Read( std::vector< saSample >& buffer,
+                                           const std::size_t framesToRead )
+  {
+    for (std::size_t c=0; c<samplesPerFrame; c++)
+      {
+        outputs[c].clear();
+      }
+    const std::size_t framesRead =
+      ReadChannels(outputs, framesToRead, 0, samplesPerFrame);
+    for (std::size_t k=0; k<framesRead; k++)
+      {
+        for (std::size_t c=0; c<samplesPerFrame; c++)
+          {
+            buffer.push_back(outputs[c][k]);
+          }
+      }
+    return framesRead;
+  }
+
+  std::size_t saInputStreamResample::Read( std::vector< saSample >& buffer,
+                                           const std::size_t framesToRead,
+                                           const std::size_t sampleInFrame )
+  {
+    // Sanity check (sampleInFrame is zero-based)
+    if (sampleInFrame >= samplesPerFrame)
+      {
+        throw std::runtime_error("Illegal sampleInFrame");
+      }
+
+    // Only the channel read is resampled
+    outputs[sampleInFrame].clear();
+    const std::size_t framesRead =
+      ReadChannels(outputs, framesToRead, sampleInFrame, sampleInFrame+1);
+    buffer.insert(buffer.end(), outputs[sampleInFrame].begin(),
+                  outputs[sampleInFrame].end());
+    return framesRead;
+  }
+
+  std::size_t
+  saInputStreamResample::Read( std::vector< std::vector< saSample > >& buffers,
+                               const std::size_t framesToRead )
+  {
+    return ReadChannels(buffers, framesToRead, 0, samplesPerFrame);
+  }
+
+  void saInputStreamResample::AcquireFrames( const std::size_t maxFrames )
+  {
+    // Resample another fragment if this one has been consumed
+    if (framesReadFromFragment == fragmentFrames)
+      {
+        for (std::size_t c=0; c<samplesPerFrame; c++)
+          {
+            outputs[c].clear();
+          }
+        fragmentFrames =
+          Resample(outputs, framesPerFragment, 0, samplesPerFrame);
+        framesReadFromFragment = 0;
+        fragment.resize(samplesPerFrame*fragmentFrames);
+        for (std::size_t c=0; c<samplesPerFrame; c++)
+          {
+            for (std::size_t k=0; k<fragmentFrames; k++)
+              {
+                fragment[(samplesPerFrame*k)+c] = outputs[c][k];
+              }
+          }
+      }
+    framesAcquired = std::min(maxFrames, fragmentFrames-framesReadFromFragment);
+  }
+
+  saInputSpan saInputStreamResample::Acquire( const std::size_t maxFrames )
+  {
+    // View the remaining frames in the fragment converted to saDeviceType
+    AcquireFrames(maxFrames);
+    saInputSpan view;
+    view.frames = framesAcquired;
+    if (framesAcquired > 0)
+      {
+        const std::size_t n = samplesPerFrame*framesAcquired;
+        stagedSamples.resize(n);
+        saSampleArrayToSink(&(fragment[samplesPerFrame*framesReadFromFragment]),
+                            stagedSamples.data(), n);
+        view.samples = std::span<const saDeviceType>(stagedSamples.data(), n);
+      }
+    return view;
+  }
+
+  saInputSampleSpan
+  saInputStreamResample::AcquireSamples( const std::size_t maxFrames )
+  {
+    // View the remaining frames in the fragment
+    AcquireFrames(maxFrames);
+    saInputSampleSpan view;
+    view.frames = framesAcquired;
+    if (framesAcquired > 0)
+      {
+        view.samples = std::span<const saSample>
+          (&(fragment[samplesPerFrame*framesReadFromFragment]),
+           samplesPerFrame*framesAcquired);
+      }
+    return view;
+  }
+
+  void saInputStreamResample::Release( const std::size_t frames )
+  {
+    if (frames > framesAcquired)
+      {
+        throw std::runtime_error("Release() more frames than acquired");
+      }
+    framesAcquired -= frames;
+    framesReadFromFragment += frames;
+    framesReadFromStream += frames;
+  }
+
+  void saInputStreamResample::Clear( )
+  {
+    inputStream->Clear();
+    for (std::size_t c=0; c<samplesPerFrame; c++)
+      {
+        history[c].Assign(tapsPerPhase-1, 0);
+      }
+    phase = 0;
+    offset = 0;
+    fragmentFrames = 0;
+    framesReadFromFragment = 0;
+    framesAcquired = 0;
+  }
+
+  bool saInputStreamResample::EndOfSource( )
+  {
+    return inputStream->EndOfSource() &&
+      ((offset+tapsPerPhase) > history[0].Size()) &&
+      (framesReadFromFragment == fragmentFrames);
+  }
+
+  saInputStream* saInputStreamOpenResample( saInputStream* stream,
+                                            const std::size_t framesPerSecond,
+                                            const std::size_t halfLength )
+  {
+    return new saInputStreamResample(stream, framesPerSecond, halfLength);
+  }
+}
@@ -0,0 +1,35 @@
+/// \file saInputStreamResample.h
+/// \brief Resample an saInputStream to a canonical frame rate
+///
+/// The resampling stream reads frames from another stream and resamples
+/// them by the rational ratio L/M of the output and input frame rates with
+/// a polyphase windowed-sinc filter. The filter has L phases of K taps.
+/// The taps are scaled so that the pass-band of the filter ends just below
+/// the lower of the input and output Nyquist frequencies. Each output
+/// sample is the inner product of K input samples with one phase, which is
+/// vectorised. The first output frame is aligned with the first input
+/// frame so the output is delayed by (KL-1)/2L input frames.
+
+#include <cstddef>
+
+#include "saInputStream.h"
+
+#ifndef __SAINPUTSTREAMRESAMPLE_H__
+#define __SAINPUTSTREAMRESAMPLE_H__
+
+namespace SimpleAudio
+{
+  /// \brief Open a stream resampling another stream
+  /// \param stream the stream to resample. The resampling stream takes
+  /// ownership of the stream.
+  /// \param framesPerSecond output frame rate
+  /// \param halfLength half the number of taps in each phase of the filter
+  /// when the output rate is not lower than the input rate. The number of
+  /// taps is scaled by the ratio of the rates when downsampling.
+  /// \return pointer to saInputStream
+  saInputStream* saInputStreamOpenResample( saInputStream* stream,
+                                            const std::size_t framesPerSecond,
+                                            const std::size_t halfLength=16 );
+}
+
+#endif
@@ -0,0 +1,621 @@
+/// \file saInputSynth.cc
+/// \brief Synthetic real-time input sources
+
+#include <iostream>
+#include <sstream>
+#include <memory>
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <algorithm>
+#include <random>
+#include <numbers>
+#include <thread>
+
+#include <cmath>
+#include <cstring>
+#include <cerrno>
+#include <cstdint>
+#include <unistd.h>
+#include <sys/timerfd.h>
+
+#include "saSample.h"
+#include "saSampleConvert.h"
+#include "saInputSource.h"
+#include "saInputSynth.h"
+#include "saInputFileSelector.h"
+
+namespace SimpleAudio
+{
+  class saInputSynth : public saInputSource
+  {
+  public:
+    saInputSynth(const std::string& name,
+                 const std::size_t fps,
+                 const std::size_t ms,
+                 const std::size_t channels,
+                 const std::size_t periods,
+                 const saSampleFormat format);
+
+    ~saInputSynth() throw();
+
+    /// \brief Generate a period of frames when it is due
+    /// \param numValid number of valid frames in the fragment. None if
+    /// non-blocking and the period is not yet due.
+    /// \return saInputFragment
+    saInputFragment Collect(std::size_t& numValid);
+
+    /// \brief Release fragment storage
+    /// \param fragment
+    void Release([[maybe_unused]] const saInputFragment fragment) { }
+
+    /// \brief Clear the source
+    void Clear( ) { isOverRun = false; }
+
+    /// \brief Check for source over-runs
+    /// \return source over run occurred
+    bool OverRun( ) { return isOverRun; }
+
+    /// \brief A synthetic source never ends
+    /// \return false
+    bool EndOfSource( ) { return false; }
+
+    /// \brief Get frame rate
+    /// \return frames per second
+    std::size_t GetFramesPerSecond( ) const { return framesPerSecond; }
+
+    /// \brief Get samples per frame
+    /// \return samples per frame
+    std::size_t GetSamplesPerFrame( ) const { return samplesPerFrame; }
+
+    /// \brief Get the sample format
+    /// \return sample format
+    saSampleFormat GetSampleFormat( ) const { return sampleFormat; }
+
+    /// \brief Get the time the newest frame of the last fragment was due,
+    ///        before any jitter or stall
+    /// \return timestamp of the newest frame
+    saTimestamp GetTimestamp( ) const { return timestamp; }
+
+    /// \brief Get frames per fragment
+    /// \return frames per fragment
+    std::size_t GetFramesPerFragment( ) const { return framesPerFragment; }
+
+    /// \brief Get frames per source
+    /// \return frames per source
+    std::size_t GetFramesPerSource( ) const { return framesPerFragment; }
+
+    /// \brief Get frames read from source
+    /// \return frames read from source
+    std::size_t GetFramesReadFromSource( ) const { return framesReadFromSource; }
+
+    /// \brief Get latency (buffer size) in milliseconds
+    /// \return latency
+    std::size_t GetMsDeviceLatency( ) const
+    { return (framesPerBuffer*1000)/framesPerSecond; }
+
+    /// \brief Get the period size
+    /// \return frames per period
+    std::size_t GetFramesPerPeriod( ) const { return framesPerFragment; }
+
+    /// \brief Get the number of periods in the buffer
+    /// \return periods per buffer
+    std::size_t GetPeriodsPerBuffer( ) const { return periodsPerBuffer; }
+
+    /// \brief Get the buffer size
+    /// \return frames per buffer
+    std::size_t GetFramesPerBuffer( ) const { return framesPerBuffer; }
+
+    /// \brief Make Collect return no frames until a period is due
+    /// \return true
+    bool SetNonBlocking( );
+
+    /// \brief Get the descriptors to poll before a non-blocking Collect
+    /// \return a timer descriptor that is readable when a period is due
+    std::vector<pollfd> GetPollDescriptors( );
+
+    /// \brief Check the events returned by poll
+    /// \param fds the descriptors after poll
+    /// \param nfds number of descriptors
+    /// \return a period is due
+    bool PollReady( pollfd* fds, const std::size_t nfds );
+
+  private:
+    /// The kinds of signal generated
+    enum class saSynthSignal { SINE, SAW, NOISE, FILE };
+
+    /// Parse the signal and options of the source name
+    /// \param name source name
+    void Parse(const std::string& name);
+
+    /// Read the file played by the source
+    /// \param fileName name of the file
+    void Load(const std::string& fileName);
+
+    /// Schedule the next period if it is not already scheduled
+    void Schedule( );
+
+    /// Arm the timer for the scheduled period
+    void ArmTimer( );
+
+    /// Generate the frames of the next period into the source buffer
+    void Generate( );
+
+    /// Source name
+    std::string sourceName;
+
+    /// Source over-run flag
+    bool isOverRun;
+
+    /// Frames per second
+    std::size_t framesPerSecond;
+
+    /// Samples per frame
+    std::size_t samplesPerFrame;
+
+    /// Frames per fragment, the period
+    std::size_t framesPerFragment;
+
+    /// Periods the reader may fall behind
+    std::size_t periodsPerBuffer;
+
+    /// Frames per buffer
+    std::size_t framesPerBuffer;
+
+    /// Sample format of the fragments
+    saSampleFormat sampleFormat;
+
+    /// Frames read from source
+    std::size_t framesReadFromSource;
+
+    /// Signal generated
+    saSynthSignal signal;
+
+    /// Frequency of a sine or sawtooth in Hz
+    double frequency;
+
+    /// Peak amplitude of the generated signal
+    float amplitude;
+
+    /// Maximum delay of a period
+    saTimestamp::duration jitter;
+
+    /// Delay of a stalled period
+    saTimestamp::duration stall;
+
+    /// Periods between stalls
+    std::size_t stallPeriods;
+
+    /// Periods between injected over-runs. Zero for none.
+    std::size_t overRunPeriods;
+
+    /// Noise and jitter generator
+    std::minstd_rand generator;
+
+    /// Samples of the file played
+    std::vector<saSample> fileSamples;
+
+    /// Frames of the file played
+    std::size_t fileFrames;
+
+    /// Index of the first frame of the next period
+    std::size_t nextFrame;
+
+    /// Periods scheduled
+    std::size_t periodsScheduled;
+
+    /// The clock has started
+    bool isStarted;
+
+    /// Time of frame zero
+    saTimestamp startTime;
+
+    /// The next period is scheduled
+    bool isScheduled;
+
+    /// Time the newest frame of the next period is captured
+    saTimestamp captureTime;
+
+    /// Time the next period is delivered, after jitter and stalls
+    saTimestamp readyTime;
+
+    /// Collect returns without waiting
+    bool isNonBlocking;
+
+    /// Timer polled in non-blocking mode
+    int timerFd;
+
+    /// Generated values of a fragment
+    std::vector<float> floatBuffer;
+
+    /// Samples of a fragment
+    std::vector<saSample> sampleBuffer;
+
+    /// Bytes of the samples of a fragment
+    std::vector<uint8_t> sourceBuffer;
+
+    /// Capture time of the newest frame of the last fragment collected
+    saTimestamp timestamp;
+  };
+
+  saInputSynth::saInputSynth(const std::string& name,
+                             const std::size_t fps,
+                             const std::size_t ms,
+                             const std::size_t channels,
+                             const std::size_t periods,
+                             const saSampleFormat format)
+    : sourceName( name ),
+      isOverRun( false ),
+      framesPerSecond( fps ),
+      samplesPerFrame( channels ),
+      framesPerFragment( 0 ),
+      periodsPerBuffer( std::max(periods, std::size_t(1)) ),
+      framesPerBuffer( 0 ),
+      sampleFormat( format ),
+      framesReadFromSource( 0 ),
+      signal( saSynthSignal::SINE ),
+      frequency( 0 ),
+      amplitude( 0.5f ),
+      jitter( saTimestamp::duration::zero() ),
+      stall( saTimestamp::duration::zero() ),
+      stallPeriods( 100 ),
+      overRunPeriods( 0 ),
+      generator( 1 ),
+      fileFrames( 0 ),
+      nextFrame( 0 ),
+      periodsScheduled( 0 ),
+      isStarted( false ),
+      isScheduled( false ),
+      isNonBlocking( false ),
+      timerFd( -1 )
+  {
+    Parse(name);
+    if ((framesPerSecond == 0) || (samplesPerFrame == 0))
+      {
+        throw std::runtime_error("synth source " + name +
+                                 " has no frame rate or channels");
+      }
+    framesPerFragment = std::max((framesPerSecond*ms)/1000, std::size_t(1));
+    framesPerBuffer = framesPerFragment*periodsPerBuffer;
+    floatBuffer.assign(framesPerFragment*samplesPerFrame, 0.0f);
+    sampleBuffer.assign(framesPerFragment*samplesPerFrame, saSample());
+    sourceBuffer.assign(framesPerFragment*GetBytesPerFrame(), 0);
+  }
+
+  saInputSynth::~saInputSynth() throw()
+  {
+    if (timerFd >= 0)
+      {
+        close(timerFd);
+      }
+  }
+
+  void saInputSynth::Parse(const std::string& name)
+  {
+    std::istringstream fields(name.substr(std::string("synth:").size()));
+    std::string field;
+    std::getline(fields, field, ',');
+    if ((field.size() > 3) &&
+        ((field.compare(0, 3, "sin") == 0) || (field.compare(0, 3, "saw") == 0)))
+      {
+        signal = (field[1] == 'i') ? saSynthSignal::SINE : saSynthSignal::SAW;
+        std::istringstream(field.substr(3)) >> frequency;
+        if (!(frequency > 0))
+          {
+            throw std::runtime_error("synth source " + name +
+                                     " has no frequency");
+          }
+      }
+    else if (field == "noise")
+      {
+        signal = saSynthSignal::NOISE;
+      }
+    else if (field.find('.') != std::string::npos)
+      {
+        signal = saSynthSignal::FILE;
+        Load(field);
+      }
+    else
+      {
+        throw std::runtime_error("unknown synth signal " + field);
+      }
+
+    while (std::getline(fields, field, ','))
+      {
+        const std::size_t eq = field.find('=');
+        if (eq == std::string::npos)
+          {
+            throw std::runtime_error("synth option " + field + " has no value");
+          }
+        const std::string option = field.substr(0, eq);
+        std::istringstream value(field.substr(eq+1));
+        double ms = 0;
+        if (option == "amp")
+          {
+            value >> amplitude;
+          }
+        else if (option == "jitter")
+          {
+            value >> ms;
+            jitter = std::chrono::duration_cast<saTimestamp::duration>
+              (std::chrono::duration<double, std::milli>(ms));
+          }
+        else if (option == "stall")
+          {
+            value >> ms;
+            stall = std::chrono::duration_cast<saTimestamp::duration>
+              (std::chrono::duration<double, std::milli>(ms));
+          }
+        else if (option == "every")
+          {
+            value >> stallPeriods;
+          }
+        else if (option == "overrun")
+          {
+            value >> overRunPeriods;
+          }
+        else if (option == "seed")
+          {
+            std::uint_fast32_t seed = 1;
+            value >> seed;
+            generator.seed(seed);
+          }
+        else if (option == "format")
+          {
+            const std::string format = value.str();
+            if (!saSampleFormatFromName(format, sampleFormat))
+              {
+                throw std::runtime_error("unknown sample format " + format);
+              }
+          }
+        else
+          {
+            throw std::runtime_error("unknown synth option " + option);
+          }
+        if (value.fail())
+          {
+            throw std::runtime_error("bad value of synth option " + field);
+          }
+      }
+    stallPeriods = std::max(stallPeriods, std::size_t(1));
+  }
+
+  void saInputSynth::Load(const std::string& fileName)
+  {
+    std::unique_ptr<saInputSource> file
+      (saSingletonInputFileSelector::Instance().OpenFile(fileName));
+    framesPerSecond = file->GetFramesPerSecond();
+    samplesPerFrame = file->GetSamplesPerFrame();
+    while (!file->EndOfSource())
+      {
+        std::size_t validFrames = 0;
+        const saInputFragment fragment = file->Collect(validFrames);
+        const std::size_t numSamples = validFrames*samplesPerFrame;
+        fileSamples.resize(fileSamples.size() + numSamples);
+        saSampleArrayFromSource(file->GetSampleFormat(), fragment,
+                                fileSamples.data() + fileSamples.size() -
+                                numSamples, numSamples);
+        file->Release(fragment);
+      }
+    fileFrames = fileSamples.size()/samplesPerFrame;
+    if (fileFrames == 0)
+      {
+        throw std::runtime_error("synth file " + fileName + " is empty");
+      }
+  }
+
+  void saInputSynth::Schedule( )
+  {
+    if (isScheduled)
+      {
+        return;
+      }
+
+    // Drop a buffer of frames, as if the reader had fallen behind
+    periodsScheduled++;
+    if ((overRunPeriods > 0) && ((periodsScheduled % overRunPeriods) == 0))
+      {
+        isOverRun = true;
+        nextFrame += framesPerBuffer;
+      }
+
+    // The period is captured on the clock and delivered late by the jitter
+    // and any stall
+    captureTime = startTime +
+      saTimestampFrames(nextFrame+framesPerFragment, framesPerSecond);
+    readyTime = captureTime;
+    if (jitter > saTimestamp::duration::zero())
+      {
+        std::uniform_int_distribution<saTimestamp::rep>
+          delay(0, jitter.count());
+        readyTime += saTimestamp::duration(delay(generator));
+      }
+    if ((periodsScheduled % stallPeriods) == 0)
+      {
+        readyTime += stall;
+      }
+    isScheduled = true;
+  }
+
+  void saInputSynth::ArmTimer( )
+  {
+    const std::chrono::nanoseconds ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>
+      (readyTime.time_since_epoch());
+    itimerspec spec;
+    std::memset(&spec, 0, sizeof(spec));
+    spec.it_value.tv_sec = static_cast<time_t>(ns.count()/1000000000);
+    spec.it_value.tv_nsec = static_cast<long>(ns.count()%1000000000);
+    if ((spec.it_value.tv_sec == 0) && (spec.it_value.tv_nsec == 0))
+      {
+        spec.it_value.tv_nsec = 1;
+      }
+    if (timerfd_settime(timerFd, TFD_TIMER_ABSTIME, &spec, 0) < 0)
+      {
+        throw std::runtime_error
+          (std::string("cannot arm synth timer: ") + std::strerror(errno));
+      }
+  }
+
+  void saInputSynth::Generate( )
+  {
+    const std::size_t numSamples = framesPerFragment*samplesPerFrame;
+    if (signal == saSynthSignal::FILE)
+      {
+        for (std::size_t f=0; f<framesPerFragment; f++)
+          {
+            const std::size_t fileFrame = (nextFrame+f)%fileFrames;
+            std::copy_n(fileSamples.begin() + fileFrame*samplesPerFrame,
+                        samplesPerFrame,
+                        sampleBuffer.begin() + f*samplesPerFrame);
+          }
+      }
+    else
+      {
+        std::uniform_real_distribution<float> noise(-amplitude, amplitude);
+        for (std::size_t f=0; f<framesPerFragment; f++)
+          {
+            const double cycles = (frequency*static_cast<double>(nextFrame+f))/
+              static_cast<double>(framesPerSecond);
+            float value = 0;
+            switch (signal)
+              {
+              case saSynthSignal::SINE:
+                value = amplitude*static_cast<float>
+                  (std::sin(2*std::numbers::pi*(cycles - std::floor(cycles))));
+                break;
+              case saSynthSignal::SAW:
+                value = amplitude*static_cast<float>
+                  (2*(cycles - std::floor(cycles)) - 1);
+                break;
+              default:
+                value = noise(generator);
+                break;
+              }
+            std::fill_n(floatBuffer.begin() + f*samplesPerFrame,
+                        samplesPerFrame, value);
+          }
+        saSampleArrayFromSource(floatBuffer.data(), sampleBuffer.data(),
+                                numSamples);
+      }
+    saSampleArrayToSink(sampleBuffer.data(), sampleFormat,
+                        sourceBuffer.data(), numSamples);
+  }
+
+  saInputSource::saInputFragment saInputSynth::Collect(std::size_t& numValid)
+  {
+    const saInputFragment fragment =
+      reinterpret_cast<saInputFragment>(sourceBuffer.data());
+    if (!isStarted)
+      {
+        startTime = saTimestampNow();
+        isStarted = true;
+      }
+
+    // Wait for the next period. A reader more than a buffer behind the
+    // clock over-runs and restarts at the current period.
+    while (true)
+      {
+        Schedule();
+        const saTimestamp now = saTimestampNow();
+        const saTimestamp::duration buffer =
+          saTimestampFrames(framesPerBuffer, framesPerSecond);
+        if (now > captureTime + buffer)
+          {
+            isOverRun = true;
+            const std::size_t elapsed = static_cast<std::size_t>
+              (std::chrono::duration_cast<std::chrono::nanoseconds>
+               (now - startTime).count()*
+               static_cast<long double>(framesPerSecond)/1e9L);
+            nextFrame = std::max(nextFrame,
+                                 (elapsed/framesPerFragment)*framesPerFragment);
+            isScheduled = false;
+            continue;
+          }
+        if (now >= readyTime)
+          {
+            break;
+          }
+        if (isNonBlocking)
+          {
+            ArmTimer();
+            numValid = 0;
+            return fragment;
+          }
+        std::this_thread::sleep_until(readyTime);
+      }
+
+    Generate();
+    timestamp = captureTime;
+    nextFrame += framesPerFragment;
+    framesReadFromSource += framesPerFragment;
+    isScheduled = false;
+    if (isNonBlocking)
+      {
+        Schedule();
+        ArmTimer();
+      }
+    numValid = framesPerFragment;
+    return fragment;
+  }
+
+  bool saInputSynth::SetNonBlocking( )
+  {
+    if (timerFd < 0)
+      {
+        timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (timerFd < 0)
+          {
+            throw std::runtime_error
+              (std::string("cannot create synth timer: ") +
+               std::strerror(errno));
+          }
+      }
+    isNonBlocking = true;
+    return true;
+  }
+
+  std::vector<pollfd> saInputSynth::GetPollDescriptors( )
+  {
+    if (timerFd < 0)
+      {
+        throw std::runtime_error("synth source " + sourceName +
+                                 " is not non-blocking");
+      }
+    pollfd fd;
+    fd.fd = timerFd;
+    fd.events = POLLIN;
+    fd.revents = 0;
+    return std::vector<pollfd>(1, fd);
+  }
+
+  bool saInputSynth::PollReady( pollfd* fds, const std::size_t nfds )
+  {
+    if ((nfds == 0) || ((fds[0].revents & (POLLIN | POLLERR)) == 0))
+      {
+        return false;
+      }
+
+    // Consume the expiry so that the timer polls again when next armed
+    uint64_t expirations = 0;
+    [[maybe_unused]] const ssize_t err =
+      read(timerFd, &expirations, sizeof(expirations));
+    return true;
+  }
+
+  bool saInputSynthName(const std::string& name)
+  {
+    return name.compare(0, 6, "synth:") == 0;
+  }
+
+  saInputSource* saInputSourceOpenSynth(const std::string& name,
+                                        const std::size_t framesPerSecond,
+                                        const std::size_t msLatency,
+                                        const std::size_t channels,
+                                        const std::size_t periodsPerBuffer,
+                                        const saSampleFormat sampleFormat)
+  {
+    return new saInputSynth(name, framesPerSecond, msLatency, channels,
+                            periodsPerBuffer, sampleFormat);
+  }
+}
@@ -0,0 +1,65 @@
+/// \file saInputSynth.h
+/// \brief Synthetic real-time input sources
+///
+/// A synthetic source generates a test signal and delivers it a period at
+/// a time, paced to the monotonic clock as a capture device would. It can
+/// be opened wherever a device can, so latency and over-run recovery can be
+/// tested without audio hardware. Delivery can be delayed by random jitter
+/// and by periodic stalls, and over-runs can be injected. A reader that
+/// falls more than a buffer behind the clock over-runs, as it would on a
+/// device.
+///
+/// The source is named like a device, "synth:signal[,option=value...]".
+/// The signals are
+///   - sinF    a sine of F Hz
+///   - sawF    a sawtooth of F Hz
+///   - noise   uniform white noise
+///   - a file name, which is played in a loop at the rate and channels of
+///     the file. The file type must be registered with
+///     saSingletonInputFileSelector.
+///
+/// The options are
+///   - amp=A        peak amplitude of a sine, sawtooth or noise, default 0.5
+///   - jitter=ms    delay each period by up to ms milliseconds
+///   - stall=ms     delay a period by ms milliseconds every so often
+///   - every=N      periods between stalls, default 100
+///   - overrun=N    drop a buffer of frames every N periods
+///   - format=F     sample format, S16, S24_3LE, S32, FLOAT or FLOAT64
+///   - seed=N       seed of the noise and jitter generator
+///
+/// For example "synth:sin440,jitter=2,stall=50,every=20".
+
+#include <cstddef>
+#include <string>
+
+#include "saInputSource.h"
+
+#ifndef __SAINPUTSYNTH_H__
+#define __SAINPUTSYNTH_H__
+
+namespace SimpleAudio
+{
+  /// \brief Check for the name of a synthetic source
+  /// \param name device name
+  /// \return the name starts with "synth:"
+  bool saInputSynthName(const std::string& name);
+
+  /// \brief Open a synthetic source
+  /// \param name "synth:" followed by the signal and options
+  /// \param framesPerSecond frame rate, unless a file is played
+  /// \param msLatency period in milliseconds
+  /// \param channels channels per frame, unless a file is played
+  /// \param periodsPerBuffer number of periods the reader may fall behind
+  /// before the source over-runs
+  /// \param sampleFormat sample format, unless given by the format option
+  /// \return A pointer to an saInputSource
+  saInputSource* saInputSourceOpenSynth(const std::string& name,
+                                        const std::size_t framesPerSecond,
+                                        const std::size_t msLatency,
+                                        const std::size_t channels = 1,
+                                        const std::size_t periodsPerBuffer = 2,
+                                        const saSampleFormat sampleFormat =
+                                        saSampleFormat::S16);
+}
+
+#endif
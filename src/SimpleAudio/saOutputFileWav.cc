@@ -168,9 +168,7 @@ namespace SimpleAudio
     // Swap bytes for big-endian
     if ( !saIsLittleEndian() )
       {
-        std::for_each(&(fragment[0]),
-                      &(fragment[samplesPerFrame*validFrames]),
-                      saSwapSample<saSinkType>());
+        saSwapShort(&(fragment[0]), samplesPerFrame*validFrames);
       }
 
     // Write
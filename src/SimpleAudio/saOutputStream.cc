@@ -10,6 +10,7 @@
 #include <memory>
 
 #include "saSample.h"
+#include "saSampleConvert.h"
 #include "saOutputSink.h"
 #include "saOutputStream.h"
 
@@ -141,8 +142,8 @@ namespace SimpleAudio
       }
 
     // Write. Copy samples from the buffer into a fragment Collect'ed from
-    // the device. As the samples are copied they are are transformed to the
-    // saSinkType. When the fragment is full, or there are no more samples,
+    // the device. As the samples are copied they are are converted in bulk
+    // to the saSinkType. When the fragment is full, or there are no more samples,
     // Dispatch the fragment to the device.
     std::size_t samplesWritten = 0;
     std::size_t samplesLeftToWrite = samplesPerFrame*framesToWrite;
@@ -150,11 +151,9 @@ namespace SimpleAudio
       {
         if (samplesSpaceRemainingInFragment >= samplesLeftToWrite)
           {
-            std::transform(buffer.begin()+static_cast<long>(samplesWritten), 
-                           buffer.begin()+
-                           static_cast<long>(samplesWritten+samplesLeftToWrite), 
-                           currentFragment+samplesWrittenToFragment,
-                           saSampleToSink<saOutputSink::saSinkType>());
+            saSampleArrayToSink(&(buffer[samplesWritten]),
+                                currentFragment+samplesWrittenToFragment,
+                                samplesLeftToWrite);
             samplesWrittenToFragment += samplesLeftToWrite;
             samplesWritten += samplesLeftToWrite;
             samplesSpaceRemainingInFragment -= samplesLeftToWrite;
@@ -162,11 +161,9 @@ namespace SimpleAudio
           }
         else if (samplesSpaceRemainingInFragment > 0)
           {
-            std::transform(buffer.begin()+static_cast<long>(samplesWritten), 
-                           buffer.begin()+static_cast<long>(samplesWritten)+
-                           static_cast<long>(samplesSpaceRemainingInFragment), 
-                           currentFragment+samplesWrittenToFragment,
-                           saSampleToSink<saOutputSink::saSinkType>());
+            saSampleArrayToSink(&(buffer[samplesWritten]),
+                                currentFragment+samplesWrittenToFragment,
+                                samplesSpaceRemainingInFragment);
             samplesWrittenToFragment += samplesSpaceRemainingInFragment;
             samplesWritten += samplesSpaceRemainingInFragment;
             samplesLeftToWrite -= samplesSpaceRemainingInFragment; 
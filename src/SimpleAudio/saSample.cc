@@ -4,6 +4,7 @@
 #include <iostream>
 
 #include "saSample.h"
+#include "saSampleFast.h"
 
 namespace SimpleAudio
 {
@@ -14,4 +15,12 @@ namespace SimpleAudio
     os << val;
     return os;
   }
+
+  /// Implementation of << for saSampleFast
+  std::ostream& operator<<(std::ostream& os, const saSampleFast& rhs)
+  { 
+    float val = rhs.to<float>();
+    os << val;
+    return os;
+  }
 }
@@ -0,0 +1,41 @@
+/// \file saSampleBuffer.cc
+/// \brief Vectorised reductions on an saSampleBuffer
+///
+/// The padding is zero so the reductions run over the padded length.
+
+#include <algorithm>
+
+#include "saSample.h"
+#include "saSampleFast.h"
+#include "saSampleSimd.h"
+#include "saSampleBuffer.h"
+
+namespace SimpleAudio
+{
+  saSampleFast saSampleBuffer::Dot(const saSampleBuffer& v) const
+  {
+    return saSampleDot(Data(), v.Data(), std::min(PaddedSize(),
+                                                  v.PaddedSize()));
+  }
+
+  saSampleFast saSampleBuffer::Sum() const
+  {
+    return saSampleSum(Data(), PaddedSize());
+  }
+
+  saSampleFast saSampleBuffer::SumOfSquares() const
+  {
+    return saSampleSumOfSquares(Data(), PaddedSize());
+  }
+
+  saSample saSampleBuffer::MaxAbs() const
+  {
+    return saSampleMaxAbs(Data(), PaddedSize());
+  }
+
+  void saSampleBuffer::Scale(const float g)
+  {
+    saSampleScale(Data(), Data(), PaddedSize(), g);
+  }
+
+}
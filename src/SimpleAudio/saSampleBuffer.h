@@ -0,0 +1,194 @@
+/// \file saSampleBuffer.h
+/// \brief An aligned, padded array of saSample with vectorised reductions
+///
+/// The storage of an saSampleBuffer is aligned to saSampleBuffer::Alignment
+/// bytes and its length is padded to a whole number of alignment units. The
+/// padding is kept zero so the reductions run over whole SIMD vectors
+/// without a scalar tail. Samples are discarded from the front and
+/// appended at the back so the buffer can hold a sliding window.
+
+// StdC++ headers
+#include <cstddef>
+#include <new>
+#include <vector>
+#include <algorithm>
+
+// Local headers
+#include "saSample.h"
+#include "saSampleFast.h"
+#include "saSampleSimd.h"
+
+#ifndef __SASAMPLEBUFFER_H__
+#define __SASAMPLEBUFFER_H__
+
+namespace SimpleAudio
+{
+  /// \struct saAlignedAllocator
+  /// An allocator returning storage aligned to A bytes
+  /// \tparam T the allocated type
+  /// \tparam A the alignment in bytes
+  template <typename T, std::size_t A>
+  struct saAlignedAllocator
+  {
+    typedef T value_type;
+
+    template <typename U>
+    struct rebind { typedef saAlignedAllocator<U, A> other; };
+
+    saAlignedAllocator() noexcept { }
+
+    template <typename U>
+    saAlignedAllocator(const saAlignedAllocator<U, A>&) noexcept { }
+
+    T* allocate(const std::size_t n)
+    {
+      return static_cast<T*>(::operator new(n*sizeof(T), std::align_val_t(A)));
+    }
+
+    void deallocate(T* const p, [[maybe_unused]] const std::size_t n) noexcept
+    {
+      ::operator delete(p, std::align_val_t(A));
+    }
+
+    template <typename U>
+    bool operator==(const saAlignedAllocator<U, A>&) const { return true; }
+
+    template <typename U>
+    bool operator!=(const saAlignedAllocator<U, A>&) const { return false; }
+  };
+
+  /// \class saSampleBuffer
+  /// \brief An aligned, padded array of saSample
+  class saSampleBuffer
+  {
+  public:
+    /// Alignment of the storage in bytes
+    constexpr static std::size_t Alignment = 64;
+
+    /// The length of the storage is a multiple of Padding samples
+    constexpr static std::size_t Padding = Alignment/sizeof(saSample);
+
+    static_assert((Padding % saSimdFloat::size()) == 0,
+                  "expect padding to be a whole number of SIMD vectors");
+
+    /// Constructor
+    /// \param n initial number of samples
+    /// \param value initial value of the samples
+    explicit saSampleBuffer(const std::size_t n = 0, const saSample value = 0)
+      : length(0)
+    {
+      Assign(n, value);
+    }
+
+    /// Number of samples in the buffer
+    std::size_t Size() const { return length; }
+
+    /// Number of samples in the buffer including the zero padding
+    std::size_t PaddedSize() const { return Pad(length); }
+
+    /// Number of samples that can be held without reallocation
+    std::size_t Capacity() const { return storage.capacity(); }
+
+    /// Pointer to the aligned storage
+    saSample* Data() { return storage.data(); }
+    const saSample* Data() const { return storage.data(); }
+
+    // Element access and iterators
+    saSample& operator[](const std::size_t k) { return storage[k]; }
+    const saSample& operator[](const std::size_t k) const
+    {
+      return storage[k];
+    }
+    saSample* begin() { return storage.data(); }
+    saSample* end() { return storage.data()+length; }
+    const saSample* begin() const { return storage.data(); }
+    const saSample* end() const { return storage.data()+length; }
+
+    /// Reserve storage
+    /// \param n number of samples
+    void Reserve(const std::size_t n) { storage.reserve(Pad(n)); }
+
+    /// Change the number of samples. New samples are zero.
+    /// \param n new number of samples
+    void Resize(const std::size_t n)
+    {
+      if (n < length)
+        {
+          std::fill(begin()+n, end(), saSample(0));
+        }
+      else if (Pad(n) > storage.size())
+        {
+          storage.resize(Pad(n), 0);
+        }
+      length = n;
+    }
+
+    /// Assign a value to all samples
+    /// \param n new number of samples
+    /// \param value new value of the samples
+    void Assign(const std::size_t n, const saSample value)
+    {
+      Resize(n);
+      std::fill(begin(), end(), value);
+    }
+
+    /// Remove all samples
+    void Clear() { Resize(0); }
+
+    /// Append samples to the back of the buffer
+    /// \param u pointer to the samples
+    /// \param n number of samples
+    void Append(const saSample* const u, const std::size_t n)
+    {
+      const std::size_t k = length;
+      Resize(length+n);
+      std::copy(u, u+n, begin()+k);
+    }
+
+    /// Discard samples from the front of the buffer
+    /// \param n number of samples
+    void Discard(const std::size_t n)
+    {
+      const std::size_t m = std::min(n, length);
+      std::copy(begin()+m, end(), begin());
+      Resize(length-m);
+    }
+
+    /// Inner product with another buffer
+    /// \param v the other buffer
+    /// \return unchecked inner product
+    saSampleFast Dot(const saSampleBuffer& v) const;
+
+    /// Sum of the samples
+    /// \return unchecked sum
+    saSampleFast Sum() const;
+
+    /// Sum of squares of the samples
+    /// \return unchecked sum of squares
+    saSampleFast SumOfSquares() const;
+
+    /// Maximum absolute value of the samples
+    /// \return maximum absolute value
+    saSample MaxAbs() const;
+
+    /// Scale the samples in place
+    /// \param g gain
+    void Scale(const float g);
+
+  private:
+    /// Round up to a multiple of Padding
+    static std::size_t Pad(const std::size_t n)
+    {
+      return ((n+Padding-1)/Padding)*Padding;
+    }
+
+    /// Aligned storage. Elements past length are zero.
+    std::vector<saSample, saAlignedAllocator<saSample, Alignment> > storage;
+
+    /// Number of samples
+    std::size_t length;
+  };
+
+}
+
+#endif
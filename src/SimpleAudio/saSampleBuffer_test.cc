@@ -0,0 +1,150 @@
+/// \file saSampleBuffer_test.cc
+/// \brief Test the aligned saSampleBuffer and its vectorised reductions
+///
+/// Check the alignment and zero padding of saSampleBuffer as it is resized,
+/// appended to and discarded from, and compare the vectorised reductions
+/// with sequential saSampleFast loops. With --bench, time the inner
+/// product.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <numeric>
+#include <functional>
+#include <chrono>
+#include <cstdint>
+#include <cmath>
+
+#include "saSample.h"
+#include "saSampleFast.h"
+#include "saSampleBuffer.h"
+
+using namespace SimpleAudio;
+
+/// Check the alignment and the zero padding of a buffer
+/// \param b the buffer
+/// \return true if the buffer is aligned and the padding is zero
+static bool Check(const saSampleBuffer& b)
+{
+  const bool aligned =
+    (reinterpret_cast<std::uintptr_t>(b.Data()) %
+     saSampleBuffer::Alignment) == 0;
+  bool padded = (b.PaddedSize() % saSampleBuffer::Padding) == 0;
+  for (std::size_t k=b.Size(); k<b.PaddedSize(); k++)
+    {
+      padded = padded && (b[k] == 0);
+    }
+  return (b.Size() == 0) || (aligned && padded);
+}
+
+/// Relative difference
+/// \param a first value
+/// \param b second value
+/// \return relative difference
+static float Relative(const saSample& a, const saSample& b)
+{
+  const float x = a.to<float>();
+  const float y = b.to<float>();
+  return std::abs(x-y)/std::max(std::abs(x), 1.0f);
+}
+
+int main(int argc, char* argv[])
+{
+  const bool bench = (argc > 1) && (std::string(argv[1]) == "--bench");
+
+  // Test signal with a length that is not a multiple of the padding
+  const std::size_t N = 4801;
+  std::vector<saSample> u;
+  for (std::size_t k=0; k<N; k++)
+    {
+      const float t = static_cast<float>(k);
+      u.push_back(saSample(0.5f*sinf(0.0628f*t) + 0.25f*sinf(0.00314f*t)));
+    }
+
+  // Alignment and padding
+  saSampleBuffer b(7, 0.5f);
+  bool ok = Check(b);
+  b.Append(u.data(), N);
+  ok = ok && Check(b) && (b.Size() == N+7) && (b[7] == u[0]);
+  b.Discard(7);
+  ok = ok && Check(b) && (b.Size() == N) && (b[0] == u[0]) &&
+    (b[N-1] == u[N-1]);
+  b.Resize(N-100);
+  ok = ok && Check(b);
+  b.Resize(N);
+  ok = ok && Check(b) && (b[N-1] == 0);
+  b.Discard(N+1);
+  ok = ok && Check(b) && (b.Size() == 0);
+  std::cout << "alignment and padding: " << (ok ? "ok" : "failed")
+            << std::endl;
+
+  // Reductions compared with sequential loops
+  saSampleBuffer x;
+  x.Append(u.data(), N);
+  saSampleBuffer y;
+  y.Append(u.data()+1, N-1);
+  const saSample dot =
+    std::inner_product(u.begin(), u.end()-1, u.begin()+1, saSampleFast(0),
+                       std::plus<saSampleFast>(),
+                       saSampleFastProduct()).Checked();
+  const saSample sumsq =
+    std::inner_product(u.begin(), u.end(), u.begin(), saSampleFast(0),
+                       std::plus<saSampleFast>(),
+                       saSampleFastProduct()).Checked();
+  const saSample sum =
+    std::accumulate(u.begin(), u.end(), saSampleFast(0),
+                    saSampleFastSum()).Checked();
+  std::cout << std::setprecision(6)
+            << "dot " << x.Dot(y).Checked() << " "
+            << (Relative(x.Dot(y).Checked(), dot) < 1e-5f) << std::endl;
+  std::cout << "sum of squares " << x.SumOfSquares().Checked() << " "
+            << (Relative(x.SumOfSquares().Checked(), sumsq) < 1e-5f)
+            << std::endl;
+  std::cout << "sum " << x.Sum().Checked() << " "
+            << (Relative(x.Sum().Checked(), sum) < 1e-5f) << std::endl;
+  float maxAbs = 0;
+  for (std::size_t k=0; k<N; k++)
+    {
+      maxAbs = std::max(maxAbs, std::abs(u[k].to<float>()));
+    }
+  std::cout << "max abs " << x.MaxAbs() << " "
+            << (x.MaxAbs().to<float>() == maxAbs) << std::endl;
+  x.Scale(0.5f);
+  bool scaled = Check(x);
+  for (std::size_t k=0; k<N; k++)
+    {
+      scaled = scaled && (x[k] == saSample(u[k].to<float>()*0.5f));
+    }
+  std::cout << "scale: " << (scaled ? "ok" : "failed") << std::endl;
+
+  // Benchmark
+  if (bench)
+    {
+      const std::size_t repeats = 10000;
+      volatile float sink = 0;
+      auto start = std::chrono::steady_clock::now();
+      for (std::size_t r=0; r<repeats; r++)
+        {
+          sink = std::inner_product(u.begin(), u.end()-1, u.begin()+1,
+                                    saSampleFast(0),
+                                    std::plus<saSampleFast>(),
+                                    saSampleFastProduct()).to<float>();
+        }
+      auto mid = std::chrono::steady_clock::now();
+      for (std::size_t r=0; r<repeats; r++)
+        {
+          sink = x.Dot(y).to<float>();
+        }
+      auto end = std::chrono::steady_clock::now();
+      const double tSeq =
+        std::chrono::duration<double, std::milli>(mid-start).count();
+      const double tSimd =
+        std::chrono::duration<double, std::milli>(end-mid).count();
+      std::cout << std::setprecision(4)
+                << "inner product sequential " << tSeq << "ms, saSampleBuffer "
+                << tSimd << "ms, ratio " << tSeq/tSimd << std::endl;
+    }
+
+  return 0;
+}
@@ -0,0 +1,348 @@
+/// \file saSampleConvert.cc
+/// \brief Bulk conversion of arrays of source and sink values to saSample
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <algorithm>
+#include <bit>
+#include <experimental/simd>
+
+#include "saSample.h"
+#include "saSampleSimd.h"
+#include "saSampleConvert.h"
+
+namespace SimpleAudio
+{
+  // Scale factors from source values to saSample internal values
+  constexpr float saInt16Scale = 1.0f;
+  constexpr float saInt24Scale = 1.0f/256.0f;
+  constexpr float saInt32Scale = 1.0f/65536.0f;
+  constexpr float saFloatScale = saSample::saInternalOne;
+
+  // Saturation limits of saSample internal values
+  constexpr float saInternalMin = -saSample::saInternalOne;
+  constexpr float saInternalMax = saSample::saInternalOne-1;
+
+  // Largest float less than 2^31
+  constexpr float saInt32Max = 2147483520.0f;
+
+  /// Convert an array of integral or float values to scaled floats
+  /// \tparam C the source type
+  /// \param src pointer to the source values
+  /// \param dst pointer to the output values
+  /// \param n number of values
+  /// \param scale scale factor
+  template <typename C>
+  static void ArrayFromSource(const C* const src, float* const dst,
+                              const std::size_t n, const float scale)
+  {
+    typedef stdx::rebind_simd_t<C, saSimdFloat> saSimdSource;
+    const std::size_t W = saSimdFloat::size();
+    const saSimdFloat s = scale;
+    std::size_t k = 0;
+    for (; k+W<=n; k+=W)
+      {
+        const saSimdSource v(src+k, stdx::element_aligned);
+        const saSimdFloat f = stdx::static_simd_cast<saSimdFloat>(v)*s;
+        f.copy_to(dst+k, stdx::element_aligned);
+      }
+    for (; k<n; k++)
+      {
+        dst[k] = static_cast<float>(src[k])*scale;
+      }
+  }
+
+  /// Convert an array of scaled floats to saturated, truncated sink values
+  /// \tparam C the sink type
+  /// \param src pointer to the internal values
+  /// \param dst pointer to the sink values
+  /// \param n number of values
+  /// \param scale scale factor
+  /// \param lo lower saturation limit of the scaled value
+  /// \param hi upper saturation limit of the scaled value
+  template <typename C>
+  static void ArrayToSink(const float* const src, C* const dst,
+                          const std::size_t n, const float scale,
+                          const float lo, const float hi)
+  {
+    typedef stdx::rebind_simd_t<C, saSimdFloat> saSimdSink;
+    const std::size_t W = saSimdFloat::size();
+    const saSimdFloat s = scale;
+    const saSimdFloat l = lo;
+    const saSimdFloat h = hi;
+    std::size_t k = 0;
+    for (; k+W<=n; k+=W)
+      {
+        saSimdFloat f(src+k, stdx::element_aligned);
+        f = stdx::clamp(f*s, l, h);
+        const saSimdSink v = stdx::static_simd_cast<saSimdSink>(f);
+        v.copy_to(dst+k, stdx::element_aligned);
+      }
+    for (; k<n; k++)
+      {
+        dst[k] = static_cast<C>(std::clamp(src[k]*scale, lo, hi));
+      }
+  }
+
+  // GCC vector types for the de-interleaving and unpacking shuffles. The
+  // std::experimental::simd types have no shuffle operations.
+  typedef int16_t saVecInt16 __attribute__((vector_size(16)));
+  typedef uint8_t saVecUInt8 __attribute__((vector_size(32)));
+  typedef int32_t saVecInt32 __attribute__((vector_size(32)));
+  typedef float saVecFloat8 __attribute__((vector_size(32)));
+  constexpr std::size_t saVecFrames = sizeof(saVecInt16)/sizeof(int16_t);
+  constexpr std::size_t saVecInt24s = sizeof(saVecInt32)/sizeof(int32_t);
+
+  /// De-interleave C channels of int16_t frames with shuffles
+  ///
+  /// A block of saVecFrames frames is loaded into C vectors. Each of the
+  /// log2(C) stages splits the even and odd elements of adjacent vector
+  /// pairs so that after the last stage vector c holds channel c.
+  /// \tparam C the number of channels, 2, 4 or 8
+  /// \param src pointer to the interleaved source values
+  /// \param dst pointers to the output arrays
+  /// \param frames number of frames
+  /// \return number of frames converted, a multiple of saVecFrames
+  template <std::size_t C>
+  static std::size_t Deinterleave(const int16_t* const src,
+                                  float* const* const dst,
+                                  const std::size_t frames)
+  {
+    static_assert((C == 2) || (C == 4) || (C == 8),
+                  "expect 2, 4 or 8 channels");
+    std::size_t f = 0;
+    for (; f+saVecFrames<=frames; f+=saVecFrames)
+      {
+        saVecInt16 v[C];
+        std::memcpy(v, src+(C*f), sizeof(v));
+        for (std::size_t stage=1; stage<C; stage*=2)
+          {
+            saVecInt16 w[C];
+            for (std::size_t k=0; k<C/2; k++)
+              {
+                w[k] = __builtin_shufflevector(v[2*k], v[(2*k)+1],
+                                               0, 2, 4, 6, 8, 10, 12, 14);
+                w[k+(C/2)] = __builtin_shufflevector(v[2*k], v[(2*k)+1],
+                                                     1, 3, 5, 7, 9, 11, 13, 15);
+              }
+            std::memcpy(v, w, sizeof(v));
+          }
+        for (std::size_t c=0; c<C; c++)
+          {
+            const saVecFloat8 u = __builtin_convertvector(v[c], saVecFloat8);
+            std::memcpy(dst[c]+f, &u, sizeof(u));
+          }
+      }
+    return f;
+  }
+
+  void saSampleArrayDeinterleave(const int16_t* const src,
+                                 const std::size_t channels,
+                                 saSample* const* const dst,
+                                 const std::size_t frames)
+  {
+    // At most 8 channels are vectorised
+    float* out[8];
+    std::size_t f = 0;
+    if ((channels == 2) || (channels == 4) || (channels == 8))
+      {
+        for (std::size_t c=0; c<channels; c++)
+          {
+            out[c] = saSimdInternal(dst[c]);
+          }
+        switch (channels)
+          {
+          case 2:
+            f = Deinterleave<2>(src, out, frames);
+            break;
+          case 4:
+            f = Deinterleave<4>(src, out, frames);
+            break;
+          default:
+            f = Deinterleave<8>(src, out, frames);
+            break;
+          }
+      }
+
+    // Remaining frames and other numbers of channels, one frame at a time
+    for (; f<frames; f++)
+      {
+        for (std::size_t c=0; c<channels; c++)
+          {
+            saSimdInternal(dst[c])[f] =
+              static_cast<float>(src[(channels*f)+c])*saInt16Scale;
+          }
+      }
+  }
+
+  void saSampleArrayFromSource(const int16_t* const src, saSample* const dst,
+                               const std::size_t n)
+  {
+    ArrayFromSource(src, saSimdInternal(dst), n, saInt16Scale);
+  }
+
+  void saSampleArrayFromSource(const saInt24* const src, saSample* const dst,
+                               const std::size_t n)
+  {
+    // Place the three bytes in the top of an int32_t then scale. On
+    // little-endian hosts blocks of saVecInt24s values are unpacked with
+    // one shuffle, the zero low bytes coming from the second operand.
+    float* const out = saSimdInternal(dst);
+    std::size_t k = 0;
+    if constexpr (std::endian::native == std::endian::little)
+      {
+        const saVecUInt8 zero = {};
+        const saVecFloat8 scale = saVecFloat8{} + saInt32Scale;
+        for (; k+saVecInt24s<=n; k+=saVecInt24s)
+          {
+            saVecUInt8 v = {};
+            std::memcpy(&v, src+k, saVecInt24s*sizeof(saInt24));
+            const saVecUInt8 u = __builtin_shufflevector
+              (v, zero,
+               32,  0,  1,  2, 32,  3,  4,  5, 32,  6,  7,  8, 32,  9, 10, 11,
+               32, 12, 13, 14, 32, 15, 16, 17, 32, 18, 19, 20, 32, 21, 22, 23);
+            saVecInt32 i;
+            std::memcpy(&i, &u, sizeof(i));
+            const saVecFloat8 f = __builtin_convertvector(i, saVecFloat8)*scale;
+            std::memcpy(out+k, &f, sizeof(f));
+          }
+      }
+    for (; k<n; k++)
+      {
+        const uint32_t u =
+          (static_cast<uint32_t>(src[k].bytes[0]) << 8) |
+          (static_cast<uint32_t>(src[k].bytes[1]) << 16) |
+          (static_cast<uint32_t>(src[k].bytes[2]) << 24);
+        out[k] = static_cast<float>(static_cast<int32_t>(u))*saInt32Scale;
+      }
+  }
+
+  void saSampleArrayFromSource(const int32_t* const src, saSample* const dst,
+                               const std::size_t n)
+  {
+    ArrayFromSource(src, saSimdInternal(dst), n, saInt32Scale);
+  }
+
+  void saSampleArrayFromSource(const float* const src, saSample* const dst,
+                               const std::size_t n)
+  {
+    ArrayFromSource(src, saSimdInternal(dst), n, saFloatScale);
+  }
+
+  void saSampleArrayFromSource(const double* const src, saSample* const dst,
+                               const std::size_t n)
+  {
+    ArrayFromSource(src, saSimdInternal(dst), n, saFloatScale);
+  }
+
+  void saSampleArrayFromSource(const saSampleFormat format,
+                               const void* const src, saSample* const dst,
+                               const std::size_t n)
+  {
+    switch (format)
+      {
+      case saSampleFormat::S16:
+        saSampleArrayFromSource(static_cast<const int16_t*>(src), dst, n);
+        break;
+      case saSampleFormat::S24_3LE:
+        saSampleArrayFromSource(static_cast<const saInt24*>(src), dst, n);
+        break;
+      case saSampleFormat::S32:
+        saSampleArrayFromSource(static_cast<const int32_t*>(src), dst, n);
+        break;
+      case saSampleFormat::FLOAT:
+        saSampleArrayFromSource(static_cast<const float*>(src), dst, n);
+        break;
+      case saSampleFormat::FLOAT64:
+        saSampleArrayFromSource(static_cast<const double*>(src), dst, n);
+        break;
+      }
+  }
+
+  void saSampleArrayToSink(const saSample* const src, int16_t* const dst,
+                           const std::size_t n)
+  {
+    ArrayToSink(saSimdInternal(src), dst, n, 1.0f/saInt16Scale,
+                saInternalMin, saInternalMax);
+  }
+
+  void saSampleArrayToSink(const saSample* const src, saInt24* const dst,
+                           const std::size_t n)
+  {
+    const float* const in = saSimdInternal(src);
+    for (std::size_t k=0; k<n; k++)
+      {
+        const int32_t v = static_cast<int32_t>
+          (std::clamp(in[k]/saInt24Scale, saInternalMin/saInt24Scale,
+                      (saInternalMax+1)/saInt24Scale-1));
+        const uint32_t u = static_cast<uint32_t>(v);
+        dst[k].bytes[0] = static_cast<uint8_t>(u);
+        dst[k].bytes[1] = static_cast<uint8_t>(u >> 8);
+        dst[k].bytes[2] = static_cast<uint8_t>(u >> 16);
+      }
+  }
+
+  void saSampleArrayToSink(const saSample* const src, int32_t* const dst,
+                           const std::size_t n)
+  {
+    ArrayToSink(saSimdInternal(src), dst, n, 1.0f/saInt32Scale,
+                saInternalMin/saInt32Scale, saInt32Max);
+  }
+
+  void saSampleArrayToSink(const saSample* const src, float* const dst,
+                           const std::size_t n)
+  {
+    ArrayToSink(saSimdInternal(src), dst, n, 1.0f/saFloatScale, -1.0f, 1.0f);
+  }
+
+  void saSampleArrayToSink(const saSample* const src, double* const dst,
+                           const std::size_t n)
+  {
+    ArrayToSink(saSimdInternal(src), dst, n, 1.0f/saFloatScale, -1.0f, 1.0f);
+  }
+
+  void saSampleArrayToSink(const saSample* const src,
+                           const saSampleFormat format, void* const dst,
+                           const std::size_t n)
+  {
+    switch (format)
+      {
+      case saSampleFormat::S16:
+        saSampleArrayToSink(src, static_cast<int16_t*>(dst), n);
+        break;
+      case saSampleFormat::S24_3LE:
+        saSampleArrayToSink(src, static_cast<saInt24*>(dst), n);
+        break;
+      case saSampleFormat::S32:
+        saSampleArrayToSink(src, static_cast<int32_t*>(dst), n);
+        break;
+      case saSampleFormat::FLOAT:
+        saSampleArrayToSink(src, static_cast<float*>(dst), n);
+        break;
+      case saSampleFormat::FLOAT64:
+        saSampleArrayToSink(src, static_cast<double*>(dst), n);
+        break;
+      }
+  }
+
+  bool saSampleFormatFromName(const std::string& name,
+                              saSampleFormat& format)
+  {
+    for (const saSampleFormat f : { saSampleFormat::S16,
+                                    saSampleFormat::S24_3LE,
+                                    saSampleFormat::S32,
+                                    saSampleFormat::FLOAT,
+                                    saSampleFormat::FLOAT64 })
+      {
+        if (name == saSampleFormatName(f))
+          {
+            format = f;
+            return true;
+          }
+      }
+    return false;
+  }
+
+}
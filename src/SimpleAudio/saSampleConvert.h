@@ -0,0 +1,97 @@
+/// \file saSampleConvert.h
+/// \brief Bulk conversion of arrays of source and sink values to saSample
+///
+/// The array conversions have the same scaling as saSampleFromSource and
+/// saSampleToSink: integral source and sink values lie in the range [-1,1)
+/// and are scaled by saInternalOne. Sink values are saturated and truncated
+/// toward zero. For int16_t the results are identical to the element-wise
+/// functors. The int16_t, int32_t, float and double conversions and the
+/// conversion from packed 24 bit values are vectorised.
+/// Interleaved int16_t frames can be split into per-channel arrays.
+
+// StdC++ headers
+#include <cstddef>
+#include <cstdint>
+
+// Local headers
+#include "saSample.h"
+#include "saDeviceType.h"
+
+#ifndef __SASAMPLECONVERT_H__
+#define __SASAMPLECONVERT_H__
+
+namespace SimpleAudio
+{
+  /// \struct saInt24
+  /// A packed, little-endian, 24 bit signed integer as found in
+  /// S24_3LE device buffers and 24 bit WAV files
+  struct saInt24
+  {
+    uint8_t bytes[3];
+  };
+
+  static_assert(sizeof(saInt24) == 3, "expect saInt24 to be packed");
+
+  /// Convert an array of source values to saSample
+  /// \param src pointer to the source values
+  /// \param dst pointer to the output array
+  /// \param n number of values
+  void saSampleArrayFromSource(const int16_t* src, saSample* dst,
+                               const std::size_t n);
+  void saSampleArrayFromSource(const saInt24* src, saSample* dst,
+                               const std::size_t n);
+  void saSampleArrayFromSource(const int32_t* src, saSample* dst,
+                               const std::size_t n);
+  void saSampleArrayFromSource(const float* src, saSample* dst,
+                               const std::size_t n);
+  void saSampleArrayFromSource(const double* src, saSample* dst,
+                               const std::size_t n);
+
+  /// Convert an array of source values in a sample format chosen at run
+  /// time with the vectorised conversions above
+  /// \param format format of the source values
+  /// \param src pointer to the source values
+  /// \param dst pointer to the output array
+  /// \param n number of values
+  void saSampleArrayFromSource(const saSampleFormat format, const void* src,
+                               saSample* dst, const std::size_t n);
+
+  /// Convert an array of saSample to sink values
+  /// \param src pointer to the samples
+  /// \param dst pointer to the sink values
+  /// \param n number of values
+  void saSampleArrayToSink(const saSample* src, int16_t* dst,
+                           const std::size_t n);
+  void saSampleArrayToSink(const saSample* src, saInt24* dst,
+                           const std::size_t n);
+  void saSampleArrayToSink(const saSample* src, int32_t* dst,
+                           const std::size_t n);
+  void saSampleArrayToSink(const saSample* src, float* dst,
+                           const std::size_t n);
+  void saSampleArrayToSink(const saSample* src, double* dst,
+                           const std::size_t n);
+
+  /// Convert an array of saSample to sink values in a sample format
+  /// chosen at run time with the vectorised conversions above
+  /// \param src pointer to the samples
+  /// \param format format of the sink values
+  /// \param dst pointer to the sink values
+  /// \param n number of values
+  void saSampleArrayToSink(const saSample* src, const saSampleFormat format,
+                           void* dst, const std::size_t n);
+
+  /// Convert an array of interleaved int16_t frames to one saSample array
+  /// per channel in a single pass. The 2, 4 and 8 channel cases are
+  /// vectorised with shuffles.
+  /// \param src pointer to the interleaved source values
+  /// \param channels number of values in a frame
+  /// \param dst pointers to the output arrays, one per channel
+  /// \param frames number of frames
+  void saSampleArrayDeinterleave(const int16_t* src,
+                                 const std::size_t channels,
+                                 saSample* const* dst,
+                                 const std::size_t frames);
+
+}
+
+#endif
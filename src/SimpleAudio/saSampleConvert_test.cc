@@ -0,0 +1,221 @@
+/// \file saSampleConvert_test.cc
+/// \brief Test the bulk source and sink conversions
+///
+/// Compare the bulk int16_t conversions with the saSampleFromSource and
+/// saSampleToSink functors over the whole int16_t range and check round
+/// trips through the int24, int32, float and double conversions and the
+/// run time format conversion. Check the int24 source conversion with all
+/// three bytes in use. Check the de-interleaving of int16_t frames for 1 to 9 channels.
+
+#include <iostream>
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <cstring>
+
+#include "saSample.h"
+#include "saSampleConvert.h"
+
+using namespace SimpleAudio;
+
+int main()
+{
+  // All int16_t values. The odd length exercises the scalar tail.
+  std::vector<int16_t> s16;
+  for (int32_t v=std::numeric_limits<int16_t>::min();
+       v<=std::numeric_limits<int16_t>::max(); v++)
+    {
+      s16.push_back(static_cast<int16_t>(v));
+    }
+  s16.push_back(0);
+  const std::size_t N = s16.size();
+
+  // int16_t source
+  std::vector<saSample> u(N);
+  saSampleArrayFromSource(s16.data(), u.data(), N);
+  std::size_t mismatch = 0;
+  for (std::size_t k=0; k<N; k++)
+    {
+      if (u[k] != saSampleFromSource<int16_t>()(s16[k]))
+        {
+          mismatch++;
+        }
+    }
+  std::cout << "int16 source mismatches: " << mismatch << std::endl;
+
+  // int16_t sink round trip
+  std::vector<int16_t> r16(N);
+  saSampleArrayToSink(u.data(), r16.data(), N);
+  mismatch = 0;
+  for (std::size_t k=0; k<N; k++)
+    {
+      if ((r16[k] != s16[k]) || (r16[k] != saSampleToSink<int16_t>()(u[k])))
+        {
+          mismatch++;
+        }
+    }
+  std::cout << "int16 round trip mismatches: " << mismatch << std::endl;
+
+  // int16_t sink with fractions and saturation
+  std::vector<saSample> w;
+  for (int32_t v=-4*65536; v<=4*65536; v++)
+    {
+      w.push_back(saSample(static_cast<float>(v)/(65536.0f*2.0f)));
+    }
+  std::vector<int16_t> w16(w.size());
+  saSampleArrayToSink(w.data(), w16.data(), w.size());
+  mismatch = 0;
+  for (std::size_t k=0; k<w.size(); k++)
+    {
+      if (w16[k] != saSampleToSink<int16_t>()(w[k]))
+        {
+          mismatch++;
+        }
+    }
+  std::cout << "int16 sink mismatches: " << mismatch
+            << " saturated: " << w16.front() << " " << w16.back() << std::endl;
+
+  // int24 round trip
+  std::vector<saInt24> s24(N);
+  saSampleArrayToSink(u.data(), s24.data(), N);
+  std::vector<saSample> u24(N);
+  saSampleArrayFromSource(s24.data(), u24.data(), N);
+  mismatch = 0;
+  for (std::size_t k=0; k<N; k++)
+    {
+      if ((u24[k] != u[k]) || (s24[k].bytes[0] != 0))
+        {
+          mismatch++;
+        }
+    }
+  std::cout << "int24 round trip mismatches: " << mismatch << std::endl;
+
+  // int24 source with the low byte in use
+  std::vector<saInt24> a24(N);
+  for (std::size_t k=0; k<N; k++)
+    {
+      const uint32_t v = static_cast<uint32_t>(k*0x9e3779u);
+      a24[k].bytes[0] = static_cast<uint8_t>(v);
+      a24[k].bytes[1] = static_cast<uint8_t>(v >> 8);
+      a24[k].bytes[2] = static_cast<uint8_t>(v >> 16);
+    }
+  std::vector<saSample> v24(N);
+  saSampleArrayFromSource(a24.data(), v24.data(), N);
+  mismatch = 0;
+  for (std::size_t k=0; k<N; k++)
+    {
+      const int32_t v = static_cast<int32_t>
+        ((static_cast<uint32_t>(a24[k].bytes[0]) << 8) |
+         (static_cast<uint32_t>(a24[k].bytes[1]) << 16) |
+         (static_cast<uint32_t>(a24[k].bytes[2]) << 24)) / 256;
+      if (v24[k] != saSample(static_cast<float>(v)/8388608.0f))
+        {
+          mismatch++;
+        }
+    }
+  std::cout << "int24 source mismatches: " << mismatch << std::endl;
+
+  // int32 round trip
+  std::vector<int32_t> s32(N);
+  saSampleArrayToSink(u.data(), s32.data(), N);
+  std::vector<saSample> u32(N);
+  saSampleArrayFromSource(s32.data(), u32.data(), N);
+  mismatch = 0;
+  for (std::size_t k=0; k<N; k++)
+    {
+      if ((u32[k] != u[k]) || (s32[k] != (static_cast<int32_t>(s16[k]) << 16)))
+        {
+          mismatch++;
+        }
+    }
+  std::cout << "int32 round trip mismatches: " << mismatch << std::endl;
+
+  // float round trip
+  std::vector<float> sf(N);
+  saSampleArrayToSink(u.data(), sf.data(), N);
+  std::vector<saSample> uf(N);
+  saSampleArrayFromSource(sf.data(), uf.data(), N);
+  mismatch = 0;
+  for (std::size_t k=0; k<N; k++)
+    {
+      if ((uf[k] != u[k]) || (sf[k] != u[k].to<float>()))
+        {
+          mismatch++;
+        }
+    }
+  std::cout << "float round trip mismatches: " << mismatch << std::endl;
+
+  // double round trip
+  std::vector<double> sd64(N);
+  saSampleArrayToSink(u.data(), sd64.data(), N);
+  std::vector<saSample> ud64(N);
+  saSampleArrayFromSource(sd64.data(), ud64.data(), N);
+  mismatch = 0;
+  for (std::size_t k=0; k<N; k++)
+    {
+      if ((ud64[k] != u[k]) || (sd64[k] != u[k].to<double>()))
+        {
+          mismatch++;
+        }
+    }
+  std::cout << "double round trip mismatches: " << mismatch << std::endl;
+
+  // Run time format
+  const saSampleFormat formats[] = { saSampleFormat::S16,
+                                     saSampleFormat::S24_3LE,
+                                     saSampleFormat::S32,
+                                     saSampleFormat::FLOAT,
+                                     saSampleFormat::FLOAT64 };
+  const void* const sources[] = { s16.data(), s24.data(), s32.data(),
+                                  sf.data(), sd64.data() };
+  mismatch = 0;
+  for (std::size_t f=0; f<5; f++)
+    {
+      std::vector<saSample> ud(N);
+      saSampleArrayFromSource(formats[f], sources[f], ud.data(), N);
+      std::vector<uint8_t> sd(N*saSampleFormatBytes(formats[f]));
+      saSampleArrayToSink(ud.data(), formats[f], sd.data(), N);
+      for (std::size_t k=0; k<N; k++)
+        {
+          if (ud[k] != u[k])
+            {
+              mismatch++;
+            }
+        }
+      if (std::memcmp(sd.data(), sources[f], sd.size()) != 0)
+        {
+          mismatch++;
+        }
+    }
+  std::cout << "run time format mismatches: " << mismatch << std::endl;
+
+  // De-interleave. The number of frames is not a multiple of the block
+  // size so the tail is exercised.
+  for (std::size_t channels=1; channels<=9; channels++)
+    {
+      const std::size_t frames = (N/channels)-3;
+      std::vector< std::vector<saSample> > d(channels,
+                                             std::vector<saSample>(frames));
+      std::vector<saSample*> dp;
+      for (std::size_t c=0; c<channels; c++)
+        {
+          dp.push_back(d[c].data());
+        }
+      saSampleArrayDeinterleave(s16.data(), channels, dp.data(), frames);
+      mismatch = 0;
+      for (std::size_t f=0; f<frames; f++)
+        {
+          for (std::size_t c=0; c<channels; c++)
+            {
+              if (d[c][f] != u[(channels*f)+c])
+                {
+                  mismatch++;
+                }
+            }
+        }
+      std::cout << "de-interleave " << channels << " channels, " << frames
+                << " frames, mismatches: " << mismatch << std::endl;
+    }
+
+  return 0;
+}
@@ -0,0 +1,218 @@
+/// \file saSampleFast.h
+/// \brief Unchecked floating point audio sample for inner loops
+///
+/// saSampleFast has the same layout and internal scaling as saSample but
+/// performs no saturation, overflow or underflow checks. The arithmetic
+/// operators are plain float operations on the internal value so inner
+/// loops compile to float arithmetic. For floating point saSample the
+/// results are identical to saSample arithmetic unless saSample would have
+/// saturated.
+///
+/// Conversion from saSample is unchecked. Conversion back to saSample with
+/// Checked() applies the saSample checks and should be done at pipeline
+/// boundaries.
+
+// StdC++ headers
+#include <iosfwd>
+#include <type_traits>
+
+// Local headers
+#include "saSample.h"
+
+#ifndef __SASAMPLEFAST_H__
+#define __SASAMPLEFAST_H__
+
+namespace SimpleAudio
+{
+  /// \class saSampleFast
+  /// \brief An audio sample with unchecked arithmetic
+  class saSampleFast
+  {
+  private:
+    /// The sample, scaled by saInternalOne
+    float sample;
+
+    /// Factor to rescale products
+    constexpr static float saInternalOneInverse = 1.0f/saSample::saInternalOne;
+
+  public:
+    constexpr static float saInternalOne = saSample::saInternalOne;
+
+    /// Default constructor
+    saSampleFast() : sample(0) { }
+
+    /// Constructor from an arithmetic value
+    /// \tparam C the arithmetic type
+    /// \param value initial value
+    template <typename C,
+              typename = std::enable_if_t<std::is_arithmetic<C>::value> >
+    saSampleFast(const C value) :
+      sample(static_cast<float>(value)*saInternalOne) { }
+
+    /// Unchecked conversion from saSample
+    /// \param s initial value
+    explicit saSampleFast(const saSample& s) : sample(s.Get()) { }
+
+    /// Checked conversion to saSample
+    /// \return saSample value
+    saSample Checked() const
+    {
+      return saSample(sample*saInternalOneInverse);
+    }
+
+    /// Conversion to a floating point type
+    /// \tparam NewType convert to NewType
+    /// \return converted value
+    template <typename NewType>
+    NewType to() const
+    {
+      static_assert(std::is_floating_point<NewType>(),
+                    "expect floating point conversion");
+      return static_cast<NewType>(sample*saInternalOneInverse);
+    }
+
+    /// Peek at internal values
+    /// \return internal value
+    float Get() const { return sample; }
+
+    // Operators
+    saSampleFast operator-() const
+    {
+      saSampleFast result;
+      result.sample = -sample;
+      return result;
+    }
+
+    saSampleFast& operator+=(const saSampleFast& rhs)
+    {
+      sample += rhs.sample;
+      return *this;
+    }
+
+    saSampleFast& operator-=(const saSampleFast& rhs)
+    {
+      sample -= rhs.sample;
+      return *this;
+    }
+
+    saSampleFast& operator*=(const saSampleFast& rhs)
+    {
+      sample = (sample*rhs.sample)*saInternalOneInverse;
+      return *this;
+    }
+
+    saSampleFast& operator/=(const saSampleFast& rhs)
+    {
+      sample = (sample/rhs.sample)*saInternalOne;
+      return *this;
+    }
+
+    bool operator==(const saSampleFast& rhs) const
+    {
+      return sample == rhs.sample;
+    }
+
+    bool operator!=(const saSampleFast& rhs) const
+    {
+      return sample != rhs.sample;
+    }
+
+    bool operator<(const saSampleFast& rhs) const
+    {
+      return sample < rhs.sample;
+    }
+
+    bool operator>(const saSampleFast& rhs) const
+    {
+      return sample > rhs.sample;
+    }
+
+    bool operator<=(const saSampleFast& rhs) const
+    {
+      return sample <= rhs.sample;
+    }
+
+    bool operator>=(const saSampleFast& rhs) const
+    {
+      return sample >= rhs.sample;
+    }
+  };
+
+  static_assert(std::is_standard_layout<saSampleFast>() &&
+                (sizeof(saSampleFast) == sizeof(saSample)) &&
+                (alignof(saSampleFast) == alignof(saSample)),
+                "expect saSampleFast layout compatible with saSample");
+
+  // Binary operators that need not be member functions
+  inline saSampleFast operator+(saSampleFast lhs, const saSampleFast& rhs)
+  {
+    return lhs += rhs;
+  }
+
+  inline saSampleFast operator-(saSampleFast lhs, const saSampleFast& rhs)
+  {
+    return lhs -= rhs;
+  }
+
+  inline saSampleFast operator*(saSampleFast lhs, const saSampleFast& rhs)
+  {
+    return lhs *= rhs;
+  }
+
+  inline saSampleFast operator/(saSampleFast lhs, const saSampleFast& rhs)
+  {
+    return lhs /= rhs;
+  }
+
+  /// Output the value of an saSampleFast
+  std::ostream& operator<<(std::ostream&, const saSampleFast&);
+
+  /// View an array of saSample as an array of saSampleFast
+  /// \param s pointer to array of saSample
+  /// \return pointer to array of saSampleFast
+  inline saSampleFast* saSampleFastView(saSample* const s)
+  {
+    return reinterpret_cast<saSampleFast*>(s);
+  }
+
+  /// View an array of saSample as an array of saSampleFast
+  /// \param s pointer to array of saSample
+  /// \return pointer to array of saSampleFast
+  inline const saSampleFast* saSampleFastView(const saSample* const s)
+  {
+    return reinterpret_cast<const saSampleFast*>(s);
+  }
+
+  /// \struct saSampleFastProduct
+  /// Unchecked product of two saSample, for use with std::inner_product
+  struct saSampleFastProduct
+  {
+    saSampleFast operator()(const saSample& a, const saSample& b) const
+    {
+      return saSampleFast(a)*saSampleFast(b);
+    }
+  };
+
+  /// \struct saSampleFastSum
+  /// Unchecked sum of saSample, for use with std::accumulate
+  struct saSampleFastSum
+  {
+    saSampleFast operator()(const saSampleFast& acc, const saSample& a) const
+    {
+      return acc+saSampleFast(a);
+    }
+  };
+
+  /// \struct saSampleFastChecked
+  /// Checked conversion functor from saSampleFast to saSample
+  struct saSampleFastChecked
+  {
+    saSample operator()(const saSampleFast& s) const
+    {
+      return s.Checked();
+    }
+  };
+
+}
+
+#endif
@@ -0,0 +1,155 @@
+/// \file saSampleFast_test.cc
+/// \brief Compare saSampleFast with saSample arithmetic
+///
+/// Check that saSampleFast gives the same results as saSample for an
+/// inner product and a first order recursive filter. With --bench, time
+/// the two implementations.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <numeric>
+#include <functional>
+#include <chrono>
+#include <cmath>
+
+#include "saSample.h"
+#include "saSampleFast.h"
+
+using namespace SimpleAudio;
+
+/// Inner product of the signal with itself at a lag
+/// \tparam T arithmetic type
+/// \param u the signal
+/// \param n length of the window
+/// \param lag the lag
+/// \return the inner product
+template <typename T>
+saSample Correlate(const std::vector<saSample>& u,
+                   const std::size_t n,
+                   const std::size_t lag)
+{
+  T acc = 0;
+  for (std::size_t k=0; k<n; k++)
+    {
+      acc += T(u[k])*T(u[k+lag]);
+    }
+  return saSample(acc.template to<float>());
+}
+
+/// First order recursive filter y[k] = a*y[k-1] + b*u[k]
+/// \tparam T arithmetic type
+/// \param u the input signal
+/// \param y the output signal
+template <typename T>
+void Filter1(const std::vector<saSample>& u, std::vector<saSample>& y)
+{
+  const T a = 0.9f;
+  const T b = 0.1f;
+  T x = 0;
+  y.resize(0);
+  for (std::size_t k=0; k<u.size(); k++)
+    {
+      x = (a*x) + (b*T(u[k]));
+      y.push_back(saSample(x.template to<float>()));
+    }
+}
+
+/// Time a function
+/// \param f the function
+/// \param repeats number of repeats
+/// \return time in ms
+static double Time(const std::function<void()>& f, const std::size_t repeats)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t r=0; r<repeats; r++)
+    {
+      f();
+    }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end-start).count();
+}
+
+int main(int argc, char* argv[])
+{
+  const bool bench = (argc > 1) && (std::string(argv[1]) == "--bench");
+
+  // Test signal
+  const std::size_t N = 4800;
+  const std::size_t lags = 480;
+  std::vector<saSample> u;
+  for (std::size_t k=0; k<N+lags; k++)
+    {
+      const float t = static_cast<float>(k);
+      u.push_back(saSample(0.5f*sinf(0.0628f*t) + 0.25f*sinf(0.00314f*t)));
+    }
+
+  // Compare inner products
+  std::size_t mismatch = 0;
+  for (std::size_t lag=0; lag<=lags; lag++)
+    {
+      if (Correlate<saSample>(u, N, lag) != Correlate<saSampleFast>(u, N, lag))
+        {
+          mismatch++;
+        }
+    }
+  std::cout << "inner product mismatches: " << mismatch << std::endl;
+  std::cout << std::setprecision(8)
+            << "inner product at lag 0: " << Correlate<saSample>(u, N, 0)
+            << std::endl;
+
+  // Compare filters
+  std::vector<saSample> y;
+  std::vector<saSample> yFast;
+  Filter1<saSample>(u, y);
+  Filter1<saSampleFast>(u, yFast);
+  mismatch = 0;
+  for (std::size_t k=0; k<y.size(); k++)
+    {
+      if (y[k] != yFast[k])
+        {
+          mismatch++;
+        }
+    }
+  std::cout << "filter mismatches: " << mismatch << std::endl;
+
+  // Checked conversion at the boundary
+  try
+    {
+      saSampleFast big(1e30f);
+      big *= saSampleFast(1e30f);
+      saSample s = big.Checked();
+      std::cout << "checked conversion of overflow: " << s << std::endl;
+    }
+  catch(std::exception& excpt)
+    {
+      std::cout << excpt.what() << std::endl;
+    }
+
+  // Benchmark
+  if (bench)
+    {
+      const std::size_t repeats = 20;
+      volatile float sink = 0;
+      double tCorr = Time([&]() {
+          for (std::size_t lag=0; lag<=lags; lag++)
+            { sink = Correlate<saSample>(u, N, lag).to<float>(); } },
+        repeats);
+      double tCorrFast = Time([&]() {
+          for (std::size_t lag=0; lag<=lags; lag++)
+            { sink = Correlate<saSampleFast>(u, N, lag).to<float>(); } },
+        repeats);
+      double tFilter = Time([&]() { Filter1<saSample>(u, y); }, 100*repeats);
+      double tFilterFast = Time([&]() { Filter1<saSampleFast>(u, y); },
+                                100*repeats);
+      std::cout << std::setprecision(4)
+                << "inner product saSample " << tCorr << "ms, saSampleFast "
+                << tCorrFast << "ms, ratio " << tCorr/tCorrFast << std::endl;
+      std::cout << "filter saSample " << tFilter << "ms, saSampleFast "
+                << tFilterFast << "ms, ratio " << tFilter/tFilterFast
+                << std::endl;
+    }
+
+  return 0;
+}
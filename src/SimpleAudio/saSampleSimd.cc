@@ -0,0 +1,80 @@
+/// \file saSampleSimd.cc
+/// \brief Vectorised reductions on arrays of saSample
+
+#include <cstddef>
+#include <experimental/simd>
+
+#include "saSample.h"
+#include "saSampleFast.h"
+#include "saSampleSimd.h"
+
+namespace SimpleAudio
+{
+  saSampleFast saSampleDot(const saSample* const u, const saSample* const v,
+                           const std::size_t n)
+  {
+    const float* const x = saSimdInternal(u);
+    const float* const z = saSimdInternal(v);
+    const std::size_t w = saSimdFloat::size();
+    saSimdFloat acc0 = 0.0f;
+    saSimdFloat acc1 = 0.0f;
+    std::size_t k = 0;
+    for (; k+(2*w) <= n; k+=2*w)
+      {
+        acc0 += saSimdFloat(x+k, stdx::element_aligned)*
+          saSimdFloat(z+k, stdx::element_aligned);
+        acc1 += saSimdFloat(x+k+w, stdx::element_aligned)*
+          saSimdFloat(z+k+w, stdx::element_aligned);
+      }
+    float r = stdx::reduce(acc0+acc1);
+    for (; k<n; k++)
+      {
+        r += x[k]*z[k];
+      }
+    // Rescale the products then the result, both exactly
+    return saSampleFast((r/saSample::saInternalOne)/saSample::saInternalOne);
+  }
+
+  saSampleFast saSampleSumOfSquares(const saSample* const u,
+                                    const std::size_t n)
+  {
+    return saSampleDot(u, u, n);
+  }
+
+  saSampleFast saSampleSum(const saSample* const u, const std::size_t n)
+  {
+    const float* const x = saSimdInternal(u);
+    const std::size_t w = saSimdFloat::size();
+    saSimdFloat acc = 0.0f;
+    std::size_t k = 0;
+    for (; k+w <= n; k+=w)
+      {
+        acc += saSimdFloat(x+k, stdx::element_aligned);
+      }
+    float r = stdx::reduce(acc);
+    for (; k<n; k++)
+      {
+        r += x[k];
+      }
+    return saSampleFast(r/saSample::saInternalOne);
+  }
+
+  void saSampleScale(const saSample* const u, saSample* const y,
+                     const std::size_t n, const float g)
+  {
+    const float* const x = saSimdInternal(u);
+    float* const z = saSimdInternal(y);
+    const std::size_t w = saSimdFloat::size();
+    std::size_t k = 0;
+    for (; k+w <= n; k+=w)
+      {
+        const saSimdFloat v = saSimdFloat(x+k, stdx::element_aligned)*g;
+        v.copy_to(z+k, stdx::element_aligned);
+      }
+    for (; k<n; k++)
+      {
+        z[k] = x[k]*g;
+      }
+  }
+
+}
@@ -0,0 +1,168 @@
+/// \file saSampleSimd.h
+/// \brief Vectorised operations on arrays of saSample
+///
+/// An saSample is a standard layout class containing a single float.
+/// Contiguous arrays of saSample are loaded into SIMD registers as arrays
+/// of their internal float values. These values are scaled by saInternalOne
+/// so gains are applied directly but sample-by-sample products must be
+/// rescaled. Reductions return an unchecked saSampleFast and the order of
+/// summation differs from a sequential loop.
+
+// StdC++ headers
+#include <cstddef>
+#include <type_traits>
+#include <algorithm>
+#include <experimental/simd>
+
+// Local headers
+#include "saSample.h"
+#include "saSampleFast.h"
+
+#ifndef __SASAMPLESIMD_H__
+#define __SASAMPLESIMD_H__
+
+namespace SimpleAudio
+{
+  namespace stdx = std::experimental;
+
+  /// \typedef saSimdFloat
+  /// The native SIMD vector of float
+  typedef stdx::native_simd<float> saSimdFloat;
+
+  static_assert(std::is_standard_layout<saSample>() &&
+                (sizeof(saSample) == sizeof(float)) &&
+                (alignof(saSample) == alignof(float)),
+                "expect saSample layout compatible with float");
+
+  /// View an array of saSample as an array of internal values
+  /// \param s pointer to array of saSample
+  /// \return pointer to array of float
+  inline const float* saSimdInternal(const saSample* const s)
+  {
+    return reinterpret_cast<const float*>(s);
+  }
+
+  /// View an array of saSample as an array of internal values
+  /// \param s pointer to array of saSample
+  /// \return pointer to array of float
+  inline float* saSimdInternal(saSample* const s)
+  {
+    return reinterpret_cast<float*>(s);
+  }
+
+  /// Find the maximum absolute value of an array
+  /// \tparam T the type of the array
+  /// \param u pointer to the array
+  /// \param n length of the array
+  /// \return maximum absolute value
+  template <typename T>
+  T saSampleMaxAbs(const T* const u, const std::size_t n)
+  {
+    T m = 0;
+    for (std::size_t k=0; k<n; k++)
+      {
+        const T a = u[k] < 0 ? -u[k] : u[k];
+        m = std::max(m, a);
+      }
+    return m;
+  }
+
+  /// Find the maximum absolute value of an array of saSample
+  /// \param u pointer to the array
+  /// \param n length of the array
+  /// \return maximum absolute value
+  inline saSample saSampleMaxAbs(const saSample* const u, const std::size_t n)
+  {
+    const float* const x = saSimdInternal(u);
+    const std::size_t w = saSimdFloat::size();
+    saSimdFloat m = 0.0f;
+    std::size_t k = 0;
+    for (; k+w <= n; k+=w)
+      {
+        m = stdx::max(m, stdx::abs(saSimdFloat(x+k, stdx::element_aligned)));
+      }
+    float r = stdx::hmax(m);
+    for (; k<n; k++)
+      {
+        r = std::max(r, std::abs(x[k]));
+      }
+    return saSample(r/saSample::saInternalOne);
+  }
+
+  /// Apply a linear gain ramp to an array: y[k] = u[k]*(g0+(k+1)*dg)
+  /// \tparam T the type of the array
+  /// \param u pointer to the input array
+  /// \param y pointer to the output array (may equal u)
+  /// \param n length of the arrays
+  /// \param g0 initial gain
+  /// \param dg gain increment per sample
+  template <typename T>
+  void saSampleGainRamp(const T* const u, T* const y, const std::size_t n,
+                        const float g0, const float dg)
+  {
+    for (std::size_t k=0; k<n; k++)
+      {
+        y[k] = u[k]*T(g0 + (static_cast<float>(k+1)*dg));
+      }
+  }
+
+  /// Apply a linear gain ramp to an array of saSample
+  /// \param u pointer to the input array
+  /// \param y pointer to the output array (may equal u)
+  /// \param n length of the arrays
+  /// \param g0 initial gain
+  /// \param dg gain increment per sample
+  inline void saSampleGainRamp(const saSample* const u, saSample* const y,
+                               const std::size_t n,
+                               const float g0, const float dg)
+  {
+    const float* const x = saSimdInternal(u);
+    float* const z = saSimdInternal(y);
+    const std::size_t w = saSimdFloat::size();
+    const saSimdFloat step([](const auto i) { return static_cast<float>(i); });
+    std::size_t k = 0;
+    for (; k+w <= n; k+=w)
+      {
+        const saSimdFloat g = g0 + ((step + static_cast<float>(k+1))*dg);
+        const saSimdFloat v = saSimdFloat(x+k, stdx::element_aligned)*g;
+        v.copy_to(z+k, stdx::element_aligned);
+      }
+    for (; k<n; k++)
+      {
+        z[k] = x[k]*(g0 + (static_cast<float>(k+1)*dg));
+      }
+  }
+
+
+  /// Inner product of two arrays of saSample without saturation checks
+  /// \param u pointer to the first array
+  /// \param v pointer to the second array
+  /// \param n length of the arrays
+  /// \return the inner product
+  saSampleFast saSampleDot(const saSample* const u, const saSample* const v,
+                           const std::size_t n);
+
+  /// Sum of squares of an array of saSample without saturation checks
+  /// \param u pointer to the array
+  /// \param n length of the array
+  /// \return the sum of squares
+  saSampleFast saSampleSumOfSquares(const saSample* const u,
+                                    const std::size_t n);
+
+  /// Sum of an array of saSample without saturation checks
+  /// \param u pointer to the array
+  /// \param n length of the array
+  /// \return the sum
+  saSampleFast saSampleSum(const saSample* const u, const std::size_t n);
+
+  /// Scale an array of saSample: y[k] = u[k]*g
+  /// \param u pointer to the input array
+  /// \param y pointer to the output array (may equal u)
+  /// \param n length of the arrays
+  /// \param g gain
+  void saSampleScale(const saSample* const u, saSample* const y,
+                     const std::size_t n, const float g);
+
+}
+
+#endif
@@ -0,0 +1,91 @@
+/// \file saTimestamp.h
+/// \brief Capture times of audio frames
+///
+/// Frames are timestamped on the monotonic clock. ALSA devices are asked
+/// for CLOCK_MONOTONIC hardware timestamps, which are on the same clock,
+/// so the age of a frame is the difference between the current time and
+/// its timestamp.
+
+#include <chrono>
+#include <cstddef>
+#include <ctime>
+#include <vector>
+#include <ostream>
+#include <algorithm>
+
+#ifndef __SATIMESTAMP_H__
+#define __SATIMESTAMP_H__
+
+namespace SimpleAudio
+{
+  /// \typedef saTimestamp
+  /// Time of a frame on the monotonic clock
+  typedef std::chrono::steady_clock::time_point saTimestamp;
+
+  /// Current time on the monotonic clock
+  /// \return current time
+  inline saTimestamp saTimestampNow()
+  {
+    return std::chrono::steady_clock::now();
+  }
+
+  /// Convert a time on CLOCK_MONOTONIC
+  /// \param ts time from clock_gettime or an ALSA hardware timestamp
+  /// \return timestamp
+  inline saTimestamp saTimestampFromTimespec(const timespec& ts)
+  {
+    return saTimestamp(std::chrono::duration_cast<saTimestamp::duration>
+                       (std::chrono::seconds(ts.tv_sec) +
+                        std::chrono::nanoseconds(ts.tv_nsec)));
+  }
+
+  /// Duration of a number of frames
+  /// \param frames number of frames
+  /// \param framesPerSecond frame rate
+  /// \return duration of the frames, zero if the frame rate is zero
+  inline saTimestamp::duration saTimestampFrames
+  (const std::size_t frames, const std::size_t framesPerSecond)
+  {
+    if (framesPerSecond == 0)
+      {
+        return saTimestamp::duration::zero();
+      }
+    const std::size_t seconds = frames/framesPerSecond;
+    const std::size_t nanoseconds =
+      ((frames%framesPerSecond)*1000000000ULL)/framesPerSecond;
+    return std::chrono::duration_cast<saTimestamp::duration>
+      (std::chrono::seconds(seconds) + std::chrono::nanoseconds(nanoseconds));
+  }
+
+  /// Duration in milliseconds
+  /// \param d duration
+  /// \return milliseconds
+  inline double saTimestampMs(const saTimestamp::duration d)
+  {
+    return std::chrono::duration<double, std::milli>(d).count();
+  }
+
+  /// Write the 50th, 90th, 99th and 100th percentiles of latencies as
+  /// " p50 x p90 x p99 x p100 x". Nothing is written if there are none.
+  /// \param os stream written
+  /// \param latencies latencies, reordered
+  inline void saTimestampWritePercentiles(std::ostream& os,
+                                          std::vector<double>& latencies)
+  {
+    if (latencies.empty())
+      {
+        return;
+      }
+    const std::size_t percentiles[] = { 50, 90, 99, 100 };
+    for (const std::size_t p : percentiles)
+      {
+        const std::size_t k = std::min(latencies.size()-1,
+                                       (p*latencies.size())/100);
+        std::nth_element(latencies.begin(), latencies.begin()+k,
+                         latencies.end());
+        os << " p" << p << " " << latencies[k];
+      }
+  }
+}
+
+#endif
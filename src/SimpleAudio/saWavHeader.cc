@@ -2,6 +2,8 @@
 
 #include <algorithm>
 #include <functional>
+#include <istream>
+#include <stdexcept>
 
 #include "saWavHeader.h"
 
@@ -34,9 +36,12 @@ namespace SimpleAudio
 
   void saSwapShort(int16_t* buffer, std::size_t shorts)
   {
+    // Rotate in place so the loop vectorises
+    uint16_t* const ubuffer = reinterpret_cast<uint16_t*>(buffer);
     for (std::size_t i = 0; i<shorts; ++i)
       {
-        saSwapShort(buffer[i]);
+        ubuffer[i] = static_cast<uint16_t>((ubuffer[i] << 8) |
+                                           (ubuffer[i] >> 8));
       }
   }
 
@@ -77,4 +82,137 @@ namespace SimpleAudio
     saSwapLong(wavHeader->DataChunkSize);
   }
 
+  // Little-endian fields of a chunk
+  static uint16_t saWavField16(const uint8_t* const buf)
+  {
+    return static_cast<uint16_t>(buf[0] | (buf[1] << 8));
+  }
+
+  static uint32_t saWavField32(const uint8_t* const buf)
+  {
+    return static_cast<uint32_t>(buf[0]) |
+      (static_cast<uint32_t>(buf[1]) << 8) |
+      (static_cast<uint32_t>(buf[2]) << 16) |
+      (static_cast<uint32_t>(buf[3]) << 24);
+  }
+
+  static bool saWavCompareID(const uint8_t* const buf, const char* const id)
+  {
+    return std::equal(buf, buf+4, id);
+  }
+
+  void saWavReadFormat(std::istream& input, saWavFormat& wavFormat)
+  {
+    // RIFF header
+    uint8_t buf[40];
+    if ( !input.read(reinterpret_cast<char*>(buf), 12) )
+      {
+        throw std::runtime_error(" failed read wav header from source file");
+      }
+    if ( !saWavCompareID(buf, "RIFF") || !saWavCompareID(buf+8, "WAVE") )
+      {
+        throw std::runtime_error("id failed in source file");
+      }
+
+    // Chunks, each an ID and size followed by the contents and a pad byte
+    // if the size is odd
+    bool isFormatFound = false;
+    while ( input.read(reinterpret_cast<char*>(buf), 8) )
+      {
+        const std::size_t chunkSize = saWavField32(buf+4);
+        if ( saWavCompareID(buf, "data") )
+          {
+            if ( !isFormatFound )
+              {
+                throw std::runtime_error("no fmt chunk before data chunk");
+              }
+            wavFormat.DataOffset = static_cast<std::size_t>(input.tellg());
+            wavFormat.DataChunkSize = chunkSize;
+            return;
+          }
+
+        std::size_t skip = chunkSize + (chunkSize & 1);
+        if ( saWavCompareID(buf, "fmt ") )
+          {
+            if ( chunkSize < 16 )
+              {
+                throw std::runtime_error("short fmt chunk in source file");
+              }
+            const std::size_t formatSize =
+              std::min(chunkSize, sizeof(buf));
+            if ( !input.read(reinterpret_cast<char*>(buf),
+                             static_cast<std::streamsize>(formatSize)) )
+              {
+                throw std::runtime_error(" failed read fmt chunk from source file");
+              }
+            skip -= formatSize;
+            wavFormat.FormatTag = saWavField16(buf);
+            wavFormat.FormatChannels = saWavField16(buf+2);
+            wavFormat.FormatSamplesPerSec = saWavField32(buf+4);
+            wavFormat.FormatBlockAlign = saWavField16(buf+12);
+            wavFormat.FormatBitsPerSample = saWavField16(buf+14);
+            wavFormat.FormatValidBitsPerSample = wavFormat.FormatBitsPerSample;
+            wavFormat.FormatChannelMask = 0;
+            if ( wavFormat.FormatTag == saWavFormatExtensible )
+              {
+                if ( (formatSize < 40) || (saWavField16(buf+16) < 22) )
+                  {
+                    throw std::runtime_error("short extensible fmt chunk in source file");
+                  }
+                wavFormat.FormatValidBitsPerSample = saWavField16(buf+18);
+                wavFormat.FormatChannelMask = saWavField32(buf+20);
+                wavFormat.FormatTag = saWavField16(buf+24);
+              }
+            isFormatFound = true;
+          }
+        if ( !input.seekg(static_cast<std::streamoff>(skip), std::ios::cur) )
+          {
+            break;
+          }
+      }
+    throw std::runtime_error("no data chunk in source file");
+  }
+
+  saSampleFormat saWavSampleFormat(const saWavFormat& wavFormat)
+  {
+    if ( (wavFormat.FormatTag != saWavFormatPCM) &&
+         (wavFormat.FormatTag != saWavFormatFloat) )
+      {
+        throw std::runtime_error("compression not supported");
+      }
+    if ( (wavFormat.FormatChannels == 0) ||
+         (wavFormat.FormatBlockAlign !=
+          wavFormat.FormatChannels*wavFormat.FormatBitsPerSample/8) )
+      {
+        throw std::runtime_error("source block align not supported");
+      }
+    if ( wavFormat.FormatTag == saWavFormatFloat )
+      {
+        switch (wavFormat.FormatBitsPerSample)
+          {
+          case 32:
+            return saSampleFormat::FLOAT;
+          case 64:
+            return saSampleFormat::FLOAT64;
+          default:
+            break;
+          }
+      }
+    else
+      {
+        switch (wavFormat.FormatBitsPerSample)
+          {
+          case 16:
+            return saSampleFormat::S16;
+          case 24:
+            return saSampleFormat::S24_3LE;
+          case 32:
+            return saSampleFormat::S32;
+          default:
+            break;
+          }
+      }
+    throw std::runtime_error("source bits per sample not supported");
+  }
+
 }
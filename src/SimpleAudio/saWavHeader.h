@@ -136,13 +136,41 @@
 ///
 /// The Data Chunk is required. One, and only one, Data Chunk may appear
 /// in a WAVE.
+///
+/// ### Other chunks ###
+///
+/// Other chunks, such as LIST, fact, bext and JUNK, may appear before or
+/// after the Format and Data chunks, so the Data chunk does not always
+/// follow a 16 byte Format chunk at byte 44. A chunk with an odd chunkSize
+/// is followed by a pad byte. saWavReadFormat walks the chunks to find the
+/// Format and Data chunks.
+///
+/// ### Sample formats ###
+///
+/// A wFormatTag of 1 is integer PCM and of 3 is IEEE float. Integer samples
+/// of more than 8 bits are signed and little-endian, so 24 bit samples are
+/// packed in 3 bytes. A wFormatTag of 0xFFFE is WAVE_FORMAT_EXTENSIBLE,
+/// for more than two channels or more than 16 bits. Its Format chunk is at
+/// least 40 bytes and continues with
+/// \code
+///   unsigned short cbSize;               /* 22 */
+///   unsigned short wValidBitsPerSample;
+///   unsigned long  dwChannelMask;
+///   GUID           SubFormat;
+/// \endcode
+/// where the first two bytes of SubFormat are the wFormatTag of the
+/// samples.
 
 #include <algorithm>
 #include <functional>
 #include <string>
 #include <stdexcept>
+#include <istream>
+#include <cstddef>
 #include <cstdint>
 
+#include "saDeviceType.h"
+
 #ifndef __SAWAVHEADER__
 #define __SAWAVHEADER__
 
@@ -181,6 +209,47 @@ namespace SimpleAudio
   bool saCompareID(char ID[4], std::string Str);
   void saSwapWavHeader(saWavHeader* wavHeader);
 
+  /// Format tags
+  constexpr uint16_t saWavFormatPCM = 1;
+  constexpr uint16_t saWavFormatFloat = 3;
+  constexpr uint16_t saWavFormatExtensible = 0xFFFE;
+
+  /// \struct saWavFormat
+  /// \brief The Format chunk of a WAV file and the position of its Data
+  /// chunk, in host byte order
+  struct saWavFormat
+  {
+    /// saWavFormatPCM or saWavFormatFloat. For extensible files this is
+    /// the tag of the SubFormat.
+    uint16_t FormatTag;
+    uint16_t FormatChannels;
+    uint32_t FormatSamplesPerSec;
+    uint16_t FormatBlockAlign;
+    uint16_t FormatBitsPerSample;
+    /// Significant bits in each sample, FormatBitsPerSample unless given
+    /// by an extensible Format chunk
+    uint16_t FormatValidBitsPerSample;
+    /// Speaker positions of the channels, 0 unless given by an extensible
+    /// Format chunk
+    uint32_t FormatChannelMask;
+    /// Offset of the samples in the file
+    std::size_t DataOffset;
+    /// Size of the Data chunk in bytes, which may be more than the file
+    /// holds if the file was truncated
+    std::size_t DataChunkSize;
+  };
+
+  /// Read the chunks of a WAV file up to the start of the samples
+  /// \param input stream at the start of the file, left at DataOffset
+  /// \param wavFormat the Format chunk and the position of the samples
+  void saWavReadFormat(std::istream& input, saWavFormat& wavFormat);
+
+  /// Sample format of a WAV file
+  /// \param wavFormat the Format chunk
+  /// \return S16, S24_3LE or S32 for 16, 24 or 32 bit PCM, FLOAT or FLOAT64
+  /// for 32 or 64 bit IEEE float
+  saSampleFormat saWavSampleFormat(const saWavFormat& wavFormat);
+
   template<typename T> 
   struct saSwapSample 
   {
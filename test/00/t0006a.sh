@@ -42,8 +42,18 @@ Allowed options:
   --clear_test          test clear function
   --eos_test            test end-of-source function
   --frames_read_test    test number of frames read function
+  --acquire_test        test zero-copy acquire and release
+  --deinterleave_test   test reading all channels in one pass
+  --poll_drop_test      test polling after a reader is dropped
+  --capture_clear_test  test clearing a capture thread ring
   --frames arg          frames to read from source
   --channel arg         channel to read from frame
+  --read_ahead arg      fragments to read ahead on a thread
+  --capture arg         fragments in a capture thread ring
+  --poll arg            copies of the file on one capture thread
+  --resample arg        resample to arg frames per second
+  --mmap                map WAV files into memory
+  --samples             acquire views converted to saSample
   --file arg            read from file
 EOF
 if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
@@ -10356,6 +10366,17 @@ diff test.ok test.out
 if [ $? -ne 0 ]; then echo "Failed diff samples"; fail; fi
 diff test.asc test.txt
 if [ $? -ne 0 ]; then echo "Failed diff text"; fail; fi
+#
+# the mapped file reads the same
+#
+args="--read_test --frames 345700 --mmap --file test.wav"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > test.out 2>test.txt
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff mapped samples"; fail; fi
+diff test.asc test.txt
+if [ $? -ne 0 ]; then echo "Failed diff mapped text"; fail; fi
 
 #
 # the output should look like this
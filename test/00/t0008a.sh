@@ -52,10 +52,18 @@ Allowed options:
   --baseLineHpFilterCutoff arg  pre-filter high-pass in Hz
   --disableHpFilter bool        disable the high-pass filter
   --disableAgc bool             disable AGC
+  --blockAgc bool               AGC gain update per pitch sample
+  --msAgcLookAhead arg          AGC look-ahead delay in ms
   --threshold arg               cumulative difference threshold
   --removeDC bool               remove slowly varying DC
+  --resampleRate arg            resample the input to arg Hz
   --file arg                    read from file
   --device arg                  read from device
+  --mmap bool                   map the device buffer or WAV file
+  --periods arg                 device periods per buffer
+  --format arg                  S16, S24_3LE, S32, FLOAT or FLOAT64
+  --threads arg                 analyse a file in arg segments
+  --msWarmUp arg                segment warm-up in ms
 
 debug= 1
 maxPitchSamples= 0
@@ -70,9 +78,17 @@ inputLpFilterCutoff= 1000
 baseLineHpFilterCutoff= 200
 disableHpFilter= 0
 disableAgcFilter= 0
+blockAgc= 0
+msAgcLookAhead= 0
 removeDC= 0
+resampleRate= 0
 threshold= 0.1
 sourceName= default
+mmap= 0
+periods= 2
+format= S16
+threads= 1
+msWarmUp= 500
 EOF
 if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
 
@@ -4960,56 +4976,56 @@ if [ $? -ne 0 ]; then echo "Failed input bunzip2"; fail; fi
 #
 cat > test.ok.bz2.b64 << 'EOF'
 begin-base64 644 test.ok.bz2
-QlpoOTFBWSZTWYpzWfwAFIdYAAAQAAF/4GAPXjz157uOO3HWVZvJ3PXumDzm
-bIt776lESU+2pKhJNKkzQYaZNGkow1T8EJUYaeSQkowk0SSmqAQpCnkqaBSi
-RMUj7S9hf9H9Im4X+lRPoaRD+lez2/o1Hr3hGhqmompqk/Rk0lUoZIFKESOR
-WSjQNNJyBRRSqwoxKbBhVSZqKDaLBFVU/MUKqoos57f9j7VEgYZDOxjIxQTA
-jxyfjN1QhN61SsKiqAiCy21KrmZPdzp3+Xz8mk9sZ0mqEdGY8PgfU9554eZ9
-vQ7So3yiKsdXz95GyvRRhwafZ4QXcOSPyM02PV3RR7VjBprVeAWd7L3kbdOI
-Z63vzn0NY/b8ZTkgIgYhy7rIwwd1xaqVrUop3g4WC8xYFGBUBQlYsUrIQqFB
-7+UOMiy21qRFEiG/vx6BrZ4MbGz373frXvmypPjONLJ0s4eJLjm9CO2asfLi
-vM6ApofVWk+5bxHD0K+5OxKGkTjiQJeu23dPN7MN5oDYgLBN50JIQiNHEZzs
-OPi9u6JBpJc7u0CiEvGGhuA5dTIsWMXPd2mthmLMimZUFCC5isRMgSYwTJGE
-iYGYLkokpiSBSJxz4sIGVcUYhElsiViaYwsYk2gkVnVMliIme/Wm2jxHFhcH
-hHdT5ogsFIFeXchs9HyBy5TNuHGmUFZAIYBJQ9tdaRNXN9Zk4RtlYqMFA81U
-VQUMljfUNqH8nJnliqqVlWIP12XEgZCGEETXtyJisiRiISAGVEY0VaFYpLaF
-RtgifG/cZ6CauWapKRCEhoWtcsrzzmnRgiQULk4wTV9v0NT+KUgjSSnOm1/H
-xuQMH6lvMUXt274dTlqBPm91KhKXZOv+J5b/e3vfI4+37dE5AogFGSpGCYiS
-miaIyciqGSayy7YRNNRJRDUlUUU1EAUQBQUWCgIKrHN7+wZ8KJ+ckxaVKhRq
-/e/vT5+RnzYoOuagAZ6KOMZOlKuc8clmkWLxZfpfrAiI4hplBWFhot2hh7r4
-ylaTtC6mk+r9q7PSSztROkDPA73V5SRKxAxjh6HllwaHHXYI0SyzsU6WFtlO
-dHM+kqFJCDSOcxhoJuZhl3WRxWpMbfSzkdpczCgyt5vhPGphpNQmSxScuUkp
-PO99+98AHxEhDJFHJiOZQZGQZKFBRG/vs4FFJTcjEwkmoLOZ8Z3v0firuZFW
-YzPP3ujKsYaSbCObaMIGJgXcn2EGq32DOjdTnRUbosPusqPaSDIPfIqZ0J+a
-Ep8xzxYuaF3ep3tw8aswQTGQTjwpXtk7VAlh68xNUW7kAM+CurbLbmKRVvAw
-87N2iaXPlaJSexkkTAG0imvsKR38efXOWhREWJrRUazsbFpVEQvxb79cmG+s
-MqQ1raXzsirXJpsNRC1lrO84fenNmiQUUIkTNL4t31YbNsIPQbe0G8WUVPfR
-2hkWRGJDStzVk0qkS9j1MNI6VKXLB6dPTY77UGcu9oXc0CnCfHmN+1iZKjWx
-9lsfXjWlo+3nuFOxcVf026KGDi0ZXHEgSeUlFM0qp7nL3lh10H4bBUI4ykxh
-Um3dcBRSpysmGNeu18aZTyFU61frfWovmGZkRB8lYnIqX61x9fn7ryTmaibV
-wpbnDFQfzNerxejFiaFy71djNDj4bp43Lm/bTSdemFokI6qGDhlboSogkZPB
-fRpFGalXHLovEuTmrNqgZ4XTrKoTUuFQAQAPt/daq3r1Eeve/XjT9Je8vPDy
-TOh72jdKP78PMeer3O0HWn194pPHjxzgDnrqU3z8/Z+rpV9zx4++lfTQxB+P
-3Hpr58bOo9T9dHvX6RFjx4UM1+717seInTrT30Iv1P7m02Ic+yfdtd5iXXn5
-v4+r1fatRfvl8l9+9494TYB++3s9vycBKQX6rWhTKQ1zbv2j2x2iH3f3x1ZC
-Ren3hfdPvojx4DwnOc5v3j1L0EoR683wuIBzDJZyi4PveOV0A7eO3p8T7Zpm
-J98uvg+99/evZeffunp7OpmSfOcKuTrOik6N+eve8ZdrxJ74+fJ4FIIA3nvB
-5DWuXfvUcTgvB+ve0J6hfjezYgm/3OAKc5c+P3146H4Oqd+bp9eShv3JxevW
-YntP37H6/Ifjd78D1dveRHPO+kHXX3fnnhfg5XPIfkFlpJH75ToXenTqdBA9
-v3ngfDnGZxU5/VJfsOEz+y6SmO87dhnUljXecVZx5yjXGhYkH7XIdsTEQ4tJ
-4/6EzCE8kgrup1IByVd72DuUj+UHAMMBk2N0U0N1BtOs48/d2ZUZgTQm6hAS
-ClEKUmRqYrETMZgHXE4pGLHbKptipuzZX7OuW1NaNpbpoa1ofpA09F7CAvZB
-CgRKBaQaEIhKFiSKiCgPIiLrFTcksqMD3JmSjMULRRcHoTpRIqkBG5UMiKIE
-DpGYjU2ysMVkxDKnW1TZG7UGlWJP7Kaic1TcDIjmje9DVTVHmMzMZl5KFrFT
-JkRWDGSsyLFlJMEK93KhxSEF5IJlIRSULQoUgRDSpoShSqqiXFMimFYsyVkW
-TOaVaTvao2nHOKnA3Utn+8131VvM1ZujexC9YJUVmBFbjFVApgsAoMqqPUR3
-CgagBOQFRUJI7FC2wL9S6bTD85Nu5PpISSfREHko8lU3Cq8/bzLIzfc/aydm
-jMInWtEKIv5QU3KLuNEqJknIKAQMWfWSz1ClqWjL7B14vdorgAOpUNVQUyip
-qiATUMCYncPCzSXeO7MnEuxoGNgxMY7ocG3Q6dCztAwTQaFqVZUhk4wQZYMS
-1wQGgiKomRXICqRDUTTIiG9gbVbYc2adAOq5cuSVnF1q4i4nU5XJXBpNVsuO
-FOBnFf3TkodJxAMaBJiTBALFEpaVsbSxNzWta21q3M1qww3Tam62ktbaiN1s
-prWqNW2pbq1W21oaatjdNpulpumjZtrZqzJZlLdWyN2NAbq1JlMUwMGBlMhl
-N2TVkqSRFaEMzCpMrxmaP+LuSKcKEhFOaz+A
+QlpoOTFBWSZTWdPzHWsAFIZYAAAQAAF/4GAPXvPU7zunObjsY5g26cLRxNh1
+z3ylAKQei1htgPXcsAw1T8JNpVGGp4IUowlPKJKalGEmkQkpoFKJBNU0ESqf
+inkqjfcr3Ff7H9knWK/sqT7FmSP7KvcvP8mJ8/fSEUFFFERRFUOpUBVkCsAW
+QEYSotZCLCNpUzmQEVElcIVGGBFVMmRY2iwRVVPmKFVUUWa7n9h3JFFxwc+I
+sJBpckvQf5O6lE763JwkVQEQXKpJXXNT3c7k5c+TSe5GdJxQixmPx4HsN5+4
+cz22HaVG+URVjq8/vkbK9FGHBp+z4QXcOST5HcLH3u7VszzFGH2J0BnOrzkX
+PTac9md+s+HaX7fmY8Ba1WVeZu0KMbttKVJmSFO8HC4Lzi4EOBUBQlYsUrIQ
+qFB3yhpiLLbWpEUSIZ745Ay2cDDMMx37m/Ws8cmJOmU4WTpZ8aSXHNsIuzV5
+1UrmdAU0O4swnqtpFHQr6p5EocIlPkgS9dtu6eb2YbzQGxAWCbzoSQhEaOI7
+0YmzjMb8SD5JdG2gUQl8dPhlB5kmIsWMUzd3ZlsMYsxFMZUFDGsyomcFDIZw
+IQnFUxrDUlQUFkn1P5hETaCEsaN3N3J5yHSJO1ZKj6nDSZnP7/bpjY4ilhUP
+xFuHmiCwUgVytQ2dHUPeTGbkeXGYtQoMVDF9uXbjU22Z2k0R0srFRgoHGqiq
+ChiWN5ZjiHk1MdWKi1CrEHtzFyRcEcRq6+3CcqCYokFwkRBYkWCcUyoJGsET
+439xrwz1Zp1JqSiDy7ttmm3v6zn5hRIKFycYJq9voan4pSCNJKc6bX4/G5Aw
+fUt5ii+3bvw6nLUCfm91KhKXZNv5OLfcznOo4dz7NiagUSRQogFViMRBQURR
+KhVSMGLWvmigoIgokREFiqCogCkARgsFAQVWON32BjwUT5xJhaVKhRq957k6
+9RnWxQcuNQVc/imyIPnXaz38+NOSivUb+N/b2QKITVWCsLDRbtDD3XxlK0na
+F1NJ7H2q+6SZLqJ0ge4HbcfsJExiBj009p5V6ME2e6jYiYYc1b2sLGVN7Zt9
+JUKSEGkc5jDQTczDLusjitSY2/Qqp5ZLaKFXbvBnIrEiwxIVkLU5kxDE9vff
+vfKr5KiMC1shUtqhUqFZAUFE+5+/XoKLBY9SwokYqDe3pfe/J0V9aitsYz3v
+vHasYaSbCPdaMIGJgXcnsINVv2DOjdTliwboyHrkxG6SDIO+RU9YT80Jh5jn
+ixc0Lu97eynjV2CCYyCceFK9snaoEsPXmJqi3cgBngrq2y25ikVbwMPOzdom
+lzytEpPYz6Z5skhJr2FIrRWvOrZrqIuJUKjOdpulEoiF8V79amjesNVMNpov
+O6irthzw9Mu7G7H3vP7+PccyNNKSTnF6W5rQMEYIKwlN4yU6kGUkd4O0MiyI
+xIaVuasmlUiXsephpHSpS5YOlnTY87UGfZt0KqoJGQ8axv2sRkJGbH2rY+uN
+oofb57hTtLSX/HbzS42VrG2WSKH6k1pznan+97fvaP1y35tGpSyNTIdk7e6x
+VFJOVzNHGet28bmqeQlOpfq9SLxhjMREHiViaipe2uHb17t1M5zYTdnRStdH
+FQfzm3TxcRIIwl+cxKBCE1aU4dM8/TozCMWGFokI6qGDhlboSogkZPBejSKM
+1L3HvlnXe7+3r3ze/KZ785dXdPfN38vR6H2+X+Rf18qgcdnGn4PhR6ndDUSa
+HdRcij98OfnOk7NkDWR6e4kTjjSqAc/OpTffHmeV0q+569ffSvppsD4+x0rz
+xZqOp9NHdfQUWHHCh+r7ddscRNNZHegi+kfstLEM9E9213mJde+N8Pq/L7Vq
+Lz5fJfefvz9wlgH3rs6+TASRBfSSqFP0iFZbfUdY2iHt+8asQiLp7he096EO
+OA4TMzL7jpF0EkEdcvCYgGQIjKEGgPdRS2AAYaYcHgT35PwSCe8N+V93fccj
+vvrOeS0kRPFUCtJcsVEsP3jjshHB0RO08eTgUgQAv93BwlVk33SGJguD6dxQ
+nSC+LssQS/sxUTMmePvTjQ+DRTPd0+vaob9ycX5+ZifqeeY8vEPB+/ZoBw4d
+SCFblqAXfs3dB+AyTOQ+VGLIkR95TQm6aamqAc/bofDnGY4qc/1SXmHCZ/su
+kpjvO3YZ0pY13nFWce8o1xobYmec3mHXOLiw6bq7f0uZJd5RV1mZcyDvKrrr
+ouspj+RaNaqTY3ak0N2g2nWce+d2YozDJSGqkAggoBBYDGEViKkEzGYB1xOU
+Rix2yqbYqbs2V5nXLamtGxbpqNa0PMhw9V7iFe5EZhJmFZkWYgRIKSIwRUQU
+D6EISZZIVgjFQgB0SRFCQUB/AKDQdCHhRJJIICayQKiKIQDyCo1NsrDFZMQy
+p1tU2Ru1BpViT/ZTUTmqbgZEc0b3oaqao9xmZjMvZQtYqZMiKwYyVmRYsSTB
+KtuKhikEFyIJ+kQkICSChIgIkWSGEFJBVVRkshUkEJYsyVkWTOaVaTvao2nH
+OKnA3Utn97rvqreZqzdG9xK9sMUqyySrO7GZmYU1WCiyqpeyXWKHMCd4MzGZ
+iVnONN3Y3zW8ucuM8zmOc66x5UqvEi7yl3ip1kqu/Ot3NxvXu+c3LpxusZc5
+xikrySnWUrrHGCm5OsMyAwNLPrMs9BFJQ5e0OuLu0X2ZU5lRzMzDMslU5mME
+5ii4rslkjS/qwu6i2P6qKQoqgoaKLtNDM2GzYWbkDAmQaFqVZUhWWIIVpEZF
+5IBFBEVRjISVAkkRCoRkYiIXYFissMsosADquXLilZxdauIuJ1OVyVwaTVbL
+jhTgZxX+6cqh0ukOOVLiuUG2Yxrdbm2brbG5rWtba1bma1YYbptTdaqWttqh
+utlNa1Rq21LdWq22tq21amtNpulpumjZtrZqzJZlLdWyN2NAbq1JlMUwMGBl
+MhlN2TVkrJkkkUgW0VhV+LcP+LuSKcKEhp+Y61g=
 ====
 EOF
 if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
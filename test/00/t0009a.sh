@@ -64,6 +64,53 @@ Compare 33 success!
 Testing threaded int16_t write and int16_t read 
 Testing threaded int16_t write and int32_t read 
 Testing threaded saSample write and int32_t read 
+Testing threaded SPSC stress 
+SPSC stress success!
+Testing threaded wait 
+Caught WaitForData() exceeds capacity
+Wait success! 11781 hops
+Testing threaded SPSC wait 
+Caught WaitForData() exceeds capacity
+Wait success! 11781 hops
+Testing reserve and peek 
+Reserved 7+0
+Peeked 7+0
+Reserved 4+3
+Peeked 4+3
+Reserved 7+0
+Peeked 7+0
+Caught Reserve() overrun
+Caught Peek() underrun
+Caught Commit() more than reserved
+Reserve and peek success!
+Testing threaded SPSC reserve and peek 
+Threaded reserve and peek success!
+Testing broadcast 
+Readers 0 1
+Inserted 7
+Fast extracted 7 last 6
+Slow extracted 2 last 1
+Inserted 5
+Slow peeked 8+2 first 2 last 4
+Late reader 2 extracted 0
+Caught AddReader() too many readers
+Inserted 10
+Caught Illegal reader
+Inserted 8
+Inserted 8
+Dropped 0 1
+Caught Peek() reader dropped
+Inserted 3
+Resynced extracted 3 first 5
+Testing threaded broadcast 
+Threaded broadcast success!
+Testing saCircBuffPow2<uint32_t,8>
+Capacity 8
+Caught Insert() overrun
+Caught Extract() underrun
+saCircBuffPow2 success!
+Testing threaded SPSC saCircBuffPow2 
+Threaded saCircBuffPow2 success!
 EOF
 if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
 
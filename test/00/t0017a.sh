@@ -53,6 +53,9 @@ Allowed options:
  --upperPeakThreshold    upper peak threshold
  --gainMin               maximum gain
  --gainMax               minimum gain
+ --blockMs               AGC block length in ms
+ --lookAheadMs           AGC look-ahead delay in ms
+ --step                  AGC response to a step in amplitude
 EOF
 if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
 
@@ -253,251 +253,186 @@ if [ $? -ne 0 ]; then echo "Failed input bunzip2"; fail; fi
 #
 cat > test.no_removeDC.ok.bz2.b64 << 'EOF'
 begin-base64 644 test.no_removeDC.ok.bz2
-QlpoOTFBWSZTWeebEaIAIjvYAEAQQAF/4GBESwpEUUCiqUqURcPBQkoEQAnd
-wAAAAAB9fX0y207ZtotmlXvsOnzYfa3c3bd3dWzd27t9TcO8si2u7ou2Tqtz
-2KO4b10ty7nLGlse+318vs3S2tmU27t3a4530+j0fSZ92XVXcdy5tPb6HIe2
-+du7aFG22FvQzsqWz3dOK7Vsdu29wznt3Rpdul27s5bsy++bT5e1X3Opd3c1
-x1bWoCSAElNBqn5GJKUA1PCGqSgEhBNSUAiQQpqU0ESFMFKaX75cy4WCcVR+
-/v1TOy7RG/tqavFo0RJlVnbuU6KNiy6o2na9BMt0LVu5Rjm7WFCVK8Qa7QWO
-GJkxPefbpXZZ7elxyIVcatcgUwcauOkIuDVRuXq7rbi2+wE9g6wU7X3bHhcQ
-UHIMiqcuk6t6KmaL13GrpiOwbmLIIHA7IxXm4VrCsklcuqa8cQY4lO6RvZau
-WzMEQe85aHKOn58D8V8iXhW3WJo2/PsD6O4bZwRvHRFO5YLBXN0yjn6svqtD
-Xbzy4uiqb7dLFNw7ozeslvKxaxRZtrxvTnXfLn7vH3iXlanthAvFrub1rBIy
-pYxMy0GFYtkxwyIXcR45u6awQ5WuD5Pdl4OE5W9i9iFThB3OE3NqdbJh0Cah
-WIUId9CCknxXXBLqeC4cVDGFc4MbPDWsGmVvMwa2e0v3ZBs5ixPUsQ3uQnJC
-umnZepUw6OwuyIbiryvoOfPm1Xq2Knu1HUg1yHdVjsvBEYeuTYnyghqFOQ7v
-ca77bHHeOBopvQ+q51giEK8Z2qaN2epwNkdeKCmA42cEuyZgfRPAW4rv1JUl
-1Hmcm8sbrvKkp5Og0k52nuB4iS6YS8desh4cPZ6K469DDncVdXVewFxHqeJa
-E0ztSMRpG44srkIImFvriK2kde9pzbdOvHT0zJVgzW5PI+fZ2zObrJJOxPZq
-KPWcxUZDVrzTT2Fgdciw9YjzEnaHj0xAu5oNN2newzrtZdUkRrcvEYRVEMBE
-UmYjhWZgeDC1ZBTpULoy8u4SqmzQxjIukHY8r4srd6u3caqXLtqqUnQ0SUog
-kZsF1prEmAa6Wdpssjh3y3BR1VlEhPQIHmA5iVe7Vg5M5FvJ3IcTBdfdGQs+
-IVdycMpnZoNuZhZ8ySKrDkBlmyVIvNwaEF6nM4E8yTO6RnZIWb1WvG+I0VLt
-uwEsd0NcNOQl5olcYhGew53pmkOLsD5wR8jxHU9qG6sZsU85d3TUTXhELPdY
-DFE7B9g69nAsZgQNnTUDUuOBJS8OgwY1AhtraBhkM55IcPYu8loIRHTJuhXC
-RK6hJ5qHsHVcsWoNkLTuEEZe1XrGJKhgypTuqG4alas3MXcttc0qVMxzoO9N
-8+6C5ohzBuyrfGs+i5Pmi+VeSF6ZmNjMjJOaeTms9fttnJagTmBvlWrZuk0z
-qEiBncdQV2wEYp0fjLOXCxqdHPIlyJG18Z7dfHueRvhmo0Tt47DgUkx/TS0U
-kLFBgxIEwH4iRVdYxw4k1H6fSZgh1cjiS7XTdLx/aclyZQRivG1jDd64ieIq
-hQR0waUlCRzft3JfdEILrCqxG4959N4tApTnLMxWoQ4pXUyNDb70qIpJaDGB
-S+JGFtQKDMUxY53s7RCecVebeszsevY0WMzIIMCrPyshxW5E1yQMGAOtWdL8
-NbStm2/XgtRkF3jFawcFl1T2hWC9RRNFUZ7O57z5aPBcdjJdvczRs5Gpe9hn
-SnU3IjRcKCxZb1FVUs4VbF677zkxe7b1Gi4VCwXNHCrGFiFjabVsMTng8QeD
-cJJkZCQhSbpsfBRYNJ1ej24EHUeJEkUnhjUAlyQqSEWMawJjUN8Rg8TnRoYN
-h46OgwH2shA5xfEk6m5xPOw89k8PvJo6OpeMJbcMGwyUNUsvUYCwXCo0LMDS
-m3pjV2DiDmXieGrI4OjaXAkGeT3up3iEnB0c1OXA05Hw3gTR5IQobHEtcxOc
-TBh0ODB4PfMnB0dGDzsIszoSKeocHodmj4dafBQug2PdjNchYuVD1azAboUp
-tdzClTAYrph4OeIzwK0e0TFljWiiJxGyjRlBrY2Ty0lpnqSxsfSEIPfJwYPC
-ouyx89hBnJCS0seL5PHYTwy08PGQiGEb8FHiNWL3k3BaK/JuC2gKblJ0GNw0
-bYTxoeaDsC+MSQoaHB8OD4eHCTo4D4eJ3hwTg4NlyTw2azBwgZ5K5CHB0ZwJ
-Z0hY1ieD04bHzTQ8HnlLHB8PfEkYzowoPDZkQ6NJXRx64PklD4fDoNnITRod
-1KHnpHo9IxfYlDgxPdeQ4m4K15aYHjm3goKC6kRFXzDwtFoQhGtFgoUx1qGW
-yFo8C4XaixMTFjB+NCgjYsRmWF3Y26ClVd2wVjiZvISYPUm7JJSV4eJzo0NN
-PB4PhsYbHwYUOjEzEzjcMWk8OD186m6OpKHU1duEOXAxK6Pk50Ki2ntSBb0c
-GhpO4GTR4PZA6NpLbJxMgPg8c1Oj0eHQ41Cx48kkTR5cjvCQMJNHB4Nj1OYm
-5wJ5PVSeHAsg2YHk9SefQkHo6PUqk5GQC+9CtCs8R8NUmCFjx1xN4NjhA7sJ
-ODXGGj1888SFhyYm4ODh2QoYlYnsMj4aHo0PeyPMTDcrJ5II4h5szQutHW6g
-tmo6F5OKB0FjTUcc7htpZiWMd94IwfDN9sIztMAwvuXAVSJ4LfI9xhOtaFT4
-1Ik07NCVEQbOKT6nCKLJ8TnZ8VXKSRh1QNuCEGA/4YIQYMGAhBoGhWgaGDQw
-YA0MGDBCgYMGCEEINAwaGAwQgMGCFDBoYMGDBoYDBoaGhoaGDAYDBgMBgMQa
-IkCgaRKSMWAMGAMBgDBgMEINDQNCJBgMGAMGDBgrBghBgrQ0NADBgwYCEGDB
-gwYDBgwYMGDBoaBoYANDBChghAGAMGAhBghBgMGAwYNDAaGCJBgwYMGAwGDA
-YAwYDQwaBgrBgwGDAYIQYiwYsGhoQoYDAYIQGAMBgwYKwGhgwYNCEGAwYMBg
-MGCFDQ0IQGCEGDBgwGDBgMBgMGhoGgYIQYMBghBgMGhoaGAwGAwYIQYMGhgN
-DQwaBgwYMGDBgDAYIUNDQwYIQYMBgwBgNDBChCDAYNDQ0MGCtDQ0DBgwQgwY
-DBCDQwGgYAwBg0DQ0DBgwGAwYDAaGDQhAYMGDAYNDAaGhoQoGDBCDQ0DQwGA
-wYDBoYNDBg0MBoYMEINDBWgGDQNANDBgwaSSKUMBoaGhg0MEKGDBgMGDBoGD
-BgNDQwQgwaEKBgwaGDQwIMAgNDAYDBgwGCEEIAwGAwGDAYIQRIMGDAYAwBgr
-ABgMGDBghBCDAGDBgDBRgMGAwQgMGDBCDBgDBgwYMAGCEGDBEgwGDAYMEIMG
-DAYMGDBgDAYMBgwGDBEgMBgwYMESDBCDBgwGDAYMAGDBgrBCDAQgwQgwGDAY
-MGDAGDBRgwGDAGDBCAwBCDAGDAYMFYMAYMGDAH+BUQT7/A9H3k5sdXYkCpNs
-YQGEB98QdHMH+8nu/X/Dg8EKsdjYNF0Oh6p6ioncB6EGEG4A95aWD8MHUgzK
-GiAwIDPXvD2DVJTOQe9BR5oFyMQcJgYvg8ArGD3bO3o2XB0fhqh0aKGfGuWN
-DxHMExcilIz9s1nx4TYmuXmY8HggpKnhscwwkGwfhyOYYMCD7Q7hxqDOpZIH
-6zozmWjEgHiMQ1kWGrGs597nlzxs41tzIsXHB1eEzC3JFAq3Q8Rg56SxQMLS
-uRaJBRF8iQWwYnODYzjuODDeLuA1E2RPs+HSlzJNFIc/zsQS3mDNhf5Hq/GV
-AVEGFTC9LG2S/Ao6NFr0JrZwFzjiDeltjtth+SVMHmHRkH6h+TRmDQwWbhZD
-ULhMKxVJpItE8Sxje0oXhaLws93HkzHn95zWk8VIMGBSIOXCwI0ne3fQ3DU2
-NtcqsA8N3a8HqbGaByA84Z+DBiUOWIabY62niQMaOfrMBcJgT3hnCkwTVOnl
-2u6GdmKNWxI7+xyYc3+reFJhdCwLcW8C8X8JyUUDYwZ9ex6OvrCtDLNjmD0c
-C/bSJIcdHXo+bCPRyzwNd7S9kTB3TakUiYUb3svwecqzIku+ITaaKhaJxQPc
-S9HRgdTE4O39vDo/A8fy0IQg/cSJChzF6OBQT09XAZ6GvwUHJY+wsxdHg1Q8
-2gwGPo3Cx+GhoXeTiYzfeF3vNh1G7NewRG2LkcLZRKdrXgYn3vDB20MbyjDB
-8Pda0repsZxoY30e8sK+aseAwqBhR510benoFjS2PLGQYHNHMEOm+qjr8e76
-4hs+zwcWUjSEa4QhhulxeFoohECcqFjY1kD1jg6O4mD/DdpYzltj+4hQw6PH
-Xg5B7wY/hlD/J76tDSvsiO6q+r5LkU0I+PfC4X0CgWn2omRMj4d6fk5wHO5q
-4MSh5T+HBu1hQzozmKBWihYSKJFgqBXCVTr+1uHjHaKj3K6QloXHJb+9cwZg
-Z2+z3hvdUbEOr+340dwRrqrGeuGfeKZZF+Hb8unDgKMsa1pkMcXnRpK19C5n
-aiwyy6XM+DKiFpNnE7300xmNYcaN1Xw6qd9o5FmxDSZzhDNpXNvngw9ZCTWn
-4dyiCDmrGupp6dgMn34VzouFe4RorRAixFCwXwug95y49Tw8Sf4d1MTqfx4c
-HA+GCysPCoXhe3hlFDi4XBaKCUYJ0WK+RCOULRxbyNMrVqOyQ5ScYxvhIBJB
-gusvoOp/hOFD+FP5QGj0Xim6hD2xm/kZ4TMEyy6sVxs4T5livx6YMfhwKhY8
-N/h1Oj30SKUDR3pwLsHGYGSsTki4UAtFFZTs8e05m7FFO0fpviuRYppEkI0V
-ig8Am+RjMjPuFYs3HRALhdaIEDu1WfQyKFE1oWYKRWKbLccTC0XZr0oHGObH
-rlf1Hy8mTvQO4NBsoYHXbEPDvd0krz+HLC2xofuerrl5EoNGyAyppPh45fh4
-DordYT5CFHaS+jIOxog9HlDcB8J0mjbFwtE0VzvXjPPBmycQmUs/XmI5MWi4
-MEwoU/CzVwmjvoP4UoJqCR+uUObbvKhoxzjY4MHfd5+rpvBgwcstT8ODUGQZ
-zdLODTZLhcNGlGLaFMDUDuJwIqmd9svOYzvPap5qOosvqcDB+od+Gx1ZwNjD
-qaGQZwoQ0a/faPR4Ov0Ds+ojCENS514IeKUDgQJlCjKj0mX2HjDCh788tWBd
-WEzwEFwuXyO96vwmie5xHDwUIhkHDFoGrHw+HBvKHY81Y1RlE3ZSSWeGDo7a
-dGxwYNDcGHRiYHqFxOGT7ur0zg0bFOTdTRQyODEwte0tRqc6Mfh+B+tCxuh3
-ho6DVKycGwVuLnnBUK5GQ4qreGqIyFRnVeWr5U6dBCZXm1xTYdeUPhgQZw7o
-bwfaa4OA9IM+GL7bHDIEOe/c6nBwbGhg5aZwYOjmUDwf1D6+ytPvu+Og1lZ6
-ClpSLxDBQsC1IPftrRQKpqhfgWhrHh8ZtIlokIpC1QoNDeIb8WHKOtNHW2yk
-Tv3OyjBg8Sh6PJQqrhWwquMJ9BRhGUQZURwOWKUeMYIjwYJG5s+GqiFDo/HE
-7W20SfqT6YQuhcKKq2cKRwTNowVfro0+RT02kaJrcXVQGCgkTIsTBu5HPkd2
-bUP+Z2PXNahxrSfek63O8GNniPZ7ca8+8u5dGupNnrixrpndmnQsoYtgl75p
-4h1ecbI9KfAh5nYIJBPtDE+dDIg0r2jDkPUEEwL6ZFiugh32zviIRfIe+Xvt
-dZ6x1pqhyzi66zKw18qOHRzKR9iYYh0Op0ejQ9G0waTSJxMTqfk1NT8U+sOD
-iaOaGqd0aG07gfh0cHpB4b+HR8mjnfJ+DibxMCx0ZiWOHcGhnXUodOeFx8P4
-N3eDQVXQ2YCtJxllT/AJCCvC+EwrwUCc5mpggfhlv4a9dpoZob5ZgzdlLgyh
-lGDAv8WD80J0bG/hKB/D4cwD1c0LTBaKbysHYjYfqUeyXUoc5ZIuFYnM5a/B
-IfDAbz7dCQ0cfw0Dy+R54fqH3L+GD0dg+Hg4Hhh2fUnh4Do9U+yzxTd1OzQw
-+ZUPDBKJ8iw0KForNYGRl8MK4eA8LyYVSDiCI26XhbEYLCYwWQvMKmekpFKs
-QML0vT5vuUhllHQxLO86Jr2kx+WtHw99Dgwfw0V9WSQgQbt0OD0e5mx8PL+j
-gME1IHRAs6TQYTHIbKqocqUOWJ8nXrI7d4bk2azen49GUaZp2NJB06Twwe98
-C/H7yhasUJjmOOxTuyjIjhfC7XkWpcvmN+Hzx1pljEdoYkGgPx8PhkW7Tto2
-elypNInokvhmFaB0QeRjYPhg5B0YVjPh4Njo95Gx0fw3Z8OD4eneFDgxgzcO
-UftGQc53Q0LH3j9nyfhy05Il2xLanSR3g+uJo7omGicHm+ePeYqLc5yNLgrU
-0NfMsCEajo1ynYam9D4bg958kLGXI0MolDouJJQyi/DSfh0GDyyQP3atkB0Y
-gxoF1k7lGgwMZQmbRMJqcyujuNfxcjOWoKM153pL5YJ0Os4jdsUaDDDNskTa
-OjIMAqB28ofhoeN122wwYdNzzxKSiHBiQcex7QdTJExuESHksTFu7cNoujoQ
-w9+/frFQihQVjp5+G+3J8ODSeHM2u7Z8DOBtQnhosy/wuF8LOPhwjbGUJ0m1
-rhJYYBowPswwYaRgSOGj0conTfvxe/XHpyvBj9FiwXKrRhQuRIMrFj4LuBpY
-SSTwMSXVJSeKGHpJ4aA7JIbkmk3YFTgPSuj8YmBY/DrPD43wYBEE/AigfXtr
-FCQ9+g/cQleyzg9rxteMy5Ka8yzZ7nL1oggotbLvJxy2ulXTMqzAtnc5zb2q
-46ZHTEsRxWScbs2PlxZHKH0kKjZvpGDC6vCZJCTDSnLTRy+r4NYOQOu/T2aF
-MgXbTofmRfX7UGiczl3KccuZaa27CygY6tFGC1K1KMMEwhltok3OCblxcDCo
-VJcKZKWoowCBO5grFzpjAs0Vi1HGInaFfI4PeNDrnR/DyJ0dejo7eBuiRP0D
-5Dam023rtdZDYcMIGD4cYknaN02MifStFsIQx35awdDwaGh4nNdGDLhWhrcP
-QYljHIXPsNd7M+5crGjfHIY2UaCZ6aHnYN7E8Dr0oeeKEJFdk24N6OF4fRcL
-bHEwcKLUKfSKxYxX9EpYoiDE9oeor7e5576xv0X4OIy8QrFwmRQowTaLBVgT
-3djS/gUvHsGyDg5nrhcNiwdHRoPfhp63++HBSKiswcYahO5gVDCf0zua3vLm
-ah97epuMJ0NsTXA4q1DNotcXCc0XhXA0Pw1cGE0aWr6Pw6PBDmpwwd6L/Zg8
-2nrkNB8bemLFpLRi/I/CsLCu34HBsZofD0fh6PxRUtjGrgSwZ18Oxg6pt5g7
-XK2D0A6PR4GDCkZ96eVRXlA2/w7FCNK8+fgzbv6LqaJT4rgPVZdmxaMFlWX0
-EkxWlzazheF8N7NHBs8k4WkJDw3BzBvRi4UlQldHAcdSSE4NjQ4PR1sjgyDe
-aIfSzXDA93v208NjxGjSYmDB4n1ljXhuqG66YODbg0NKaTqe3WZNGY/DR6TB
-5cSjvLSw37g5Qx1KpbZQ67qIVi8KsGRsvL7F1IeMek9J9JjbY3OVDi5Gg65i
-iB1gGi2qk7wmQwpiApSLDr4VklnIdmxFmb1CpKheChlcIND0bcG7G+Hz56Gx
-7VDR3VDW1c4/HuVGt6NLwxuKI5haFUJwk5cJg4OMKkHzs8JiWLWlDi1Ech3d
-qbY78knaIHRtO3UH4fd+Gx+BqDwd9+TUuzgxdN2zdHxp42ct9L6FaF/X70Yh
-ztwwZciBQkSLlu9lM4uvZJ3wuF1ew9HNgq9SJrhY4pEzhbaLBWKAHkFom1Gi
-YoUZFC15wUigoWzea/rMrD913ott3rOcmdqP73ZyEOH3x8HOnXvIFWhrQX8O
-1j4jRZPvHbFvGDhMplOdcPdFQ+C7SrhZDOxU0GSUMXSgntozq37JFsZWcqJN
-hjvaNxd7lS8bX33lC4Mzw6lHPcKWM7h6mjIchHEi0y5FShdGDp50eo/bDidd
-BsgbTg7SDAbDqRPhwaKTbsJRHqWPGg0Px0dBixHCcQ4sCBajhbgburATo2ks
-DUotNGPR8OjTaZB70JXAxv8O8KuGsw8A4MGlv1jQwcs2PNI94MJCfEamwb8N
-8r1/D1qEfDY3rPj15c7k+6puli9uhpJZozmOlImXhd4EyrBP4bLFFUFTE+Fx
-CXBfhXK+yuycnIvQPD0cKkcK2F4VkI9hpQqRlSexqIs84RMsMYQmJLFQroXq
-YM8C91HCszHbCUs/CxG/JW15ECST3lR7UcKIlNjENa78lDqWFOgbsY2yDCjJ
-aeFgshn5sKeTDM8PjOsNtr8K6BWtRYoNJ0dDWuE5j4GPbDhBu9X8NZAxjB8b
-8vwqCqGfZHpuWoHCcygUF5QTutDNE6gZUKRdkqg4Oo2xSlotF1HtM9snsbIn
-zwa3Wk6JUo4F1bA7DJhnRzo6HYwdskPJJVE0OuieHQhZ0cLBwczw7H4GguGI
-7vw9bZGVedNPUE4c5hnp2ooiR5sTbSZFLl0IlGi/D4aHfYO/FSE0NFHhmh0/
-DDhIwnwaPYG9DCsDEtwHuqHGujTxPo0e7UclFQs1NOBGEYSP6encd2EPz0VG
-LeIx3q9B0OiRSndYrRE9otRXcWvq0PhwYO5hY3ewYlj+HDOjg+yh1Bj6QkPD
-r62h+G8cCwe639zx3jJWSZRw9qMR7sQyKWEaDhnV4XhOJhcHZaGFJYJjEwjZ
-8/G1UGQGxStGeuhgRhHRu4ND+Ho2Z0bHo/HrvRSDCedUCgzXycbwxFWWYVWh
-r5eLo8Gx+541/MoaLljfhhdlEC7GEZIXXh3ycsYODmcHzI1x+NdCy5CpspIc
-GEH6yh1dpY8GDd5zp33Oz6b3ntGcyjGG7K7op6uhwb6lVyrTwyD1ai0Yfree
-N3Vm+Bg22MWnOCoXL87ZkwW7tk1Q80clYzcnhaQyzS060XCmjbUK0M4aCrua
-uJ7PLzevo2s1QrDFhEpfR9jRXsvIelPjTwGAzCRIQ8LVmMaUc2QrguCjSSbe
-Y6n2DK5qrhqHLHdt19mjWvi1hpCeFxxdLjlPchiIMNGpnEnwz76oUXFob85U
-hlXfeLI3drd7aLCFyZ5a1Fz3J+TJ85kxcrbRcRE467mMlyeyGJknrkp3ooWi
-gVLsBcLQuXFh1rAt0SK1eisUi00TpyRUK0vZiUPUgbxMHQ7SBfJ8HQKHg4Kk
-SJhxQ5gptDmG3YrRomRIutHKNRpoqFItFRl2ssXC1DcOpa46eKMLNY8LsisM
-TisF6ZK8LKEUVBIuRfMk6OUHxXfOjGrwMGxwY4+TUseDQ6IsVopNOP6zxVMe
-L59esl3Trw1BYOLUVZiZjwnduUCjN6oGPUM7ERyREn4cO9i8+HJRf28HNIwj
-OVusX4HgQYZZ+SJXvmzODBzYb2x0e+5R4ZyGpvRVTmzxnCe0S9WXAg/DfgfM
-GO4NJ2QLGcD2DRSXNFhIRwcKHQ0LL4U8H0aYxqW3CCqJg+RIRrQXijeciguM
-4vMRJQWLtJFqH8iw4Ojoa1vWyxJNDVZXw+HY4NKa3Y3wYPYMe/NUSPRl+GDz
-4H7psbrD3CQN1r7Ds15LJE5KPIoNDnQ9Go0Ub4fhoc+fHfQcOjOyMh+Ts7w7
-g2PR3acWJEi7IsUirbPVtihGCo9lo1HhN9fE384MaSAzpY4UWefqy+/oVc00
-zOH3agZrmDVtb5QyMKAkWBaMZkS0jQ/sH4cyh8O96bSHRmcH4e5waHZogkGf
-bUFwnTVtYLtv9m5f78jb1tkY7d2lYHw7GPh6PR4nRljoehZ0oYPyUbHr9YNf
-d8PRqDA6meqKcPhgQYeYHRrR34GJxo6ySST5fnvyO7t90JydGVBmOoYVihEk
-LEihUKG0ifh0dG/GA0mm2N2wLqkoqGDbelj0csJ8PRDbxNHo32hxbfw9Bl57
-GDermbo9JycrhYLROalwrTNqGYZ4u7tjfOvt37WjI2xtwsuFvws6tgxjH5TS
-KWX+FIn+kH94vwu0pkzjLNNvdD4bSj8Mdk7+SvTRmjh7hhdpooSYW7WmEEm8
-DEkeKbI4HDvMixSUDikHg/vZQ4PIHYBejG/DRRcLkepJNG9fnq4M+Ze7TjnB
-54Zoz8JzZFSviHh9fxRI3B+PAundLWZz4ptwmNmHiiz1YZjc6k7ruThigpoG
-O1Zp2eQwWaD4FimfPjrFzmJ278veQeMEF43FNkK1ZswRy40Hkoikw14taSMl
-XkYcRhQuvHHqZHjo7Ms4vpUFRGEbvDEKZaosHOOVLBxyENoqRAaKBSWWaEgm
-R1q9FQULkQLhGBcJZougXWhzU0LTE/BwbG9wYFDwT1j+TqGjo+D8lhA6eTRh
-y050eNBaYnh8AOEI1DkoLFXc2Z25juMuUUeLYUbpAm7wncMFkhooy5IFwtE7
-CpU6RRTpYKtql1bdVaPC0Vi80vsbgzTE9aeQjTpMMYkUocM11iHFYq8qXhOK
-RQLhQmO0fF0VwrwTWY4ciDZOFomLOBQ4cPw4eTJo7AbX30T4MGHQoXC5s0oY
-bU3lVW1Db7TKdOKjEQsDyOj8MHOpSdbK8DTXOsj0fhofvvDE0vgPDsb8Phsb
-8OqZQ6KwagzvaNTZ+eRoYSAmcLRUL6XyLFBeqzdujwc/nl3Kht8QD4Kx+Reo
-sWCqHE0Sk0xIMvuBeBZk+HvNwqk4Mp+KTg3wYOBscHxkLnhmDW9e5fijvfZf
-Jw8Zhji1kaKAVC4VioXcvAvPjkCZXnB/DdDo6ntqJYzWQaHnbpOpWD9Z6UXd
-ifROLhbtSLhMKeKRx0vjinFRKfmiYV5eZAOi88KxaHjkYKkUoYwdk3eE0Did
-OeriJ4WQ7shqdqDBZcFi0VCDxu972P6oRoKBMCocHBWKxsewpNSRYOjWFDt8
-8cnWrvCvcPtee8WjkiYGDzhq8LYYo8zozRRFUSJjhUYK+x73BZgvWQdsC5Ot
-FguFji4WdtvijY8D1mL26sEyMLExAW9i8MGxnBnh3rs2HDd8G7GGufNEHg0N
-JphYXvR090YQZBsqBO48+Hg24hJAtFAnFIpBxYLYlnWnnzhXPU/kYGhsbe9D
-hwwTLWiw8MPQnBhYw1Q9GwtejY1wyj4f0CJ0b3fcJoxrcmj13tYbPmm3vzGE
-J3b4+3JX34sww5f6Ljx0f2uDRwdDde6N4NDfhhF+Gtw4MdmjQ5Y2Nj8PMoI0
-kHB/QYbj3R10WUw0Pamt9p+GMGaobH4XhWZ1dFeuni78Zmx5paWpyN7rrmei
-NnJmZp2J6fSpi0LkPfDEG+ziwxgvwxfUs2a5YxkEqVsVxDMQWMGSrjDtw4rW
-vSYOkqx2bUxaMhogd9wiFFqlNKyukxOEK4Uj5YRWQaM17oYpNMYfN3sw4p+L
-KVHGuThKwIjjFmnaWG1qvYRQns6Ohqk2Ok5FjiQe60NJaYbHSfUFDtMHgcEi
-cSjXwcKBp6Ono9Hg+eecH8nQ7Dhn5YZoZHU1MGJ46jS7oYIOAoWIiGkMCTlk
-nJxN4TimWyEcFhYqEwskwV0TQKSMOgUSKKaM52A/dtO2rowdZB5H99rK8d3x
-4OJ56uzRa6JoXZwYU4mOfBUZ3C1pMthMhE+HNgQfw6Nn0LdGdJMwri5Rox36
-xjBgGXyBz8njxjuYESGl4kjBMKxSnE1RDRV3nr8qIqZVXxqMHExMTA6kGDw2
-GhNQ+Q8PhoYNDftjY2NZs29Gk/DN0/HH3QeHR7y+BIQiSey8nBz4b/Wb3ujW
-L9CJQ1UjGS9X6vhbYq9PmeKMFKboOFRev3nk927ybp26xmJSdFOLRSYGpl1C
-8Khy3h0d3b0YmcHo6dTPujSa8FkgO+Cs9wQw4QGDlLRihNwuFqLYkcdwpQpE
-05no7zbjVNe3zLOlxYpMFKKHPYMaD4f3mmRj7QsfZEwLGZsSuVg2PMM8mg8H
-g6ZMB/VzU+D5ISjgO9ofNTR7dwwZBy4Gpp2ynp7T0+4Pqs9FYVS4mC5WBAp0
-ORyVRYDCpHh+HKC9iaMPsTBnBh+GDQOdlA+jQ1VC+sTLZJ+6zbOtwd1u8fGl
-ItEim8wWOPpltomDBW13RguFKdluZmB8KCiPwcyVnauUA6yEFa8VztlLwYKw
-t8OEwMJ5vheRQm2yRX5IiPFXh9hKtvtHSpB6mDODcwdSnkHd3SljaIE9wK8R
-4VofsBWKX9D93EhJboqRx/hTUMWG1wmkxOXDwuJor55nZ9D9InX0sowm0Kha
-KCtIhBYHBDw6a+Gxpbyxil0PYOxvJYNaG3T6do3WnIMvZ4dfDXSJDOjXh0cT
-jMEs6L2mfSEy6D0mlLDRefFosoNS8Dzg8CxCHw4UM7bsdj28+HB9WYnh0+jE
-mr4bPQNGuwPHDBogwMv4jx7V+x/hulaZ+v49nyFmWBgzw7PRzyCt6YlXt3RX
-HGQVpS2g7JaHeHnQy607ppVK6NhZfTcK3IdQ+Wu47m3lRZzXOSnKLs7qKiTD
-Yoho4uO2nLDtm4jlZVBZXYbBJ0k2/DNVWiC9bOc1wkKY1xaQIeNiYOm40mpy
-/yaNNjblA4HRtIPR4fl7oWOlD47+XODx7Q+E1SngYOwxDY8Do0h0cOYOh49H
-TiaTkTBwYc2GOw4HRtOlD8FDhts5ZuWaGHzu0YXJ+F40UFWGRI12Ljt0ETJg
-79fhwdd8NUmBIcS8ayXonHhoBVeeblnb0HgiYUluPrcS2FFRzjwYYOPw2Hhh
-zi6TAdZuGDb0rNCsVklqweRTAooKyIkkXrgMFgsFRWCwVid2Zo89dkTvZLeC
-oO4Vo1GiLF4XJZj1IJ2FD+ktFCqIrkUJqgvwtG+DMsawbH3CiG4PQ6Nju9NP
-jkiMt7zaeb1nGEegHLY9udKgUEMKQ8Lx4TDLOY6aE0CwTvQqE1+hhYCu7KXh
-0bvR5xwx0YdGcJhg7yyPU6MyyMIGCyXC6IotFoondZ9+LP3XIQy16HgD1Kww
-LE7HhbnjwoFAPAOYxwpMbcTtQvLdjl9Hljg7p35LoZg5v5V7ozWJlkGWpFk1
-xYwXguO8TRO7pTUW8HnLhes4yqFKIFtaihxkeEHPAahE1ftjYem5vg4OJoes
-TB5BiW2Vo0nw6D3vR/H4fh6mkr7Q8mJJBvu1O3TwOY07PeooYZxOHJEgxjuv
-C/anx7SiBBYKUxs7D40D80VfhdDE7GB0djm86tdPYkGzwwYP32Ng5UCYTpYK
-RS4vGCtLFYpKOpt6tu6bT0Evph6Ot4T3jF2IgGQ6kLMEaFleGEGVsgWMINVQ
-3d96Pw8HiQbzEg1tX0fw9w9adGfnMpi/DtGdHUsfgXWoJYUi9u1k57oueonD
-yJNRQqEys2nUx+TticSSkqXk6OHh+gyxsKCZpgmHCgLuPNDMh9posNsURaLF
-VUlVBAnFdDC8KJsdxMK8BXtFdueVklPCtUHi8320aLSRUlgqtYi5Fkj9icH7
-w2MHDtDZ8exLk8eGBoc8QoZ0baljtq4O657JZoYai5h0L4OEq7dhWB54w7gV
-CYVEXuLFQULdds/Z5lj9sd+ny7sBFxibFgWyydmTEV5Vxg/BeuYQ3BoXAhCh
-sb3jWwgNxTtgcug+wNjAQfsfcGCOBFg7RaRM9CVNDFNLS+WYZow5TkxJkJZp
-Z0S0UDaYLRNdg5X5bGE3p0KCMr2VeQN1BhLxZUrb1JobbiCSUnFSTGhkoyrh
-uMFEo0TodUciYxPJYuCkM9ipOLgotYOY4P41MySTo2P4t0bU8PDkdHzmjecS
-D5JAhbAg2wCtCJ+g0OuowLB31EPHY8Y1Lg5GCoXLOSsbwm+Hmu6Cjh9DsN0e
-Yx6N5AshDkIteqjBsK0ZoxsYSdHR70zowYDfye4OD05uertZmjfIlJB14LS0
-+Sjw+Gu6ljg22R3bof0CB1kqAVZ94GiDAOjQ+G3BsGthQwznB3tjGEFopM2u
-B2WQssr2Jj5DFN/I8j4iJiXVisXCvUOJqPPS6hMWJk4tqw8WsXHDNbymIUZm
-EkjLRNQq6LLDhYCqyhCvHw+HjQww5SaylOpJ0cOa+i16pgnC0XDIdF27ClUV
-gLRUKOyhTphYwIM56mxkGH4wmmpQcSSJwHtvCYRg4Org/hqvDB0vRj9lJkKv
-etXuYuS4UOK6REBrNKGG5ZvnivPk07e4VW34B6Oh42RNhwnIXrw2NZWFI/Cs
-Y5AmCcqgTYqkE2KotIMbGiDGy6bGQb3aSx4MPQIl7XNs8w1LLbaouegeReFQ
-tRArBMnswkYYG8Jq08wtCHeWoWCsTWXdh4MFGElkWto1x/bmfuEF07nYihQW
-hon72eLVChNEEKhWKyHBT0bZ/DbX0Gc62lK1TDniTiWG2h+h4en4aHo+xMHR
-XJob58NWPxB6PsjvQ6CwMOjsGL7eESNEhGYNQZAdweV39sK345XuYHxsyyeD
-UOtpBwf4fUcfT4Y9CSxljvua/dkgbokptKsDYM8MoZo0Nj4fihhn6ixg+ePR
-wd3dPWMDK4OQzgvCi7zJEWK7kdTQt9Pef53Ov59dV6JJnz2gnsPdcKGnY7eD
-pqH4Q3Rnae4MieRbjxQsFLC7uJPK3LEzhQ2P6UWrshA6/RiQ3R8D+YMCISP2
-lhY+E44pFyOFAnmBa6LZoGvHj44wrB3N53+KKNbO4GDgFYMb+GPyZVSx339B
-sHmmvuDo/hg6lJOsdOpkNHXkaH0GJ33vn0eDUHvPD0eDejEraO4Icwe0dH6k
-j3RrgyCH7b3Af/F3JFOFCQ55sRog
+QlpoOTFBWSZTWdjHsLgAImPYAEAQQAF/4GA3nbhWAAPSgAJ8gSo1oFYYAAAA
+ADSAoqlUqgKKBQEkUQSUAAUFUJSJABVAIhQlVFBQJAJAghQKCqKpIKBUpCgV
+RQUFUKFFKRAUUUKSUKIogAADTIyKhkGp4Q1UhoJNQmio00EUBE1KaBSkIElN
+PkmkwlE+Ip9J+U0cT++0XdCVkMBfteqtCaDMKB0h0wmMyxh7srsclnOJ02ES
+7TwJ4hFixGehgkaAvRjdWjuNI10kyMrrqrJSDFGmrikaW0rJDsyETOvUO7ex
+3DhDHsRSaZbTRXr3CmDiT3HnJGG7nDnTBIj5uB3hPWtjVjlMl6OvcREYRgMc
+yrUSTuSCd0RtUQsGbrn5jFMLLBr5SONj3y93xasXMaJ2LyxRhnZ1meyt62nN
+3Pc9U6t9SHHKKu+33nTN5np6qZqeJ0lTEYLJjOzyPTLozijur1Qp4eCqVcOK
+35CyOuO2TpKh3hilFq8QbnuVTDiKZ6GzEtRGF+JnFnSWjOkbhZPErIJG2PtU
+bJ44DD3obTC9WaHXxqvOKIy2hZZLKj6dTp5HnBnTVKJpQvYc8GPJqYTJjxCc
+nB5LWtQwnuxcJZOBaSqhl0i7MGww5FElk5gpZ5mk8ap6wZO9VL8MstO8yFS0
+uspLsYwqTScIHaRMwZ0nIZeEGpSWTAOAhZnIeJzIl9Y6UreIdJ0ieZWqtQu+
+qmB07opmw7MXLROEzFWy4+yHDkUKRhw4xaaXGPCYSpfK4ThPE4TpLDqopnlT
+CmJAcHSA4PeppsPRmkwdGsgKHgy2nodotnjzKJZN7E6T1MbJcxBYHCenplsv
+pNJWqnbidtF54ZpNNZkL6NtvB1lpIWRwdG3YhbG6gIYg7yL0lE0PGGic6o+I
+1D1sZKJ4m6KdPMvqGlqepUqlHjDOKOTEwWUTcRN6qIY1qHOMVVOyk3qGEopY
+MwwSiaDueGenkuxFJ4gUUp01mko26b9DpMOM9C6Ik5gp2YmBxwnsU21jkpNK
+CjQolnkim9GLBnpzsOAaIkyW7sK8T01KPGKcDSc6zqSidJh0LJ6TYeDzfBTe
+KNhTfYcQfch4JcmIu6RVEiToL5h0xXDWZOI6hhjLJwl7Coe0nCYSjrFh0nUZ
+4lGo9JvIXgrXVgaTxLJcpCg0niYeVq1nuQomkSdJpEiTSWE2amkqmOh101Gi
+cDhIx2CCxoaGhwaHoyODgwPRtI6MHQkbGx4OrkBo4NCEjIyNj0u14tlper1e
+li8Xa7W14XaxHq0WrbK0XFxdL1dLxYsWl0dBgHlpA2ByHo4Mh2ODo8GxoeDw
+ZCYoaGBi00bBsejQ6ODYzqSDA8HB6ODghwcGQcHo9HJgLHo01EWOjI0NjY0O
+DI6NjA6PBsbGxgcHo6IYMjo0PRsdGAeA2PXHBkejo0MjLhHRgGRocLa6LtcX
+q3wzpYvWMaWLperFssXi8YweL1YuixeLtera0uj0ecTo0PR0ZGBjhDwaHgwO
+DwYXK1MXRYuLS7XpcWlpaXi9XB4PdIg4Ng9HRsGxkZcej0aAqHowNDQ4O8IZ
+Gh6ODXCGR0eAyNDwdHo6MDwZB4ODwb4RBQ9GR8TxOBNxV0iTCJNJwnAWSiJO
+kgcHoyOjI9yCI4MDIyMDQ2OjZYuLxaXa2s1PS9XS2sWLi4tHR6MjgwPLvnK6
+NjwaGR6NDI6PR0YGNYOjg9GhgetREjYwNDgyOj0dHg2NDQ2Nj0ZHRoeD0eBE
+LI6Mjg0MjI8Gxwejg0MjwQ6OZAaODo7yAodHRwdaIwGxocHB4NDhQdBwaB4O
+jA7yIYHg2PSxHS2tLpYtI0tra4tFp7mLHg9Hj0jOxDI0Mjg6MDA6MjwaJwlE
+3VSyVvmzxLIW1kOk4489oTpPd73SiVKVg9LLywlE93uY+Cb26wsnSVN8aTwq
+eNFolQrhQMHTQ6TMOJ40EnsQw8GTkDDqMgYRCfSKMWLFhGLRaVaLSxaWLBaW
+LFiNFixYjEYtFi0sLEYWLEaWLSxYsWLSwsWlpaWlpYsLCxYWFhYLWLJotSaW
+WLBYsFhYLFhYjFpaLSTFhYsFixYsVYsRixVpaWgsWLFhGLFixYsLFixYsWLF
+paLSwLSxGliMFgsWEYsRiwsWFixaWFpYkxYsWLFhYWLCwWLC0sWixVixYWLC
+xGLFWLFi0tI0sLCxGFgsLFixVhaWLFi0jFhYsWFhYsRpaWkYWIxYsWLCxYsL
+CwsWlotFiMWLCxGLCxaWlpYWFhYsRixYtLC0tLFosWLFixYsFhYjS0tLFiMW
+LCxYLC0sRpGLCxaWlpYsVaWlosWLEYsWFiMWlhaLBYLFotLRYsWFhYsLC0sW
+kYWLFiwsWlhaWlpGixYjFpaLSwsLFhYtLFpYsWlhaWLEYtLFWhYtFoWlixYt
+LC0sLS0tLFpYjSxYsLFixaLFiwtLSxGLFpGixYtLFpYYsGFpYWFixYWIxGCw
+sLCxYWIxJixYsLBYLFWBYWLFixGIxYLFiwWKWFiwsRhYsWIxYsFixYsWBYjF
+ixJiwsWFixGLFiwsWLFiwWFiwsWFixJhYWLFixJixGLFiwsWFiwLFixViMWE
+YsRiwsWFixYsFixSxYWLBYsRhYIxYLFhYsVYsFixYsF/FSCfwOj1ODg2DY9k
+YSAG86ODY2v5fy2ja8WkeLwuNLZflhG9rRerFxYWMLDC75788bmpluNT78eS
+3RkcHQeDA4eHwDowMjmtjY/DAz0YSRgfDjIwtDCaPRkZoHo6PMsQgdGRlSAf
+huGRoYHqU7A6MvR0Z0Y4HKBsYBsHw/F++O98kw1mBKEj4ZPA9GB5g/cGLB0z
+4fOJgModGRChsZGjdYGhzoyIYN4t+GDmjCSSMQPoHm+eT7a2vfi4tLJezbV6
+XFi/YLpgc+ShPhysHvgcHw2NDAwOmJhY9GBwaWR0bpjR6OD4fb73UobSUoaH
+DB8OD8XZ8MJ3RyVI+HChofLpdF1YWeLSxcWkdnixfLtaZgPRgHGk6Pw090PD
+BIUMtb9eb4bXi7WzF6Xc+WHi0Xixb7X5YUOjISPh0fh0dShseDHR6PB206Dw
+eDI1AwMDc8J6SnTw+Hw4Mli4uLixdLa4vvF8Xp+rSNNTQ9HwyNDo2Mp9YMJV
+fUNJQ5aUPq7WFhYsXy0tL2xZeM+7+r2cespPgpDg8GhwaHoOj8PhsZHYHoy+
+SxCTg2MDpo7woSA4OAwNT5ZteLF6trS8YsN3ll0uIz3d9gWzKUf740dfMDIz
+A9H4aChoZKWlqYtLa8Xa4vlpaX7F0MWHY2GpwHB4P4ZGw10378eOhz8nBOjg
+wOj14/D+GRkcGBkfDzg2DoEDAyNEhwbHKGRk4MOEGA6ODQ0OjNA0N22d0/fc
+r8XN7wn2ycw6ZpO3nw9vMWQbC3ISaHA6BvwWPw6UnyaFHAkJsemJ8l94Nshz
+BpPg3vyWlpmkRHRuBgwfg737ozqYwhIyr3O15OTxk95perFi1PPFhfT/Lo4P
+BwcEKB0cHw6D4fDQ/w8GR+H8HhsbHwwPweHB8PAeDo+GwscGR0ejI9H4eG50
+4PBpoa2Ph6HlCo0vX04v+X8uc0vltpcXa3WD+GxsbXw0PBoZG5GE/DwaGT8N
+jg0OgyDbIwMDI5T8Pw2D8Oejo8Qj7rsR0cGxhcGxw6IdgfDI9Gh+0ZB6NjIh
+jwfDQ8HR6ND48Jg+WDHnQ0NfDbmj4fDIwEDo9dCEPh2j4e+GEgaG6d4Njghw
+fl1PVwvXZYdmLXpcLTxZ02tMB+GR4mj8PVw+Pa2PAdYeBtiFD4aGCh+HiaPB
+leD0cEPDjIw4WNDYwMuSMDA3wLbU8OAykDk4SOJBQzY0PqGBoaGB8Z34dIfY
+dG0wejIwPRsa0cHRwG4EOjQ2NDaOjg2MB4MEMPJZZKljQyRRter5OB8Gc8Mj
+o8Hw+GBzE0bGF2tLfJi0W18vy2Xixbflh4vV7xdLfq0trFotzxYuLFi9W75P
+qOjqaPAfDo0Oj8PgfdBoYH4ZBrlKwkGjYMyN4NjLo6NDufS+XS9YtGk2Pxfl
+5YvVjFh+XFtbWF5MXi7jelptZ6tLtdLSxaXFxcR4v2lk+up6eGPy6nRtcHWy
+NHR6PLHoNjSX8MLiESkytxb3T31YfL1axHMWLtaXixb4rDnjP01vh8/Ol6vw
+7LpYWL5eVi4uHq5ND9emLxfLT1Zi7XTwmDB0YHAeDgyPQbGDdyST09ks3u8D
+MLszUjk2nM3lfaEePh4nAgepKZoRxKMAwkLhpPgzepYSU8CifiU+qsG/rDpS
+Wy2kJyHGhuk50ITgYMVQ0dwejweDg78OjI6NDYyDxbXi+Xq6WLFxfLi4uFtY
+tLtfLi2XHq2vlxfL5cXF3peLtdrCxgaGRoMEKHR+HF4MfDRVD0dPwCiHh/DA
++TBoeD0bHw+H0Dq7Xu1tZqYu1pYbWMLp/F8tr1xCQfw+H7HEO6PeDHRjCeMc
+WwpPJIyOjQ4PhnCYgDoxwZBmfpkaHp0YGQaOjgyb4fDIOjY0PRv4dHQbHd7s
+byj73B8OjY6NjvRhrifDR8NeB3ZELHw3cJSWMk/DK+ShxZO6IQOnh0OKfDiQ
+Pw+HAfujA/D3CxkYGQ4ND0ZTB8Mkgwp4bGh0aHo8H5MGNth4mA2WMzQ038PB
+sYG06MDvQfMyMj8MNFDQ/DRg9G1850eD8ltpNDIMDYwMjkHh8NjJ2w9ScISf
+ByEgcUkaDR0fDANj9ifDI6NjwZBsfhw4nhsejT0aGBgcokGDB+H4afDg8DBg
+waGh0d4PR4PR1JKgJD6Pi0rgRqUcHw8HBqh8DwpODQ0UEBDRfFi8fLi+XCxa
+p4mYtrGKhgeDzZkYHhh9AYkMB4IDA7o0PouhkejQyNgyDx8MPhwdGxofD0bG
+hgYHAOjwaGhgGRgdmsJMSGE8WdTQh8mjgyMjwb4nRjoyMjwaPA76LGQJTgy+
+HR6Onz0YHa7XrdxdrpYuaWW2WGTa8Xxz5nczU+dwcJabHAb4NjY/DowGnfC9
+XFpfkcWL5a9XxerycWVnpeOjIyEjQ+HB8PhgcBy/o9ssdPY24WHTOSZtNR9W
+V46deBNvPh4cHpchpuk2PU3qQGHTRlCBhLSh+Ph1+HiFJ8MtmtJE0FJRl0av
+Rp2UsO19OLr40tr1ZO12tr5dlk+nS4vlpeLF4tr1fHi9Wl0vFjy32sHR6OjQ
+9GhwYGhsflODQ4NjO1scHg8LtfHunT5cu1+XKxeLC46wyevXy0bXS9XttbWl
++XaYMg8fDZYylGE+77ta2HkgYH7gVpY6NFA+EOtSMsA9GgsY8PUwfhmB8PB8
+MjY4DkDBIyMsD4e7afGcLi8WLa4ulv1Z6vF6XTFliz5dFpbXa1OGeLT0dLS9
+5ZMtmfDoyfHxD0Sx4lDQ2fRTA74ejA4NaPwy+BkfhkfOjCFJ0dGx0QuRoeDp
+tGXhQ4MDwc+H4aGfPgaGRwfD4cH4dCihgJKGgfDowPwwNjQ+cBhXo8Hg2Mj0
+aHo+BiXXqfOjiWNhInEyR0fhnp0ZodHo/D0aGR6kDY48GIubGMGBtJHRsHBo
+dGhobHg4NgxXMyllOfEm2nwyOg+GxoYHRwqh+GQ0kYDlDQwWMj2cB6Pw8TRj
+w4NDYMDI6fDqYNQM9qBwfDQyYe8dwssb6r9dPY+Ol4vF6tNtml8uLD1Y8Phg
+eDLI6/eG2vDB0dGRgeDwZWGoxdrtcWly8nq4X0fuPbw/VlFjbFqUGDA+DwwP
+gvtfDg04wMPw8HB8GfD9RA+GhkcHBgaBogej0cG0wYNhiIIxIkihz6/gkacH
+5Pu6Z8PRkHw9hOjaZ4YDw7dWOjwcGRwfD4cGhzyBwY6PRwZSxwng0M9B0PaR
+Y+PtKcDHpm8jXnx7rNH3wZfAzU6J82UDQb8lGwOcG1NDq9e2GGD8MvdDAhKv
+HVNslMSS6OLzG5nw49ml2Ysm2li6WuO1i9XxdLxe/TpdrxYsLa9WL5cWml48
+WL5aXppdrq+Xc8Xi+WjI8KHo/Do0jo5Q6kjYwHR4NjI0DweEYGpXw7ZLRoa4
+PgHBgZAgaHhI/SNr4hOD5IoJlNBvR2hskYDg0NePDCbBty2njoa6OpkrFter
+XT75eMX303Xxxb00Xa1Hh8MhwYTw2Og/DwNGCR0ZDOhJb0DyQPBkeD8k58D8
+mjk6Ph6PlLixlPJo8Ho10ZHAbGxuwflKSkiB8FLIyaO9mQ8OsYYPwyDR4uLF
+pdPF2vDF+L4vNsm1xafLS+vFl+XF0tLtawsWLpeNvlocHRkMHnRhTBwaD3w4
+FB4Ph16Mrw8Xabcan2aMX5erteLF3fL8qHRwMD4Tw6IZ4bKBsfD8OWDQ1MeF
++X4+WNH3feLb7a0tLFxbdHg8HR9BBYwyHlsbH4eDaSNDg+Hg0ISHhg4Pw9HR
+6PRx2CCIZBzTR82EcAwejY2PB0ejweQMJpfLawufHS7XF8uOltHF8vlzRA2M
+FJQUDXTqSnApMHXg/UY2ltYGjwc4PFv3w/DowNJyhkZUsGBkc8DAccGUsYGB
+8M2sj8PBoeDI8HdHw7I+CBuwo5VW4cG3qFPHEwZGRwcPDA2PRkZGhphIY+L8
+tL5flp2u2jD5tYeF9iy9cM0MdGR3kJBxtx4HjQdGhwYgeDIQMUND1PDg4MD9
+cjQy0EFDQ0BS4shBYw4FNkr8McG3w4HRgegxb7CGOBsnzd5rmfAaW5nu1zpl
+Z7pM3MJ1K+cH4fg+G0+t48CXU+CXqXSXgx0tNTOvwWWNDpxLTnyUJXA2s9vj
+idJv6ffYbmNpyecOhva+W10vC+XlNTaxdrpbWl6sW1gyOBQ6PRgKGhwdGDg9
+HB4Oj8NjIyHB0Y4M0ODwYHo4Oj0dGhsdGhkeDY48J6YHhj5LSRoGy7cGCnwx
+DA0Pw3bo+K4NDgWEjY2Nmjg2AcGDR0ZvoYnw+9K4kpI+HgdGh6OD4fA+Hw8D
+QfDJ7w98MFJgyhQwPh8DYwPRoeHklLGxsLvRwdaGHs802kwHhA9Hw/C+WLF+
+aWHy9W18v1tZbXWl2trc9Xh8vVpixaWl6uy27ZOp1PBI6NjxPDZ454YdGDQa
+Gx8OD4ZBxkeDQO/J8Ro/DQeGBsG8HR4ffdCTfDwcHw+Mkehwej0Ph8Mjzg8H
+g8eDDwdHw8HBrRgdBocCxkHw2Pvh4PRpTejCfDAPhoaOdfMlD8kB4fhOD0dH
+BsbWBofgdXnhcWji/LtdrnEaXy+WLa8034ez8uk0sXi2u1xer5fL8vh8trpe
+nqxfLpaerC/Lwvy9X4vy4Xy0vF8uF+Xy0tr6XLXq2vVm1cXq3PK9XA9W1tbb
+LFi+XJAUM9GUoiR0dHw8EJGh4DI6PRwH6rJLHo/D4dHo6MJ8MjA9NGx6MtBD
+Rg9SxjjYeHw2PBxsZDWDyS+Gxr3RwZTowNDQ8a6NjI4ven4fGp+WL25eT5er
+xYWixcHgyIaMj0fh2R0dGsPD1bHwZgSWHBg6nw9HqdGLZOufHCfj69g+h6FM
+ByyjA5w6nLJvYpOe34+CiF4HA+Hjg01CUm8LKcaSsmU+OKUGBYcbCBLwc+L4
+aPCB4mhZ35OjBYdc+T4oxkaHRxJH4aHTODQMDY6NLa9W14vml4sWl4t6Xi8X
+y2tLBsdBkejqljY/DIwOjQ/Do2Pw0PB6PRCRoeDLY6NEUaleHYG5DR6/Do3Y
+8HbGB4MwPIBjxtDQ22FpJ0fh0aH3BkO8Pj6/vuDwZHgyPR4PBofh8NDQ8GKG
+iQ0eD1KZyerNHqx2tLtYvl6tI6XeTJ8UMBoSPRwwk35NGA8Fp4OHkvy7Oq7W
+l0vl6vVi8WL5Y/F4vl6NDI+HB8Ph8OjR4fDQ58GQSSQwsjQ7AwlD8NCGj4ZH
+ODI6N+kZOGhYlalpY+Gx0aGxipHwwMlsZHS9WlxcaxfNLi3eLLh6uH4fDI6U
+GjGUD8PwNj5cHB1JOFmLP36aZtdL5YtLa2tLDi0vDZwdGxwYHRgdHkj0YGqT
+5O/D7u9oPJYc4nQlIHBobOD4cHBz5shg/F+m5meemFi4uHS8W0frxbWy0sF0
+vlta/bWFi4u258tr13fB98d8kBB4wd8MLxPDwe8GRlJHAro4PJGAkYtbHo2P
+B8SPB3ro4Hh8nxyRtOJQ+teg9Hw+HB4Nj8YMBQ4PBkeMjwdpwH4YGxtDw0Mm
+DI6MjI0PBkdHl+8NL8NDwunUYsvl6u18tF2tHyeLa12seB+Hg1xJHo0FaPBl
+4PwxPpjx5+IHo5xdHU+wepY6OB8MD2QiCODDA+Gk4MSND1KGhoa8DbowOA/D
+L8Pw2PYHBgGR6vh930YnC32PibLgc9hNvOsEmGmpnKWkllIYNh+ThxOnGqSG
+A1H4dG+HRoLDUkfhpm1pdzuent1euGLh8sPFszpdxD0tJdcIMSgNCN+OJRI9
+DIHo2e31hYu1xYulwPF6uLxam3y6WWLtbXq9LF4tTi8nhafLt8vjo9kfhwej
+WWhY2OjA/U/Hy0ODa8Xo0a7NPl6vyxa3OW16uLpeLFk6u1pstLFqXq8Lxb/K
+xYtjAQO92PUHA+HgwN+GxsbEwKH7vRh6MEjwfD7B8MDAyODCWOhLycGBsYoZ
+H5gYQyn4eEsBI9MHg9GBndTicOBS/DY0ODY8GBgfFfLsuqfl8tLFpbYsXWlj
+2ZmfL4yNg0PB4NrqwMGDD4YHoPhxISIwdU47g6XbI6MkyPhtPkskPhgYHg62
+ND8OjXQsefHw3I0MV0fh4WX8ML4ZGTBjcHej4ej84O98Phk5AwEQcHKsYs4d
+DODfwYaUODgw+Hwyvw4wMDQUUOD89w+HBkYLS7XFsvlxaLF2vltHFpdLYyOj
+fujLbD1LHqfDYWODI/DwZ6uq4u14vljS2tHqxcXi0tC4fgkZH4a4byGiWXnh
+4MjiYMD8ODg9HqciTo/D8M0HB0a6MBQ+HRxIB8M7aQnw0NfD8MD0fDI6ND1X
+0xYbHq7XS4vy4ulpd9LZpYcBwcHw0DQ50eBMEJ8Pw8Gl8M9GAIGHRtsadO+9
+gfEMtBI2NjI0DA2OBg0PwzRo0NjUjCkyMQOjISDY4P0kKanBoODI/DeDwcGh
+0YH54cehTQ/PhllOD6gsaHC/F0vjSMcXjSw0vy7W1i/LtSnUiLHBkbGvhhJH
+yQMfeT5xqIk50s98ZpExvee5GPYgrpzg/MfBoYkPWgp+DKbTU+MHOExxNbew
+cDFwoeMkvLaSg5CakMrS68Ol4BYbfOJwZTqWPShLHBodH4cHoyMAyOjcxdr5
+d8PVi9vlxcYu1sul2vShOj1+GQfhkcHj0bGx4DQ0Opq4u3y+W1i4erj1b2vT
+Tp+XnFoyAQMb5ISRoasZGDyUPBoa+HBm2mgbPQYmPg5L9Dg2Do/D8ODgyYNv
+ww/Dr0YHcBkfgsaHo0QUUNDIUMjQ8HB8mjo4P1GmaEpZ4b+dLa2ui/L1dlvS
+1iwxZtaXh+GR+HwyMDI2PhkbGx6dZeDY+HLb83qFexmAkbWh4PB8MSOjg0n3
+RkkdSE8PAa+GRkejg0OjypoeJacGAsY0uYCxwbCl0dGYr58rJ5OGpwcX0/Li
+9+Xn1taWh6fDY1RwfSHBwPh8NDA4OcGLGDmJg0UGpgxN5DQ9GXBgJDzKY4M2
+HiRkcGrGx0QobGx4OGD4Z6P4uFtfLpcX5dFxeL5cXy6Wl9SNk+TlPpGEgt8M
+jiljCWaO35NGRsaobT4MAMHaK8OaMMj0ZsY9X46WL5cWLTC+vltcXi6WL8cG
+DOQmDz5rnTp8ep9KeQsYGix6h0YDC08DtAcaGGBqB4PRkdGBxbXRer5aYvF8
+sXw/LrR2ulpfFixcb+Olnn6fL8tLiw8X5bXFodLDxer4vG5tcWrvpdrb5Zsu
+YFQB9Y2+u0wdTRtsaXRwb4PBnRwcHgP3OPDxHgwYTr5NPamDlD0eDowPcHo/
+DIwMQMGRwZGTg/GDiQMdH4aHmdTwYMyYPAfOPB6PbbYGBsdBsYHRsevhiifE
+u90PpNND6K6xXLPcA2YjT5+c5JISE28H4Dt8C/k+LMgxoZhhz4cTpg6PDocH
+Fu3Mvlpen2er24t5jHdqd3yYvnw0nELTj0Pk3vxEB1hMTqdy4CY4JA6PQmLL
+GxgbGBkdGRnRrg7o8HR0dCx7Y8GRkeDI6Mj1pPhovV6uVtcW14XLWDZi6Wyx
+cHBsOjzrCdD4eWPRnVPDFDo4Oj4dHRkej6h0ZHBwbGl6ODg2MA2+H4ZGh9MD
+8kDqUOD0JGR6Pl6trFpfL7ovl6Xi8L9i0O1pUMtB4bEODhmjAYMEDg5l2MR5
+IHkD4dHpI4ODg9HvYGR9cjwejI2FDY8SmOj6OhCcH4dxMODgMjTIhVFPhwbZ
+GEOhYPR4Mc46zw4usnq6Xy29LxbWi6WLFheL5cGBoHUoaGhsbHo+ngwO4GjB
+yxkbDWIbGMGR4MDo9Huh0xw7iUtzhhqdOC6XS8vF88WHy0u1+X5aaWcWMLMR
+jtYZb2ssWDZTQMoQODA9HjH0hCZ134PBowNDg0Og4fDI/DadHgzNDo+GkwfO
+l20dLS+04jz49X5er5erxe+OGx+0CB0YHSmgYN+TD3mQocpk6YNDgyN8HnRk
+fhpShoakbChieDND0fDgwOrYMDgcHskJVgNQPZDPQeG2CEPh8JY+GBsdH7Xy
+eGZ+z1aG1jpdrXi30XRfLFtYvV1kYaJGR+8+cDoxo+xx4Pw8HR6POtg2Pxwb
+dDozPP4JCU74fDZwcHg9fvA/EDzaMB/DJwfDQ8B14w9Da4vlyuPF8vFteF+M
+WMLelperS0vl8vVtYuLffv8+3P0aWH9P5fy2tG1j+XF8tLqfLRYteL1cXfwy
+M9GhlCh4MyD0fnVPw2DPR8uLi4sXGFj1Z0srutrhH/i7kinChIbGPYXA
 ====
 EOF
 if [ $? -ne 0 ]; then echo "Failed output cat no_removeDC"; fail; fi
@@ -521,257 +456,199 @@ if [ $? -ne 0 ]; then echo "Failed diff no_removeDC"; fail; fi
 #
 cat > test.removeDC.ok.bz2.b64 << 'EOF'
 begin-base64 644 test.removeDC.ok.bz2
-QlpoOTFBWSZTWVU04qoAIrPZAGAQQAN/4AIAYEVLoAAAAAAAE6ffFtsltSjV
-bSHnveSUiQqAALy+u2QOmXdttLm+d9Pvta+3LdE21d21dtcvfe23eWnru+q7
-t72723FztU+h3Ey1tJ6m7am2O3effU+993azXVeujpt1x5afex7zSfTUirsl
-tnLbeTd7tznMbrmr1qu9J3L0pvLMt7bHcaXL23T2ne+9bevValkvjaO5N3bP
-ajetkFbW9bd3XXbrdu07o3wSQAkkqekGp5MRSUgBiZJilTQBIQTVNUgBEkyC
-SiARIQJJKD+/wx8JrFAv3w/9/o/9GQ8f4uabIKjn29qKtsB3kZu3jTWOZ3WN
-Nx7tevC83Ae4I3oiDBtNttg2NoYxsbY0x5266vQUMSZeOYfPzkl7cDBrtwju
-Up47ujtLszYVkRIvK6SjhmM5c9l1nOa0VrpMQezHoCx6NrHYemgjEFHgzLCl
-yvWvVcG8dkaO13lqPrsu5a7hye6rLSsmcObwNYuYdwLerIxk4bIohiKBRGHD
-mLTnfyttdc2X7IWfnHnrjNolSlRKwvcPcLu18xXOYrMODe29cy3lvHbbWFuH
-O0YIy87QeBdwE9rOg1UvFg25gVPHXmunpiEyZdYg1XQkd6mR2DXlNSWHdDwE
-tZpjyeVzhOiHdAoZQnHcfG6rNpOzXh1nc5Ua4wsDjc0ZNEmIiziCBklLmzMu
-yc97AYmTY9ctyqY9mIkiPqISR2dIa3zKLXXtOcCXuNvu9Hu6VOCOLjMUMNu1
-BDrrPHTwu7zMN7ZzPPBley0SwE9iOp5HFFuFbuKDs50UI8FQoXu9yB08l6dp
-nGZMOGIOrjNKRdWukHt3clfN5j6buK6RD3drNCE5Hejlw04dI7TK5mnZsB0b
-RNB4By4Tpgwxzu7Tr3butwZsO1dOzBNguSEsv3N3dRYJW9k9C5dRduZbWOGd
-jpemIUVm46onoSk5SbqcPB3F1Ok4NwB8RF0tqzu3DWj0pLxJxdklpG2EliFh
-jNvVmYuhxPreM4dqQ5XtGbIDe3oNvIXQxNmMPMzu2ptbSRL7GYFpeZuwhPIO
-dep5CvVDAFBxZZxJpZcw3yGHpM5U2ZU9SNMgRDjdMYTwY88YdN7eE69pw5SA
-8UO6Dxb7idYWh7zzAQVcoN0N3YYkb2pk8ngHFDeOkyvCsKIr7LSFrxWjIMPK
-7ihPmk3ReQJ44j2Vbm97TJocZiml9s7qdquXc4V5jPOeXTgVd1HLSJV7sMtU
-D53OWn1lpwHocNWZXg1a1KNM5B7d3tUHZh9hBmDjxp1ZA1i5jcV6C6J1K6Ez
-J1LB23JQqNsG0GLm5Rw6EiDolM7v5bPvgOxv77Hbbc+2MlaQd1jppJGciORi
-lzk3s4tcRJLvfMxCzr9VSQR8N+Pe0DZV2LBlNvOTBDsxmWPtcnYNlcXVTaAt
-G9nt7tBGZyQrupZHhsI01Pi7yJ324ZlzMHBZuoLTXOOHXJ2bc4MoaYTiGsx0
-K4qMJ7OKiDR7gs4ZH7EUXMm4jtLqeE228IzUz0TIeCat7ia6RxR7M7MGJqcQ
-Zk5FNDLKj1jgJnQYxlScoMeC05URDvFoTqFlb1CMbzFDBOIuynrmaMLHHzDh
-GTee0UHs2g7XMaVQOvchyjDmwMgLdJW97hcmy312nvIp9N48LG9LKyUQOAl9
-LOuskIctKc5VE4dGbQRQX7Fhr5HtWMPpuPOsNQ1MjW9g1NyJJzMO7hyIsJdQ
-197K4qXs1KiHLw3wtFguFy9TwXNtNc3xG67nI8FNYzxl43ukN9gOEQPwwSMI
-SQSUTgOnd8DLQF2rteFgq8VPWLNR7N1vWwvG26RVkG0sFBaJlNtpch4NmIu9
-GzQVCzybgadY8HiWN96MeyLSb4mGEgGhodg2GTBskcNRDY0akN2lJUG+EcdE
-o5ITIzaXYwYNjSZwejsbLkKGJex0DRyOhxM4hqTFg7DCDweDm4kJJrjJ13Do
-2JyRMwecSDAs3zGXWNpiwT0Q4FlC3UTGM9zCkZsdplGohxkIMGrgQLNjwdjg
-6sJ3E10IsGDaXY4RmzjIOh6PbgYax+xpyhZOY3YtFaHwRtEYtBWi7FYqKCAN
-qlY9FBciMWYjTggrSY6hEnBwdjB4PLkcS86nIsTg9HB2NA7GDY3QSh4nbTXQ
-kg4BrHBdyGwYnEZ4UCNKhWh6LgjHlDY6Hu5JMGh5kDo8G9pgai9HhqQ3ZIXc
-kmxwe4kHDCTjwmJro4OcTtBZid5SUXIlwobHq8keGwoc2lDZ0LqMuWQmOSb0
-yGJEi7pNpdwwkpyGDoNzg6HbJIQaIUODY6HomgODErg2PB2PU7TuShMM5A4P
-B4PRsbTkxk5pIySk7Y0NDocTkcb3AsbGrJJ1NdGh2HZISLrgdlDQ0MGDtTsG
-wsswOdhDSaGRHwtRt2jWKxeFwtRsTb8LRegXuosiXQTWmSywkTLzO7nGQ0Ew
-bGJzQx+FwuF4UFSPaKCYmiUYEphBcGKZpNxO7dwoejsdAG5cJDil2PB4PSSG
-DE1WMmCbNBwg6Ox4ODATDXgsLT4TNa4Wi4VI1UHg54LB0OxwDcZIzB4XGukh
-Ei6TVjkTo8GDAkweDYwLmxwbTZJJFwUImNteQxbSI2D42zlpeDHuhqGHnA2h
-eU5WLgYrFqNghlai/Dbnhs4tGGe9nl5vhdYtGKDd8Pr4PC534HRkleIvcGNW
-GcXOsWejPOhb5yX3egIIYkE5vwUz3EXcusIanm06yJpF8xS8EdQXYBlDrTvH
-xuA8MGi6sBzNPsyMIS/LK8mk3fglam6agmf4Eg/hIcH/wKO1oGDQKNA/rWxQ
-YMGCHoPoDoYMFBg4MQaABgwGDBgwAaGhoAYMGAhBgwVgwQgwAYOUNA2MGhgM
-BgwHINQQuADBg0NDBChgJBgwQgwBgwZAGDBgwGCMGhg0DVCKUDBoYNCEGAhB
-gwYDBSDBYMFaGDQwQg/vWNgwQg2NA0MGiDAg0AwYMBkAYIQYDBiNDBoBgwYM
-AYDAcghYwbGAwQgwG4DQwBg2NDQMgwYKwGhoQoGA1BgwaHKBoQgwBgMGxlRI
-gQYMGAwBgrQ0NDBgMGhoQoGhoaBgwGDBgMGDBCDBqDBoGhgwYDFgDEaHkGwb
-BgwYMHUGgYDBgwbGhWh/QQobGhoYIQaGgaB/QaGxoaB5QNDAYMGDAYNjBoGh
-gNDQ0jQIQYMBoGhoCDBIMGhoaEPQGhgwbGhoGDQ0DQMGDQMBoaGhg0IQaGhg
-NDQwYNDQNDQwaBoVoYMGqGgYDBgwGDAYDB3QhkENDBgwYMBgwYDBgwGDAYM3
-QNDBgwGLAYDBgPIDQxAYO6GhCIwQgwYDBihBgMGDBgMGDAYDAYIQYIkGCEBg
-MGAwYMGDBgwYDBgMGCEGDAYDAYMBgIcg0MGDAdwEKGKEGAwYIQYMGDBgwYIQ
-YoQYMGAwYMGAwYMGLBgwYOQVoYCsGAMGDwgiUMBgwGDBgwVgwBgMEIMEIMBg
-MBCDBCDAYMAYMABCD8ICgn/Dz9+GncOz850bHgKNwd39Njf7I4YNW6hVVJDC
-aB8baHLI0KDdk6ljvNS/jI92GgrP1W3X0nV676vqUXEVSC0Fq0VBDYYJ8fZo
-vfFJEHZZMBX8ydGPcbL5BqjhXh3CJ4bwmOYKDq3EGUUKBSKGEgUnqsjo6u2T
-X9Umkue6MShgetMPDodjYmu7G+PU+G7MS1odSdb6NDuHBpZXhnFqx+W7YaJ5
-FTk+FC6/O0Mc5Z0nsiSyhWuVrq1ykocDYxFPHD4ejB8N7sD3qCxgISCJ7ppI
-WMIPc9Y+y8DnNhqDI7MMGFKdaia0ZuFXXwtEwoc1u6D2ueusmKxuknFA+y/n
-cow4kgYvgukDitQjBW8b4WhXLeFwvP2HmuSacGZ3ordIwrhYZLmjMDeFOUVS
-ehXgs6jCRUKIsWcFCYvAgQjFeEkgCy/TaZi5pcM3HDknkPonFAuThAu0XhcF
-MWQoWV9Y99dBbL+dVYsYmi9GuFcaMFTwUjBUKOzLZDi8lBgoF/3MCCav2PMQ
-XBJBt+KZc7HpXW9C12VacKIfBcvmQeDvC4QkkPw1ekiQfDYdHnLPsicGUdH2
-7Dw7SpoGkg8r6x+YMfA4mYQNKHE/yAvd3urqKI8c7fG687jSdSk8OkuJ+EJF
-hE3Rv4rZg1BMTFu7hp+hmiz7sD1xhgnothrYyxYLFbHVkOjwqQ5OkLi0yZa/
-hVwmje8wNp8MEcjGQgNpJO8+s6Tpe0XWNg2DY2Ju7NzfjPvxtetPlalCeCsV
-Il2jhO8iY3wnHbH8d6hm8Kl5ENmaocK7437SedhSWfVdE1nCojaHoqE9+mie
-314GaLCtiaPSxNQV+FYuh9TPcrmOIt33jxkHBCOHFdioIFdC7oernb3or4Yl
-j8M9WD06klDRBm+xsZBkGQH6DnjQlUFEsGt3YxgyCbFLeqheh9QmpBNEs5ES
-eM+nxe0eet/nc3eSv5OLl1iwO9u8fl84Lv3RprtSBbe6rx3Z6XISd+zkZ2B/
-agi/smeplUN0PRxekIsfWaYKCrbmWpySNkW7b1o7a8Fq4VU2xh3x0cYdE3vb
-hwOBOjXXR0nXelYtLDLNZjCu2w4nWqzOu26qZcNMS4M+Kj/hbHi3KUYjROLb
-4loHY6cl4LE7oNVtPhoef0djg9TEg88Pkr4bGzB2NB8NB8ljpoYmxxGgd0Ui
-rswNAvNWItECslhgoXGo9Xq6WYZJ74QH/QVWQEJEGQQkBkBFJFQRZFFJBFBk
-AVBt0M/31DQ0tJQP3bfw3/UMTNxNgnT01KSEGltC2UqYvC3fsoheH82h9N1z
-bP4eHg7G0KGPJExscKe0SxpKFAqK2vClFCcXRgMaDkiqVhvvC0wVqyy0UjRN
-QoeuXutrWEX6CRPYuNjQ+HHXBzBvvIHj4H6mEh7p8OsB+f6EBtMYmwVZJAbe
-NWKKMsF1Qa8NDKKGFzv1uDG0k42M9le41YUswXI5n4ybXjCuqjOLto+QxeRY
-omoGd1B8L6qUUISaKqa+91KfkRshS+RovhGe3VuHgjNFwsmvLLGwZSHwsMWh
-hSyBofhouc7lfd5ft5OOWdS5dDg60NjGw6mGx5fhiQa4dGWMsaHlDEwHQ/D9
-7i08GAUWOAQYMgQTYv2s7sr4sor1g1Y1Co/xrRhPk5ocGx+DY7o+HQ20O90N
-lJQNxRkuCqmCYqGLvyjjYPLL6yPRNsYNDBh1PixvYXCawKIBhqBjYwiprpPG
-56faEGsMzl2LZQeFNMKxNhBOYMok93VBCx1l7oofD6D1TnIPdZlmD2oNVB+q
-4OsGei+9ujucr4t4bLFyNsLBjRcKBeF4UCvesWi5QEAnaKFerdKlESEJEksY
-PB7z5MHz+2D2MzDq8skZsFeCkJ5HkOLkY50rQ+F8gb5DG7MExWLJ8du00UKH
-lstLadZt4OFjjgmt5Ye6PRyzdDY0MJ91ENLoCpnhMlqh8GJ2Ry16uso9XLIO
-x6Wmx6Nnixms15MJGPHCFlo/Dm0ofpCJDhIGjSRk3dvDecHg2PZKH4qBA777
-wFrSSRHYxIMsvLFTBnIPN0Ab6MLGdj0aDQ8HOg792vs75xYuupLtq6+eL2y1
-a7aafXS4IiH7NE3Yban9vxzGmOGAz7RVQVV89zqKyONgGkdzriS369KWuxAW
-EU9HWzwpDfWHzeXluwq946XoQ9WhjKh3h4T2EicwOSGTtviOGIWAsycNPaqI
-CE+rsdKcvgvjS2LwrLRWPpTKGgixRJYcMs2dseQmDE4eOc2NpB0m04ODB2MC
-x44nEuwjQy8T2Jg9Hank2OYPB6MGw6b8h58lwSD0I3odcBgeTfRg6HhUTw4L
-0NpY2NvLL6DDJkOhidOJ4UBChui619MMGO7fgRf6KKknh5n79yk8MuTWH4eD
-f8MHTDRE2Nq4Njllg9/UOuSzVPgqqNBfgbr8BywU9S8HeMQLXF3b9QzR4KnY
-020PKSx8m04fDfOrU2MXB8OrifaHBg5Q73wdJ8knw0O/DvYyrHd+vWPme9jv
-nm6XfjK6WvkrEwuTQFprkVhuRfCwU9kzBWLxTTcIvaTfCk8Jhrgri54ChOGX
-ZnlorNRotNtYcKgV4JmA3TaJ84KG++o+Vh4sV4j4HVomy0R6yrx5e8HJDIdW
-dsz6F0lChwxYlA8HZY7+Hbr72DmXVjCxKGXhCqsYHpuYWDwrJobNyJG5dj8h
-B6PPeovcuypqmsm7s1VlnFs7VO1B4To1V4Ez7qSD0GERIfYbRRvb9hHzr0FL
-M+BTonwNkRj0TyVRhEW+jhYS6IuLvbvRNYoF69sWlLI7jZeubtyMiIWCxb7R
-mB9trw0PJtJOe10cPonl5vbQ4MG9jAyYN+0Tgx+GUN7HY8HuQiQ+rBQ56TFH
-tnu0i4xMz3WwYPrmJkMeFilHB6M6uw8Oq8fDmtpBJCrGbL6XnkbS2ZmEq23j
-IRDPAv2ef6xeUuGztWiz4bYm2X6tXmF+F4QbLM3Xogn7EwwWCwUhlr13rZwb
-M2z4/HppW7vfPk9WsHAocDrCoOPh76DChrfs+BvOc+SPhnSguw2PBtK2bdmf
-JsZygZs3a+g1B0fWU5Jg5nw2GQE+5ofD72u1B5M7ebMMkh0UJhPYrDylsF4X
-enB+MH2+/Kdk6MDY4OqB5RDRHiVLl1DKiGB4z0z01zZ7xyvFjC4VJDuWhlmh
-r4H4IMN3hRoi/EIWM9zA2NwqwwTFXO+0XCuL5ak7JyDHEQYLhOHNNZ3lri54
-qcM3zzNmNU1nTrPg1U5/m7Fd4xZv0xa5jX4NDtHXauxYYNWgIwR0OeL67KXS
-TQWbEUO5mQpinqGasLiN07s7tJ0kJe+M7a2YyeceOGiDVmmkPLJ7wd1IPDxi
-4ezS2JRtq1GmHLKqtlzjFc3DXkm0GCoThdHDjRiyRTQ6kVJB2G0ic4+DND1I
-xMPN9OBiWPr6MDQ9To4RIwZxoecdjlhrg2bHqexOodzArArQO0tNDB2kCwNp
-Q+ChpOHBoApihcDtvA9lOg7L87L5LKO96R/x/pLTkj+nj76PxFyx9eDg5cjC
-xg40M2QjZJ/hu9ahDlG7x4UEfCeEqFddwmI1xrgUfheFB13ItkXQCiyEQJyb
-NeIYrDwc500o9G8K0dL4l6LD4eJskaGZvJoHQwYPCyx3EkkhEkHCxtwcGl1L
-iH26CyhClgOxuhv6b2YyMKnKK2NNBwZFXrZ0ec842u1HqVX2kbQYhqPK8KAx
-iJ8PBqGx+Gwd5Y6HpcCyn4ZQSDc8yUC1EtGCgTOK2NIRwqDx1BwpFK8lQSKc
-Fewx4nI7md1nZWm7T7I+jB8NO4mJsMbKGx1BhoYHw/ODQ+Hg4PvppOPNDwcr
-Fzxg6LlppdbyxP72TRbX2SiGcLBd4Fu/vVse9D6vnI7sOTchozVrtKHYW0k+
-zi3s4M77D4cF+33zFNE3JfyMe/WVYcJgSjwrBbXLkMLFCdYFIsVCzLF4ME59
-vbn19Pin1QYrtzGioFRqISlGOawcLzulEYUPwxLLDB+L2lBLGPEniWMvjgMs
-T+gn+O2wWV0SwWvhaJ1bz6/qsuyfC3rf2omRx9dFowWodi1nTY3OX4UFzv91
-asH+hChtwFB96rWcYbAoV+F7bcMIEwYKoJR5Ei0TC6eFUiDKzOO3bMZnd+rF
-MIaLcWFLyDWhcKI8KBlfDmnqUX9dneDC9jWQwfhtIpJ8LUWJpT58vlIooU/O
-Y11tGC2jO+zZOQepi1THYREY3PJAm18VCssstKkjwszSc5/CdqFnJMJkMiXN
-IgVVlTZ0IcVXRFUjBZMkCeIf2MDtsqcPEFzc4b1m4PE2NB8m0gQYnw7Su4mc
-oPh9WfRowThFGg0urdXooMTlfhYKsFS5LsboM3RSRmDQ0NDV6zmJoZBvh9CO
-zuQK/B8j8Jo1UpF7+x6ub6xO/fEkbhO1/30Ygzu/WMdS1mYPuZXWZ+qCfqOb
-6mXfZN70z3VhrvLXKFI0gqEG93UrjavjZK7KZ1kUEm7Ya5bx3c83A+Kzamap
-AOgSE48jdl2k+fVoasYhL2zSEUz0aWmo0yYCdOziuNdzDuYtQXlAaK1QsmWM
-pEqAOFCe0aBqMVIkUG6aSvBsepSWNGNB4aHY+ODQ9saqD4cS02LiHoHWJaWF
-FpB0mr2rZwmLr2kTwmLEQTQ0NGLhm7W94wecmQjMzP38MNX8KRP+f3zIoEz/
-kvwxI4POczAdjv4mGUGCEy6G1sGfhw/oYweC8TIHB8x4LxChMH9nnta/mvJ6
-OtDvGqO57IYmhpvtYBB+HxsYGieRUKBODjFCsTCdHZcdbCkXvXgq094HCFIm
-HE1kmESJnQw3Gs9RF92fso5MuhyviHjZd4LBMKpThWjyLEULRWcFk14VVU9r
-OjpmfBXhcK7uzF3M6mQnEko+CBChy6GfDB7980Hrg7g7y8Z0XIyeiGDBRHkc
-LwucXjzVsVq87wxbzsszH5z7rS1EOJQ92MkS0rN2k4V4Tli8UQwW294TU2F5
-knmDgoGIssGA9YqQGwJxoYDakTWsOTejYRcNMtZNkwYHCxWaKw9nSKm5lMBA
-YKyCs9IKBdF/AnmXIYhi+TFS+0e6TgQLBeoZEU4rLFrJQLnk9YcC3oIEwpBi
-3cxMM4mGkFE7uc/q33i6HKGYlOsG3kaLkYHCwVkliqKxdBbfDdMNGmDy9jsa
-5ljID7O8Jwb34bR22UaLzmAwygUeynJAWi84ufrPIwJRwXcNB63ChMX1Xrek
-o0xby7pvhPCoaxYLCIsXhfhKCuzOC89WjL0g6H4bg7yyHXI3rRos8NQcNj43
-deqyOCqYK8CtmZJ4b70+HvRKcayiIDGDY6EDiaShsc8Pd7Njg+wxbBsbukgV
-IcW45EisT3To02IgJLExwmPG5y0cTA68LRYvY5houFFwJhYZNdvm73uOGtyc
-2tHoWgyCBcLBacEzmrm8Pt40MfhoM5nx8OOtbGujQ6g4RJIwfEHZTG73rYOa
-SroYHR+Hfcyfeh4o2CfEG1uZklCYZzRdooEXOngTIk6OxtokCEGxsdB3d6HY
-17nk6TYrFwr7qFyOIdxOLu9YJifCsT2KBYwmCKqLPdz3k+ij3NGOTU709Hdu
-U+Z1v1hu3Gsyjjql5mN/BBpgvvvgouwd8xELej3lt73AMxKj5xhY2IjQztHC
-RKtdMORzk9htSD8OMXNuQVBtGHN0ENHIs2SuyBk5JfFQLDdMGgp2zizCsuJ7
-sODtDNNkUnKwHSOFiNSoYUBYrHnBnEwc4m0iYOm00GweOHOBSWPNpyeShjgU
-ePPlOD4aHB8PUwejV0PAsaHyeU8PCw0Ox4nB8swXWKZMoHi5c2wpGE7g/78n
-FX3YLkU613Q/fw8uhpgzlkolHdJYXLT8NBuDAb8dMNyikwdD/QbKm4VCNjeT
-ZArEwpO8ezPW027wbZ4o8yxLdVOEioqzwLNbRQLBZLI6xSLixaLDdFYULvRU
-ULwoL6z1CsW/fObqpG+I1BSNgmV6S0ezKPV5vHEbm4Yp2zVbigVCkUhis4XU
-2ODi0G1Ds+yp4XhVzuTY8ZMGFkwbH7w33ex2D9kfhj4cHBMETOeImxt9wOcZ
-JPhUGI6w8Yn0XBRY4ODXqHbBjefc+HY78HUhrt8HmkkziVlfdGJY7we0cH1V
-yonRvXstIa3ibrUM1OGC9t7bPsXVaPu74Y6lazrq8w7eHE4rFiORG7fbMVZn
-LldIzwu4TB3HRnCfAV3MwifOZ5/MihM8i2bZIFBPHwWVRDd5fZlj8kfDDo0P
-3hV3Gu1b488taptY3P6sxYwnEcKBMYLkr8MHQ2VAorim798GLnB5hQ36pW7e
-S08Ofry7hwapslm7weZNtGw2lGCZQKy/ZR4UiowF43O9ZG7zLJoZTOhR452I
-JvITxqLFgYiTkN4XhhMGkySMk2bSDpJetYPhg+7mhwYMzm0xMBzVD1da9EsY
-PPtDhY9Hw4b83e8MOM5A3pmW3doljgrmE4SKJCGRRQ/DQ/d1tMBtfZ6DQ+HC
-5j0aGjYxO+o4NDg9bhJAseljQ4WMD7B8LeFovCyjRdmWJhP6WZzk90P8TdeL
-uByvtPQfCgVIsUFAxQtRYrC2D4V/hVqL0xwNLhXxgNMoFMILwpaoTIwgKY0O
-mMIJhdDR0F1i0UWv1RGmnjxl40qGyGtjhheBhPhS8C2TnowmjoxweGzbvgwc
-U1VLLNkH4coWi0TwtcUwn65ZM8J10A4o6/SeEgwuee+tq3Pcqvenp1uZujO1
-5Ol3WMzWZ7ClzyOTD7Nv3o5Wd2rVDY7BhkRuQWEQy79k2606Axxgx+HoXTAb
-Wj3pQsuwdhvjrkdd2BnvQiG3zySF2To6h8W91K77rVvOChiKuCasdiZ006n0
-GNKwxTjfxb5eOJ3mGlepWAZPHEFHFBQCAcXtJmJfDSdTB9pKHZYm3o6HkA4N
-p41TfDicHgwdm4MLHo7HZSHFqM2mQwSKBPuVjGiObraBti1JP7+/0Dw/qGJ+
-5QHwwPzR4GYRIQhqyk9MYeq0/QW4KewMRmC8L43fPYjUa0pFhk/jaHTQ0YJ+
-1vJ6d5Tj1Gmf0z7R3q9SD0TSVljoZ9yzcSxvUG+SEhg1UQoQzaUMSDL5UUsf
-rGx5YRicsWAwhhhuJNFxrBYufXp297PGDoef6PSXRNsNP11yPIcUhqKlFIeA
-9ZG6RP5GiF1jKE8tEbtKcyx6KEHf6MLFUdovIysFCFMIfkMbDyHJeApcFQt3
-az9Xmd70xse5SPUoUMMZvwUPcO6kGrThC8zDDNDPwzJMPhuDm8LIfa+6Np2+
-Dzw5ROMHO6pgWlB4YdG6wqqpcG1uRfqoyPCQI4nUvJbHRc5kRhuvXrfOmllu
-KBrKFBOEC0RgLPCZhTFkCdwkpG+5Rgny+hOL0HAbGDpM70odrBjIXz1dNh0H
-hVFDihFBli4UuJr8J/HW5u+VJzU8EFJRSQepuJ0bGD2XHPDrm5UDoWFHA9oB
-3NXyi7QVqMBXqRMAKtX52QgxIRQmaU0D4vY+DMHcBrg+MO0DPMm67zr1xhCg
-aWRvjnFwuoV+EwOMtND6ujXZYzKH4YNWWP3RywMiyKy6FYnsTWx0XKVizvM9
-2erPTLTfiiyq1LIYFHycvjzAMGFLfIu+3nw6SMjrIUP2YGsGsGxsbTmG5xL0
-Nl6srxPhWQmihZ4UtmSGCjF+u4ObSzNDEv44Vzt58zC9532QsIOWHBrExNnb
-SSchmqtaGB4ZyzsibvHAtJ9ff2CwVsNw4VBwqXFIYM41liZ4T0XF4fdzc45H
-tZncz1qe+AwWiwGjCIvV4VioXWQTwuhmEwzeqxUqFViqJMIQkm0jp2NX3Y1v
-aXjwYPR4OBiXQ4ND9jQ/DB+JnRgPR0nYPAK08oBhup6dAV49lFtuU9DkxFZZ
-Us9z6auXT0rdePakeoBJvt7qGF+9i7wReCoi9joMuXxzuJYe1mTxh1PzSQw/
-YtHmeKhcUPHaHTV71tY5c7dWM0nK5ccqIZdMgQw8lhquQfheHR3jTYWrxocA
-jUWjZmvMYydWSjU4QjS0aI6EYKkYKEQlCODMFoGiiA0WFkKwYwTcKg3g4lMw
-bC7Sk6lLieG0vaGw8vk6XIug5rcttKZ/v9/D8Of0Th/YnwUmx36hjUNaLXB/
-Un6x7TdjIO/7Z9sJuJsfhvC0py0hXtVSZU2P2YO6SYSnHHkh0qF1Mi2rY3N5
-g27wMtYNuTLSSQnFNo0XhbyMJqIE4XMR4FgqFki+HY8L8lhbqRMKhJHozY5v
-ZzKWvcGj4Y01GJXyRJLH311IMGxl3q+99XMUZJhD3nitiQ8J0YihYLBSchsV
-HwN834ta3elg0N8Hfsr7vw3xPJJiEaoUUF22cXh3hXsFDWLheYtMEwu7j0Sa
-M45sBRtEceNu9U0DIhDwiBlkPd4MeDCjpfvRxMkT4d1YxiYKpJCvxBV8O6o8
-L6HJeoXlHILvvCxGgnLs/EWs4W4WPwtR56jAxHT0qi86ppZA9VF3NuyiC/Bf
-C7Wja5/hRj6okGgaIO+d96/HEh2DITg2mDNSwXkXuI31YKBMLs4T4wUKYVos
-UCgjJFtDFXQpoU+8c2saNRMM88rHRKICUQLwULggUbGiaSaFPC8LMFwO287i
-3kOFSoUSH7LVtLhZhSnNzbhwoFIcLBZfjhaFN6e9qw0tZL9DtruU3lC6RVJw
-uFSLTWWHCMDZyDwonkYjMGwZom3Z4lHSomEdViLcleaMNhvLhBoafJNVg0sM
-sxJIXPFxNdkGVeDHUO+A8l4Pw5yqTYbpxHZqC+IHHe9O1p7bDhfkovkVwtXI
-sTytM98D4Z7PAzkhKisCoIsoB3gK2KbwPNjdSvUUPuuuAeHg/WHMXXJJMqpC
-B9l4XrRmMuH2itZwnkBWxUE37teO3Oun5uZ3hPmNUWLRYKQ8pc5hG4kb4WMT
-VXdEo8Jla3yI8da1wsjG34TjOEye7avGq9DhP98/qCJ+E0BGHjIPewOj5OjL
-oc8bsQvHvGoyovhzQr9FPs3x3aNUS6umIIJglQwnFZKN1I2aG06NnCh8lyB8
-kmUT2DLWE0cssNDBkJBuYkk0NjVpJCxsa2zAZM8lDqq4YT4c6MYM5orftDgw
-NtAIJDm4DkZHh9MrpPso9vgt+d72VN9fxn0vXEX3x0HFJuvgjMSB3gbn3xEN
-gfncNJHeq5PpudztPUPE9Csessa43O2Y3PcciWjup0cPr5ffFQIRpX6dwRBE
-K5i9grdEo8YxBTDt+VzkhW7aZ6hpduW3FFyD06jWHInqWMb1FC53tJzsFw2g
-WPVMHalPdDIUPU6M6NDtM0LDDZE4uIFSS4UyEC1EcLTA4LHgwiWO2h6NpnA8
-b3YxPb0mJg+XIgV4i5FqYHMGvYODWuFpi6/v0h9p9/AeP0jlVf4HUu+DeU4A
-P5ODP3sDWWyd3GTZVE4LjoZOw993YLeFGO8O6LS0iVNDlwPVy9mDLr+NjNzI
-eGy/X6ikofGBoc2+R5EFiLFvPFCyFYuVzvr2mkJ0a+Hg0mk1sa4XLzBNjF32
-xhS/bC7JGe4WndjWcGJWtjbsJf1Mm6IgaufzsbcAw1Wx44gx1sCpjiEcfDcG
-yDWav4YPzks1eigxPFFcGe5djYwQrY9ztj8OwekHXh8UvchJ2VYn91Zw/bfE
-V68lbLTa2eTWxkokOhBJfhRuDiwendlI8IWFi8iseQkFJ4dWn0O7HgwfhzA0
-MbWzPqq/c9jjN/EDKgcikfCoXIsgxMP0r4FWWLILjqcWidG7QrF8LtZQmTlL
-sXgh4MowX5GFDZTHX7J3CyYdEVYswCCoDwsRRYzExCzoKKsg306/nLFOGSKP
-D97maMi3d4Mg5WRK+hCGqLGVmfYPhMLyUo3AUioV1grgUCoQdHFCvwrFwp1t
-3FYLUbAxWZLdygj2+0wzdObLFg5x4THmVHruUnqqlWKRXJVLBeqI8BscG/uG
-zSWNBvXLCx6mXzi5MgNg7hFWkL/CfUrarRcJmM/feNVHtwW1+s8sPI1I3A2A
-cJo5i2ZIrFijl0x+TuhytDh1LfGcHLTgwNWNYM+HS2vhskqQPD9ZZNDnr4YN
-wfqTR4zMqRoPQUV6JPdActBlItsDkULZGivRorQxKNBlj8N3mdPjY9bcgYDF
-lovzTei6dvhmC22QUFuZ4KZiT4wMvCcHUAnkTitG72zuUcPSrxOC2NhvCP03
-4a+GQfD3OB0erY6NiGHfDg0cGG5YyUbGMBriRljRVeFgwGAwLGDbeDwSPxg5
-bKj7GPry99VLuusqyzuOnemiLtmecJONumbJiVzZjZwyLRiGdhYiPqeieoi7
-mSC+vTWBnKrbhofC9LhXBujKzNh1Fsxkjuad3D7RUyQSM44xDuzdPLVXY51z
-QdTa40827AzlrE92NTkqk9E5fZU8StjDLIfoXJroYeHfeNg+FgxKdpgbGB1N
-D4Do+XZodBSbGwweD4Ot7GDBteJtwaQpIOBrDYWm/Drw+4PB3FNjwUpDjoor
-RQYi+JtOdLN2rj78xJ+BeGhZPiobYXcG38Ph9kScGUkkoYfSkejQ9tJVQgyD
-DDQ/hvgz0P4JgqnK828T6ji/LDd27IJ0k1Fi4SwtHE3vhYJ79VCaxM0zApFF
-xQpBSchxTkPAsccTFW/CkUIYF1h7yHnPOEsOEs4Lu53GvN9Kpm9cYw7HCwMx
-FAnFYPaJ4UC1ZRahemFVia3cGE3vXotccOY14yxyTGbDDDo0MG3ZOLY1wxg0
-UUNRJI4wMT3ECYK2tFAqFpPB9x1HlvB8OIZ4dDBhtLH5sc8PwNQYmxm7H4d7
-oeDg593Y2an0PkhIEHHDY76WnkwJDw19Z8mzj4YamhbECbQTP07p2liwRYmV
-PdPiJDQxyFQBwU5uhiaoUIDr7ufrZRd0/yql3hx6how6jkPBiIE4mFXKSKax
-c+Rm3PhsfDQwq2xMKG0vUkCqwZ0b3RfqGMNFFouOcDBYLRS7NF5/MGHa4N9K
-Pdqx8kGbscPhiZLoHQ5nic80+2DnMNsGPCZYLg0TiwViqjh3F5m3r0fgeDAf
-sHnY5rU04NhB9VCsUsSDaOZAWKxUEYKBRkF2K5wavvULhWJgtl3OwFovFUKh
-b5/TrN56W+xExge8DicVkIls3wLGE4mF4uDR6HR5E4Mvi74ljuxozNbHdPpC
-Q6lSMUnJQXxov1EFBaiCcP2GYJl7MGNJJi3u9jsqBKGARLkM8NJobTE9E/kx
-phQnf2s/HTrtxX3xihRwTGDT3wxPFkIEnxqtDnmySx5d2O6bqMyxYMJl04YQ
-pYoViYUeq3JEx6sqxWVYMoTYpE8D4UojsThnkVYyltpNjqgsZuAXwaxZCGqX
-BhAVSYa8cr94bxD1XmJ7h7OuoRkAthdgPIAOxp5ma+HskSBVDPfV6xnwzXRq
-x17WYO3NjnBg62mGDuDA85CaG7uxDiQYmUMSA/Ze60kHY7G7LFxI0wsUJ8ja
-wMBMvfLJqy5+dL6Fvc4UfWxKEp+TQfDXhx+TB9Bu/oODMHnYlA9YN62NjuDm
-bnONjoQ6O2hy4aHKMGqoaYP1ScGwZB+69GxC8oYwYZmfYCvhg9HRmOYMeSe7
-sVm5eylD6zJWtw2du4NxZ7r0yXlYmRFruZvf+LuSKcKEgqmnFVA=
+QlpoOTFBWSZTWdg2WckAItPZAEAQQAN/4AIAYDnZ0dA1aAAAPQJRVIT7bTEI
+DQUpIACxKSpCUifeuHUqqSXsakONo6UaoVUoPecDlEAqiJd25FWxqVVAqWIN
+FFNjK9Gq9PdlJFUoKbZbu0cpFUFUUqqZAZISJSqp3O4kj2bTCRtYu2eCSBNp
+SpkBpoyaSVMgNT0xGqqYamEKQTVTKaAigTRJKT1BEiaTFJKNR5D3weqzB+/f
+5B+ON78zm5uhAn4gomOj2bpi5IzkQyDRqHEjpXMupeoHE+PiSk1OQFUVRSEH
+Z+1h9z132ucN9YMOUtQ0jkNDZ3k4+t45kZ3C9PIPD0xdKzRk5IJFwvq/QkzQ
+Jncwexl0dc1K+Lsy9uHfSwLJeXO8deLjs19ECYpE53M90Nss3qNnYZvDn1QS
+znTXJtrXa2lX2ONliVgghzXNd6nHkocQfeKt1SHotCxXhj1cVfdhk3CWGfaq
+Lq69fVbNtPHS5TXcqO3RFkzm+CBNWHJcMpU0jOCzTVtbWEa9AdtPAQYOwrcp
+h6c/E3LkOrU8GkzKxnVh4gIZuooapo7UXhNcoeMyb2sYsjp8p4l4p+TZsjp2
+rvIpfgy+wq0G7nu5Iq1b2cksqBO1LlUcchOBOjbnTtt88Lh2p3mGUhc+puzN
+Pupd57Pfb1stvFhxQYE8veREljlqCYMsMA2KunOorBuE+XlRsdByig9B42mq
+L3Uij3jtUcKHXDcWyDhuqKqN1d7BsNUOJ7HlfDsI08jTut/X0e9RdH3ijmgl
+4O90r0cTNdg3yK4HLDVVFHn1Jq2PKDye0do51IcaPPHp6e4nw8DmtDzIo3Vc
+NNwcwjWD4dahNUVr6K1oqdh0ejrWTs1FG5xNBoo2P1loit5To1FmrMzSH1d9
+BnqLyZUFkV89jg6Tel0nw7H3ZvPo25Wtp5eTcHY9fXdaT55AbTlJmoMH302k
+37KHC76Do8C5B21ruPw8Mq2GXxydjup0Dug39TxNYO0zSHC1jGktj5+jyXh3
+V2x5Lnh58En3fuUXT6Lyd+9Ra+TB0Oh0xdH5N8WC5xrab0GrfqcT6H4fuxUO
+w6bPMug0eOzt5Hw/NXfQbdFPSj6ZLuk+46p3HfoOcT57Gaiucm5sodW35tU7
+HNJw3E8byaJNca07gNBl7tOad2cqueY+dR9qqxyIyqlNJzHcc41lRdHxuoyC
+Hm4rB8tN3sHj0/DwdLpKTBpZIdGygvOExgadBlJOERHCoecTNVXPqKNlb+C+
+8nR0HLe6jjpzTUG6HxEe4TPXo67Tnojo62TMXSCHhyj4fDG6oe8HiYPw4Pep
+4fh2Ph+D1xfQQw77UfDDobkV8PB4diyHHIh2PwduDoc0T8Oh6cbB2O+0Wh0O
+h00Q8HB+HWQnRgbHBwHBnoyPR0bGRwdHoyPBkHo2OA2NjQ2Dg2UQUMg0Ohh5
+NbH4djDocHo+Hg/bisGHgyDvIIihwdEmKGRwHR4NA6PR4Mg2NDY6PGSOOsg0
+PAeSMjYwl6Mjo2MaQRA5wZGBobHg4ODsfO40Pw8GGHw4D99RLofbiL4ej0YG
+3rg4Oj0YB4DY2NDYwD7Q9Ho6B2Phh6FaHg9HQ/DD8ODQ9BweLo6ODIOjA0MD
+A6Njo4NAwPAdGR6MA0NLY6DQ0Mj8cq8MPh8Pw8H4Hw9GH7CjY9HQ+HW6r4dD
+4fD8PR+BvpOU4PR+Ho7GHgw/Dg6Ho7HYwww6Hmk8Oh6Pw9HoVAw/DodGp8Ds
+fhh0bHR0ejo9BseDY4PRoaDCxsGB0YHRsbGhkZGRyoIOjowOCGO3Bg0MGDgh
+Q2OcSxwHg8HQMPw+Hww8Hgw6Bh8Owfb5ruvDwdHRgdHB6OjgyNDwYGBgZHY4
+PBgOA2XHg8HY4A7BsdjtTbGRgbXEk5EEDQ2NjIMDQ6PBgdGx0aGeQHBsbHo8
+HAeDg9GOkUMPB4D4fhhh0PB2MPR2OkPoDowPww6GH2RHB+GGHo+Hw6How6Hg
+y8Tw69B8ODfetHNpobBtcmK4sDbUR2crDR6vE04cih7weDNTw51hDSpKsY6N
+TEtIWyMj3YDLiGCA5LMYcDjx1DWTocJC2x1wxNjtbya65zOn+FH5Rkf8Cjgy
+DAyCjgODgoMMMqEMMKDDgwMEDgAMMDDDDADg4OADDDD+kK4MMKwwhDADD/HB
+wHYw4MDAwwImDDi4MIYMIQwwhDAMMKwwwwMAw4MOAwImocBh0MOCEMCEMMMD
+DuBwYQhhXQw4MG4DQ/UNAwQg6GgaGA0MGgGGGBoBhCGBhgcGGwBwYYYBgdYK
+6GHQwMIQwDDAMODg4IQwrC4OCGAw0Dgw4MDCEMAwMODDgxAwwwwMAwrg4ODD
+Aw4OCFA0NDQMHKBoYMBgwYIQcwdyw6BwYYYGGB3A4DoHAcBhhhgYGBhhhwcF
+faAcGxoaWCEGhoGhCDQ0MKBoGGBhhhgYcGHAcHuA6HQ4DgIQww9IdA2hhhgY
+YcHBoVgwYNDQ0DBoaBoGDBoHtA2NjQwaEINDKGgaGhg/mhsdA4ODDgOKuDDD
+DAwMMMDDAwMMO4HsIaGGGGGBhhgYYd4Dg5gOCEMMMDDAwMMAwwAwwwhAwhDD
+AwwhDAwwwwMMMDAwMIQwiQwhAwMMDDDDDDDDA8wcBhhCGGBgYGGBgQ9Dgwww
+AwwhDAwwhDDDDDDDCEMOoHBhhgYYYYGGGGGGGGFf2HBhXkK4MAwwAw8wHBgY
+YYYVhgGBhCGEIYGBgQhhCGBhgGGABCH8EBQT/h+HWJCQ+GbHw7BR3B8O+p4+
+GuDg2HAcIHZCKChRiAB7Z0xJobHNdHIGwdKu+X39CdDRuR+F+10bCWDFoaB5
+zlj0Gk9owmWMDI8Ho+HbY0KD5tChDQwdAo+1wrA2HPJW0jso6ODsYNDsbHB8
+987H4ej2x+Ghsb8HhqQK0dGagbGWBmh+ODj4dD4djrW7JZPQKKY+DGxxKDo+
+Gh0MFH7o9GD0YDgwHkEA+HgyDkDvRkejgQZ7zowWGDNro4OjwYHZH6eZ7zwI
+MH4IXMWlgaMHY4VsO9CEHnfDR6DzfRniX8HhgZ5hCQWVenhgMTg/D3boaW2B
+4MrDbTg+HY3pjg2Ile+JYIXAe4Zx8XD3Q2bDQ4MGh6Nj98PB8PscSbGKro0M
+jsDCamjQ/Dm5A6NjWjox8MGDdjU/7d570WlBwPJzwyH4jg8HRs6P2LwYTzEP
+4aNHBgfDOAasz8Mjo6YOjY8CMBsYHKkdIGBY0A6GDX5BN0dJzieTNeSJQ1ob
+HB0DwewGiDAg7/BQNjB3vRGhzGgNGx0cwsYbHw6PM5Az+GB+PG06TRYWHw34
+Gh8MFekgRT4Zy6FfMGMR7+B2WcIdHnPDDkTY7H910cHo4O/DVD+AwcDQMH1G
+jKXwfDsdgcGWx78ODg2PK+G64Mhgxo8GhjgaPRsee33wfSFD8nxY5wYOhsaH
+T0fHBhudSeG72PRs0MGDgwayhiQV8tnw0lg0aKGgghdBIgcihFfKRQvvSTXd
+8/imRF+mfY96S7Dmc0EMRKiZ2De6N4etZo8DtEcChNG5kHo7yGjxO1OHGbZg
+QicLLEUO6+PEHBjiYldLSB4nUwPBm6NjtJTXlkeyGUvUm9cHqHkvg+Tj3bHp
+g2Gp/h8FJTg4PBwekh0cGWnVYGRtPh+H/hsbHo2MD4dH4ZGxweDB8OxwaGOx
+0MHB8PB2Pw6OjjY4aNdHpL16HJ+BD/oiEEFkEBJBkEQkFUVbH8P+fWND+Gho
+HoP8P8O9DIMDAgwtaGNDgUujX9td5v7MsKNTqdbHB4OD/QND0d4MSh2O9jF8
+OxoaHDQy7HQ+ODiWNPw0OjujdZ3sSPgwaGXgyPR0YNjseg+Ho8Tp0cBuDwYI
+aHB+gbHg4IWMD1gYYHB0eDQ2FjEocHoT6uXzYaObOD4fDBsbGgjQ/QIODT4j
+A0O7Egw34cHoPktODwcvRwCDIDBoMGBgdB4Ph+mq5dedJXkjI0PRkYZHSxvo
+xUMJQ9GD8MHdDE0DY8Ha+HYwaSx0MGDBg+g37OZ5J23gbH4Y7Ck6pwPhsdGR
+8POD8ODAMaBwdbBiBobQfDoHQPl8NoZIHQw/DD5PhlA6QxoY2ep2YnSx4N/D
+A8PBnjcDBpOjQ6KHqGEYJocGDgEHoWMO/QzBpDuuvvWXjbQ/QcHmDwejI/D8
+NDljA/aPhsRNGFD0lJAgNjB+HY0Po/e5Jb0coaNqdHieHo4OjCSWPh8Dwe+H
+g4NFDA4nwxOpy9Gxu0tNG7GwdGxoYB6HE5YyDINl9HTS+be+HQ80PR4Pgyx2
+mk6ODd2D4djAejoaGxxMGxpeHBsfD0NCaHwZClKGDBjoiI0MTkDMoDg0bGIa
+Hw4PRMV9bcRMHdEU/di2R47zMc27pafM2lJEZZxmo9te8ToeDzhr132hgUUE
+0LwajQoA8ajBYGq7gGjRaDF3WzrwSO+T0vUxMD3qSk1PErJvQ4MDnBhobQoe
+jQ8GDQ2PR0MHgwdD1wdGhtkcGhkdGwejg5g6OjA2PR6dEPDowMjLwGB6Ojwc
+HujA2D3g0NDHVgePujKzjJg42xf6CH+BArSilKoUKF+j7qccCfn8PRunB4P8
+Og6PAaGhkZEP6hro2M/wxifwy9wYTD4ep06amGDcZo/Bhh6Pw7Hw3kodjDof
+Dnw7Gx2RkejB8MBYwODY86WP11HnA5Q/JaSmJ0eDAzo6NjHR4PuQNpY+HcHR
+0cHgwNx4YGhvdGB+Tw6Pw7DXBsHg2NDgwemzw0PR8PfPhrDRt47zaoPDidGx
+sdHiUNeGcoYkHFIMvg+dDQ00DnqHQbHdFjjWDQ0PtGH2SQnLvaJO5xOD4xIG
+BryObs6Pw2vEgi5gjRkLKIDwPRkbG82CvqMS2YIiLrUt8NlbwcHBkeXQ5HLn
+geOFDaUkjQ4HACk6MHg55fUPhwcHQwcHQyWPzsY9GRuuMjg6Pw2hQz51PT07
+0KODDxMorPGiJB3B8Ok4PB+HyHw9Gu+GcHAZseHfA0VQYmRCYOg6QMWMb38F
+hg+djGJg4YODqA7zkSxClNDQ8G3W5hHiUfdsIGBgYPkODBkage8HowOeBrR7
+YwpS2MFjZ8kHw4IdDVI0QbGx2dND0aoYwQzwbHo3E8dvsveMMfPhg7Gx8nPh
+8Oxg/A4ODY9EgMPeHKGJAMHrPqHQUPh86fDseAxNDFpafA9YMa4NDB8ODoch
+oaGk0PV1ecspIBAKgqGCixWinh0VezxZfDvkyjM2ph/a7rOL7ay6knnsbPsO
+t3gd5Ss93HMjd7E9utJ4rEYtIFQQjIFxhwMBkmPScGwkgJDT0EpowHR16hS2
+PAnlp4CSpDWUlsOMPBkZSx8OD5hPDMDweDA+Dw2OjBA+SxobHRkdHgPQgdGF
+5gyPBsfDg9WR8Ng6PRsYHgwNqcGR8kjI8GBDUgVnisBGubea8Yee/f0GDo2J
+g/DY2FDY/DQ+8P7Zsj/DDV7GBY3I/fDwrQ8HLDQ76ljP4fDhB8MB90ZHmetO
+8aSqMGhkC9HR0aGR3EwGxgwYjoYDg/Djg4NK7g6djkBpsaBsYD0dD8NJoZB3
+7hT6SrE9pIPR8W0DsfhwaTw+HQNDB+HV+HgzYOjNhwcGR5Z9R0eD4dTA8Mj0
+iujQ2Mbo9d0hCh+GlseDRY+nzY8HIGhkfDYwPB0bGB8OeHgzYyMUFj0bHllj
+6xjnx1+ubLCmRoscBv7MwbevyfD8OD0bSR4vBjwyM+ixjSEgPTYxr16MIVTo
+2DWRowNDGDeYOD4ZGrchwe9CiT33u1n2mBie0ej8ODzSKH4bYHw/DB6Pw6HY
++Ghoa+Qsd8YkGgZAZXonBoecwnZw3bqgolMeED8EA4OxwYR5zW9sC5obGWY7
+GDoaB7brB4PR6HhgsfdHRodGBp6Mj8QMMDm/da3z999y5TU6MwNmhwgZG2j5
+frM06NjA+Ho4fODXnp0ZxgwefDY7oGH0CDgwfOxjobPDCuDoe999WXvD2ikt
+NEHo3oSDcHw83xfhvw4MGDnkNR0NN8bGykMHo8oZ3dZ87slFlB34cCwh5o/D
+QyPh8MDAwPR8M2Pc71Phv1SPBrAkYpJHicGQbwdjY40EhqmxibmDY0NDQ00C
+BSFSGHxvvkmN8G9lgnVCxeTd34WL+7n4iyj3ZuQYu6IFnhvubmxMsNF3jY4N
+51Om2ggwOGPyc6MNLFOAYeC0xtKXvQxIUx8eHlJb4pPMEvDg4UNAdHmWNsjy
+VPDQ2OD0eljoYFj0cHY0NjUHg4PR2MGhg8Gx4OC6V2kKHg2Njg7TqwcHBsaG
+DBg8T4hquY4OzZZZgY/v4f4f6x/dGwffyyXPsCbGg4NNkBYPw7JeDoQ1ux0O
+gb/DNsSOD/D4aHwyNx7KzeTvxGkDkoQOJTISlDQy0gnB2LhfB2SeS+Fc+ExW
+KQuB6xQMGx7bF6PS54eZ5ODQ6GhuDehidniT5KEgPA9wdjBp2NjobB2Ph28H
+nx0ZvhrgwjE9XRnwz7SeqLY2MPWGGRsskfh7ujndSx8lRCfWZ7QX8FQ6Ox8O
+x9Q+SjXu79fLOkcz4wg7Z0LR+Ho3g+GISxjR+Ho0OdHomDA1B8UODfxYWODd
+h8O107lodDYbGk02bNjtNjoi1BoNjt8MGhwZfA8kwbHsDfEwLSVoeD4GhuDQ
+x0OgepBlD4dFD4bHAd73kx52i+6fWl48HR6OPBwdHg9zr8YGQ8NsnBxg9HYY
+PON2IVoejB4OhvyyO2NJQDTwZHo+H4cGIPDB69ov32F/B5JHyeGRLGWR0cHQ
+ZGibGehowRY/IwewtI6OYWlhgNDVrwqAkfulcPTyci0687ToyMj9wej0cGRo
+fDYWljQx2yxsHgMDYyMjY5Y8Gx4PRro4MD0fDo6Pw9GDY96E90ONgfDbQwYD
+oeD1OjZo+GemjAdGRrwwHQseXRI0ITQ0D4djgOx1jQx4PR3M8Q8UGyBQd2Fx
+zg8Hy8L8DQcgbHY6aGMGwKHwcscH4bLLGx6Ne+lwej4aGkK/kxYKVwqBaJ93
+oHclb5R9zdVW3TK+71zZc1ORzIuHvuvmnVwnSNWqZmpzZwJOCQ5cNTBPjDkz
+RaKSRaaeGKreFjwJWQCEoJH0pibu+DQ6nUhOp2g8OBwbfD44BgwHhsSQfDwe
+DI8GhwcLHg2MDo8SxoeA6OuujQ4Ph0YCh0dB6PRkfD4dGx0fQNDAyPgejg04
+Ph0dHw2ODaasYWNodDA3vf4/iRwcHg0UMfw/wP8MDI2H8OLRR4/D/Dg6D3Ao
+dHg4D4/m0higeDA85uz97X6rlhYSweDoYwND0HL8NDY18Ph1sbDB+GnY6Ghu
+PRwa0PCDY3b2QfDgyODPA2A0YnBp+HRoaHo7wdHnw+8Phrw/DIYMfDjvCXTg
+1IcGhwcGQckejI6M2PV04c5DwMTo6MvRsaHo+TFm2LwbHDlD4IMNzXR0Mj8P
+Q0YKHZwdQ+Hg0PXYNjQNWxiJG4KbCa4MjODZF0XXXCW4HBsTFosREnCtYJnC
+hiYnUCYaKvCkHvTatjSEHw/D0fDa9GJ8Oxg4M58EDtHx6gzDAhj4LTqRIMB2
+PBwfD4dDDBsfA9GDoewej1OjwJsaSamCDrY2FjYW4M4MJQ4aOqe4DJ3lvfRl
+4h5owb4kByrOjY4ODp8PQeD1LkTE2NDWD0YN5QyMD4cGRCxoZGBgZkeD0d5j
+7OGjobDI6Ohkg8PBk2OkLB8vB+3w0DSmr4ejKeHo4PFocHw2OjY2OewaGx4O
+dHw1Q8Hw8GB7Y5fPpwOnj/JQ6MD0eD0b0fh4PBgiISeGdGYNjz8Pw0liGxtK
+GLdAweJQSMyTY0M0Njo+2PP5+SEsM/Xxs2MH3h8LwNjZRofD+HY4O2QaRiBg
+vdHw9SR0dHODnRwPQdHQd/iR++HvlAhINQ3RuFKs+vi5wsZgs8LG5zrpuR9w
+LwkvcGhkIeupgGhIWkpGHXGUselOMHU8acS1yExKw6DXAmWUMxEo45HcjheS
+YMfLZDxabDYYc2NppsoQ4Gx6M7Y2MQ2MDY6OjyxoYGgeDiBgytD0bGB0G2h0
+dHjIyPR6NjQ9HNUjkPT7/H4aGD0ewejB7dnQYnkgzVGx4khEDSUPJMwfw1g6
+OAaNA0P78Mjg2NzwyjZheBT8Hw7wfkgeA4MHS7g9Hg/DQ2DB16gb2UMGDqg4
+DY3Y2PfDw2PwwGg4Phsfe6a8dLkMT4L+HR4NjwfrHBoelpaR4ZpIGhkDBhsc
+T0WyNDMw2PhsczB8ODo3wG5kdHO5PJj71wfHgoONaMHF+HB797CaHG9jJDo2
+/DcGDY4ODo2b5MGvfYBi2Mvh+GeQfcngww2NDUtSoPB5o+Ho74N+eVZgcIOG
+PRlNkfgfC/DsDyUkejvB+4GDv1HQbBrBkdGuDg3IkjFLQM87MBsMGx+HY8GD
+myHXvPeK34haYFASEjA8UsaGBOjo8GR6PdDw2h4cHOgejvBmBqaMGSULAbmw
+aGoHo9SVDVnj4eT4YTqTLY8GR0fDtDY2Pw9keQPR+kY2A6MjeccBgeDgzVjx
+mDhI8GtLvSQ2RsZ+H4SDW350Qdj2no0MGxg0EG/DDBlDDZAcMGGxjR8ONjU3
+0aXMBg9EJshyxwaPTeRfU6nB8PBkZGBvzEJ6KBQLhT3C7LFwspEioVQ8OGKx
+4NhWxix3YxODg8K73d0bHGiJogwZHo0MDoxw8Mjg5PRqdgYTo2UPBkaXPDQc
+HmjsSNjQwPBsbXgwcHAa8NDt1qhoHB3g5BoCedkVI5eIETHxRhMUV9u2Xu8r
+vudZ1hOc2h6tu8GQO/duLQtZGGhz8rZYsbQvxzMDqQEB1I5bI9TjocdygPJr
+4NYFYdyNFgtmvBE8FyHGrvI4U6CZ4GQ6nToahrxK3qUFj0ZHLHR0cseDi0ND
+Q+sfDwejYyOjFJg88MDhY2MuDYyMDwebY8Ho8HV6+H4aHq7HqYlBr9/mfw79
+Ik3Ik+sfh/DscwaGlgy4NDD8NA05PhhY4Mn8ljQ8G+DweGEJQyN7FUJg9Hez
+K+ut0YH8ESwodjof4fDg+MSSc8DRsYOh8Ox3w6NjQWOBQw4OxvYvg3WDFkYP
+w3dyND4cGhzo+sbX22xzoU0QW9Hw9HBjg8G/Dr98Du1QyykjQ2PB6ODg/LsJ
+o/YNDKXg5BiV9ofhuD5NjC9ePc14g+Sx+aSQpLDAPDI/JT16PR4MbUjwkDw6
+GmDwdXY0V1pkdjdnfhjU6M5hI1XBusHgO8D0ErBKZY8HF6ODlHfV6OMmhknE
+sfEMjQ6OjgwHgej0ZBm7LLGA0MGAIOjA+HB3w/DnBwdGBpdGh5XBwejoyMX0
+PDY+ytnhw8ljI8GRwe2PH4aGhgvR0Mvo9Gh4Pk7Cz4bKGgkAlKzYwHCpOUFD
+0fDaZ4dH7w6MHvqPGknhwdjgbdPydA8kJDw8Hg0Oh0Jj1IaZhsbQseErQ2M9
+G5wYGQjBwejRoxY2PR6ND8OkPy4MWOwMQMnL+3lwmvAgcGQsfYMAS/D0epUi
+S3OjQWcDBoM4NfBhsI5H4d4YdHR2AiHro0PrtCvh8MD7hzh4MSIuxsNGhzo1
+AhwrkHMfGETbA9Hg9Hw/JQOUHw+G7Shm++gbHgwdLdnRr7w9Gw6MHh5u7gxY
+yPwxwYVN7KHg7HwbGGFDOUNQZBzBiWWHgofDwb+NjfvpjPp+NDFZGR4DI+H4
+cGDsOjDowaGD4coYMVxYWNaNWMDY0PMBhPDI/Dg7oyM0MjMj0fDFjA8qOxG0
+bHqzn08+2b4DaaFuynX0QeMDq3KhyuyTxNwQeh7O1ZR6nlIZXl1xq0Lz07Cs
+KxDRqfNdQpGaAtsuQ6mYmDYQOAakJBj5g4HUhODDF6MeeNsNuJ4fDg4PBsQ4
+PACx4pY0OujowODo8Hg+Ho2IdHwyPR8PeD4cTg2MDo0PBwbGB8nh6nRocGR4
+MDfE3Ukn36h10iPwzA4OjY6cGZZD8ivB+HcwkcGcHRru4GD0bTSbkfhkYHBt
+0RgYNj+H58M3nvG/aDoXE5TTDH4fh2ODwI2OcHhoYJsZ0YmD04MHiQEg4MDA
+2hpDUhpQ6nw08GAKwfh37CPYV9t0EJsiHB6IfcGB4MTg9CjBopKGxghobHw2
+DpOtDHw2GD4qBNBg+5rJXbtNnB8G0gQNYTe0oGh6h90aGyQJgNjt8M8Ng0eH
+31Q2MHAdDbQxq11zvOGyvujpZQmpI9Hg9Gh6NskDAHgZGLH4ZG0yxsbG/DhQ
+xUDI/FhejYYPBwqyQOvwx+GhoYOh8Ph43kua2WwaGBg7HK9DynSywvAc1oaT
+2z1Jsag2MHg7HgNjpedGDg6EPZA/DFDoyaMFDED8Oxs78Qh4cGgJ2R0aoA0I
+ofhoo8OjgPw0OkofDQakH4dA71JGmRqkjwa6kLHg/PIg3u8xkPr4OAyPROjA
+PPhofDhodGx8cGCzwydGhgcGx0sPDocsDQwnRwbHBqA8Hb7N9KwPg8ngxk1+
+Sh6PAscHUoerHvEklDAl0lD4dZibC9DOFkGD42Ojgw4PDg8CgdHVkeofDDt+
+HAZGB3oznx8QNnBoNh52Gxg2O9xfD0Gx89Hg5T4ejoh3w0Ojo0OD0YB0aSxj
+ZgZGxsbSR3fd3YHaPt5xi+ZpSuTBIbe4fjhTEOAkc7H3jwwIe8K9pqJVjWoY
+6AhDDwWKQ4N8g8tFkmGMGJg9IkUZqLPC4ODhNBAacjQRCgp4TS84mxNpsgde
+OfEhF4ODwHyMDA4NjpgwPRofB4fDY2PB4NDY6PhwaGBkHg9GAeDA4PBkc8Ne
+HR6IWPBpYH3Rng+GnQ4dPgqd/vfgeDQpwaNpaTw3Zwej8OjRbUaKhY0RH4bG
+hkGEGir6mDXwxo3I/h6MG1c8S+h5PkpPpTiYODo6rg/B4+GLGGRwd7Y2Nbg2
+DScGgcYMe+Gx2MBsejQ9GA1l+q88d9mwrrzY4PAfhwadj0aHg6H5NDpYPfGt
+jB+C4WlQkSPTw18PRh0mwvl0PC9gQ2gzUkmjWDo9GxofTv3mGZNMcGB6BQyM
+D0aH1Jo+GiBg2R6OjI+GIHBkeDo9GDB8Pw+HB2OjVp4evXgxod7TunY9PgYM
+GB2PV6PBhhh8GokljEoecvfqic4lDg5g0PhoKGD5LDuDNpSafDQ2NDLegwdj
+Y4ODwDB8FjYycGhobHvjB4D8NBg5wdGBoaSxi1sd7FzNnvk+fh0bHB0ZH4fh
+tPPBxcHw6PwODANjnh+LHBmViBj6Fvw+kOpKWOjo2MHm7oNDPghobwcGA4QH
+wwYO+lBwDycGhoaHNiGDBgaHw4BoYD4eEB4cHR7Nk6Ojfw2T4aGQqY0YXgNj
+YyPyWEjE1PRg4NjyuDGDIyBAx4bHbGyBkZ+GFoYc932pgaHQcM0O/k2Pwx4Y
+/KKZDQ3BoHY19YMdyD5OjehwYPMofDB18P8dDEMGM9GDC0NpNjaHW9jg7qkp
+gwBTWjRgwQkQuAzAw542trQ37zFmcpkHAVrRjpjvh1gYYHIHydiE4NDA+ZHE
++HB7o8eA6Npg0A9HTgzA4vw7HQ6TRoYdDgmKgYrBbleasKE0SgaGj4UAmLB8
+PE6MD5oHKofhhsd0YkHkhI/gwOk2OCHhh8OxwepDQ+GGhiHqZ0bQ0IbGHcCv
+Rh/B/PisFS8Hzz3u357nyWefIPNW05MBypBYuG964bnVP+LuSKcKEhsGyzkg
 ====
 EOF
 if [ $? -ne 0 ]; then echo "Failed output cat removeDC"; fail; fi
@@ -0,0 +1,529 @@
+#!/bin/sh
+#
+
+prog="AutomaticGainControl_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+
+# Sanity checks
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+if [ ! -f $bin/$prog ] ; then echo "Didnt find "$prog; exit 2; fi
+if [ ! -f `which uudecode` ] ; then echo "Didnt find uudecode"; exit 2; fi
+if [ ! -f `which bunzip2` ] ; then echo "Didnt find bunzip2"; exit 2; fi
+
+fail()
+{
+        echo FAILED $0 $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+pass()
+{
+        echo PASSED $0 $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir -p $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input looks like this
+#
+# Constructed in octave with:
+#  n=rand(N,1)-0.5;
+#  n=0.5*n/std(n);
+#
+cat > test.wav.bz2.b64 << 'EOF'
+begin-base64 644 test.wav.bz2
+QlpoOTFBWSZTWfnTV4EBG6b////+Q5BMFkgDZyBZjCVCFJDDAQBgBgRADGgCTgYBME//0AU+AAAA
+AAA5o0aGmEA0wJpoAyGhiANGI0MEZADmjRoaYQDTAmmgDIaGIA0YjQwRkAOaNGhphANMCaaAMhoY
+gDRiNDBGQA5o0aGmEA0wJpoAyGhiANGI0MEZAApVCVPFNqekb1J6g/QpkyB6gaD1M0g09Q0eKbI1
+NoaeVOvreLLmNJSRgUkY42GcKRrhSMcMApGGxiFI19jHhCkcIUSVrYBSO9mBSMgpGHfw2ApGAUjI
+KRiFIwCkY4BSNIKRgFI84KRiFI0hSPMCkeV5AUj/AUjiCkcQUj9ApGIUjgBSOMKR3ApGAUjAKR8A
+KR+YKRzApHiBSNIUj3ApH4hSN0KR/AUjjCkfeFI5gpGQUjnCkZgpGQUjMFI3wpG+FI+7e2wpGyFI
+7wKRvBSPQFI4ApGsFI0hSO2FI4/nCkc4Uji4AUjgCkYBSPSFI2QpGkKRuBSMggroBSOkKR7IUjl6
+gpGcKR/u1ycv6hSN0KRpCke8FI8PCCkcmj9wpGuFI7IKRo5/Y9QKRza4UjdCkdzeBSPN+2xnCkaQ
+pHaCkYhSNQRKqzQiVVkCkf2FI3wpHYBSO6FI3gpHICkbQKR2gpGQUjUCkeMKRtBSMwUjeCkePbCk
+aApH/BSPqCkdAKR7QQVyhSM4UjQFIyCkZwpGcIK2+brBSOkKR5ApHZCkfWFI1gpGoKRshSOwFIxC
+kaQpHrCkagpHpCkdQUj1BSPWFIyCkZgpGYKRkFI7oUjdCkaQUjqBSOQKRshSOkKRuBSNQKR1ApG4
+FI1BSMApGAUjzgpGgFI6AUj3QpHyBSNQKRqBSNAKR8QUjrhSPtCkYgpGAQV6AVRV1gpHhCkeUFI7
+YUj/xdyRThQkPnTV4EA=
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+uudecode -o test.wav.bz2 test.wav.bz2.b64
+if [ $? -ne 0 ]; then echo "Failed input uudecode"; fail; fi
+bunzip2 -f test.wav.bz2
+if [ $? -ne 0 ]; then echo "Failed input bunzip2"; fail; fi
+
+
+#
+# the output looks like this
+#
+cat > test.ok.wav.bz2.b64 << 'EOF'
+begin-base64 644 test.ok.wav.bz2
+QlpoOTFBWSZTWbSEh4AASqb/////////////////////////////////////
+////////4DF33M7TTbQjTbZC6wXWEqzs1xWzvat73bjt73vu6dvb693udVSQ
+vsKz7OnSqobY9unsPdYO7KrdqKA1rdnLRt3BumN2cnbHbtXXNvrq7waZrarV
+tkO2dvXNdavM233be3etvM58bbfcr776O9LNe2dN2z6ygJAiFKbFKICYACYT
+EyaNoTTExMACYm1NpoBGTJ6TBGEyaaDEyYjJgDRMmIwhqeaTKnsExMmBMJgN
+AaCMJjQTJpgGgBUIkk0Q0yT2gNNRkynpk1M02mhTYU8ACIeIMaTCbKaaJ4mm
+RgRp6MpgaExoDTQm1MAaAU2NTJjSZJPyTwIT0TxJ4TQYgJso8pmmqESRTRo0
+yap6bCabTTE9JNHoaVPxpiANKnvSY1MYRTzEGTUzVPxNAaanoTTJT8mKn6am
+J4ptMQ0mxNKejKeMmlHtRpN6ZNTaap+mjTRip7Smek9U/VPGhJ7VPymaaUGk
+lIBNqaaYNMJoZsJimRo0GEaA0E9TEp5oYJ6NTVPGI0xAp4nqngEynhppoU/V
+PxCaM0J6NAGowNTxBop5GmTKejJhMQyMBNGRqDSSSTTJphNpsNMAkQAzATRp
+oExMEDQxNqTBpppkJhqj8kzKemhU/aaaA0TSeTU/JoqeGmTU/RNTZNPSeqb0
+KehPRgmFPAmhmoyBk09BU9QSUpETap4jSmeKeTYyANMSNBMwhgI1NgJPTQZN
+J4ExEzU9AMgAaZKeEwGk0yaZTwTE9JiGCGk8mTU9Gmm0TDSYmk2p4mTEJ6DK
+gyYOuhgA4PBISDpxINxe5S91uqZGWtZNSNOgpLHsfmn++sUUK8b7RJaRYKTp
+aOb4sf+nS7v4kV5d1r3fv+RiBAHgFiLbwdjIQ/F/L/V/uW9liib7nOSnwTlH
+LznvK0ZZaLEj50VSzXvaX62TxiHf8cSRjpzL/at+Qjge1/zI1oS21DMwHc54
+CEIQCV65VIIYFPxNqyN8hQzu8xq++G6wCABNA1JjRu9nJrT1bCbppv7H01Fw
+pSvpOC/kfmklUjn1+5eEdxnhpJjkZKhSp1BpSpzXI2C/8DreW+TLS2Cbs687
+sUpB8rSBtdQXzqjzUTi0PDbwTvr3Ble94v6mB03yqS95AwDBz+Rjcib77uef
++rwh4U6ODvj7NJeUn2n/bZXM6Kq4Ekzd+9EvXwE0GCOiPJSjO5WeA8PbBhjl
+e6voLD57rEtQPYKyCvVc97FfolocSB5XYYnr12Xzbyor50QgEAAEoCnwDak5
+xP0b0285HOs0F7LaJKlPHp5NfTVaJ5I99astlgREwc+9B8eaV8pdNEU0pdCO
+nbSsr8y4jhmkz6sUcnR7dxXyeaSxKiByryL4JPYN4c1tzkL6aXClKqFm7d0g
+vhymDBubh/yxEPR+21le858rOTGiHWuA0i91E7VamgMB0dP0jsqW9DPrvoq1
+VQnwawixmzQ2Joz0ui7DQu44sy2L79ayf01qB2vD3Ov2W29rk+17juPBXiPS
+F76umy4KQCEAQAABmJJ8ef63wP/vymgcg/uFxVfRz3UAP666zNJR4QhCAAAF
+9TsXFUx9/bZ696l/cLh8KU7uZgthB7HS/amhkc81SMOO2shjLHb5LdQ3y1Yp
+Kd7Za+kSdb4NPOq5bF+pK+b/Fi7OjpGGNz2fbojsllZ+NHq+E9o5snM+9Cdr
+j297rYmxX2Ht7wJGQbNgjkS5cxQ+X7WC09tshJ6Ur05g07dWPucg917zU+S7
+OyLcjVfEhybbAyq25+EyXWHOJlvYZxoJVP21/uCy2HL1YD9vchUfODJr9A9O
+qk6/CR/GCEp93Cq0J8TNtFptH+C/v7tV096zZz6IMiNpWsniYJfQof4xpjCi
+Y4mSt6x2SJrNmjcea7dW7o0JAmTVV6FtOk/8wj1e7E2uHj23X2e5Vem+f03H
+4x9Flen4XpbBctAidJ2tuQKQX/GKhFeQUlnVCaPpVA2U+rWAhCEAvh5W9QOL
+nQNz9yU4cjcwBWpPufF9RjQoyErYYJ/3t9HM8/R8yyfZTNP0bykrE+erv+Ts
+jvsz8vubD4UzNem39T2Q+SGY8q+VWK0QKzIrhHNFpvZNu22P+enRRZbTfNp1
+rDuOibgL6NMZLYArAUcCouYZZQxG835WixfXl9Q5Sf/RI6QPuWwUHAxl35ay
+Jk+ePqyonHRxXx17NEj3pgkIw3Q9QpCWNLXLTpeQaBqpMBZVVDp9KI/7zxvO
+ntZ1yNzrMmewMXpt27RwcP9trPYUgmeKetO3zX7+SvoIai3TsARCEAtv0lXQ
+m1OM86KGM2U1VsuMbrnrDf4dz2noM0ZuPeNBjgbxgz9+M8NGieNL0VD2mMWb
+vnVSh7h8neS5Th/etjjhHA+4aciIAEIQAADOzSfR9Cs9znS3ifhfUp/h8o3t
+qD4OiBRCrtPMENmLpdWORV5g3JvkRkCa4/NvtU09GbYbGUzsbqm2/FTs68DF
+m4G5SxEH0vbD6ofnBmv79dpDQEXUjrSlILhzeOfFjObYjkbQNhDHGRtxfBwT
+ROqh0NwtZ+xx9K7upWCMSPzkuljeM6y346TzHtks+GWlht9VFNpEuX39HBQJ
+8TFn2l7qIDm9vFuSK7mPRPwRXwoEgu+EiPhDVPau1VXjfpS9rasEwhwH9S3H
+CUMn8l65XeBI5oLA5/m/6X+tQVEssPjB1HKzqUtdd35t1Mz5wY6q0aPpvmI+
+Vp5i4lf3vNH/W3UiM3wopyRrI7fmuXlREkqsP+8T+bKY+ePkp+qx+sAQddX/
+ZbUZh2L8MrT9dYl8ezOGPFkpEvwN6h3MZl1LRCcfSnNSyxcXhxoZYR4ecO66
+dYNpLO8ehSjjyW3YTBJaiipYqyqsxeGk5w5/JccdDK/S1xWuNxgM58ZM1/6A
+TcgRGcZjRSYIXXmJblshYSstP8ZL5hxuNeGjR75JJFpaFNF9Go23cJOBZH73
+0vN7mddkHARfAv3hRwLKZCRee5s1/BycxNdIeN5KBEL3maIulRvPlwf8Iwly
+GGXaa1cmzju3XkmLTPqsO37/KQwDfyhy8S7oDTG0mN7tmsPqn3afs813Fwzy
+efKhwUh5houzM0/0EC5Hsf1V+tnrLHnxf3wVTDsMBpfXlSltFk1cHNU4X8KU
+YbPJDDjsTbL5v9G+f0icN1Zyd5W9+LQLxE6AgDFsE26Xeud35HJbVW66+962
+TgPo3fjeSjgM00tasLh3gZZlHo/qyLGdQfzNjqQwSSXGLf8ntwag/KHb5qT1
+Kh1+74Fcn0PrOlqfw3F8x3MsXE83KpBxOVDRv+CSh9BAlPcqui9EnSx70Y45
+FUfkqBp/T47978129SluJrOeaouY4z7B1Ea8Jcl2RCy0L4YfF9SzttJLVyHt
+BAEIQgDIfc52Okz/7eV8jBT1Dn0PZ3/v+mDCgPK5oCa1PG33sXEoh5XcyIAh
+CAAAep75E2nlY4SkaP3SFSc4ZxoWJsAixew23/hIHfERVVyjBteyGZtEWVrV
+dydQY5iHRtu5R8KooLeJjMIRF5vg8sapVglA9arHZ/xnc27VRGhki3x15aoV
+9Yr2XWAi8KhIOMPwG+9BxkOkHqn+Uyb7gQgCAADU6i3tk5sbrDB6h+JdI0zQ
+wGJTV2HPDL6zBeTk8fXxj6G+bOFggIQhAKwpmhwl5d2XEqvU5fsP2iS+ajax
+ktaeH11SqZrKvtlVmFs9tdeuikaGRtNl05lax6Lfdd3iYloahe/9IfMmkpW9
+bLKR0OaXWLIHYnrRi/M6IGTUbLcwd19BaJXkNYNmSjyDFKDiQIlpEoC8/J7d
+4qRcjOzCD0y86HaOlPvIqAQYIZtACZTZQUuEc0p+8Jd097Yivnvk79d+nQmo
+qV51+t1bo+UZxt3yhlonzWBlpOnRuysEe2U7TvqCMv8EY8OjybdVa+5qVoP0
+WsXLrdmlO/lr7vv560wxiSLGALjCDxnBgRQgCEAAARoIR5jsYzsu3/nYFy7V
+Ec7/oQf4Xb65VXWJ5585FpCLujdbX4WhetxnVbcpAr+u88hftU3xvet8yaiY
+lX6E21T12KHyforMPLDZGDaBoAQhAABOTSX6vM23sRIefKrby3tKdPkIcgRm
+YNZXPNqaxY3437asqRV/Rv9yBut/6+3Vgaf8D/SAE+GKNR7w5MVPXUBOPWYk
+MeuUpQEIQgFEbYXQKrXIU24tVqC4oIO/ll+nLk2vou18wI8DQ+NbIHWx4nPb
+57E/4UUvwm2+CjirP3hWIcafL0G5gkrdYX3R2bpMsq4/qTr+U7vdFmqKUhkQ
+EIQgEagKbF068I2DnHjT3a+xG9vwvUBZiqPWFehD0yevNx0y6gC+pjYzS8nD
+nOukvzJbbl5BeJ2hH3R4R1+W135FuccK4GAYW1UgpXYUCiljgw0tD/S62Vpt
+MHMraVyrcjKpdzBnNG2+JNs8jOg3Dah8sVpqruVof9X911Yi03GeAhCEAhj+
+5RJu5FeFFTXyfpU5VswCXOVLoI/Q3K8YHH4GP6SQB/lp57/hkCAJfS7u4TFn
+l7GIl33H+WraZZ4pdVN/NPUUfXxDZTiD6HSwTJmYxKkDH+2G0/KOI+WyJnT2
+U4TRfeWRpX8R8xHgcrJ2iMX5sdJ9CLyty1mXsSlEtdQLN1bqLGGEH0S33SLD
+PRZizY00cUjme2ScDizo1LfFPX0KkqtmUIeksZacS6C9Dt6CtAqHf6JGuSI0
+IkcxWs3KKtl3FvWeWo1KeA6DrnF/L/x5zD3AtLZc1w+0hdfuS7Zg62NMSuQN
+YhmYnuckmuBOTSqIxncunjVKfSqY75xxJl0LAgCEIQBUm0xhq3cYzpfzcYFR
+145t2cclkUOT1yTjyUAYLhIrw0Zxq97YElHkMamHX4eXLHSnb0v7vNqIWLL6
+GahY3dL2ucAhCEAtsYkI/kYiMVdDkgp00DuCv83l7RvU4oYBNdasX77diRrj
+cbQ78tmew7Cc9DwllnLhyiFCP49ZFRyq3yHaHPEn4B2gYdA3zcNFuYUDlMfn
+WTlPPlX3sd8pfbmTn6nSjlxCZk0xpddfSM8TKL2yXmsUmIbKEIQhAFhw92op
+ypofti5Zv/dT13WBOahV2rudHJjTynMC9Gb898cbf6SlHAxcMNkD4awyLjDA
+IQgAA3rZ/QUanGCNqwM0vXx3nSuTdysVHrOel8e3Z9b4m16+uZdvxYvBj/Hi
+cUF57qfZ1+Zgt+95FWqzKFZVRZK9xF+m2sBTkyp3Fh3HQtN5ltw/UMuGMGfP
+ML0LAC3UkKBahnhIjWshVss+jCfOZQRzj55q1crRBlV00vACEIQB6jGPR0Gs
+mU3DsqD0RC509zTkvdw6/DDmTQkAWtk9pMjy/qtDrMarkzn8W++THnPW10+y
+rtDEyaEgDtw3J2lJ1GPlw18uee43h6osmMc4OkCcQ9gfcwDShXKFtajOyjvJ
+dN4zh2TBEQQBH6TbZUXIo0/0woSrZ3TSRr4xcYxWQfti6nWZK1W6DYZ0tQnz
+TyktC4D1ize7uoGoqLby/PdMJEnOgREQKLpLlsLq7dKRjYukjRlY7PxGXdsw
+I7TW2ikn93POZycl1VdZtRg54uqG3Muez+IcAIQhAH+QUKpTBBJ1L5c73Igb
+wxrVqMmsZh6j/mYyzP1bPifxZeLafTT0fkjcDqMZJ/FI40wFodhJAEfJn8sz
+Vm0FwzWSxj91vbSSQCn/C4or9koO9c0TflE7Nggzj8LBGbA34CEIAAJn+5S0
+Y1G4RVcdnzhZM6bfh/Hz4/PfWLXKrH304WHgsilRsaKFGhfI+V8JA0VEyHJQ
+7ID/UIM2sDXsuTAsp+IqAlE3kY6BiI8k/SuOfUCcLw3jWo03zYHafqFCJimQ
+AQhCAKdEP6tjWJrUd1jOIFomfrRylw3RWzLIL5jdOvfGTsujSVLaDA69saAd
+nXSG6RUk6jckQOrqqPvHbIQ6sjivOpLnWliHl+4pEQgDbo+xkk69ESSFM2UD
+bu5QcPkbOz/VrslgOVt+t2vvmXHoOOlQ5fFTHva+s8145s18veEkhYehSSQv
+5H758jxdzbo+BjiNYegYm4xmIyjQjYzIXTIMZF0V7EkAXsqM77TvgtZ9EZqt
+/WuJtghCEAnqEtUYAfpDnTOUFpe+6pSQUjPadc0LUU/uLkX4WOn1Mv3rB800
+OMwxVxwTS6NLOOGH9AYTxFqQM8QsXQ00y0Mlt+fNa8+1/FEyP2xaIwR28qfF
+VsLO8z/Yw+t5dlbGxvzdq3ySrQIfEy52o2Fn8FFqcV/RqL3P+IfNRsg1axb0
+yND3SFFDtmFDdsrxZ1bMSBmMtsH299Yk2o+uVsIQhAAAJmv6Ws5xSTrLy61R
+OJwIpSvuPMTjyoSuHIUkATNHeNhpPtse32RJIUPRedDZcvt87XxPN7bzkXfU
+kgDDRg8Y8nVx5cQU2adIVtc6H+/52DJ/4bz8/CZv9nvrhQWpjb0iIgANG+R8
+VhwOT4u12MjcAiIgTv/t5yPXrXDuxhcsxYsoWEhIUaN6dCfdQw0PDV/n1HM6
+3UyZAzV6yZxzxZme396JgRH6TZ6Q9x8GpJzYe2AIAgAABQAeNSOLyGv36f0a
+9itUBlwOI6n1mmdMgYwh3TJkKJexW8e3n3CoIiIFo7hpTZnYHwmA/h8t9/va
+q7M6Gj9FZ3O5V9fg1rXkMP22k6CIiBbya3zCunJWBE4EPegqeCgJqagyYMTc
+isEkhf7uFfV6foelMXrA9nleDgiSQrp0vSecr/9N/jYaeeznbsO5csnt+8o+
+0IXFkP/eTWtN6IhKAmAfgFZFrFsftPq65d/LzOlfgpdT0Um3Pa6hZbaX03ae
+yc6AaEsVvdFJiHjBkvAVf98juSihxWKGApNTRQbSGOO8YcC24d2c/4wFqAhC
+EAqVv2F4/i3bTB3r77A+QzqBAFixiKjSyFR6fh8n18Ohp/cicMTeXeIoSQAA
++ILfh+qiokpx+OJ097rBg1r+QoZA6BsKA7vpXWJQEIQgEzTFQrl6n2Ov1NWX
+fR0OSqegJJC6/Cp/Do5ia8xYgxCSQBWbvfbzraeuqIy6SmR8x2gv+sF7A4zA
+05BvCLsGBxmC+2YL5nG81dfMfMmy3nr12Z7DNt5qny36yhqfW6R3llvwT/Kg
+q2sdjf6xEqSsldeXl6fGAoCoTBdW1gvHttrzUjKQ2Wq8qlxO96LJHvkptV+u
+qKXSmAqQYRfWmnVk6IgYk/UuEuwD+MvTOISNbzaiKMMGnkXkGn3RjlDv8Sh+
+To1mE9Jp8cHSf9EkhPtNpq3ciSQqC817KKp0fGttZZnUNDMhn9kvnCz5VdAQ
+gCYwLRQJgXcd7a+mooMVvrvcL/wN79+T2uB3li1sKJpj/98iZ/OktcJ4GO2u
+FLkahVVUUVU6KOqTmaJbLfliGd34VR/6/QFB+PVBERAq6Yu+YvElgbGltfVY
+ziJCAK5jFU73nwPyaLc0Oid+7i3TlmGxdtHLSEaSdTccrSSW+qeH2cTTU89Q
+byc436XLWXt8yNbKfZKwgIiIF3IECj2eHiFcs4fLC9tlVDjJqqJxij7f5IqW
+kL6sN1fhrOv0e6JJC2uwsMLDeKCv3j2fOhEQtDa2/FEkhczwNNBgWbdXJLFF
+FXSbvdEhmRI9usS+jA/PxlNzVWdo9giIgXfvPWw+n8mGBEkKXg0hAFNNzn7+
+9I5srtN3ahvB4VmSbt7+xvJMv1qx7hj1iKi0slC0lpEIAuDGBpd5F3TErGmD
+SSAG2e0mT43Ti8c4ePWtM92sxwbQtTj1se8pJDHY5+cqZ9/Dd2+XISXf5+Ez
+d++HeevNRsPSspj4JPqflmAREQKxSh8LYSLBdfZC2skk7wAckaKTeI9K5Kvd
+MPiUkJF7eJ7bdnxa7dfPd9rjtzzvXVW/XkNMJJCzcdQv7+/Mfh8wT62I2ZjM
+r9GG2tlnrhOczzBJIUJdbGR1d2isrlfz1tXFd6nvVNAP7U83BXu9vpuq7gzV
+W0EkhXPpb5VRTMExAkkxiR/hhec9paqq9aBtU/ftrl3x5+/8O46na6BCOOMJ
+IAnHq+9PzcHISLCRkSElnCxQ4kTrfoJJC1jvoclv7n/FbnMX90/xNT1cnieH
+Udj9s7xBIiBbLRYo8Z+sM4OLQobZFxK0CSYmrsoKlFSN0fHvNdvA4gHjfeAE
+RECmddrvW6l1kIdW7AiIgWuk1ZiBVyS6ilcZRNT2zdePgraGRsvhxbYqzK1P
+I/e8di/0/l1j9bBJIT8JJCadbCV9ecKog4ODO3GEJhYxwRZUW7NdZ/wPAEkh
+Z4SSFZQCEgD58fiRJIXGd8xmva0/5ePmFisshIA5hzZTf6/oUy+BL3WCAAYK
+TpX/bw8q3cuXDjDzzqXaPbCFx0pJ4jI86SgzXiSQnIkkLePHtqgq7RdbvqBJ
+IUYU07Kj+KRMaVM9OREE0H0zJQkGgNBn5Jx0brYWHFzHGsVu3tfgAnEuzPZF
+KMSevnL4+Q7R8uD7Czb7mqWepufen2ye8OXBXAEgB0v6WZCQBWeZ4/toX4DF
+i1MERdwREABjtVKViGcvt9vhLHCJx58oesPZBk7GQRRh3VMta898kb5pbTmY
+Ct6dL1OtWL3cuw05X6czM7OOKDAIgAI3RS6s/AQAe495NHGTJgyoMR1haWtI
+8KXnP5PgYcqW0LDqQsmgLi4lhQXlQX9X0MdiVlJIdqLsw4yAEEExkmMqZMrK
+am30A/znSCa9eH8uPMytSkIAfwa/LJPVA9CSAOg8QfEZAxeE88/qO4JADsDv
+GjB/fk+PkTOzmK3j1vJ00vbmu53/06ls22v5WbRcHg/GPYt6lFwhmCISDvoW
+ex8PxTXP5yxERAAUuqwrTzfDtnmvEkhRWit7QSSFWZ+2YC8vtC+0D6/PyfZT
+UmzUBIpCAIFiuNFLEH8VV673PVHxy9h2aj7pj3fTa/Ke+WkEgDWfSExBzAyB
+eAyAconIomxCKJ79T3CwaXETr94dW+yOls4nWdlbVOi4/FBERAlMM6/M+9Px
+yYDAvz/ZNL7ASGMzMHjcJ6r9C8mw2uubRRkTJgkAVoPpHUMFUR+SfIofXx7l
+FQEQkIAbGNCKsxkoafoMXodW8+Gm1mxieg9pJAF/7yF5d8H8FTQCXr59fesQ
+6f2rU1SfhQZqgaIZYFCX3aLlHLzfg/1ub0Pl39rdui9UdUFISokgDzX6AfLR
+5stFMin59n34tURFUzy82fw/6/93XBSKNSEAAoB6YjN3en/V8zjPP7PyYn4G
+zqXsb0sQljjznxqk9PLlqDNYqlpQjE5rVGn12t1HVyHz89rpbGqjj6a37FKG
+oSSAJ0HK5pzxJAHsRuO8/gwDGZ4EjATRpILlVFFJGSNja+blrBsktr8qXQGq
+IiIABls97IAbUbESQBwqWnmnAhAGy5+8h9o6hG+Ik5MbwjsTzs4k5NySbhxi
+hx35+f8JTEqynzrEhAG3YyGzzzn+VWdbl1cyH68tm+EkAcrl62FF9e223V+j
+SXnCtXDklZU5CcM/X5UkgB1LwvfucxdKcp9ocnlY9oF1KQSQB3tD90SswW9J
+IAgZb49laLvH5GQfAQAPhHszYvV5TNlUwgDU6TCnhMtT0PRUl+k06WEz/Y/C
+t594jLDs4DK736YNbAgGwUHyYPAgElUpzgSTBqIycSqZRqmFbHLi4xmjVKst
+djuN1MWGhq+J1ch1apQERELC8XDahoMhXVozu6ISchqlxJMIScc1jp05cYCp
+x0zKCSQtXhva5bpBxagSSFZfN/bm/V53Tc62Or7U32+gstVsfpz+7cQlDRMl
+E4cFwg/gZBt+o0MA4XrYBzSiSQoPkt0kAHNrNx+uH0OxkM//bPfrVQVH0XaC
+eRJICfY5DrJMmw+phSfOLFI6O4MIBVn9gCgFO59aTHyaTjLXnO1No/Ropcm8
+CquCXywxlBPSSU2d70mlJhOTGBE8JNWACuYVkooJWFw8x0tyf34Htr830KXd
+cmZbPj5MjEISImxVoycsmbcYja0Xs87sVErfuHRW9lMevyHX1J5iljnz66rr
+3wySaXUzejSSF3htm8ep9se9pcY4g+Ktxn4a2qqdelz4HeUO5kTI86b+1J9V
+WrUmku1EsZWJGSgBAYPtLbLsVCMWs44qILoYdH60HEV92s11XdnOFnn+MdnL
+6e/YWNlVjmOjo3frMe07/M0M3Iy/dBOGpYZvN3nj5d/EfKWEOoLkZcO5PO0O
+XH1g7odLD9wihSfmm/tE0VjYqenv6XK69RT1o0KKAgQAGQwjAY9FVVg/hlVo
+0xtIwbRk5ES38/7/xNaO7fn3a/gudzN/5m0wUuomwe/5UUS3WKUCk6xTVypo
+zaYb14EjO76Dc8S54He2P27JZi8DQNJk3SZNLCZZCL9rW78u1829reDKPrvZ
+ye3att3TZ5LPCpUfWAjKkKLxkZCxYuh2g0GlB03NxY0ENpHUOONmfordyNj9
+OqzOq2KBjTbWCgDCbm46KaHJwJ0bEW2bWgkf+WEf2mySQB9/S/Fl68eE01NO
+VmXWbxW+/Bv04yT6FBfIQbrSaIIHoTzVDT4rIT+L+qNF14283r7ksZZ9PS+6
+ieMZvNl6Jzmx/JwsxnUQii3mA0DzJ5N25ISFJUSLerEkhZ3B3/7f2/Hg7Tt3
+zqP6SQBVysfI0L42nZ2RSwJ2YSnRXqlJErA96wqrJS8b9Ox8QY9Z78DqLvKP
+Y+UXbHp6pR68WvDx5pFQspjgahfGe+2HpbbRf+yETGbnS5WDogREQL1PNLy/
+s+gouqE1Es+ZEyKOVSGUoNRNJlXxieX8AIiIF+Pufh48ZGz3AtbrQeZ7NPck
+moaUxRlY6aXXL1mib6HVVIiIAC1yV6r8LVcXkdH9EwREQL8Dv6THF1jt3JK0
+HpIKKHLptTeco7osSZPk1/ImrLnai0qPfVo4adaCKxJ+RvTVjhzDEepmbSeu
+nKxn+rXtMPCsa86bx3L8vQGTMhxOW+Sko+lCpr9wFQKPbiaG+HDrvqfvp1GM
+L13tauD9R6CjKllLbPZ6UE/VoRLE/4QsQQGOlEqVFERjhbS0ugEtG97g2lG5
+wf9UZcxYQBAAenZVE5vLzvJBZZZVBUQFoAUuhjCkjEO9gH1tx5j/SI4HbSBQ
+Eeq3Mzojw4cIAyBm7SJidBrWlaNhABERArL/knekemzoNrRQ+3t1iIiAAk8r
+2uZKMoaph87DP9FDjwSbIGQCEmcdN567maTc2pl0mQIiIF0uP91fy6WxUt6M
+ERECno2pbo/XGpG0iKRqA5Gn/rvrCteN+1l+R/OihUMbNn52y0wxhMTSpwfJ
+oPb3CQj4M9XdTQDneK233eWx309rmR/Gr8rnM5K33H6p/1sQGSzVsweFxFxK
+sxxTifSvTwfL+ODu91aT/xb3hQUCens2Yl2h8+8nzak8iIgAD16/7Dv3FtZ8
+ardVpS9tx8Bjj+ZbAPRNahAmgfBkFtvChUgvIT0pGlfVo/oNhMP83UzionX5
+/Pvb3nryJJChxqp1s1V4ebkPWQpbqX/Uv/i32ldFm1jtRTPr4GGDGKZOhJGk
+8QDxfWexqZToUesalQ239vG/7+46ygoa+0UxM04zFY2nZ3ZmbQ/lvEDJwMoQ
+ECamUgvRlZVvAoSAPc4j7seD5ML/78rLeN0JAHLnvWvucgTOmbTK621UmJoS
+qsckOVsvrwPztWhfJXbvOur9kX6cY9PSm8nir7igmYwRxTrY5lBTtRH47mKv
+9QmB50nDMgyycmyIiIgUNy2R3oyZmWFj6b+/H+Wmhae5+7uNZrT6nWogmh1d
+VjDazDusjJLLDh3h2Zgo5MWPWWcL0U4Pd4+xN3t3weT+qSBAFH/mkrtFNPlK
++NpLHMaPs3FE3eySGo208VRWmi+t78fO9aj7Enss3tL9OsTHAiIgTsnAZN5d
+vMPGumdWAzE814T17NgiIgW78N+m9buOWX0911l3CRm+pySrkLCVlpaHh4cz
+yHbO8p53pz1xMQKOVN+SRepbe4jHn1R55OYZjfiOk3ZnehwNzKTlV1jvk1tv
+1a/xXOBuviu+Z2dPb6psREQAD2Xe00e6MDPDGUpVjjKFMiLRezBrpF6LR9f+
+mzrO50LEBj8PC+qmAjGol32JEailg0sSSakXF4/bvp0ULMfPVUNrTcPQ55AZ
+5k07kvLtAREQKGw0uYMwaJDPBeai1bQERAAcXe1nAnZ+s+OozTUERAASJ+Xi
+WAiYSeTMlFRQw9e3slzllVhowREQKSXng6/PiP/8YKkCAibOqgQFUk0zkYDM
+MmMxvIFXV01wpicinU9X0tKyx087Nz+nXlFLmDmAEzTmE8+FHsIpQpfABBK8
+Br1O3itKrlYV1LM8tw947mJcpeLnkpaYN6SRIjWpbdIMNLAf52l61+1cThsO
+hq6u/nGipTHtDN2r21ei3PT1dJN5SSAHl7EkhTBiuxJXef7QkkLuargXm++p
+HfQ2nAvgHS6qpKN5BxDmXXJxjpCoJxs98JxWrs8zQ1LloyEyzcswyYmDh7bW
+8gQb28CEugBvBLPq+fJV7QStSSKLkNPigCGYXzDGJHiUb2MXHB6LjlgeK00g
+3ym4z2ifTwCIACt22V+/2WqNZ9fET5m63CIQ1RSrVq/BqH9vNnxUrQYCHGJq
+M/Bj59sQmDc2qEN8GryCAIiAAQeO2rUHwx56zIHzJjCZBERAkMtMu3qOV7bn
+++qrLjua3s8Op4rZummmnEhOVyCaaasqocnPZzqwj/sdbTxvXbbGweMNbGkZ
+mLxkbuJJCpvybNhs1ZaUhXtiPBEtk1Ygl2IIliQpuRsz9biIEkhWdk3Ev0T0
+Ku2WgemRmNaTl1Ekgm8yggDNQh54YtYbCS9VPgiIgWnEjzrXL774jsFQzcNH
+GF+Yw0NEPzQwv7Vpfz5Sk+15DascenfuuxqXIFQnk8nglSIiIFMhSkZnYLBM
+4V9ZzLJzSoAgQAGv89n9Pk+zO8q5kPwSDuqlnmoWVkRQPQnJJKOk5d0iCscz
+maxy18DQERAAdeShsPIMTGkpAMcOaQY59l6sxYSFtY3a4v9+1QF8hxfTT8KI
+dtDez6LFiGMrTs3ldNS3z+Wl+Kq7v2H7HmnFTDAYAJPEEWiIeBB5QwryU+rp
+9LC6zsQVekkhOtmYTYPVLDCSQpB2aNRJADzdHsemk28tIGCNi2jSeOkX3xPL
+f3V/ryVhT7V9pHWvfZKDD2+ChhITHwcIZ9iwuGqXz0h4IvhZH2obz0/3UPv8
+NsE/tROG6NDGgcNtHBun19XLn5d+pwN2dRcZmtvGiWBkZSg5FJ3bsyTqRCbV
+RRM44O1KCLRI/IfJ/yGc8jafwgXM0c5OAiIgTU88/HSaDUNCxoNStWqUVFYe
+ESBAgAKLe9jE47jNSBEABi55+gi/wr89BMERECRtcKlHJaqA0BYe8YbsFhf3
+8/m23u/r2+RbTUF8sTCooKl5ByeMXv8OcsZeHQfHPvO3EZEFDxj53rS0fxr3
+8Qn72mO6na2fuIcugQAQxYaokbFvWjTRs24ls3/1BO4QAAIAdvlfY/7PDQaY
+SVOwgwh+EvbRo0wR8xl8Fqf0t7WK2355Gzffb6h9TDtepvXb3CQsXvYzGQ7/
+DmQh0b6ieJgyA4emS9rKaRUyfK1noHR3+9NxV92l0G/b9iL4AkkK9QNPFwcC
+QNxfcHfX5j/EPb7ACSQql3p5XRSj8LKGf2tbQd36t/4/k4+wmchpNExf22Ji
+ybIA9CdGKBnZCKRxSSH+YrUNuXxIzW6jqaVUAiAAtvX3eHuf5gdf+/m4NqmM
+ZlplRuqrTqhS5zKqipo9NhWmTjcEhzJFcDQbcfZW3b39PQ4VSNRQQCGLzCGM
+fhIMAREQJJHFYwRyQ3tY82ff6o3ApMFY9/a6QnSh0arbuXCznJtnsPNKLKrG
+mnrJcNngt6l/7yg0Gsq/F1aSfWWE915XhGllkjKKvYR6DmK0WtFxC4XCi5yz
+39Z7HxjPU5znKxASQBnuVYfh89/vOCrptukkAau5D41vQ1TZ6a457VGYM9j8
+KHNaL/dZgNZpxaOSvNhECNH3ARo+aJECBJxB9kGmrTPhqD9NRhPZ9PQXyOWu
++9EMRPibAIIhBqwbyl/MlKA4ERECcJNyTrP61dP/HpZrTa6x8ey13cozTvMT
+GIp550g8UMkiYkWtcKe/47g8agd9ltbt85zZZuDyIiAAyzUN5Ju4QcIPb5Gj
+EMTMY6QudHIZqTf7j1XHw6OtrmjaY3287HXq+473lxgMMggi3zq1q7HElEIo
+h+ZrEZ9Efvh4n+Dlqlpc/DL3Ph0PFuljaebE6FL32vyUGEEUdh22DijRWEwr
++cE7ysvltukJvy41nbdTu6zZ/idM5KicOnITn0UUGs2U0fpjwREQK903lPQK
+g+jNeOj6zXzG5n5AiIgSW0NOZqYl3Qch06XUgqqGMqDRT+WYYn2Gq94roLWw
+C5+cgUJAGr8zM+paOXT2EF8XV1fIhLISSFiITu5i+kXPZNy6VcxahSsWcaVX
+LjLlFV1JyNJSqkAQAEsoOXyE7VjNSuxisbhJYsE+PpoCVcifHIGoUUfVxs95
+EiLt13NhYl1NIaKe7KMTkmt0p4maBmp4PpOBITcTI+vvjr94Ouxy+Sn6zlSc
+nToIT7gYhyoDJBKTTid2nE0mH5HB0snZft2dLm+TEVi0ppqMn5jrR57EtHNg
+u2MYl1VRKLTj5Teys5ESy2oz3J9vzNRZGxp8HQHuD3LUImUByMPzkMSIOVLF
+HFl35tWc6e/AQhCAV6okfN/LKIziKb7lbnfHIkJaE6tXwFxERAAaLMQK9suX
+akA6kTVjIwyUZlDtPGfFw0fNC/J0vJw4z89HHgiIhOcpMvUxp2siNmraP6L2
+NSNI6PKHHVNbuBJIWP415Kr5+/R8L5NhxJzyn9CT8qsuXGGmB3ROOOzDlYBM
+A1XHEhdhVqqIHg2Uykp/rGapJwRdghorIAmseXplyZLREQX7pPIkgDPxvhuW
+IpQ32ms2FMLwRJIWdLdc7mW7Ag2PMiB5s3/dxOUbWQbeKAycRW3Nwm1G3OoP
+yoFQOzsCWGcUgyqjkPOxulSV4rYo/y9L2BoLBYERAAW/ktuLJSIdrtlo9ZYy
+wTGOVYK5j37a512bR1Dlgu/Ingy/dtDakkI2BJ9fj7kTGPkiXy1ojtHZxXk/
+8S3fQW+VHOqhic/+KtDUyPMWMtNPoRDIGQCEsZFYgZeyOAPPk6vD21gc0ndJ
+OoZSgg9tfNDp+HVdtTlVDtirzLo+hLTbcRiCCD0iZ4WBtFVJ6ye07nzz/j7m
+tulf3W0/zOI3isRPtQHp9ew/QBkInpv/tNCAiIABCuUf0f39b9PJCc7hXTu7
+/K5i+VOBuJKpT4/EnNDXGMrAd/HLkDrqXLzMeHRLffbMMS5RzWb7fVsLDm2+
+YmypKm9udJvK1IMXLFxyAwJFps6sgG+bSqbbuzonTrvjkbGbqX0j0xlISeoD
+X6+pJ+/cg66d0goPVd+LXrG19zOFFZJBqyIycQwWrQqOby32Mhow0/IAGGLo
+HU4EQdpeBGTsXXKkJOuu3S4tmb16X9T1Mw5vWx34xvLW7h1ckh/Y2pkFsume
+iG96aR543D/BTN78Yf/w2Hy87LbqD7M436mfKznMy9vghwR3QIZ0CfIDBPjh
+TgnA9T8hLE+eVt4C1YW/gwvtB+9M1hq8P3FxVf97Sc0TtWwcgjlaWRg08com
+oommEwf/i3e5iOm4QEREC4PG7azubXU8Q8cSN20eCIiBTucNzVo/OrfUpnlm
+0kF13edbZ07ENjZydUbWZvvxLDN8/2tLppma3PX97cw+UEkhem6EkAaTK8P0
+Y4SSFjMa09yPkLpTXO2OYUcwjlg3UfioR2zTrP6QSSF1/szbrFyNf4m1wx79
+GxlK2O8+EZgR8yj4+Ru1Y/ZRqPimmx/EZ6ffc737OVi8L1OOaqqu6t6/ukkA
+YLv8eEq+RTr3IO+ACAxFXGYq14q64dxCOLbWL9StxTEkgB39R0zEQokgD1Ph
+vztP4eF78l8WFCZxeQs5+69cEgDPsYcHv4rO9aylqPpwVx5q+4iEiIACVTDh
+JMGZrEkJSd90wPFXJSVeNRTa3N/StGC5Fu7n03jLN98gSAN2nufkvqXRTQSQ
+BmqL5u9Xy8r7J6XXctBxfqK/0FCxh1ZHGyDz+5/wovbQkAQQkgD6N6vAH2rO
+CSALHEStPW+xznis/VfQ99RTJq5fOiYYHGldQJWIYSx1fsOfZW/y7HX1r29A
+XtuREQAFVo9haU93iNeNQiGsFJGCEAka9mORSS18Zkp2ewdfc5K6F4hcEPCY
+iBAAb8Cxv3QynggfIvnujpZDMU3ZTkdvY7GxmFVFMAHaFhaU6mh6ZVcYxgoK
+MdKqz8OIV70efyOtI79NMehsM8ZMbC8pppHAIpQhERAAIB+ghG/cjmfe1tfM
+aLR7XwcaJ0sCJIA+bj7u7BYL/TBiBAGqdshRcrD6ab9m57d1rNyr9EWvNED5
+rWdjIIRh0DAr4wCcEFKrjY0/PHcLXavVdSrs+LkYpsIyXwDw7Ow0Jhn97fW8
+3M9wIoW9QIAj6Zz8AkkL9c9kdb7Wce8TqsNrehA9nOFwXXk0sS2SncGzaGXJ
+4gr2LUiIgAE5AzVRcFbPO6SZuNWdS8j7Gnnwja37bQfy/j3luzpCNjblGyzy
+0jiVJSQlWUzZjZsowSSFibsJJBZYp38avj8+i7tXgkwACAHQTycYj6p71g6C
+Sial1g6JZOvMFljtEBumMBJJMYCszszn7P9rjYPxm9pZlZyiSSAJ3/HvRWMx
+N2e3tjQM9szKGcdekatHTKEZkREABH3jvX2DSaFpl4m1vtFPfDOv5POT0o6C
+o7r/CsWOKYwpm+KNMYNaIZI6/YHQIlqYizeqHPgbDF3xptqS/2Wu1+z7ebv8
+pM1OSWzmjhI9jclm5IQUK4cDhxcSWb83Qv6gIJiBAEQJwIQBR3F0tNzy7sL2
+BeRewREABaHWOP47uOeNow9ZUJJqXz0Hx3/0q1BbvJ7tmCIgALnKYT5o3u9X
+hXlrpbs4cGN6DVwe4QMceggiQboZg03OsNPBwASSFhdd8nkzEJ+/k7QkkL9M
+93M28CSQpQ9mV/PuJn1/tgH1q1bNr212TV7G3VNOscgQBqxY2ok95ya5fGfW
+kkAdTRRcF+keJJC4r4XX/AkkKVn6ASSFqtr4szGwcHBwMGzANL3fJhk+x2c4
+OomnG0wfjZpszKu11EkhY/cCSQm+Cvti8aiyv8GkkAZaAm277NDoCQc8VcwK
+KHOHuwEIQgFeOIy2V7OwXwNs202jvrnMz5yPybJNC7/t3lL8wQa0B1HMF9VG
+zmnpm3pAiIgTsERECo91bdGz93x5TB3Nx3jGuIHrd2Ppl132L0gkkLT1btHV
+cfHEe/wMER/nedm75gmEhgoV1oYXB6+lxdnHdWZCQA7Fb4+RtfFqNLWwUXhL
+Hazt6wC5E4DGCEAZiy5WvEkhaJmRXhcnAYYx0oqFrlytWHw/WscWailNubGH
+ye02fCBERAnFvsFvP0Pm/aoi73DrK4gLLVC0jjzl5D9mx9j9oIiIFF+7v8/n
+F6WknfBHbfF2F8gy/9pT7luzkntaBZWHoJgctPbX2Gt7eL67s9GVgwEIQgFT
+YtUYb1jAZvLQ2TTyicJykmcQDAtnZ6TxFUcaInxVSxhKRBs9sofkdDW8UWdO
+0ZUPg1BXcrMERAAWv7Xt5Fh6B6AkgCy7vl2Hn5hzw9jwaCRzjqu23+XOQY6t
+wW3f36hJHyZJzRuomdgfp4+A48MTnpZ8SSF/W76+xxvOhxJITbXaZ34PFu/O
+8Utno7+262UpC7F0uj3RdaXN0AuHGdCi9jD/bFVsqvrgAIQAAOEz41Hqn/Dn
+H0U3WZgHztI4SeL05WX+FpAnzSrV+GUlqnXDNC+eukkhbzk+r7N0gQmOWJJC
+hPFwvk0MBpPjZfTu0KXGta4EREC1HFopLw0dFsVVW3vjJGkYDCG7tCS5eJqX
+k5OBe7OZhp7rUvzPekDIlL9okgC/f8+fQ/HMiSQuvVaSl9HWT+4Ycyilq8nu
+RE8ImMNz12DCEgCfYKsZgwLgu6rGNzYga/LE+ef9hDnHdVgqBre5g/HYxUjY
+4+pzNTYudaXPbZbBHWWiPqhvUaCSALrg4bBkMx8Nvj8HuWl1NtsObrRIQgEY
+egEIQgFOSV8jbwgz12Cir+LKycwktHejqLVMcu1I0CC/Jr5QYoMDtEhs3qeS
+BPjg8ZDNHmdwbbMmy4S/Ad9fy97pzajjeHK7xmsqrMftMfFix9A/vO9jpzRt
+DIp1CDzHGY6Id7ZJLoXeNk+LxuhiVXD4tVqZfZ0m9x9S7Ixorup6/2tS/hXw
+xhHa57A4R3dTQ6t+LdOlNTWCZcJpozqe/rOP++TVMrBcwSQBRXi5+9z+AwSS
+FnNT7nsPX6T+Ps/B5Mvc8t17jK8ISSEzbjo9u2VEO0c41koftX0mBui9aEyg
+z69SY9giUHS/v9z5D7wjIzIPdH5s2LOtVnY9/u+4UoNcBPAIQgAA0SDovlOZ
+mxnbv0+X2E0nubGAgjMFxZmTrYNlKwYSsEyAlK/O7ESj+dsjhrosJMtrjokk
+ARHQ2fwV2uvHx9HO3v+l8yFFo9fpIie30RkhJIX7S/PvN26ORJ27sneKOJKL
++Fv9MqnZmKPp4+sHLvT2CP2EIPP5f+rbCKg1akOi6dIcT7Tbewc7gAhCEAby
+Mu0Xxq8l9mSAxdMYC1hgFwHMJZhlSxdiLhjpoGlw1xX6ltZVr0u42ObbP3DH
+xtZdr5G5B5392hMFzuFwp/YUG9qsjU6h2v8k0ygkkLuCSQsS2ykPW2qIh5xV
+HdiAWFhWb1dvkz5Wq/iV3+pS5KNaACEIQB+yvVE9MvL9SE/lj5f8rss0ABEH
+0MDEQIADr+yyb/jFM5blcvzuvcpt2tSwb1aZaGYxDFyLmdCiEMxI4znB3rh+
+jZiQu869QNs41oq71a/f6kBt3Bx9sJJCiuhzvd5tDuZB/XeNmkkAAbU+zcfZ
+Q7c5Ce1lFreKkdSTfTucvs8tKYnyNHMr2yCYmT4tf4MDKLrVuZ3WQ77r6oxQ
+EIQgF6GQyfIySwqznXFVB3ixLGRnfOSG6oaTH2zTrz9+22twmLGNU/CWzvXS
+F19GjirhKhnWiOe0HNBpMtII7OziEIQAADJ7RwTqBOoXeaa+FCo/X6sbJ9LV
+ajx+xGpCAMvt7VVaCdeaPH/fx+/neFxaS5QjtE/lm9nkJH5eJU8WMAEASlcG
+fdJ7IUgwq5qphIQF0dCw1HDHoZduZfWkTGwi+PcQ9VUL5jFaFHB/6dtIUAxj
+Rkqbp+zXAw9PUkyUliyHIz5ScNzM2lW+DtjzZAIZSSsGIgNpHrM0s4bwBbA9
+rK0B5T1sDzFLPZKv3buzF27q68+RP+v4v6jN/bB3V8vXITI0ZkuSqlNVoK8A
+EIQgDO+X/trcSYkkKMXRZsDzxJAE++xst2ogSQB1JHBbh4xl48+KCioyK9SK
+imjvW1eJ21r992hoovtJrGl4+HvN6DcbT+BJIXTrBJIWv7XUr/+gfllzC7g9
+l/Ir9Kb9hQBCEIBV/kXTk7HEZFVk0tZ0VXbvVVBtyhuOhrt0m1NKiZagWxNQ
+ctqNvW4ZAtaeoWaIJCX7Q37Iml83D2n/7321jrPVjQxHEYEy+ptwnbrbOGFX
+y/D98d1ciV6PqvrMARAALluffY+aI/izqL1m+Ml+72jt3oe/sYUlI+fFR+jq
+4zNGCYlNPDeekkfv/ac7SfFVTXix5XzUt80PSfOGXyfRmne2sHPXw2e4vqSu
+1BERApS0heF14u7aB1cu+DcLahntL4CIiBRC3T5zNbZYHZR4c2uUY23DEYxk
+ZW+GNadlpHCEAMLVlmRo7sJeM74kkLsV2uvv3RhwD9ZAlrqC5OQAJSWimfsy
+7WEpLTK5lhT4z3sDlvaNOgMpw7Gyy/vw9bwa4B568bFobJytzpOOmN5ENH4Q
+jYwFF+jkI0QkI2HSgUnN5lMv8NztZBrvs9KtI4VlKbS47JUGXo4DWaTE9ru2
+eSUNmU8CSAILAdy75Xda2s/7g7T+dvnf7199j9n7HfsboJEQLmneyirsWzjd
+/bnW8RpqN3bhuTc8XlvT9PV8fTS5nF2JO5SmJ1kTkdB3qn43DBcQEIQAAfDe
+4ml29PKRmxF7zxL97HBN5EJlLmRbVJbvKp+wukuc2El0Wr7THefyle/TAIQh
+ALH7KvnuKa443YUlKdp7UpAhcUgUAs9wXQbjQzfuxUWNHut1xAcoARAAHZ84
+n2Ssv2jXzziu1np6u9r+Tm53MtbL2eHdNHPfp4B+t/66V1n+2Zc+0AhCEAmd
+xiDHEhtSCnJRlU83qJnROKV9RfiBSWsus/9SyqzPmoGB1d+DudtlcdC/BTUw
+geA/MwhMoYuLGX9bYREC3cXdGN3M6GJVpQoqBeVMbXkuei3IOz4D+FQtWTo2
+TfSFFx3qP1W7RkR57Su5/niCLK8MhiAIQhAH3sf+G0tZVa3lRG9VsWKiyDI6
+aE3fMZJdjl1U3U9FA7lYoYsYsxyqr40Li4Wg4l6W+OQp+VHYtlkL5psu5hN1
+d69IR/wP9C8b9as2Vgv6lvY9obs4v7KpyjOU+NprBBb3cw3/+6Av4GLbNdO7
+0NehXsxERxEViQvgVSpirVuypsRXjBsQTroNZafREb7PyhqUyW1vXAZJ3E07
+29uaqBh8E+zJZZAEIQgDSZbHYCwNi9p4CCjXOlobf4zEhAcEdPcebh7WnLNr
+TLSLwN5plW3HyJZKKqZNn+nd+yu5GPgProhU7iJ+/NkaL2UVy1bMF4LdBc2l
+cSNFkAfjZDB6X0N98nycmpwQ3MUGuYMDTlct4F/ytT+p/6+j65r76ZP2uVPS
+tyUlOhthIu8Ym69UpAnoERAALFLmIoize1DaT8EPvF05vlQqiM+jDJAIQhAJ
+eTNs2tnfnXq2l8uO3yqx4/y03z6pHR5HWrvR+NFR73nNY/1XNAx6BP4xNnpq
+88BUxNgiJNoebAPMjyAHOAQhsTIacL8s/C3huztrSZ2S2qwS2sj+1MAEQAFq
+v24nW1ZlLjtbR13PDNNrB43bzX5pZkFDUU83+RZUwyIAhCEAdV1YbHQ+nkms
+B8MrFKOKmp3HkgrEbqotnD/2N7F89ckyXrAGjE2vcj5r7QPRoImxWu6Ngr3o
+JEf1ZoCcI7ncu5S9qxErQiPzLRzrr5x9gWwAekcX1K399TwtKt0Xlnl9VfPk
+kwA/p506TZuUhNxJN6XiZyKnYOPlCPoartJ853LfehhP7dh2mVpqti5uuqR4
+gzgAgCAAAYAA96fp3KagN0lIjfCgc7CPlEjx+w8sNYhO103Uk3GASNftpq/4
+v9MoirJXDNtuHH8nvnQh7EYJr8HR6awWZ2Mvm7jtTk1maJG63dHCLa1ttvex
+CQEgAhCEAlfCrxxVzy9/M+T2VFoRuF+g+bfFzHMZOZ3NNmq4VzziR/SDBZcR
+pchygfAPLuLy3798Httx+DzL/63VFullfpo903+GqpW58N7hxO4Ag/u08PY8
+vJwPXfIQAMynl0Mz15ujZsTA0KePXopn+E61+Imac3LfyHUyk+689q+xr4Jg
+Uq5fDo14wAGT6FLVm6zdnu8nrbSmrLucCIgAGvFgkV9XVsaO809xmGD5tcWK
+e3wXTKOclt4+zxVHvZc3H9iukL38+0NLzFga9OUw8N2dHiauLeOttoIQhCAM
+X3a08dGatbCb/pPKJ5TlqR6dMAnklne/XaNafRVMR7YYVluXvaX5gXd0MEDn
+8xtUHDpYcOX6JdlIUH9Lym0138beHTw2BqxfHQ8MojEJ619Y0ykQbZiAPsId
+FeeW2bd4OxvjRyzPDyjD+J+sg72/r5+pus48pjWAthsS/sbf2QeRoT8qKYZM
+c9v5Hq4O7+76NN6OJsvS3CezaiNBNPmwAIQhAGzkkDGIadWee++8ao6QPDpJ
+dHgbbPPcnXWb0/KWLjzPtto4plRDpp1Cl/Y5lfo9GlhOnhzd0j+JmMiEIQAA
+SVbN9NAao/eV4NuX3kPXay1gcnsKdptcyqrjU6n7VXcadvaD9upvPdNhlhlm
+92RD6QF3JkNlIkyTl2Wj0/RIPonhGA2Sm573Z5xw95jGaGLiDLlITTAAA7Ym
+DBVuy3Hl0Fy47ngaTJcrs/Tq+/VLsIpypq/wmjn6CJ485KnlqV7PrJ0AEIAA
+KNUtzLgG3z/Y+FZ9q5mAmY+VWJn+rB3hmCPAbO1h1sI1br1DmnOhe6NclDrN
+iucZT7VD7efevzq/pcWtT3+k+zUG64jb2mNyrO3TOpTVWTh7mF41lTmunJ4s
+xOO//periuReVbS599dxfXwIEScdhL6lnbWq/2nmxgW/Wjav3fdpuR0hbt9R
+3v8P2CDUvaPC6ruoq0bzgb4gi/GyufAyvLedHF4lmhh3H81L7ng7N9JkVDfs
+NV78bRAI37QKksWsLH1ae1Dwy5azXJcev2fWz0p/2SrdYTQwMxk43LT1TaMq
+Yu5iEjm8Yumpvu77blX5mJ1bC6zLjsKzjG5kZ7grzGUltlzsfuWO7nJ5P92O
+2ZQa+bG2aZEGnuZyBzWifPPsnaqj+WdQvx2nC+uSRv97EfruSLoc9gNVcizY
+VM4PzcnxMJ00bl6h5n+CCUM+bWkHlfI4wvwlveRv1mFOUjPxsRi+/U3c2yJt
+DK0Nv+/pgxZZSJJJHjf1nRFZ/d0pj42ktwHcNSFKXPIGppReLLZCmZtKmW6T
+l8b8kGhp0/bYkGfwb3jH8c19mnx5S+fJJ4J5MoW2HfTlQlxMRUa6WNwQj5Ub
+zwPvHLiOfZPovZ9DH5M0Cky3xcJk+oQOxEiSFpgM0lK/X1eAtvyb0oElOiEv
+nfS8npiCJV4pHCPiMyP7o/Ycr3QgofW1ovdh1Jw3eSTw1H02ltYX++ud3OM0
+1evLnY51db9nXfCb/LceMWWTVLDBYpwyoIQhAABYxs77p0lhYyDoP7geZwGw
+k1JgVPVZchQNkJrk9L5dVNtvSVQwzTKS+t9SxKQqMdc+YBCEIAnB4Xv6AQfc
+iSoDeUit6zRzQX0ZjuuBQpZtHe4KLB184/4yd14bfJ4Oy01f0g+N12Wi4z+j
+szDiPoj8xinO3STa+mLetsrOe9eh7nn+xvrk/LbC9F7hBanzXbQ2M3Bu3Bd3
+0qJViAkUnFbk+Xgiktkwsb91M3dyY+G0nfMZY9DvEv12TDeruN7SYS683GXs
+C92+Qp9tzlHeJWfxrSqWPtzxwIfiYa/IJ+IvxER2ywv0W45F6OumjStLaMfV
+IAQhCALc7PERZvJhn8ET31P8NNPStcv7ET9CO7lZ3KuS7MPOjX/WGUez7i/b
+fu5nkrm1Uqz91bU+zOfGV9mNauLYiv1Alhtus+7Rq7uFQVgVEtsySmsVzrFF
+5PlgBMqnYtamtalfpVzVnFoVv8CbJ7F63c2txKVe91/76Ac2AM+3HdHo28sD
+slPsb0NFjGHdysEeXnlXa7MMDqM8HYAbt0K4/rvt3TnLP9x+BYbuNg6eztT+
+F2SYFi87WsYPSmj9LCTh3Mslej3F6of/OYRYSMhurYjc9Pde2EgydbmTkikS
+u6ZLKJ4yGkVWFrhb+FpG9t5KfAuXau7Znj72h6zuo5r9Fy0tNHdPgShhKmbL
+tai0UcyNMhHu62bujtzO3oxkiHjvNQ6uj3aAC82Md3fsIU8yOOLoigv5Dfj9
+rWyWjB8xJkH4PW3nR8KYOYykvSHQQYsrkUTqFqEwdOybVZMrGgDuvgearbT2
+5leSDWnUNdrqme+r90zDVyjHedodXmcR4/2w3lzKia2Jt5Q9KPP67W1Nav7G
+sbN2NUxl/aulWu6KX6ur2HG9Hu/bhmndRZCDpdAr85GMu4vyad76i1WJt7oP
+dr050LWRVtR6/Q0jy/Ytltrg2Qp/cf587cMRp8vafNM+LPQpWIYtAtH151Wk
+QhCAABmoXJ4hGcNcjiYNoGeH1s8PskuIdDL22aYAIQgAADLJRvdxLuBUalZk
+Jeip3FoQcdRQWpccSPUIlzcue04tDF3/EelWCTJHAiAEyQjNbsXmyhwZyy+J
+abiUAIzWfWq6fuF5N1YanyRdmdxuX4ZaxSu4rD0bTeD0sVuZf8qa4lJ5wjb9
+Xadapujn4mAqMf3eAHXitij9J5qBaR0vt2SesWQnZtO3Oy+wJmOUVxxxIy+p
+6SQAgBICAhCvCAUOAnOFB0ZfOQ+q7aOA2cE1AqYAhCEAansS+brJcCsM8ivl
+luI65rDsGBlr07nJ3w5Ca7LBSQA37m25r94+Rt+077uzeOx5up7fU3VlgNTy
+71p8BlsNJOg9YzQkgDh3nVm7L263HK4bJgbz/D2kvbVX2OO9zVQXM1xz9J8J
+1bhZ7s+2gemAt/8XckU4UJC0hIeA
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+uudecode -o test.ok.wav.bz2 test.ok.wav.bz2.b64
+if [ $? -ne 0 ]; then echo "Failed output uudecode"; fail; fi
+bunzip2 -f test.ok.wav.bz2
+if [ $? -ne 0 ]; then echo "Failed output bunzip2"; fail; fi
+
+cat > test.ok << 'EOF'
+1 seconds of data  read from test.wav to test.out.wav
+At sample rate 48000
+ With low pass filter cutoff 1000 and high pass filter cutoff 50
+Fast tau(ms) 50 , slow tau(ms) 50 , peak tau(ms) 50
+Lower peak threshold 0.4 , upper peak threshold 0.6
+Minimum gain 0.1 , maximum gain 10
+AGC block length(ms) 10
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+#
+# run and see if the results match
+#
+args="--inFile test.wav --outFile test.out.wav --blockMs 10"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > test.out 2>&1 
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+diff test.ok.wav test.out.wav
+if [ $? -ne 0 ]; then echo "Failed diff of wav"; fail; fi
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff of out"; fail; fi
+
+#
+# the gain settles the envelope of a step in amplitude between the
+# thresholds and is ramped without jumps at block boundaries
+#
+args="--step --blockMs 10"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > step.out 2>&1 
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+awk '/^[0-9]/ && $1>=200 && $1<=500 && ($3<0.4 || $3>0.6) {bad=1} \
+     END {exit bad}' step.out
+if [ $? -ne 0 ]; then echo "Failed envelope before step"; fail; fi
+awk '/^[0-9]/ && $1>=650 && ($3<0.4 || $3>0.6) {bad=1} \
+     END {exit bad}' step.out
+if [ $? -ne 0 ]; then echo "Failed envelope after step"; fail; fi
+awk '$1=="maxGainStep" && $2<0.01 {ok=1} END {exit !ok}' step.out
+if [ $? -ne 0 ]; then echo "Failed gain ramp"; fail; fi
+#
+# this much worked
+#
+pass
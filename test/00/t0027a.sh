@@ -0,0 +1,821 @@
+#!/bin/sh
+#
+
+prog="AutomaticGainControl_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+
+# Sanity checks
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+if [ ! -f $bin/$prog ] ; then echo "Didnt find "$prog; exit 2; fi
+if [ ! -f `which uudecode` ] ; then echo "Didnt find uudecode"; exit 2; fi
+if [ ! -f `which bunzip2` ] ; then echo "Didnt find bunzip2"; exit 2; fi
+
+fail()
+{
+        echo FAILED $0 $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+pass()
+{
+        echo PASSED $0 $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir -p $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input looks like this
+#
+# Constructed in octave with:
+#  n=rand(N,1)-0.5;
+#  n=0.5*n/std(n);
+#
+cat > test.wav.bz2.b64 << 'EOF'
+begin-base64 644 test.wav.bz2
+QlpoOTFBWSZTWfnTV4EBG6b////+Q5BMFkgDZyBZjCVCFJDDAQBgBgRADGgCTgYBME//0AU+AAAA
+AAA5o0aGmEA0wJpoAyGhiANGI0MEZADmjRoaYQDTAmmgDIaGIA0YjQwRkAOaNGhphANMCaaAMhoY
+gDRiNDBGQA5o0aGmEA0wJpoAyGhiANGI0MEZAApVCVPFNqekb1J6g/QpkyB6gaD1M0g09Q0eKbI1
+NoaeVOvreLLmNJSRgUkY42GcKRrhSMcMApGGxiFI19jHhCkcIUSVrYBSO9mBSMgpGHfw2ApGAUjI
+KRiFIwCkY4BSNIKRgFI84KRiFI0hSPMCkeV5AUj/AUjiCkcQUj9ApGIUjgBSOMKR3ApGAUjAKR8A
+KR+YKRzApHiBSNIUj3ApH4hSN0KR/AUjjCkfeFI5gpGQUjnCkZgpGQUjMFI3wpG+FI+7e2wpGyFI
+7wKRvBSPQFI4ApGsFI0hSO2FI4/nCkc4Uji4AUjgCkYBSPSFI2QpGkKRuBSMggroBSOkKR7IUjl6
+gpGcKR/u1ycv6hSN0KRpCke8FI8PCCkcmj9wpGuFI7IKRo5/Y9QKRza4UjdCkdzeBSPN+2xnCkaQ
+pHaCkYhSNQRKqzQiVVkCkf2FI3wpHYBSO6FI3gpHICkbQKR2gpGQUjUCkeMKRtBSMwUjeCkePbCk
+aApH/BSPqCkdAKR7QQVyhSM4UjQFIyCkZwpGcIK2+brBSOkKR5ApHZCkfWFI1gpGoKRshSOwFIxC
+kaQpHrCkagpHpCkdQUj1BSPWFIyCkZgpGYKRkFI7oUjdCkaQUjqBSOQKRshSOkKRuBSNQKR1ApG4
+FI1BSMApGAUjzgpGgFI6AUj3QpHyBSNQKRqBSNAKR8QUjrhSPtCkYgpGAQV6AVRV1gpHhCkeUFI7
+YUj/xdyRThQkPnTV4EA=
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+uudecode -o test.wav.bz2 test.wav.bz2.b64
+if [ $? -ne 0 ]; then echo "Failed input uudecode"; fail; fi
+bunzip2 -f test.wav.bz2
+if [ $? -ne 0 ]; then echo "Failed input bunzip2"; fail; fi
+
+
+#
+# the output looks like this
+#
+cat > test.ok.wav.bz2.b64 << 'EOF'
+begin-base64 644 test.ok.wav.bz2
+QlpoOTFBWSZTWdpomo8AlIX/////////////////////////////////////
+////////4GD/HQNltZENudjUso7Y7d3K5o6b7enUiRvXdRJqg3rd7cdGq3mv
+dw9stvbrvTnp5uZeXl7trpT3vTqbZdsl072729rvJ7zenPYu3et0d23t17M7
+Na3GatrO7kvu3e7O7fa8911174AUBQAAAAAAAA6AAAAAAAAAAAAAAAMq+3vX
+bPvW73evdbndXjz3ezYRrzs+w++ZQ9tyb73N28zOzXd3e9nr3a27rrSne97e
+r3nuTZ13q9ztUztugu1ze3p7x66dmZ7Nz1ud7vXmrDu1dJGy9m4U2mbO297S
+LrSgSU0eg4aSSEMRkxAp5hAaTDEMmCGhpiaDEbSGRpgmRiaaMTQ000aGmIMm
+JoaGmjQYmTAjCGRkNDCMJhMmAmAAmRo0ZKDSSTRGRpoCZpimyDQmmaZBiZAy
+amaYm0mJpghpjAmIaDRpMAhhqZGjCMaTI0ZDQAFPBo0aMSPU02k9J6p4NGhP
+RNojTKbT0UEpJESjyPRM1HpU/TE9BpowRGjAbQaZJsEBPSMwNETFNqNT02iZ
+qnmjTExJ6T1PSNMU9KfqeEyMEwmmySbKn6niT1P0ammTRobUMIJN6Gmk9R6p
+o/U0gkpJJShoBtQB422YYQhEJ4wETTJjQmTI000A0AAAE0xEwnqek0RNqD1A
+NBo9R6g0Gg0AaMgAGQaAMhoaAGgBFSiQKeg0KeTap7SbIMIYp4aYgJ6NGEAZ
+oRkNNNIzTSYp+k2iZo1MjaTSeQxNomFMxJ5PKmNTyMU8Km9NNMmmjTTKeInp
+o00TZCeptGpvUNAoJSRImgDSYGhMaDU9DQyaaGmmCBkAmDCMSm2mkxoNNAyG
+ImAwRoT0MibTTRpppkyaBoYhqbU9AJhomNNATBkBoAT1T6rsvHYCZEVIlW8l
+uFo+rm5JEqV2NauV0ZRlRTHMC5EFhCxer1jULrewiSzrAiAHtTkG6I6O1Z6v
+dTtFS8i1ws9lmq3cucb643wuc42/KpT39gld5tC8DH9GhPqpEEALengGO3fc
++gxHxPcVBvt9gcJ+XoE6T0hhiJc3+rKugKEwnf3hyDDPvAJCT6mO+Vd9Zw/i
+0MwdOrYRUHA+4UX9mvGI7J6Fi/whPlPDsR3zqbbrVjZlRVjSFGVfwU3fYzRc
+bFVoYGnG4w14PN5fSNm3PX+l9Pb6au56EdXvID2MuaO2VUWZ8ngERBGIUd43
+RejR1ozM+KrfhKythdcOxYPtu9MrR+RWvMaRZQEv+G0UrymwI8yBLEiXweS8
+bQVPFvL4Xg3hIkkWbcGQxOMmKsNW3t9W/z2m8Nf4ZclCfNZqMI7FtGJ6oPdy
+GWZMyPhZT32WBXji+z5Ly9km54jtVYZXD1ibF2PTltqXQ6e3+w/1s62EHwbe
+7Sd33/pEkTMZYtajZIsQpTVUAw3yk6HiU77yHEjjQ3HBq4FpISQN3Ek4OQGe
+jzt4Kv6SIPTAoB57RgSerJg5w0gr8aYk7ElUnH2vj2hTD7ml+54z8MzhK+UO
+Op1KB3xDx9+cgjMzszZWe4M/syWO2RJ+Xmwz/BrCe1xp+wont0XR/3QE8XAI
+iCaqsrn7TrHLNTDZJGewpL3rTrxAiBdemiksYPZGBJDmJ/4hAHpc/yLgOWK7
+ZTa/CeHZoQ7slFmmyOKgrZG8s+cwzS2eXgyZ8P8GzJHNH8QQohD3G2Juvjas
++Zz+2GULsYqTfLihp5fwHVM4e1gC/lGNeOfh2CYNklTu/Af+WUw/d6j52+EK
+0dKRnzGfEr+7z1s5ktwjCVr/ecbjyX3MksMgv4B2KGY+pfiyf84ErZ6EbGM2
+Ih2MT24ivpjfZsr+2/yKruu9TBGyEZoErINYNnvelGHI3hkGL8bWLUHBEJtx
+Tx79HPD3CPE4OAJEy0aVPGOHdhXpEktW3jbSMRe023kXAGMJv6g+LsxwOUdO
+bkYJmsn315N2o20QZilNoc21NRWInnWbwXLkGjJ6UGhdUvN9orJ+BaTS4b5q
+olo2105m9K1knnzsDz/R/tIcKosRpdUaaI7BC5AmidxzmxlbX8lAV4W+h0Ot
+OlrwWz+xEjGZfLZZy3S3mM4/Upn8qKreW+pGckb4lGmjnsJ//cQNxObpw7HN
+mo0cZCymNJNYfkfr0YhzLkxmh6lusf4RFCGMp7PlQGsBGDSLlgF5jGrDhlap
+oT9FHaRn8w31HIpHl29vC+8ZvMDv2XmEGd7xpeE5Dj9II4zmMepcLeo8fXH7
+ctM3i6rwixmjDh5m+tw8AbQWVCJaCCDkr30KYggjRQ6IcgyD8DVD8BG9VL/f
+1d+eXuMcZ5FyqGaFQMwiaFH2eYEBNjF+Z9qtY297Z/opOH3B9AbnOKw18+a7
+/FZ4NRv+GxhFdxuyr4vIXNGKh+GwGftAyaCpXy679qyY8HxK+abWSPObrxdy
+yHgZOjkBfYarpsJ3J2DnaXnxACIgXJFCG7kcJL0/m/T53Lb4UQOz8SmiH23I
+Y4i4+jfsmYY1APWIvR+bNhcOVetI6f7JR+wBEQKljhDwfWG9SiRavhMwIXtw
+oyh2kqBeYpIF7bOQVRveFupvvoCKNsnrmdGAJoa+D4IywoRGejNzPmab4ewK
+cejjA3NVSXgNjYyEcQvFUuy3owB+xRZnL233X6ExcGVFKT1zZoELFzDzbLxq
+7ZOXv9h+kGbKGBL9CnQPb4+xBuK86NPuAREEv5nclc5T05kwlyyhvuNW8gcT
+hbkZ5IlP8GskseQU2fWzinHbkuU5zyD1EnB3l0dag7s4xfsr0Fcn5wxFCcw8
+9SWvHfLJuo687nayQwHtF7P5GY/SqU4h7nLyAHl7DuPt97V92Ryyz7wfcvmN
+vSz+MyWeGSKnYis4Pd0c/ccalKvlXShgKL+TznZuHJ057CrxRoiCyByc1yT0
+Ycw/BQ9jp4UJDH2AXwZVZjXd86S/BWwv+Torl6NxPR5Q7OIvJ0VdQJ8Lpyi1
+C/xwwA4tp8Y4Vqk+DDGBcLpL7vcN8NiowByR8xFrJJiSbnOjWTdJP6zCek97
+Pqp9XKzXfhdzonItxljNHOcqI3QuXV1YcCi+5S98KbW/K5jV6TP1WA+4WuC1
+DFTH+Tw1/RDEV+YbO0PYxRi+doDoxH8YSbN9wcJP9aPdiM5Y0sf6ZCiB7ijh
+CtrYH5o1zwKvwfoHsdmkaF3KIL3w5QRl9eVgO/OH7pRUy4c1yo3C2FrXCTaz
+3Xi8WfRls052Z3TX6nP1If+TWOmFLiYgERBOmCIglUOUhSozNdia9GWhFurd
+Y/e29hRXoVq+P9ew7GoH6QfoksAO4sZz4QUP6nMtrElGx2nxo64iQwcOTWxE
+97Mrt6LocKL2qvtsUH2GXVpx7Cxb/2/zotKmb57rloK7mBv6U+dwNyKbHhNw
+VP7TjRkhOal/h575eqmjeDEWNkwbQczi+t/C9UjQ80GUr4YBKZeDyRNmoQAB
+SlIbuLabaBA0VDFbrYi93oU4+p952tmvzNhVnz1vB8sd+o9mrtRovfIM/2OE
+qvG7VACCADmoR/g/QcUnCeoyR6RzdwvWfQGL+iw7nLu+4n3KJTDI2VMKR9VV
++lYeNoV2JOz2/NKoLI9jZUb9q4V+N8xWB4W9c9ldoAh7VWOTPGrGoVdCNBCQ
+hXXrhXsHg0CIUqUK4UBmdsFLCmsH7WwlbwekpOfMGT6B/M1hHEV8QeD5m0un
+2RkRho/zA9HHaIPwZ+B73Lf1cI5YWcSHGSrxsePGFjYLUP+JY5T8kuqE2LR4
+wkG5y21Zf6+0TSDUw4sqdiFbtPzCrVDXWzi8uZ+MhtC6Uxg8jxzT+0VMMWPu
+K0/FYMa8sNaIABUGpvWt2XPKDF5I+cvdKe+SGNlcOLk/VbowelXKq3YXf6du
+hMt+kzDatlYf7NxicX+XFjjLjMnwJy3fDTYOwfFNaZQ6uAml3cA7D7Y2n95y
+mJ7nT3Spdrlu6ETvPKpXCaQPQrx4wiFgKYRcZ2vs3e2HaOQ7Xq8cQTzn995v
+9uOt3Ath8ZAA+rfoRx2slJhrydzjxVNBngLpWAGrz4e9oJF+8fYV8O/sh843
+VfwuF4FQSNMrjNQOSbeN4QyjNRoDnzfitQcYhB+GG2jTH7jJQdrr8r1A6jmC
+Hf5m2G3fRM+12FyvcX/z+ixEDfHrVuyYZ3BWgmxmB7vff9cPeTy/sGaEmKvw
+fQObaMOPwvjeGkuIINC2rb8HyJHGFlbBnYp5XHKmaol189m2GCwNuMeYtq5E
+kFX5PtXLqNtuP/Lkmj9zj+CMFG7JtmZGT9iXYy2vjhIFS9nZ0FHu+P7/yf1y
+UgTkFqbzhEgHDzbA2/TO9bi9qcHlrf+CJoBow/dwSa4OcNfoId0FsHdJjDj/
+yZJckQbo6JsiTREQAczgkeWyMzU7HjYW8rlwJItTSbwX54vZl5c7e2ALtYnJ
+35HGzwt/4gig0+3HThUxq/1a/zMjIYcxhRGCqCuGl+3cGTq0msPEvBLK4RoZ
+YbRa0cn6t5nRam7Hy0zSQw+H+F2xR0xnMQOvs85zirOUd4hb67jiEWh2jFFk
+XNztjD7EVF3Q3WijZ1OFOKZEl+YeF/IgzaEB6jnzpTnoPfxSQL/P5mhJVau/
+Y58HhDDMKJrZeyL7FnOEeUXeD/ncUthxUJOzptjc5Dd87bnNH2X6xyxdERAD
+0EYbeSZzeDmZjGxCqM3fCGlM9cD6abptM0wDW48LrHDrYQe3HD9ju/9CXGdF
+vxD+14R0cNHL8k/YYLJkNbocDYdXuONm519H07oJyoKisIQGEHyCXYjUWoRE
+APfSJfeOMQtgYTV2bHVTNZOdWHRfCEBE85b1DK9ED7DfMjs8kZ8lDjtTD0nw
+ULcDgmfrxeHRv6wlz5mvXGjcYPqfxG2zuS/ZcgaewSoMybhney9pdjkYye5J
+ZjO8nYdqE6R3jNZ9XCmOseaHKyWciiSvB/rfeqp4VIk3V7kzshK9c1B2yUIH
+AjXzdgrlHdJA49XVSK10Cu1TJjWY57vJyVue3ieMNc5cUn5llDANEF9fQ0FU
+B6Qy+lnAZVl4PCEz2A9aP0yAPWUg9hVbBVZh54sR0QbWEwebAm5OUdfingtN
+THKkc/xseebvC4IiCVSIIgjNPWClGPtX0OP/ZOwthhHxmVl5TfaJsfcWwwBg
+IRkGxWJ4U43911RKLIseBVDKPP2mhLnVi47jtdvphEmhn51/fdYgtwjTt0OL
+3X4I91UKguEn6a486sGVQrIeMeoWPLaX69+Syh3j9/ya7wcaMYv0FtVU/S69
+zvjdwBpH2gurWtxvr2zEGnXZ2skXbXFkKJpd1s9FjZImv1h59l8fOdrPIoU2
+ipmaUpRXT0/GZFnuM49aFhuNkRZiTvHA11tPnfasd4p2RfXdBRFHtJYw9lRy
+4XAMwMFsPmjaHX44vcHlCyMaO+2lJBWF1q+3sM156cJ4pt/E/f+vZ2oy0zlM
+OWCTAh5EhU/l39QnXJd6jKysMb4Ixh2/QFMLkJ4+T4aGW9dcB6agKfMg12mr
+g9g+zW594nzyp1meYPgfMdT1lqtUucomgREEngREEcDqDgUpEEyTJlbdq7sY
+svR4zUm67Y8i1oZsNSYQzl6KT7zjr2RpiIjNnvrKles3sJ0zL9ySKuXQXdGk
+rBvz5Ewfh1/A/G/G56MothS/jiOjUKozunJ8MtiVnm4TA4uGuqhp2Vl9Qpgv
+98du/jjGahS6w1KDvCjeF6kaVYpBSN/jKjv8FeLfeLanXn0ZivPSMPvK8r9q
+W8PHrw74dD8tOWry2nR6lt1jaQ+icyubz+RvnyR+Qa0GeseXiAaTGgzg/Vuv
+Go8e+OjZhCiU28jbBqG38f0ogEcALGx2g1CZbc8SIzuuVsoELZDOe6MHBhwb
+/D23PHsGlrEx5uAG7DvmOYmlrhnQwTj+C43Hfnl4Qr4FjjfB5Icw16xTStac
+Y5nRdz5YizPk54veU5y7qUlBYCENwvyuXkz7YHh3zs8DaPzCOGnb09x2Vcg0
+VGqqvV5dIoDtJnQ4EQN9ddnVCXEyezmpHpb34jwEm+mbd+hcLnc4vkD8fUVh
+ivjW1fjnha2pB26Lxi5FEU6VYvyxrzzv/5WHnVyNJW2Nu7ea0MLw5plCK2J8
++VYyKfWTXvwiIAeEoCkc1ak9RHnCc0XfCM7/IUs+nnGNcXh5y0ZVbCjhY/DT
+OyuPDFWNYkaTeJYDZKe5UxIJisHrz8P84NENuMo7+neSC1qPbWVue6I69n8a
+punWAVgtSh3M40SCTDAgQACZOYXufRqq9WSITGGzyn2O111AJT2v73Ajcg6H
+a+k/0kEN/1gzWXlGAtioRY6U311vkpAQAUhMuSskTEXhDcmn65+Z/ZnsyXav
+DdHdqzqeCcKfauZ6PeWwiDAdQ32x2HTKGKisA0RKuqO7V4IEdvwuS0dFYhfH
+6BGP1QDGeTbYMVbcw96pqsrfy+Y044JyZo1Psp6k7hg5BU1HbYDwdrUdMdE/
+huTdi5tiR6WvJw0UgnLK5WiAgI6yF1K7aV0YhkMlO7I2SZyI7nC4Itc2K+Wf
+R1wzA5f+UqKys5QmnTOJkwVKm+n2vwaqBxHASS9AayqObI404E3Wjkbc24Ag
+DPJdIZrSqpum3rCq5suHxG4x2FJJEQRBNa7XwiyhmvAWTZjO5jl2NPNZWxiq
+Zne3qE0fa1ZfO+6PI5fAV6SBpBrg1K04yFYI+P4VPnqwdozlRD5wt5AufR3c
+S5Dcef4Eb/uRKo4Nf7h63PVOA2aQnSIc9U+EWQLV+Vq/LNubnpXTM6EcdeaC
+69/b/0vCoiIAK8pDc4/bk8erCUH1dGNgXy314q2pd+QVbJ+52Fks6xOeTyLR
+RW/CYhvX+EpRvq+XFmIwoPbb9symiOAW5e8fUn5BKGxYvVpNqBb8RLTIQOIU
+aTaqS54uEOcqS/LM7Cpk6kpfIpj/v28et1HUag9cr3l16GUBUfQNR7gKje/P
+znddOR4mQu1YafGhHUAr5TOPzjKVfH6YYNTtIy3eDbhvkU2JFRUXj4FVVhJD
+r77t5wf+hbflFjq5RQoAAc1QidnmffpPH2w258EbEdzSJVHxBEAHQm1I64df
+OWOjVyq4nX7gdZgUTqMBWf/QTUZ/GeNsTnxgPJxqBxMMlR0ANB+KgtPR+423
+f+EmVCtHaDM9FhheVraUjNAKGAotm3oUlJKe//o5vdZsw4FKaw0PHrXlJV3Y
+4js0jV/S6n196PCKovl4Om6szNjT/DXxqKjK/MalSrG+km5VhjvHARdJCjR6
+OY4q7Kz19SXpn0VVIZu4wwxRvkHtfAm2o/mj/8uacZcWeH5ZgaFNCPo7RJSb
+JT1CCo1o2upMjZCb8Axo5tdkxj7py5nzDiJ4foK/WeKZEf3+JcxuaztNri4p
+dy5SCnq1VQ+FgGJPGl+BUoduGImpST7GdrIccR3JUBghCiD8OIvro8Zo8oBv
+B4KrsGra3piR8K28OHWe3nSMLdq/Eq+P8KFC8glxtQ1ZH1hoDuyZpAlNKclH
+JiYmf6ko6rEdQREAA2zSehs4yOSzil0JwUQ5cJg+bAiOukeQGSgqjrKLpoWY
+Nw7Yzfbw5fZBVRH1db6MWVlrRlAfEN4fSeXTjvb7KGXy3A4C48SiYltmMTiI
+iAAiM/j+4bFFtXDEyXCb4cx1oE6PPVUTg1+KgBzFltM/1vxh2MzMG9XYu1L3
+lhdRhSJfiCJFgRd+WDgLGLY8TgSLf4LYtMcw0MDjRwyYggyDS0mMLM45r31X
+8blhBx2zHc/MStO24jnMMzQxfHk6bQ3eztGVlIkEQS6Hp0EjoO5t8Cb/LLlI
+OUSSoyHtoKxfLstxixPjFAH37MaYTbV2mRoWsu4tfNs7Rrg/tDxU7A2XQV1X
+YDkBzscnzM9S38+96AX3o3exaryGQ8V5RcflUYN/yVe5XJYSAw6Fwd8nfu1Q
+lqhKOVM4zc5O0R5gmOiNvMBmMzej/XYoISYdAsdNh2eAnsyWKwzZcbC8HubA
+3i0QMrH00WFMEceBpGD6JmKYikImYgwIQAVYQRqoG9oyjxFtruIkZjIU2C8A
+8OTiVeQjsb+3rdoS+F0p4FVeex55Cq6K09L+i0Ox293xMQx4x7ClUQjoa9JJ
+IgQACQUoYSiH9chqhPIE/zLPzPSzN1Ks8Kv1tmpaWuUVh4HaAqNSCo3y/aTu
+yj++WJYqjJDJltNbrfE8Ri7an079ftPDIeRuGZvk61JgeNcReQFvovxpt1gS
+QWLd0W39nK1As8qrpdxjlHf3H9E6ftxsqeX6nzbweKToJIR5hmPXUNB8HwfF
+cYaaTV51gxAMSgTOOoGgkgHtpxgtgWYjwsSmhb9RzZav34xJ9OS8CF16a5Rt
+ueWJeXYtGbpSEJSLHHuIy+Y2Bg+OPZbMYKdKZ4K2nrluxy7PFfQaPYhfYNUz
+oX02/QraHvw9+aNSc7UHZ/WCBgVhRDcZVbuL/RiIWKbMp1HKT/Nlo6C+PxqD
+dJ9ZCuBfa16Gwdsy95BSdbTVSh6UDDnUB20axPKNYd5ELYhzQx5XahMA58E2
+idCrBFA8uiCQiIEAgzNmb6ga8dDJiv/D2+5D/sha4JWR5ktAKuux7D+//1B3
+b7NvZpXjqB+4bhM71hE336FADoGEXCtQBbxPTWtuEoumoUTuHbYXjf3QcAH4
+yMwMvAqGF5GkQXaJV+MHfSlmHQvgREQAEdM6T8VZpNF3ehRKnvxoU7VEV6kB
+YJSBEQAFlear9v/9yYt755lDt56u+czpjI1bXQva+MZyAaFEv35XF9Ye6fS6
+V71L7L8hmpd/pJeZhLLDdU+wsQX+RhBoJWUErWAzdsg3GlRLLguMF6VDvLZk
+GsYc0l3t1uWau93KgwFsZ8Bz6pRg9G3wsjoFV+K8SnaYdavd5OUjfByzc1ns
+xUU/UsPO+t3r/jq9vr+mOZBMuFd+rB1epQ9zAQ8LTpeyf1DR0AX8x8Wsc316
+RE5z/XbvYyAuaLQdVScnzL3D3OuAEC3ZnG0sJCHLyx11+x3DiKKPh9TBRR+S
+r8bc7/t6zyfSDyu8mzE2Q0hBGbgjNiwsrMlKXFd0dFjLMYAgGsnaZ1ioEbdM
+jfOr3f91/0P+rtREqMmn7/2LFCBtzllto/T3chjQePUwBEQLIUioYERBL5aF
+gREEW+ZOTn407vDWCzWJiw2BJGFr8/wDv42Br0DR+/mY+FaEeoDBc/udao6M
+9YPsbtWQofM9fVO/LR5VXb39v9q9u1rupwutDml1t4A+bjJxPd8HOp9rZ8uC
+6C5tRQrtsRKlRz+ULOAlDbJtjec3n8gp8pT4wP4Bw3JtQG1tiPWpqbjzfRzn
+2EPHoPuFi4vdar9Bpt9wwa2sUOf2f0+Gb8V3nHxVMv6iUlGSu7MA58Dw6+bR
+UWMfEmhdZCRwoynxuN2+uayBEABts3X+DnZHewxx123VNQtW8VmxJsTCwrRz
+NxHHMac/+Vx1LbTDyfmJ13p9q4z+9iQDwirIOQ6u46KlgPiKTCKwR2CnM4nJ
+cOMNcE7yiCh4QwDnCa2I+PhOxevLhKLrHeR/xy4AiIc/x9fcJ3DExuf9bLx/
+RxvN6d6vQKjglFHQH0+VlqbLv7LayWl+e4AiIAAwmvfMNOdns8bAGVP5tlb6
+fo181vFwp2mGk+XztLOC17dgOMY44djmkCIAAwM3aum2V32ZWe068yPHUeTr
+683UsB515ZcqVCd2y/xph4XZ8fLhmHl4h6DVQ8Kf1Cq6UK+Po0WOFz5zDOF7
+FI+EWtCaCEREQAYngYvYwGGgIakbwERBIV5xWKqVGgUXuENBNarzVx+PFSPv
+062jz7VFPv6JDZCkhNRFUA7PT0uK09RXMP4k6qgFZZcZjMDnMFGq6h/Pqftx
+Z8knsYxctl5pYbD2ATJOgIiAA3D5HS+Tu0h+El4cbTfpehQq4bT4ES35Tr/W
+qvSpWXqNvtvFW+/B4lzxfzz6m/z+f7eL4nDoKvjuUzfN0vL5SSyEt91FWfLv
+iLPj2DWAREI6A2w8Fpd1IsdTuaG7Tp5NTiDTl7n+FquooptQabTmpRrYOhqF
+DqXp0Wuo2/e7Wu1TMLa10mQZlWPr/G86TTmTiPQ5eL38K/T9DJ0OhWm72CIA
+VyDr5fh0ZlHI4Ml4ZNde+UjTr/AWrnNfDp+jBxKDtGiaVOZWzh5+ngEzQ9Fu
+S7t+bGwciIFwREEmE4h2Zpj/F6Xn49prouAnALj+EQ8fGjFvplOUxIBAIEER
+KrNP7+p4KwD88cej0UPVPP5DHPXZFERJX/P3FeZf7LL+uspLvf+zmJKKaBib
+yH12YS850uttyDuz7rHWdtR7mOY2PX554Wuol5HJQkJlFbTRX+XbNNV7efoP
+50p3x+mVqtrpong7zYS/hxGxJDaQsPlihyIiAA3P08h03RH0NCmYoxsbGT6t
+v70I7ZbAIg3IkRwEQD/zy2fL/PahFibQCIe9iGiI5THE4qJEPR+SGrf85lHS
+xLKy8JX5Ls22F81LqdTU0L8w+SXno1vIq6Rh8qGy8P/L7eq8Mqzs72OxfgER
+ApS4/MFR6GI0+54Wvvn1xlFHcqKOhxWz0XPof5aSIigGLb65Y5nMY1Ivqf5V
+z9cUUKQJCBsj24iSIgVoYnpLHU9qbJs5qto6tBZh3gaxvEEcLt4xMiBKtG73
+eduPe0xER1efG2fn2e73YtTIi8fsXFxi7GcutbLQ0xoe2zPQqq7k9tzc1aq/
+UWrT2qpppXz3aVbAAQPMotp34Kj+8FQryTnvx+PJZoV5zfI9RcdHeHCmrlz5
+MZiXvtcqXXXJ4nNzJ4ByH7+OgA1OeAAIARbf+4uHT+nbzeemvN3eCv3W5jxi
+K2OKvMF6QEeYKnsIDAk4eXkKRgYFhGJVAeibwcmoCyyOzIIy6FvQNR/k5xuW
+O5jUFAS3MERAAYCz84v63h+8Pr1/rUVra6pBeew6J8TMzKip5aFy0HUwkOlg
+QIgCIiAAlWCV83t9S590vUeCaeqXpsaCfq1HDrF1HR2KgAiIFlXCjsACIgXZ
+dUysxAiAAs6jQ0TnwHLXf9K92OY3pnc0tWxDDC0SiKvwiv0bieBtXUaxwjBv
+t978NvFr8A4aozhw2+l7KRmOytJUVi8jflvnSjUaZTZt4BQQVP+p+fU8nQV1
+4pXWkrtTQ96y5uqmZlqc2uh8r7arO0xjhuMffsdqqemyKXZJdERACXisR6ql
++BEQTryVvoYjPErx+/DS5jQREErf2AiIJChaOoqKwpIbt5D8dT1RC05lMeDB
+cooOp0+o1M+5+vZiVkjGlBEaDsPkjsZ2UhLYT+PQum+BUbnvgVGEGgtabyr3
+Syv172X6L2miYbjMw/npvc0/FrvD7lpTfnLyFPTtpxeYZPOh5Y9gYWBxrq13
+ewo8aCIglJ08/VjI0nFo5coR3hHXi/CrCmbrenS+v0+CWrwUUz2T7bMzDdhl
+RxHUEljvgrq/IFgN7Ad+iaIRnDxLJaWgwPow3btaal98niwWovarvIfh3sXh
+fWa/H+LbrfHnMpF5pk6vhfv05+W4Fo6stw4SbDVWIsqTFZklBiNUaI2Iw6hw
+QolU1wvtTJUyrPK/b5qIbUIrh1ZzzUEnB47qodvFsLxaUaCu/O+/zzxkK5xX
+BwnsEbY4jp8AAgBFszQjT8r0oSTmp+OwDqKm8p313u1uG1mZEn5c9kA12Vv1
+8m88W/I8/7PaIBOgCBuNphsMCo7qeBUfa4eG9n9lf8k7zF52PBLHwTwYNqhA
+9UcrLloKgl92P9KYpjsKxZHEelmZ0p3fnMrSXwjZzsSnY7rbNgERAtlNx8dN
+sMfMjMpnNhstL/72NtFEo8vPmAIiBaqYAIiBa6A51zcpXPiPJva9xwtVGPSb
+SM8lMpEnt2cAiAAydNRvZ5oCFY9i8/HQXP+KOsXiKN+Eec2/UyIiAEiu2vu7
+voqD2GFyqn5VRULkgo/pYFsiSLcZRDIjsbdgZAyCjgQR0C+cyhf83xfzo8lA
+Wba939UiovjNOZawN2UeCIgAPXvXD1TedRuK447IbjMGuEZBaekvcpwvPZ9m
+WsX81GIv/m+yoX99MtOFB0t8ct2fR7uTvKbQYBH8JE6TnORXJB7h6WktcFSU
+LvDUiywrOWGUM2VXPpnprHitYj3svR6c1iGsGBzzqC48kXiucLvHksCIglKi
+EQAChPqD90GY+tmAIiBMyDrl+zYFnDo6KWhnTTrMpy6zbXv6vuEr6wAiIFxA
+CIgWt41gxMSfOMJRyJeKf+oclOcua7mEfGT2wrKDKMjOyGPg+R/3is9KjING
+sKSkzVCwLZ3ZfIp2maHerN0Gbj1UNGK2s70tzxdh5QIiM5N9ZYpr0tD9N7sf
+4a3ZTd0BUfmBUdvtt/uiryt8VQDW03G1/p1XNsNXd/BOXHHw7YAQDT5mcV22
+31N9S3+jUumEg2HN06/3x+dEz0viZ2dbE6oydeZKVI68WcBLOBubkr/ygjHi
+ar1Itb8IzxOpL93+++nYzxt176TQNAAgDy0b5Nr4sLrKrF+z6cV1T07kivr5
+ZU1u08Ubm7u+YiuMsdeG7b60tsBHAAEAKxsfF9YseTyB68X/e3WKUQGT3/am
+z/Km+TIw7LoYfG/Zi9fpWP2LjO/2hW8Lfw9JmYM/ZiybsXRcPHPHSzXIKHqk
+AzElWJkv4Vz/LSXr8Sz/5BUb4CozYdj8Vlsz2XkgoBQQg4nt8Z9HbWGXEQAM
+dwPfPYxnzjQzcaG409jYLO6z0U+Tipe9dZywu7dtxmFAVbJjdbz/Ym+O40+1
+ytZeURh07NMq8QRAC8FSMLlYXryrui9eOWJW57HblsdIkqSo7FHUzVG6I5ub
+AjFDyPDwKjNbfxhxN4zUQ8jqinnO7FhlP9jMaiCAGW8tn0YDIRa+mNTw92l7
+OpUkrrQmUrqexeACIgUwkAERAl5HXdc7SyKk2lNF6vI7rm83uajp6fGstgdZ
+awsHfFYHeyDVIMTtilBz2IWsTsG2gtmFqFKL9gcBK/3s8mqgFwvPcxeLLS0p
+tNBz+Dm/CmFFGfvqRxxbbMN1IE72tZqRWNFRuXzd33np+JycJi9N77Cw+Ppp
+9eqnq17eFuy3WqeQ7ybQdzQCIgTfjLm2EhqpJ73I1L6Tyv5k4PCoIvrGB5IS
+D0M4Ty9AwVNdUc99AXHZQVS6Z1czM8T1vZmcGCo0uDvvf3r9/CwQqAUwKjaq
+YFRl7b0J+d8rJdYoo3/hgqPfy1ntPiVVVsq3B6KZUUfj7gL9pfOpsBmKae1M
++R6CIgk95+KvyKbmdU4HI3HFslsec4FKG4bDWmSj49scZfFYIAcPZjH94Hlz
+gZ5W063M5FNuUl6mkZ9b5bJpLspuyQWzA1hECAASiEHH5n02YU5nfcHM8bqs
+ekjKns/jz87nfpApOD5vc9YmHHMe0I4GNHEeN+CCgHTZHZe1zuXqD2JoJqIQ
+mQu8yzMyYU/SL+VnIxGiEGaf9xjmELDgOzxrTSvLyXl5h5E6La9GZ9rs0/+Z
+vz5lcdB7l4Ct+zN77LOAIiD01FG1bjcStj/XyLMGiLOqgHcUncdrScbQ2iqy
+O3BUfC1wKjN/pSFDSUYKjmcIqgGDUUfutde12r5Ga86f1GBnp8QQAl8I6n/+
+T2woegk4IiACxtDa2dFs8/RUZ+kQcfbDja+BLMSkXmfve11/MY8eF+ZUpqJn
+EQcVSqe4wERBKVmkbh/k2stuvEyz6AmnqqVRO7UfamusrjeRsNSWvVMTJS9+
+l771jcbqfW7flp9OCpNOFQ0WdU48jGGxs1lJE0zRXMojSF0orsQKHJ3MFR+2
+5xe6kZG1/ECo0nkd+Co+To/t4+K2VPcMdqNJ0+F/3g2PV8OTRQCw3XHdG70R
+k+8BUdfeOyquH/LL/CCo3q+AqP9Yl53XUYj+UmEpSUcWUIXoL0WqBj9vJh0E
+QHUHTJwGlHMNlXya1jtW/4tdsowL7q45YBxNx0tDDTPQmFuDsqqtotJJQh9w
+hREQAliS+GCqPcY+StMHSY+C/v01GslroHGnbq8JCdp6Vh/EmIhBRAPBSNvv
+mruv7vjlcsFezENJOU+F9yux06/L654mn9LDzrPZwn2HqjF6pYtnvIfrEkq7
+NOm/R9YGVREQAfwDLKVYJqNV+eqeLKg66eafAbzIt4knbiZg39t3TikNpVaD
+14Tpph4R9jDBt7X9+wG6JqsgREABg7nabrTQuSWHqOZAERBJ6RBEQTXf1ioH
+8fj/4+jp5DuTOU10ivCR+uueaCo0PhgqOY4uL7NxGwxWJO2wU1icTPzoqATz
+PZ+fI73dC+o+1tFxVrULOqnpYeoqKR7HsrpuSYYbp8F36WxzYGO2y60e2PAi
+gGHl5Tifz5XkaOr9CUlDyb35sx6ulrZzc6DQXwFR0wKj2mxp7N73yanmAqOa
+BUfj3vnxoyqAQqKt/Kc+m0zmFmuP181yY1TGhvoTUaNVzMYnJxVAIjOTZQBG
+jECDGI2WhNmeJsZyEUMbHFH/gGMP+nPqr0xpqaxPcXyf6dMVVs5eOkSd8ARE
+CrgCIgVvVcyL89n+9X1TSS/FBEQSS2YIiCUG0/s74cxo2cxMq4S3BmsbNTIz
+ZihmEo5Z7i8mcBUYZwFRlDXRSyeJejLGsJHw8xepS4T7YuWM66YiIgAOJ5wv
+Lylr1Hl6+Gt9z0We8mHn3RjFsN1A8S1Xr6UuR5CzRjEREAB9ua4qY6QZgmWx
+H3tlsugZ2H5TNv46l9Ta2wxQJERAAHYuoeTniwgfnnqjoAqP1AqPjT+p+A/U
+MQcsFAKwPhoLfieH/nrzFPuz0ZBeYBR7po9UUy1Osl91Q1hHuhTFgU9hYDIW
+9f2YdlM05Yq3J0wVH6AVHvt5jdRxNj3v3WAFRsYKjbuxBUa1rMFyN1ubMzPl
+d3t/1kL6KWthrTFoiIAZSW13UZeB6N5ugREEiAREE4/di/v9TQbi7hbezp7u
+mTtRsjtfUsXmaKGhScnZ5GLlyRApROlxFNxSsq2boW6i3cOG22cVjljJUbC5
+b6y4LOzveLOt9XxFYfN1vRoZfFL/5O5dsmRc5CRVQDxczDxdtU7zKmJkIWLN
+xW6FzLnx+zKOjC6QuierQklDeR8js4/Zx0jewpq52MSAiAR0Euuqqrr/7Y+9
+hdeylc1JAqPsY9NoBRb77tXG1795c+UGb2WDftmEOHH9bhZuLi15QOGBksjB
+A5qAEqHCDMTjBmXWMvEKHhSvOyyGSqTSj0on0syriVllezzq6h+Gq+aBA9mW
+q+aGSOaiIgBxL35ev92//ng7TBs6urrzML9O65ez/3e7NO0CIAdpSg7Wg2Rz
+SP8XExlEAoqVtYVLYxUApdwbWc6FVuup22by3Cy26zfr/HiOlSegV33MNG+Y
+lib2U3RAej8YD8fPXgqRW9FTxKSl1WRYahm99Hcqe0tCO+6fzhsvWLnrfVE5
+JZarmeRU0fQNpwUzU6gR1rVdmb7sJXuk2NLvZs520xx4b7X21ie0E3KtLJrZ
+E0NEiRpZDSZLJU0jUyUzNKmFTLNZGfmTWo16prOefkbzEDXdverf3k8dC7SV
+zYKoB43kmK4OwkLgXHVwj56WiHVyFww08DcNw3Dc3Xcbm4bm5Q2qblyhGtuu
+60VJSi6Rsg947NXi8vHhG9F0eBQAAQSkRQi8ERkZT5rI5rb951C+r5L7+dl7
+W8nf3Do8RQoREAKin3XQ02z2mz2fo9tgrDBOxIKUiIgB8iQwr1U9SXnHsege
+0QQAU8LDQaFleS4ySqBEAKlDA66p4nuP+N0tpLEAgwOXwnxohfRQhiGjXBfe
+QUxChdIGpIC8SChc0guL6TW9BgSMhDERACh+yiorPiv44zVoqO9nxUA2NHfZ
+yXznNofq+qR0Wi0UqogGZROf8upbTjXWeBrGmXysrmDp75ZGSiVGX7RaVKSW
+xDBK2XFdKXRMwyLtd7v+N2urdfum5LA3XA6Cng0/dHKVQC8AqPEnohpvT0P9
+OVWVH6SQdx53HMC93tQoREANLQq/oov8cRxG7od52U7Ilk+mApGVlxVb8HAf
+Dq9gftqhuVOZYN7NHMT/wNmw3bHVqW7Zus1nEu1tJudH57Tz2rSorJfiN5+t
+vDPdfQWOw2SVxmhsHGzmzO7gbyy5pN2esAQBf2E3kqrJ7OqXfnbvZHdHAeAg
+IG/0/AoOMT+6Px9TpbTN7PkEJWsv8xfYRxLO0hXAmGVJg2h60Qi6Vkkp7+6X
+AaTNQwGA/Wnp4uD7zNxMjpNJg+0k8CqgFdBR0kGOx8xPsyeBnf7bsvAajuZd
+aFrjx+24SPfk6HCrnEuG44hxEsDwB48ExnIFWSuYFJmE9Z5icYqVlTjQ+/5t
+xm1mfOZ5CUocpLzEtLezddZV1npjUdcKfloAgF+W3eAlc4xQI7ACALz8DCTq
+TpOgCATknUXvicXi52Cp/jIxWU/mYidlE1N+rT889oJUHMN2IiADgmYERADH
+6yUzH9exoMFfOeRGgzGFJfxZfjX2M1kLcVsNaHwYJsBQuvBPOhaRfHETCGBU
+MSCuvNsFiC+gLLU4RRgJNQiIAKPMx0iZ2AkGtW6rWQ2Gu3L0rX9IgCAY96Lv
+ws5ocLc5KytPjc6525yFb/JhVj3YdywMc+LzDk6KIJ0YWlzSfyyJJIAxj9xv
+r3zr5ZKheto8lwyf2AJIWR8toqMv/k5nk+Ri/vy7DuK9E0/72rLQrNHJzTY+
+cq5AQzhgiBEQABtFRc4Z4eHxzcbPQF1s1K6giIAbVPkW3QGXhOpddkzSuGl9
+DQfncfxs1tCMS5ICAClIYus/V99v4XzGi55QW/ywSsJ3inG9gonbsrB2FOhR
+9h2iejlZ4fraowbO3dQAK7WxELQkMGZWHceCT3y6CKfASAKjwDE7+KTUJUdA
+yzG7a410o7Ju1CgWlw9536PsTfc+OzDtFceXrfeulRK/SBrJa0cvAyvGbZdn
+4V3wnJOWHBcuTw25sdNeKV+uOOBO6v9RQLRCAgBVClIsl5o5NaiKJN7aFoUY
+pKHNAwdbK7J4PJtR0s5jXHvONi6s1quNVydjstbVOBBADa6Lc1xn5FezmUbv
+N+MVvOvDypKlAIiAEnxAmPLO8PJ7BMSnVFMAQAxXYkRNPptlzbJmcf9gU3sz
+CAgZ7C22V8uxc8xPy77W9Phft2Hl9B79meoH7vzLqpqqqpzv2Qr7DB0uupT0
+7qh+QYJ6Axs6eG2hcu8dtlilY1I3nkQpagFKPab+ECIACpMX/XOpo+cfcKZK
+vvowTKKiS45LiQG01OV2ua8sP8P0qoBnr3ZtfdC5x+vM7nfJDXOn/VVANb7t
+ky3diaFV9LfLzj6lyFjF9Ta4/5sw4bNs/MXYdQa3IUpiIEAB97dh6j7evym/
+NGI1sCV7BEQAAFqRFs+8zbzDD85lFnoMbWfRDKGqhQKHB1a0Q768yloeckDL
+k/G6yNaB5idwREABEvB2CEa0tLx0GVEZGmPDUZdXmImna8hF5qMofnAWnTVW
+GK/6Gva4YMTJgCASautQBsU2CIiAGM1+WiuF8zaUlJxLl0pO/VnyBpBEA/oB
+1fI25miJb/n/Kk0G4C+/Q89VAKmJ3I1yZtell3D33nf7y6cv+bw4S+ic+mE5
+GACAXKG5b31Lg0GEzdxgnxMD38xfor2fjOip8qD/S/B6/n7aReITkcAweYwD
+SF5fuxkREAB+lBm9YxvtNJjzCl6h0pcewOitvww9LNDI0GXWJofOuxDIPmoG
+r1ygujGVkbQ0ytDdfmE4JmY7MdKi8+HQ677y9xbXWu3A1kE4TySss/SjqMNt
+Ob8JbzVNzw9ePJTY9ZXOrZ3TGqaABAI5p2rx3t1cbE1eZ54QIiCYrmPb2sbf
+Wq6VC75jhFJj/3jpud5Q1nCbJpJrxk28aeKoZTNo/5cpfvk0/hzWnZlvb1P+
+3A/h77s2dqgEkJ/vseP+3fM/eOekkAM5R9r5k5vOVtEOOoRMxWH2bt0zy8Fd
+jBlfXr8el3vfXh7zDz/lHce051+b3Ps1cWt1iLox3isdEwBUFLLFKqwRhWvl
+aP8Rn737y5/tZcmXPJvg09j7uX7uSSRnhyj25TIJSTQN6MxSqypkFYq8ben9
+7F4H3tbiMZW/x96Myftf3N77mjkdirV9oyGBVONVYZAZBGRDCqVGG9OAVlWq
+rBss/U/hYux5vaAEBi/tMXhcDN/1d/Z+l+38/Y+O03KHH8IaSjIyVkvFJS0S
+koWhs3DM5Ft/U6kUPNe+G5b/VXdCiddvh3bo1udr7fDZK9hNIXTX11UlmbM1
+t9m2f8jqwcPeP5LuZ4dOGWObh+xuzMkrHPllWE3BmmNLTGFq0nyjxw6piVGj
+RtRha5w1k2xJJ/AZLqyG5z5sOj0smWZmxnEjJmER/BkkGEskhkhvQyAqqKqZ
+BWWdWyTICOxXCxOSxbWvjsnNKKHjbiigwczwOBIP5Ax2elpaWkCSYItJDFYk
+UnCWJYukGPuv6Y5O7Of3ebf+9v9XBxV2v5OFISFLLLueXyHLUgYpGzF1C8ys
+VcFbeDGFbZMEcZGJIAulzlMuf99Or+PVVXK+x94CSF+P+FKCSFrR9Ek5ly2c
+iY1hkxlHELlwqVFyNZTz3ig3lAUPHXn+GEHfjXLc5+TBJIAh2Z+Z5JlLLnHI
+Gm613DiJiItp4OxGOmJHOTWrkDWW7TuQ9/Q+/z28XYtum83bugkhXLcICSAJ
+ZHRREqlySUkKyjI60dZcGNMjjyJFWrHf5Pf+++y3c+ST2+k7v/cxricnJJas
+hGz24ioz2ziEhMRLEyCThBISqxeKn47KrFnHx2IygZt+5qcOS4eSeSYfB4Y8
+XCGRPFDIijycMsYXB/p2fpe3hOx86Lz6nv83J7vAxVwavAx92OOPYskkljEI
+izKEpsTDFMYxFER+iUlMGBhpY67s03RjlrbEaSQBubHT5Mn42A3NnMrSxxsK
+uRlk3tRkYyqZYVRFat28sjxWYvAt1eZvzffRz44+97fh9uaX6Oj4umwdFlGd
+n+EhcLhUcNPnHDinaMCBENJuX6Qc0m4zuj4O3z9u7QT+TpM/Aon0XOHNbbZt
+MHyuYDGpw4itkSYPLRoPcONhzdXlfa6Ra5RbxcXFxcmrlaxnx80KxGyqs4rV
+qoVcrFDFyTWxda0VTlaxbqcfzW23YrXnZbenuSEhZ34usyMa1qSEhZI3NMnI
+lJYhhJmkpKZBUi1CU9s05SStWxavizsUAQHB4Pw7HBX4ssf/DxAkhdWQtys7
+cnIyjhsJpSbaIi3oD2J454x6uaBB79C5aOgqYTz9+0e9b94+lYs9aL+1jl/G
+VkEkLk2bFgwl6zt4+Pt48W+w3+Bv8cYM35vt/jGPjkRj46xzmFjG0etjYnAi
+6wJIVcONo0eyBg5E6SQAzsYASQviwj3vT/GQg7Zi6RUhA4RiPRmj3ER14nMY
+tQeDGVBw71OmmBJCwNBIA6YSdlnhyuXLa41VWprc0ymkJJeVygtKQ1ZFJVYS
+ZTCQypdQYbkxq/lejjdJoaidpH2d22bsNJzk5sySQBNNa5bRoOWkPetGYmlJ
+piSXoEWScgZolqBDrdn0/F+RqTqfrMQCA1NqnTpV4KLunSkkAYX9fTg40hk5
+FPU06CjLDAYTMGZhU/m2YmbJiWc0oZCEIdLm8Kjg0KhAIDgn4f894AgPTmzj
+3yNmllxEkgBo1g1pyRzi8Xh7jeVIk5qaXi5tj2F0nqT24Pd3QchIAdkZUDwb
+elPper1UJJAHWu9vDpT0U0E5SUqKkgohhSwppKaabddFJX0VuBZp0Szjds7B
+jsv4/usvxY6x0Y+PoaGgX56/w7FemimWDU4YVCIZMSJkxJKzEYRSy1BlZki4
+hISAkhbyJJCQsSPweyt52GvIkkAaHZ++JZf0cvP+C7d0puTpDts25rTbaTB1
+s2GL5pbe19sfBMZFMMgQBJC27hFb6Oz6aKNOe76NTU6Rqaem+brabt0e4eMc
+8vA1XpBhMSSy1q1atW83Jj8VyToy3NK3sy97IyUhIUkvommz9k7RKrc0cpWi
+kyTJat4TLJ28oyfNNVkyunn/JJIow2M21LHHk60e2mDCMqhGzNM3kMIyKUlq
+RojjjiMo3kfcyZZd9L19/JJF9XhEpwJkhAE02j4juZAJIWH0Odk5xlQU5wiB
+OsrhUlBRp2y3RERFC45RSUZ9Obm/S1tOYXCXqdrnq5TuW3t5cO8/rj+5BJIA
+5/TbBEDjVBwPCaTNizVNyXGbM1jel6ASQtNPavVMrXWtzfT1Jpo5rUs0TCaa
+pN1CUa20DiIYagNMlia1ajG5THDHO6XW8oJITgSQrWE0jxdPDTSAICgSQBo0
+W9mvAoniMqJg2DO6NJxxMNHRZ+eOdM5ze7537szeM49MuhoaEymt57nRNzpa
+uSSEpUOcTHJaNJpjOCUIzUM9NO2STE2rU7vK0HJCQnbj37mkdfk/h0bM/n8W
+pcvcajzswQNQetuCIGCInOPO1mplqIpoKTAwYV65qFijLMuec0TrdyAOdoez
+g8H7jMVEHaXOaNai6OGhsPeNDCPGDInSykpzMEWAwdtxgaF/dutWm67Nuu59
+yWVS3LeeZ497CR4mjxtsmUwy0awwtytbFMpvFtrR7HJw+Lu4KRJAGn7OtyK4
+AgLPyWCvY5GC/fsWOvY69njlcssLNcEkLMLDA64CSFZGFnLVk1THWNjqpmDD
+fY2pvjeAw1MbMN9Et8z3MbGslna5/l4NcNMr7QJIXBr+mxx+XXs2bJ0zmbeN
+jKyCSFnGcY+OmMGa9gsoshZLNnbGY1lMslgs02GIBAV5/fv9GCBAF54JIXP8
+r9V7+u36MTWxykhcIpAukohJCuzRKYIyYZGasiVY+t7nZuc6qZTEut8fu6Ut
+arvcir3DRMo7UhUDJJURmSRmSVapVKoJIWSwqs9uOoIQBW/pfJm9Tmh+/z5O
+n7bO72lW7XQyWdDPMrPNkq1DFC2dYt27dYZGRFaNRgkhRdatUk0Lnp8ulNsc
+zwDTS5je3mdbneOEE9y2SHhL5boKaSktDLYWCoVy2V67CvSTzzrnE8ROP6vH
+Qkhe5p7V27CdAIBk85DjHnnekkAOmq1ZBhWVZZQVhjDKOCCSFaMq0b2IysXt
+YuKCSFis9n6b7jX+x88cGaDSvLQzhnzgaAHUs6F5nZwCIgTacDNADQM2G1od
+XXIGEY3a2O6nymPjnOx/odH2sY2cXYMf563rDel++w3xfKtVRHtb/f7+/Vq4
+foezB5eZp73i4ob/By4/QkJCkjMMZ0OTk6WEJkNyZCUI1LFKRymSMm+ZiKWp
+NLj7/tZtR/Ad5ASQvl4/odnDw4XH5PCHgkhfF2XnGhCDCChA4gWge6VDM8eP
+lO/JGyTV1YwSQvJxu/x+Hwyb1zJJAHg8/Xv393ng7rOeSmpDxlQ2jVXBc4ia
+auZCoQOOoLB4OeRMpW1XzCj4/j3Qr8iHm+X63Q6D3OXf9wif12SvTn5gxZZv
+ABAVMB0aCfZCiBBZZ0Z9kxGD4QfUi7w/4+f0tggudm5vO4PY4Ow3MckkAP5v
+mlH9qHOxHk+vrgJIUCdhDNQxdlZtFHBG080nITsOb79Gxm8GigSQB52l37n4
+G7m5045pfLUkKxfjRHGdRXhRSxF0jj6mLi4u9te18f0wSQmbhhtbkbNL17ng
+BJCue7vdHbXzyI+gepfQ9pcnJ3uQYVvcmsZBH6tvT+Kt2Phwx/N78fa27Rk4
+u1tb87GRnhw5MkJSYmYGSTTKbhraHYg7nti0Hmi3zO5HeC1bBJCkltEvgyck
+EkJy4Zy9AhCHE4vTus6devSqKYgveTEsbxgxlexY39FksheqKvXxK903ljqK
+x+YskXDsnUs2QZe7WP4Ode0eBn2UhAFj4LGtXr0168IqQioITjIDGEIMNBXb
+zIOROxJCQnBM53l1oHvz5ffppQkAd+nQIZbkXHXfg88IdiZ0Q1Fpo1NGyEzA
+4bbTk1JIA1jsTe7GNa1sq7P0+17zS1a236VzsPNh/W60ONdJ6DDxlSaZfrhp
+18E5Sqa4w0ywsTTLFnLNPHMTm77GVmv6+r6vRXSSAK+X5tr5EhIWbSU5mpwu
+OrNmuyxTmlfplQqERUYWFXVemA7UnIE5OzeOnJ95UgPd9JCSE6Jmj5XJvk5l
+0h4YAkhfBzJjtbQ4G7TH3nOeXXuukDiT6xeGDKR8RTUKS8QK85PhKDV3dWwC
+SFfv2K55qN33jl3z3vRXKbrJ+QMp6RhKcCZha2QIyOM5rGDDkG9q4a1Tu91S
+Znj8fO1uTncle47tOz+S9pyGzSmYNmmwIwZiQkJl8YXzn3yeIiJ1OF5hRReo
+fRuw1WAyFvq3C49553v5A257rIutt30hIXw00U32jmxCSQmaJpN0XA4iBo2+
+82ubB2k/LZAAQD36O1B/HgAIDxXfQ2WRragJITci5oza6lJspjGoyjSHBrjr
+e4PiNx71pu7Huuh9O/s0eOecf1rbzlzc90LvQ5UJ1hiqYCmmnCkJCv4As7WN
+ZVeziMyyyWUwr3wy2YlnEwYLNixx69c2Ox9OkyzQ6ej8djMs2LGXZsKL3cap
+XsYyxuWVDEiLJYEkhV1sWCjNsxFfNMagnZYLFipmbzvkR2M3M4PB5Xd4LGcu
+uhIA+65VBstzZlE6PNHCSAGHK4QwqNJiY4XCURMNZEkJITW5swcKYmG7JMZw
+3OZ0lyj4oeTOgCSF4J3gcc1Tg7nmzTqLNZTSkkAUu7ELtQeXRhUnuPDeQouq
+dQcToSQnG0bRS+dkIeLi8ii/PrFCEkLWpoOfSG1OduidX79Hb0ShMh0y80gQ
+vUXp4gEkJ6QkK8PmUh2iPsxyeaLz/c3ttksiQgC+zdrJJAHxX4tmt5GXtmWK
+tfL5GSML8cRWV5RjLauhFHduXZlNMzm3Gt4tuTz8X7qZJvhuFxu5w/ic/xuh
+C5UIDx71oOMpi3B802hFNoTTFrxnXufHW8pldG1WrVs4jK1YrZ2cWi4ZxGMM
+6SsXC4zaz2MC6lNtNOaRzMLslzuert3wuq+7w/Wh6QSQoejyNusbu3WRO6Ce
+8vYS+nEIE5+WMJfVJSUUXyfqz3iijyXq+6yxTQqDS/UenDY6Pd+L0aZj18Bg
+r9dirkRXr1DArDCwywU2NOkpKDLXSOPOZeoRcFatiiE/RgkkAQAEB+Q1rcGm
+CSEwEkLvdqOXvYKmFo3EkmGXiYwRGAcOHYE0aDRgX6kmFikaXJeL6ObLh6rA
+8Vxxz/o8p4JIXj+C5CEGPc5qdafNaa9xEwtSsHuqPImJ+EfAYzCTmUUbxIQB
+73uU08rKr1+5XCkpZ9buTbOS4a5hkOcOGMyE4dM0mGsGEkpUbHHGjqVOLLmS
+5n1ASQnVkkgD68enqe5a1crodDp3IEw9kqrDUwZlEpk5Q0j3jMQyiU25NXzd
+lrW8ncc25Nw8/j/Ja8/vzTTeY7zXTaw0uDhzGFstqYtscy0PLZBz2Pe98x71
+q0CSFtfV4fO4bJz18M+l6uTOfRnc8uv0HhrvNFMJyIffYMJycvsL5TOTlFAM
+iv+c0oQhDwsi6s97kza2eSq52W9/6je0zcGP7RppCQnOTXMUl8mimUYSokij
+JGXOnNufU+N453L4jvCqmC7dnJ7W6E4hAEHvfy9HsloBJC5kEJIT3va4tLKT
+R5lECGI/R5+jRiOfx3XHFy58niDR0Z5+WuxOszMpFTCcnHVJyHbxGEDOJ9fP
+Jy8DyZhAvD8R6u57eU9y3HiSAPiuXWa5AhDWHPW5ASQBhd8WkSku0STEsatm
+UEhaljBIAytCQj7K0JAkkGfUtWo0kgCt+D0pFGkkAVsnK7NXZM8xYtZVtYYy
+MyDPOGppRhMRZRGTTcNiqFociJw7JcOcAIDhZ0MrJyX5MM5ZxpzoBAT29Po9
+APJ59bDXuJlixYiFY4ZYCuWFYVDCwVwsMr2C6iKzZzxmNexs9hUxsYAQGwzr
+2MHDslix2l7/wY+Nz+fj5lgr5fezPD1THs4yx0zbWMs3H4qsVywWSKyFdVCw
+V4cIfBmXP0oZnyvPZB3wdlrUkgBkke4CSFh3PFHMwrSEZEXwv4skjCOOO6rp
+Ec08ymG9kwDr2rBkASQr9688AQHs1DYC5qP2DzfJCAJITufhNOdzzTuJo5jr
+g80yBEOCZ2GJqb5ZvFym/KCSE1vHmQybD8rup7MPSfpwl7b1pm6Q3gXql6E5
+eoKheipooYrs9N0p8U9HY6FPXp4l8EkKcvH1u3XSSAKdGDME4+/4tHvwoYoQ
+V8ZxgnqEjYGBVB0AwD23xzW3gEkJ19zcS/074JIXodyrpKTazuTocrA1/jYQ
+Hq9DlDIuKaTClYCkvvImD3DHqo9vQkK2l9X16fu29MuemaO7c0sWPWZ4iUwy
+sjkZWYYtYuGGIuysrXRgyQNHSGa8uEu3PW345tK369lP+rdTS2uYdr3n/Hte
+qE7h0bLl1EOJxA+ZiE/EGOHX1gTueYIMOc/kMzH+F2DC4w4MHsY5w2aWW/NJ
+w5iK9ITEZcuzEl3eDbo7eJxLuGy1vvdqJ8V193sXeK+4wSQBoXaC74p4bjnb
+nOdB0C1cuDVBfMJyAwZMZ5rsKL14nvTxPg8dnXh3eL/eeoEH/D7L9/X2qOpQ
+z0RDyhXzXKk5PgVF2BfbgGGInjYXucMvviCpfd4Jevr68vm0tfyxsrVeYR3y
+rfrFYVwrFUuYowZomiYvT7mLW6kdQ7kZ2NXybMngXQPbPNW+GPjR+HomSVis
+MYuIMjMkjkOIZREspNYMWVMN1TVN0Y/VhuxT7tFE6AQHnonueL0gkhem/xK9
+c6Grg+Sv75u+/ZOVgxlZosGELCsqkiLJTXKaUoA57NF/IhUd3JuRLGgEBx/M
+c+9e43elO5N0Oq1rWrLHbQ1NmY1G6Oy5zEHmmT5a5GAy6dQ1OvTl5f1NsEkL
+LBJCpou09Xm16aJ+PBohAHGmbKVpJGGFSXSUYwjjI47ho9GXjXWTeOSVgJIW
+kxnXl92Xlx3LnQ41ya6yYUsu5xhrC1JLaJZjQON1hzBukugVHj7UHO8PWtv0
+fT5ebtUbWClnVe52ncNnC/CX34S+sE5UMM4Yd4yfMMyjlk5DjFJPDg8H6/9/
+5Je+fP6Fa9me5y+t/M9z8TOnn+2zlPnGcp554hjc0IECAs0GDJzkcqKkqPmb
+zemcTwW29zsG51NhS68JJPJuUkt4mUpsDBhKTMJCaYzNgHDZZNjixXuL2Jtd
+vT1NfixXdbw6Wr9F6wSyvifxBhcvzt1SaX89KMIhhGiO5ISM0yIZL45cM01u
+X2Tczmd+7+dkI0kgDdrH23eZVKpVGaeRW9sYqxi8BYpH9vvuFVxTesGb3xlS
+Sz5VUw0q2rjcnn4FiqDkut3u7jW3wakxhn8ZH6FbGsM6ItnK8kXBIBUJjRkp
+RI5hvgZZYYSZKAyM7LSywtIklayOTZMpSc07dWb+WL6cVVzWQsfXk+co/xU0
+z0MpZtU12HCOEMDaVcp3Q1CywoGFJEGcu4ZAUZkY1hkCcrsVP0snraGS1eh/
+6aFnJ0egjfTtbmU0G85OPlJMk5InJIiiIdAzj5s46ff0FBAYt4AICf+hP384
+5Pni9diwOY/h/ACozFwuFmpLM3MwkIKIBUQZnQ3e0Xf5sZytNQUsjPfw0Uj+
+/XYfysJqmeg/XEHnZXi6/oxRMUPUjcViBYmDDeNMKwdR9MRJPVjXs2RvVTQp
+JkmUmc9Ttt9n4bw+YPWiCAGdEdTEul+V3O+sCIgjNO9qlp6tB+7w0Ohti9Ld
+HTokSbe3CSOJKXAIiIADjSCd4Q9S11Xc1WGsuDENsXmn7Mz31zUMhyGXf5z4
+4xPONIiIAexKX1f7TXTvu3J9VBy+LxfS2ZRUDLrChBAB6El7lW3Kk3VyuVtl
+PY6vdcSGideogFihOQg8l94nczBVAPs1WrgNBoHmBo9D1vjXQDDq/gs86nQu
+8msk+tgOdDungUQsZMw4M+DAEQADeAw51fFvfiReggIhciCDUliPl4Vz99Lp
+BJAiNIsoo/B+wxTM0Oe91DRqLHKnO4nA5+qn1V9pb65x7c0uKyW8QQAtyfv+
+6wW7pSWWVvfLiKhzTwlH4TjAiIAD63cFd8FP9EEsIGxdIdaXsr57X3VfsZ8T
+NSGVtN5c2ljlrwC0IggBh4sSX03ac6LE9/FK3vHZbdkZdPybAiAH8FKTS89z
+62W6HC0f+nj0QqfE/DGU3p49/r3bAmvBM/OjY+N5SwjiwyIiAA9gefA594aw
+YHvHfeu3Scwgu8sURTWGATj/eHMoaFQLQwo5JyOqi8RD6RBavm+MMfxftJPZ
+vLrLf7tPeJsXitxiMTkcX2UGbs5zTYW6nZ++G9YH+wwr3gDREiAAIAJMOgk5
+bWnL5zBBANxeYnnDxfo8TzMp80cw+F0aqATmY/tV8iZ2+92ihocRL67N2u9P
+W6ViI7o4kQIACw9LElNVFUtzU42+dXsfmG0+cE6QTtYwhNH6F+f7wpXqMcny
+XVSdzKLJPnTIlYiTEZViMWNx6aAgBQiMT4ozzGBYPCt5KXF07YrWe4Xmn6xk
+lUPKjOLzvu5F/8XxQsTQ/mYsWNJ2HI1YJDyf1k+r0rjrN3E5iDMPh3n8nrCm
+EHj5eZf2WL8Pa0GDaOjZiPUuwXjwEAFLRFwDf7+ehgSJfzNQKm+5/LyzJ/6v
+kSymS2tPyex8Hi6qNq+QUjIKIA3CbHz6bY1FJmHygoNE4eugb3tt3lhapPxP
+7+j+j5IoiIAP+DNpIwx0cvj4eAp54B0IgQAGgIc4317E10rEYNorSsgnEp5h
+/2fQ01bZNLL0HpqkKmQ8jhQj9Ypf4WC6kQRBIJrW3MXIL4+frhASBAOnZ3Au
+iiDEECDLi3Pf4+yNBAr39lwfpy+X4HCtm3aabVpT6dIyYSZZRFhGTFR+7ZK7
+cnR5PL+UsXS3f2kgVHkWtr1uMqqgF2rmd6y96suP13aEfIxbs5kzG9iH+dEw
+JEdSvWAsUOMViK4iAAN/RuNfsB6hqqzqbKv93eX8muL14zArUuFym0jTHdts
+Nha1UAx5j4TsRBAMfCA+rR7TO5C3kQ9+291EFyxU1mMdaOjjtHAWv8K9Ic/u
+an69Xj0nWSjSwIiIAfzX3wJwlLBrHNEQgAPrsKUu4RwIEABKGITHKp5o+DjU
+6OZmUSNEElnqEPcRRESNI6CJ9N+NJEoRpB0Ym/RhePpUUuYOoQozb1GNiCJE
+vIolCLmKRohdoqOZ8qz43PgSQYVLbNY6zKH0IHoiIgAPVqdRqXYvZKOUZbaF
+wDg3y7glS5wN54KyEFYDSmJOCoFRRVNsqKjMqVuneRE0yteaNWcolzeOD6PT
+iYhSxVJERAAbdk0f9v36px2MlVmu6pTxWxERAAOlQHPWOfWcXHpTEwwRcDvV
+t/YQj9y/zs9origREQA7Pp1nXvaL4+a79RPSrEWM5ohRWHIUaGseiwsPHt6R
+53ptQzyh6YtqMby8vGKxXN/PE/95/T7JEL07xDT32m3/Bms1k6s5eb8YPbFc
+f2yMBEA3gwj81ad/rJLEe5tvZ+/wqxrCsVQCs/+9aUqz5Ftjy2Ec71m/5JZJ
+bOnOylIgcDdy5FtWWQ4SkI+yYKdCixbuAUWGXSwdORVtzclMqnG3pSmfBuGk
+xmOcLHi1cZqO/mabNNkwUJn5EtLIgiCKvIzMLmjZwGte6td1fQWud0RH1azE
+SP0gCi0NbWhFDYSTYxfp/5thCGgslmshZIHJwcLuqgGSqfIr1l7M7Tf4L37k
+EgEBUA9P1Ziqo56e7/ju1NDDJqoB0/xOj0dRSfNu+DguZza2tsBr3cioBrXY
+8/n+XuD4Y1bG1s0ogHAjGX4Wxqvw5Ju37REA1LEw4KjEdd81PLOXy8vit3KK
+oBo6H4ouL10sUXg32KYwstDExmWMvtCIGSRcVAGSMkRpAP7/fg44P+S0IqBi
+3/f+CFfjICIgBoITMVr0Y+99zZX3cW4TX35bwz/rdZ/3Dfd4KWuxLDc3CiGa
+4q8Q7cLCrsQ6mttFlxaKLs228a/9bLE2RMTsmtERACE2CzWmE+qw1JtpbVNO
+MuDTRbHE6bDl2tg5TXipN1Jg6dEmqRx5KGAWHQ6LnHl8FFzjzITvkbv5DIG5
+l+s2TbvKdu4QA/pckEQAuSP/8xkmXjI514bGzYXoTbcrxQ+ZCeNwAQABjAur
+ae919/vH323J7nJ2FkuS9y4wPq891muX0VB/4DZ1JMpERAAejdVFTqt1uqmk
+cG9b9dTtW7CvsLBmMJQyoQnCjRAwhigygdYUXGCBjM1rneCrdjh5DD+lkMPS
+7MhSnR6mSUQD0ehVXqf/vup+8/2qaOpk9USJwZHS6qQzrbTh6NSIiAGqKTYv
+Lfb89IOHDobhFl8iybcUcoww7ojAh3UUqRMGOdqdFvxtMg43uwzkNI3wJrWu
+LjC0rNWmKABEQSHu11a2sgcXdcSXJQ0jg9ZEvWesgOUxqj3fg8V69ani/iW1
+AntUYn39bV/3fgKgAQHof8qS2a+itH6/8/h0u5UUazvgVG05q1ajzZ+McVm0
+UAm4Gq2Rpv8fnsdnipeelc51fVWGSBUcICoxMrieo1+nle3svbqKNgBUbNKS
+nmwIDAnTt3U9TKkrA/8cEwL52BC+OVL3e5QysInO5vG2cph8mGll46JpVUA5
+d9/mX6tUUd164Kj9+aMtT/xfZxwYxV72V3/+r+/4Xb459q63WydRsC7pNhER
+AAR7+OTT3nrynHZ/MtTOJ254ne5NF6FzAWx+x1IIiCcfUuGqr23pLGUr+mnM
+Smj0REAPqicZirg/pfL0fVr98ofyEgx2f2Y6sJF8EWCIgi+CBEQR6PvitGBo
+3QFuWzlBQxaH2S1UFBiNthi8XjXzUsoo1MgCo26MAIEXP8r8LZ3JKmfo8hkM
+Xwt+Co2cFRodn9Hv+PZI37ZCPo93r5vlmo9ijdu4qS1dVH11EK+P06LezvOR
+0aabMJpnEhs3EkNibVOIMH7VJxFfa0L6Rx+6Vq/Pzl8p7fJ9h19w9XCkmSfA
+54Kj7wKj+HBwCij9wKjS4GJjM7nbxeLp+HuSMkw3M7ci3SpHkeQLLHFxCzEL
+c3HE2PHEQuRbquxWG53AVAOsxsf54WBhsigj+pt+xtNw9uv7FRRyNICo2s9S
+8bW93uguaKAVlf8K6VtsBUeMCo/dfJrR4DP7js5b3meTAIggB9ULR6ju9zlF
+ngorKfrQ/HfLq3PowSIIAdu0t/awosY+XZdbOupo5THqjqeWvgwVfkREAHc4
+Oi6y08WzQdVQ3wmeh2DUkcogHg1HZYLJ1Fe3esz/xav/hd9ZkptrrRqoBXss
+YPLmhKM3YPChZCE4BwuHEHu+fp7aokkb+8900ljbMJMJYRERAANr7TDtx/+P
+Sgk+FeLXLqOtavmU3PV3BA1RSSO7fNs+sR8bYHCkzoduoSeGMo0MYYpmZtEC
+ZjhhV6epPLs8qoo6MFR1Oflc5yZi/+tyKy/36+npakvz5RaavC9CY5XIlvLx
+H3eTyeljrReKiUsdj41gBUd6Coye5vPz5nM5b3yLacDb4hNuNFTZt1NUvyxp
+RmfqumpMtWuIeE3WDDfGkm+dvwq/ra7b7XCOAIiBOvAo6rQO9m3Y7HHOrqRE
+QAENuEnwlGR4y2yneHo7rCcu4R2tOdu3XTOaV1xBEQT7eOVj3Rvc1KUOQ4rr
+GVRw17QXmw37LDgocRyF9nFZkpDzPhKcrsPpyRBBAM0OkOqpfo5kvxyYevlN
+RYDhbuYx19ymVu4cbI5STqO+l/T1vsqKM2CozfK6vYUMgZxxaKAUUA4qY+18
+b2/AERAlIBEQJmoo9NA6zYRUiomIJastcv9Lj/sL6FevVjfV/0QAREEX6UAg
+W8nJkBFEkfdKQdMVxANCUoPS9fP+pC/DXP9R8V4o5+eFQCnoL7OeP/WVkW/y
+LF9hVAJ3e0AKjKgoAJsNABEQJmj+GhKk7FD09Zo9VQKRrfeTG9JNZa1H4K6q
+hqVeO9GnD2czbuipVmXvNYg+REQAER7d+NxtxYpT523eZgI4wvrNQRMfTtLx
+00fuVmmclOPx0LJ6+mI+HChIvWkDvqXYri8dLLrfXlDtKg25BWH3M4R2FQn/
+KgQJw6vzeFZF66+7Udj91qvsl0Gd1kt08Mi+y2UjcK74Md7GtxNCCIgldRAi
+I3PG3bkd5pMPL/bJf96/4lFHQAqM02re8/ne3qaT+Ji52cm9vybTGafxicJv
+BhGGZmiElNFRxbNNRvyhaCLBr2SZs0GyianclenZySgQAIiBP4fsttHj0S5A
+iIFec559fWp/c84FdLW9T3mOQS81R1f6h3R/rQsGe+NsgiAHN1QNQREEm8it
+Is6DktGiYy2Z22E244p3U2bcJuYE1YzSLPeJgNLNbZmqkZ1hNK+FZEEQSU7e
+PxuXovP/dQbf147ZmtsNgfXv7tP1XJUUetBUeHv6bL+Xa8bIW6Lbb1k8ne29
+dOxNvtMoXkFEEvFM31q0v/pcNqiIgBdeYbRoYlRvSa83zWo1IxgOptO6oZis
+MuHjl4e3IIq8ecWek6mCE0wcfOZzAIgAJoxUE5b+Vu9kcVPUtvD6cxgqrdIK
+9bEo/fiuIxK+7lO3a8XQT7T1JZirp51Uy1/xFz4CBAAN2cz+LAXDkKoB42i4
+8yqgGuyIKjDmAqNw3t1chh+ytfYcCQzWLxZ+z7a+hryGUX96EoTdz6x+VVKR
+yiiI/21DE0Mj/vIarB4mwop7h0ddIJ8r6zmhsxMhZLJuo5vsD1arLefJ+NO8
+9ayo9UZqucpERACzOhFyX51f82UKELh7pOi2vnPW1zsk06a/h/l42jj8xmBG
+yGz2+bLNFckREAB+PGOb8rro5viXJ3O3xMLvZOv09A9n3lYpZ6p69sn3EWLi
+wGAy5NkMS0XLRHJuhY3UKGZsUnoXxaJe6ajhQ+T14uEG4oI6FnP6HFsWyVnS
+uWjTlIgiCSwERAkei98z0/AzTcw542flerp3bjzF+7/Bd74HIwXgyPZgui9o
+GG0f2l/LHr7AdWvlBP0HQOETs+WgtQKYDAHQs0mycGzdFpRtcXDbb2bji7jT
+WrkAQCS5Gi66ljva8WrwCqAYDCZHrgVGxAqOhwvlZv+nR5PH7ujq6pPzXf1X
+qpuu6eijyrHxN3sEViXQa2UHGA15IJECIF0F5k4oWgtrZOy2HciFhYrMoNKX
+XTPxP5wf1E4KNENkkyL6ModXZmyplKxUtLuKhtovmveGBCB7+3Hzv1bLaKpN
+svqXlX1+k93o1OE+6hZif3iXUs+mnYSYj9+o/wAiIFfvOsNT+t5wk7m9aa19
+tRAOkkbqJtFAL/FBUdD1Hu7b4Ot8j5zeHEsePebaPz6e3utLaS8M3IwYEMdQ
+ylKaAm1tThxEELm/fcP3y8w2SNgl1TNsefohoSaawgRAAbYlsQhl45eu7DoZ
+LiJQlcXGwmEpWG2SGTQMvZwfRsbPDaiIEQL/UYBEQK08NI4/udh6U3T0DREt
+P2zAj3K/ud5XNMmjMmQl+8TS9Ke9fRP9zjjkIuODBE8VRtchOBuMwQwiBSku
+CMxtejqiwhaKiv+AxbqTVFf41i77EmGMVWWfO1wFR/OhBUa9FcdFcWqgAOWw
+6FRT4MQ1YxUsNg7dYPxZ/NrNZeLKFy5U/EEREABZpoeIrJTYRK9ObCkjZhgg
+JOsQ+SXJJAIiIABAmxv3EfGUfJ1NS4Dk3nm5mB92+MtOtEAERAqCDp71Wj5G
+DqalP8vqfirtOx/X8jiShEiLtIwjG9MEhLhUiICZKDVZxBKjHAaHeGiIjBJW
+VSwcK7430475MNnk9c5eaHnu0egUqEHY/hAnVIPTLcU7fxkL1TVc8/Mz9LTX
+CEx1omVcrkx/gMLGZmzPpgscNqcEtWG9Q0JgsZH4se/MLdkD4DAwefOqGckN
+W+Fuhzifc7jBF7c8/UD88cR3Xp5DWrXJi5IWqInW5DhTXvw8fbNjZWdTrXeB
+fUlXMefPZ2YmnOOtd3mnHfczTal66vHRIsfNve3/n3Pq8twZECIF3r6CIgiu
+7P6hs7dklmh6XFD+Ho9eNI03ru+JSFpaFJEWgsCxgqMesip7J7PXPUS9Hw9E
++xOLftvp11AiIJ4wREEgn5+DZQkz/UyCo+7CeocjxMjdrCXC7PgCIBeYMC5b
+zMVNzjrkRMQcGStPPoel5mxTMtStl62NjTdNDRjO9z7S/sfrAQtFVn/XBANP
+SbaSgbkC13ra2riWmNil/5Q2iifaqrgfq4f3BYbXVq0lpMiP8AKyS52IAIBI
+AyKiALIsZXWnfUlOxsdm5HG6EO7cQItykOB+Jo9sdn2mr/KEOiRHmf4cAiIF
+7ba2l7PJKeHw2h0i2Ndh4sgk2aAgBBqBRORkZkR65/Px3txGw+D4+dnNYbB7
+KVzvo9Fs0kz2ckGvo898YmbuZvj8Df79zxc3Oavcb1oUIgjiOMaR8+1QrjRP
+hmogtfDg4GBwpochsSG3FClPiAP0WPdgG+Y9bcwq2eqj38taUTA98REAIJ9T
+tbK13CqoB5hZOj+6ME3453uSs/FBUa/3oKj7Wzwnm/J0uF0PzjvBqu2s28r+
+tUUb2Co5iWns++i+iqgH4eSdH6eVmSQ13t4zx72szaeoVElRylnzOZbNGCmv
+tOsS8y6OhERAAZyKiXTROndq2avQvs5jSaXS43m7HdsuJfd+oT0KjjdaZEXF
+qeGyTLRaVU5KRwYBWAXh7MxuwHPOaxshz/VIgL0iS+Qyqrsd9H0FSnT1AMfG
+51NMYz5dILRqaYi6tQygERAuqAREC4OiQ7Sg9X7d5Jvb7dtbrR/5+TpfajZN
+0zecdlja6rxZ5Zl/2szLfyWuu/62789aw38u0pBp72B1Ly1PDs8SmraWlYQp
+tYf9zuOn4Ny3SrqzwFP54kw6oawz2jSA0hprd4IEvQzHSiYvxfx+L9OVLbyY
+HGKoBlO1znLtlACo48+HWAqFHK3rw5LK/+gKiAZ0Wc4Uv9jbmszDvkWgQoYS
+Eatbf6X8HPMvXdqtWr1u/U9f2eKhnrBDEvSHvdx66FoabcrO9Cu3krcBNv3v
+d8UyfnU1vbwdMZo/KMZkLY9J24sppt0kCX5KuuoEzVELK5A3UDckze56O8wV
+VlX+8zRKVvVqvbSp9XcrACAM0l7wxT7H/I/8qmnTf07uP82KVHrO7Wu7e96/
+bTXT+c518P83OBwg5bDu5Bz3GdntJWfBTh9LqtbsdjE11HeOztdT8ys07WJL
+XF9GdSSDgaUlh0N1mfFzM9mgd0dxuTBNZR7F5Gt2zBY4UFlbM0Y8hWJL7IY4
+UCgyb3R0lJE0bM8c+lyHCedV5MHLV/bAIiBRDV1aLUXGpbWBcXPJXc/Rcpwu
+kv3oArdR4MgLyrr5ioddM3erC3VE69CPl8B4cBLEBdmqsWvcWrh+jfi6WwQQ
+AbxLNf7p87o3ysRWqfI/D8DuZVu22P23wcycVQDR6Sm8/Y1ORbX8sW2VlPHs
+e8JVAND0ZXsOdyeHlctTLRHxqhSukI8H16PMI8tYI8avn2ZEQIgXCa2howT2
+I8dGx9nzVhfLsTW+WVolBKD4WY+nJ4EsinMLi3TbvbTKytlLUPA9cFsQCIgV
+Tql+5+cvDbmk7IrrWz59V5VpYfAOi8xcW3ShVBRBERAAUO8GhacWNFq1Qf49
+Hm2Ykc4I7xaed8TIsMM4VVAPrwphoabVH15PJZ4FRzwKjh/Dhm9FVh4uJaZ5
+vYodevddjUfT96TyUOmIiIABSqlFL+E79vxPofImuW9h/f60cu4FjvPPkbMe
+0UvhGTkiRkclkqi71zMX6C5PcU5FQQDMlaWJzGW18OtMyyHGoTcjjg7YZrDQ
+PRjFMOjtM1Ttw3V1bPwgRnI8t7auoErEMT7YCMpN4GFdblZTUnDfT/tzYNZn
+5xxs15fvOFDGXxtNaIbqa4dRhtJq1luNOr8Jr7RS91FXzeV7zq0dcNEXI5Wd
+9MBJEQIgVZe8n+XuOjlXit6ENaTAqZ8WIXgtuzgn7YilCjHEfb/wXyIx/PhW
+M2o1CdQyoT2jME1Ak4Ncz+JT2YPg/vb+D81UiNrtKWOebW/fpqpW0Uj0cwE8
+aLPnskMmaAAQD8vy7tkZa7AODhNvDwv1Mxv8zPc6qvLdjc1AwOhrvY6DHMka
+8vLZ0EJMfeskMJEQIgTAJKIZlU5Zq6qdhX5Dwj7YIMVc78/leYJWlpOkGFLV
+/3Vj/SthFXH4pyPGJSMiO2IowOZjChZxgqGMh4O5OMwuS79ydfzEXhH1fzrc
+D7l1pf4dX1vDgcOXxXOiXbugVGEYFR5t7FQbYObzUoWREXRmYtnuP16dhu93
+jx8xMZYQQZ6YLwTDz+3q9RyB/MQVslSvej1Xs1yZNPDmOUwFQmprneBaawPB
+d3nDMrKgAiIEokd4a9UYTIJaAI3MUdubFbZ7dUneGySDqHCjo0YCQxgjG8CI
+4m9IZKDhLT0UBCcFEREQACQa0w1tQEr0ErCY9ghDd5fOOOqRkEMXJ2aTWxw0
+rrBsfK81vzH4+J6o/BqYgqlcuYzby4fzbLLuYABAC86UnuecKqSdqHrXTJNH
+9G5OMzwbo+L01vnQQQDmjE33I9bawm9vhOFUa+Q3ZsMb6k13tS9iZ44cMuqg
+Dl0Yt1VSN+dX35t8oOV5zo+PmV1X+u7L9rXSFqcndUkKvfMecXbyw6mxQ2gm
+MlAZNEhWfdg81CeTIbJp/zyy1esc99CeHlxR4YeS3SxYsFcGLpbIHcs7TawI
+wYhWLQCaEhFGj0ZxKghgh6wyJyTf4bzZJTBhzPlwyrerx3HAGxX42nGWyUua
+2rN0k/hi3s17GX/z+XHnRpdIyzr8aekukgSfL/cdqg78W3d3j4aNQQvLcYid
+743NhpEQkXXIlDqR0uvlkDHwo7tSuMeiysq9ZDvVvJek0NarpkA2xCf1Z2RG
+erU+gdYaf0LXH9uC7Nar9vT+DOqy0/avqrOw2kSiKf20wNAooBmHIGTSZBeT
+hiX04XKMDhPliiLEgIiIAYpJowGLG1WvVxl6RlWfUZNFoj5iIw2GqZthU9uG
+M46yG73UgjvtVxyX9qUxruTigrLPwFuvvz6rSv+WLYZcU3EYWHehMtx9UF0Z
+NAW/3Ymb8DKV3DRTOV/nzc/bMVq1FG2gqPa9VCl5XAuu1+yx9DnM8VYr3Jgv
+dK+8E3dZTGkMEQb33xGVr9OlQPNEW1j5oiIgANuo/z9JXxVerLMQ9b1jtZbM
+LFmq+lNSv9PpHbNDjDj4swUwN+W/OYgREABt8LjB6scLlC7tujKscDk9Ngcp
+bSIx/TcaUiOA6VZLzyheHPm+K5+eZBkcCM9Rmbl54i4/puU/O169IZAzVaKL
+5cPCKxAnqfi9bKEOpkSu6FdffkFNHuej/w5AkugxuutV29JJbqUGz4doH18d
+NAhQ1T1e4ZjsR7bGxYROZO9MyBRhZ7tTzaHOel8WJFz0MjuLo2ULCTHNRaC1
+Tnj1WNIHYZAAERAvSGyS1SRLlfujzskNg0JDRzzU/YFR5x/8o0PCMLoSoIpL
+rK1ZmD0PG329l4yJHJzM+spZRQ0R9o/HdWYCItoZOaKido6VFRRf8h4qT6Iz
+jIyKCkh3W3ut2Mue7r8cy7PYQKbEqREvfnHt/aXRNqNhji3cwOP2YHeNYQxd
+M0KnwIzl/nDNZJpmR3DTL4mwi+hB6X25WGCKJAf+DU1jqP2KEDTPb32eSJO3
+ubQNgbxtEf9DNsW9z/gUclbepN3jQpUqQo7zyF8WoPGUjfZHttQ3ykGBq2CF
+b6osRdxg8GbuZgSkE4Rm2fhH4W6aK4fJfjTsnkVa6efC2m6lYKAIVlZsIgiA
+HNIXE9GyVbgmMdn/glrtNi83QmXcoznrKVQotPfvb31z62OllRmLlkHM+8+q
+m6U9a20DVvgtwuLrGLQcs8DQlEMWTeYfILIoM5p7dOO2LRBctHRvHXVq/pge
+m+hGJvFIiIAA54GYCnO9PxSp3mjapxbv2vA6PXVkcgO94h2HPY3fFPHt4cv+
+cHv1nJBhkROK1c8OUc2SAiDEFYOx0ccDB4eA4BpNrjMGHDYoyHYPRqsRldoa
+DHxp+xdU7Aqno7dbuIj18cJ2kAnD6nW/mcCslZREQA/aRk1YS6x97mNowq0J
+11Krs/J/Izzvl1lssmWwQqXpR2WREQAU/VVQO5jsfpeBhqbxkKZ80Z+nfyhw
+/afOlUqmsOwpLEdHqvv3WsN8SBYdVRbXuvj7u8nqcM3CijTdnAFR7TLwoaFr
+CVID/88GEqNc26AzhxhVM+V9N10iM/0dmMbhhkskeQUw5YO/QPbWDWoxwg+B
+1nYSYyY3G48omnI1vbOZjTmtjAbi/J/p10bG5VImszQY+1msDhteeDxBQpCu
+2ddfjjdYTUfwziz08tciMHkFJZdKRoVS8M3xGtu96dVqDfYegIHNTB0D26Te
+6dWuj6ma3rNWqB/2VJIYNb9e7iP6wiBIG7YzKdKf5NH+xRjFvNSvZYdHtdQG
+nRZTMANCK37eFvqXdpwKQ56HEhRRDMJd+OAJvgvoSEO5lEnLy41hNQvz/Bxh
+j3LEs3PwX2UL0BEQToHAgd/KM8nqzZfpKH4SrCV+vhHIPjyvmMwMQcgvg26f
+BtJkGjwtbEIIy1R9Rex8DuefHClassOPABFJbyGefuatv35uG3mskuv31NDD
+RMIoigcN1UvZihvX/T9jyUiwWcucTuy66zWGsu2EE4Dx8MQABAA+GHBAL0xM
+etQbyzCoeqZ4TXagMyv9LjZ3s3nrs0hnOmqp1+cqwrHoZLv4b2rUhHNA23Dy
+8+xNlLaCucwd5ep6ZwGnEtzBwZ482Ug/Ex70ra2VjY1b2DtfVnqsy+kzpczB
+kIscnYKFLEVWp6QiIAZjImU3DH7jT8srD8T0tua4nZzblvtctsbxRGsxHLJB
+mmaVQDF873i8vKldIanMz3Q6NwF+7+o5RFP5YZ34u1oj4Dwa0jldsxSIiADt
+KSi5b/kWM/gxB41B4h5RRjFDSPAH4ewZL2CsnG/AWQnp7r2aHqjJDkdwSo2q
+T0/663W6HUyAZp0zWHPMwU4kglqJRz6JZxocnLDmyK7sL7aHp646jPIZcdgH
+HA56HN5grq7HTfF8wrpJrFmOQLZOhEcxtYoMePvXVApRzRjNMyyNJiozd+KU
+k4USGvvnwbs5gCbE1Pt7P96b3yxzOGT8TSYxYY7MTjWEYQRqoTg/oUR4cqpH
+s4qPaZPnYcb26OmHQs/+i6lH5AOO7Q9HbnRsDuEOeJtdgenMygNhh/4VLU1L
+g74mrsR7cwO9GBZd1eeMZ0YDN2zHaHImN7IDG07AKNPFXfIW6Qeocn8mMoOQ
+YhvGpA6Sj1I9FqrLT5+Bl2j+v/ohWLfZU5PCHlECnHU6n4FALoiIgBa/2jo6
+pGiVraYAbVyLJr13ZgtpluiZNomjXxwsO6ik1gqJYI3mQvfkX1pzztHarJF4
+nW/IgcyzmgGNtbZ0eioeIha7Hj2OJKJZpxT8wjPNcjrcj9mCuPbBWtv9TU5q
+3PFvVLd3azNlKOPw3ig/8jS5mNjtQMO6rBMRsT2HIWVFFe1+9HTcYM12ZFOB
+Ns/oNWdMlsL1hxGI+ZTQj78B46xtjrMtcbj4+PkD2D9DXcqx9OELAoo6fTzo
+qjiyvGgKA6Rh8NAt9R7GDgoXQ9YidgAZr5LBqTamhzsQ7ZXHBV35STjRixV4
+g28zzYntG6E/vVhhKoytihh23RsmLPLVE6OTSev4qifts2GbOUbYvhVjF/9d
+7ZeCAmRwGnwC/+7qyODqtEt/mKHb/9UBwEEW3oDCXBgttFoh3JIfM2y0ucDw
+vjza3MK8vlErIxMnhml6csZbcSfEwvG5nJdF+Gd01Rzje3QVTyHS+J+EbH9Q
+bdLUhjFnPt2Xrw271sG6C5496ONfD1efH6uryXxEGfmztoG4C89KGMUSXhMI
+EyhNkgTQwJgk5PLn+e/ozHwGkWpzg6jkkVrlXqbcBXXzDzENmKtRViR2teGw
+sBgjbTlvBEQSMBEQTx20fvUT5pyIiPEMdQKibMXIQ4eh3wxOl+O+OoOMGJMB
+vAMsPUL8eL4vmUMaLpQazWpwUoQxi+xvCYPQNl3fquzzCKoMCNkmrGqFNkxq
+ePDwEw5UsyIL+RQ3NJEA7p7Tg24ph5K+IYrbsMBVcCjr2MHSPxJf7Vap762T
+V2gb/dXCPHxqt93Gsxf9jtk9afPddQyHqtBilS5iWgXJKTUG565nBtGgUMZ/
+naFbg3X7se6lDO3I0NWYMS7ILkmSh/xnpQeMye7sckzhKZrTtb8bxg42JlSk
+q2PmPgle314BtREQAHmHSFwREQAFxWWGXixQdMYn/ldkaafHqudA1g5dK0tb
+Ip0b75mrn/bgpR2g36THinvRQnJAjf6eUTWwSIIdrdsH0Nxxt48Jgcl30i74
+Lf2wzqidvm2qFOKGVEsPNQKoM95l7TDkH3WA/XkaJ3ZhLD2tjvx57bCR59vN
+DUiZH2cPkyb0xkT/7vofcokNYhxgD+PwaoP5ycUKAHW7xRH6WFFKyhxFIK8Q
+qNJncG1O9hKY7R2I0w2zr6/3e6ac3HFy4zms8dm6jr/sjLySukfY2L5hTK5g
+0Qw4JLWxgoQUhZIMIFr8i/ZBf+eHibbyUSRWD0N64ublj3gyFEPIKdSBzt3f
+XE047NZLLphwJ432OMl00iiiLC8M6OKrhCVxuYBHOOmwNBIdMxpC5QAczs9+
++i6OfZLyGmhdykF1BiXDqNzGer3Lf0q4YV/Kzw7c/6rwa1lqQsDN6GWWMJ16
+CmtrEcrvkc9Sxn3Jjfumvxt9liMoV7BkcWqP/V1M17dSLOxoCwYA8538K42e
+3/CsLwqs5a17ivqRpYrfuB4FFK77j9544NF2nHnNJGsPA5M+0KHr4tYa6QUW
+k4xphkufSKAxGBYOgssd99O5Z4Nn7FFM4KfL95SBoigyz8KhKk4HlLmyUnZj
+Rnspfc5R9QzNDRvedhmmUdBYfMgVmp/EdYU4cb1r/kJy/NSiNfgyiiQmwo3Q
+Y56Q4/wHSDGJ+F4Ya8Oz6GfDq00g0A0VQxrElez48V1w3ferGJ2pSdsmCyoi
+IAW3DbXZspbPHFO9Y2PbGgoD7U2F+hB3mFrpYRppaFViJP7/RX/dAxVYlTAj
+UePlRo6ty7cPHmOTXNhbLgbuaKkwprbcL3yBsFgFVmIXb4JkS9j/FsZSg4eB
+1uvpxNoaEN1qhZjIif21+Ir/GWX3YfiG8IoBYCmmWf3q5wZ9kyxrIdHpZ8Jh
+1mj66aMHjcs3TqxOfAdvbji0kF5EEoKRPBrQU+GLxuD7RjJRX3kdFyGp0CcJ
+wIkAh3Pr9/7zvZzcUHAeOXdhheBYpEhNDNZcgJ4ZBtf8D4IEAAdkuvfQHxwJ
+QWsfs7H5yOroAoqKNRF/WTFy/zrSyuT3bWclERABmKjkXUj12Y/c9OnPOPBq
+Oj+fZ742HyPUdbC8RaO3tGrvbY67C6vR9Cfop/sLbjzXbPDYbeUyNJOjqo6w
+rrGXouDjIU+QyCpmzhYfs6qtlrhsP0FYnUtcROafa4JuYgK/x6X8Lh/wkrJ9
+mPpaNtFUJQc0OKTGrmCKDoROplBiY4SzTFx6DBiK40j9q6+CUjDs+lk+3wOe
+rTqNSzjkT35zlaLF7I3NwLYcH6vV5ZKxSJ6/OCNwaA4ERAAGbMfX9dUR1X8D
+xj7wwVHsL21V4XntmOdyHur+G4/zLHA5vwacnutxFyJa3icmoFvESMERADr4
+KX+Y/G1g2SvHi/jxD0DyLTYk7LjDS77vE4OO+S85GigrqggF6oucmqD9pTfU
+X/F0C/Akirn/RtwMQd5lzI1A5H0E+dQwI+bJO938MzbwhsY50rhJjQJdYb/y
+9RyNUfQWf8Q25/cVR3iijfzD6be8PLkS27Y4Z8pF2E1wq04hihlZe2NvsKIp
+7Rqv6yBsJAi9cW0/7ljEyQ04ZU4pm86fIvRV+eWykiUJMvx2JZRj018fQ8vL
+/rg0wUgNaEf/ID4KeSU1S2Hl42vyVmhZttQQoa8G989fWSG3s7J3YVHWzVUk
+vvTOM41drFdBX8sv44I5s+bs+xO1UeQQ0S/Kqa6oIojiggzvC21J02wyYLXE
+X6DOqLlYJ5IwxVBkj1LVp/jxY7Z+I3HGCQDteDO8EJrFg8zehhr625BxtWw2
+AyYm8D+N3ZHucQv9KJcNfiBMcLio74qxfzWyEhzLrTop6bVX7BEcxBFlaxY2
+PqHRC+EtzpKRwc2EcRRD2Ou8e5dE/mhEi1SQ8hTHY4UBFUx0eKDK/jBGmqZ8
+WtrhK+lyhlgIWCpTty6KGjD00kCdey4GedeHqurbCS7sCTT7mDKEcAiII4nV
+pjFlCXcstRi4Q4Y14psEnMZpcJDNDtnMnFC62N+wvb+9vge3jmlETM7wZIT3
+npJbUCyO346Y1o4cs75nDiGoomk85Kt9lO5iCukwY/nO+gM+TeoJw1MnszVj
+9OmpXsGFuweqWjciI3AWRfBMiRuvzkWreeXaaS47TX60weTmp02EJ1CCG9XM
+ZA3bvOGuLBsvXIf4OQ84/FkzXjh0ZaR4vTn4R8O74Sh77vNQox500ISg4Zsq
+9ctZfWR+OP1JMV/oTe64CxObwh+iZG4/Iyjer8svVzIXv2kwfuX7CCiF+M27
+zgYhNG9Q/J+2xwrV6QlU/Yf1qX5XLNQydZkAlv1oJ0fcQrpyxXTPalITeGJO
+A0XclyhPM0/zcL6QRxCVtNxfN8VdQ+18ay1Mkrfu6dmzkGfbDYXHHmHAy77z
+BuN+Y4pSwdK/kadIuZsTb2HPm+ICyHGuQqPq/6Y8czQH4Fllykshnyrkv18K
+KkjQmfP0IY3u1PSopqODKM+c1I1Wy1x694PLqP8bezqYk845SkZezm00ObiO
+P1nKUtU7kDhFlKY/2gn3CvvUdrmL+SkcH7CAiIJY8yRwtxokmPf4vEZK0mC8
+qnFm3xkPyOn4jFfJvuzwUR5mGVa6IszPvmrRL7c+NYcYpiREEQRvw1DXvj3c
+Gbvgm1PzzPyLMbsY2BFgOOLJUdFkY18EtfsW8w4wePNXNn4xwngQ79kghofj
+VdoP54P5eC2fv+lZ8e0VwkkB9CvLIDCJH7eAMokFESX1avv2w3tgz7z7U/si
+Tt70Zm4iuVv+GW85mgrXyKzJTnBNwbrr80lIW2PRv233uAresxdTyxfBOZC0
+psBzJU9EKaubKSL4CxXBmf+cVe0ZQkyxeaI/7wF0NaYXqZo+BPb4VN/uKzfy
+FfbqDgeNyG0tvbtDZIVNUK4/airCGGwMe/FLVU36C1K+ywtgnHIA8+M63tW4
+myqhfd+JLWhhe5efxhJF9oD2jE0edxLXTYKXw/kHsktb/zrsy+W/pFytg0OR
+voIaSFMaccidKb8pDakzpTLmk0mIOOf+qtOVU1sVaYoy7lYZhCMOMZuYUYS1
+F4K/qhuOzp8W+BshE5HlMEdFgHTdDZKqGtmfKK5Lwi/EMUs8kWVZvTmFeMwk
+taSQFrx7C35Q9BWDqbcpiOYEwan7/xvP/FK5nMN5VOO92e96ctJy4xcwyYvq
+Nqb4pYUzNi+mH8TiRpPlZPgd8kj8xkHHVdfe5y2biu7Yh2QzhMlxsel4M4RY
+t3yqPdkNarVk0WY95vy3koPY1bVStSR402J2YwcVFfoIgiTeD8jxznXqrcoD
+cHULwgH809HTk162p+vTI4YMeusywCIgnkIC0Cje4/B0B48mbrRHFMntZgn/
+sM5vcYsYMdzQHbYG8G/le3yFfFo3F6rEioYwj4zjDc8s2ZhHUbHI2HxKcptg
+Wv9yYBEQS7kfOHLrjeUF/7HLI8kDinizFYO4ewgTIlSRverPeLfwcGYwcyIt
+1ALk1d7yMYtjRhpwEAL0pE3JdtMawxBQ9XDQN4J0/s9hsPix1riZY+Y8a9Xj
+UzD4dX4qF7SiIgByyGLPKZX6+FgGRDjhK/9TdN/YZEH/xdyRThQkNpomo8A=
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+uudecode -o test.ok.wav.bz2 test.ok.wav.bz2.b64
+if [ $? -ne 0 ]; then echo "Failed output uudecode"; fail; fi
+bunzip2 -f test.ok.wav.bz2
+if [ $? -ne 0 ]; then echo "Failed output bunzip2"; fail; fi
+
+cat > test.ok << 'EOF'
+2 seconds of data  read from test.wav to test.out.wav
+At sample rate 48000
+ With low pass filter cutoff 1000 and high pass filter cutoff 50
+Fast tau(ms) 50 , slow tau(ms) 50 , peak tau(ms) 50
+Lower peak threshold 0.4 , upper peak threshold 0.6
+Minimum gain 0.1 , maximum gain 10
+AGC look-ahead(ms) 5
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+#
+# run and see if the results match
+#
+args="--inFile test.wav --outFile test.out.wav --seconds 2 --lookAheadMs 5"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > test.out 2>&1 
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+diff test.ok.wav test.out.wav
+if [ $? -ne 0 ]; then echo "Failed diff of wav"; fail; fi
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff of out"; fail; fi
+
+#
+# the per-sample AGC overshoots a step in amplitude and the look-ahead AGC
+# does not
+#
+args="--step"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > step.out 2>&1 
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+awk '/^[0-9]/ && $3>1 {over=1} END {exit !over}' step.out
+if [ $? -ne 0 ]; then echo "Failed overshoot without look-ahead"; fail; fi
+args="--step --lookAheadMs 5"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > step.out 2>&1 
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+awk '/^[0-9]/ && $3>0.6 {bad=1} END {exit bad}' step.out
+if [ $? -ne 0 ]; then echo "Failed look-ahead overshoot"; fail; fi
+awk '/^[0-9]/ && $1>=200 && $3<0.4 {bad=1} END {exit bad}' step.out
+if [ $? -ne 0 ]; then echo "Failed look-ahead envelope"; fail; fi
+#
+# this much worked
+#
+pass
@@ -0,0 +1,58 @@
+#!/bin/sh
+
+prog="saSampleFast_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $0 $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $0 $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok << 'EOF'
+inner product mismatches: 0
+inner product at lag 0: 752.73383
+filter mismatches: 0
+checked conversion of overflow: 1.0384593e+34
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+#
+# run and see if the results match
+#
+echo "Running $prog"
+
+$VALGRIND_CMD $bin/$prog > test.out 2>&1
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
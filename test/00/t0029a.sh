@@ -0,0 +1,72 @@
+#!/bin/sh
+
+prog="saSampleConvert_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $0 $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $0 $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok << 'EOF'
+int16 source mismatches: 0
+int16 round trip mismatches: 0
+int16 sink mismatches: 0 saturated: -32768 32767
+int24 round trip mismatches: 0
+int24 source mismatches: 0
+int32 round trip mismatches: 0
+float round trip mismatches: 0
+double round trip mismatches: 0
+run time format mismatches: 0
+de-interleave 1 channels, 65534 frames, mismatches: 0
+de-interleave 2 channels, 32765 frames, mismatches: 0
+de-interleave 3 channels, 21842 frames, mismatches: 0
+de-interleave 4 channels, 16381 frames, mismatches: 0
+de-interleave 5 channels, 13104 frames, mismatches: 0
+de-interleave 6 channels, 10919 frames, mismatches: 0
+de-interleave 7 channels, 9359 frames, mismatches: 0
+de-interleave 8 channels, 8189 frames, mismatches: 0
+de-interleave 9 channels, 7278 frames, mismatches: 0
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+#
+# run and see if the results match
+#
+echo "Running $prog"
+
+$VALGRIND_CMD $bin/$prog > test.out 2>&1
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
@@ -0,0 +1,91 @@
+#!/bin/sh
+#
+
+prog="saInputStreamFile_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+
+# Sanity checks
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+if [ ! -f $bin/$prog ] ; then echo "Didnt find "$prog; exit 2; fi
+
+fail()
+{
+        echo FAILED $0 $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+pass()
+{
+        echo PASSED $0 $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input is a two channel ramp spanning three fragments
+#
+awk 'BEGIN{print 8000; print 2; print 40000; \
+  for(i=0;i<40000;i++){print i-32768; print 32767-i}}' > test.asc
+if [ $? -ne 0 ]; then echo "Failed input awk"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.txt << 'EOF'
+Testing acquire and release
+Reading 1000 frames from test.asc at channel 1
+Frames per sec. 8000
+Samples per frame 2
+Frames per fragment 16384
+Frames per stream 40000
+Test acquire
+Acquired 40000 frames in 42 views
+EndOfSource() 0
+Frames read from stream 40000
+EOF
+if [ $? -ne 0 ]; then echo "Failed output text cat"; fail; fi
+
+#
+# the acquired samples should match the samples read
+#
+args="--read_test --channel 1 --frames 40000 --file test.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > test.out 2> /dev/null
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+args="--acquire_test --channel 1 --frames 1000 --file test.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > out 2> txt
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+diff out test.out
+if [ $? -ne 0 ]; then echo "Failed diff out"; fail; fi
+diff txt test.txt
+if [ $? -ne 0 ]; then echo "Failed diff txt"; fail; fi
+
+#
+# so should the acquired views of saSample
+#
+args="--acquire_test --samples --channel 1 --frames 1000 --file test.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > out 2> txt
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+diff out test.out
+if [ $? -ne 0 ]; then echo "Failed diff samples out"; fail; fi
+diff txt test.txt
+if [ $? -ne 0 ]; then echo "Failed diff samples txt"; fail; fi
+
+#
+# this much worked
+#
+pass
@@ -0,0 +1,100 @@
+#!/bin/sh
+#
+
+prog="saInputStreamFile_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+
+# Sanity checks
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+if [ ! -f $bin/$prog ] ; then echo "Didnt find "$prog; exit 2; fi
+
+fail()
+{
+        echo FAILED $0 $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+pass()
+{
+        echo PASSED $0 $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+
+#
+# the input is a four channel signal spanning three fragments
+#
+awk 'BEGIN{print 8000; print 4; print 40003; \
+  for(i=0;i<40003;i++){print i-32768; print 32767-i; \
+                       print (i*7)%65536-32768; print -((i*13)%32768)}}' \
+  > test.asc
+if [ $? -ne 0 ]; then echo "Failed input awk"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.txt << 'EOF'
+Testing de-interleaved read
+Reading 1001 frames from test.asc
+Frames per sec. 8000
+Samples per frame 4
+Frames per fragment 16384
+Frames per stream 40003
+Test de-interleaved read
+Buffers 4
+EndOfSource() 0
+Frames read from stream 40003 : 40003
+Future timestamps 0
+EOF
+if [ $? -ne 0 ]; then echo "Failed output text cat"; fail; fi
+
+#
+# all the channels read in one pass should match the interleaved frames
+#
+args="--read_test --frames 40003 --file test.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > test.out 2> /dev/null
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+args="--deinterleave_test --frames 1001 --file test.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > out 2> txt
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+diff out test.out
+if [ $? -ne 0 ]; then echo "Failed diff out"; fail; fi
+diff txt test.txt
+if [ $? -ne 0 ]; then echo "Failed diff txt"; fail; fi
+
+#
+# each channel should match the channel read on its own
+#
+for c in 0 1 2 3 ; do
+  args="--read_test --channel $c --frames 40003 --file test.asc"
+  echo "Running $prog $args"
+  $VALGRIND_CMD $bin/$prog $args > test.out.$c 2> /dev/null
+  if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+  args="--deinterleave_test --channel $c --frames 1001 --file test.asc"
+  echo "Running $prog $args"
+  $VALGRIND_CMD $bin/$prog $args > out.$c 2> /dev/null
+  if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+  diff out.$c test.out.$c
+  if [ $? -ne 0 ]; then echo "Failed diff out.$c"; fail; fi
+done
+
+#
+# this much worked
+#
+pass
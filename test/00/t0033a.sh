@@ -0,0 +1,120 @@
+#!/bin/sh
+#
+
+prog="saInputStreamFile_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+
+# Sanity checks
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+if [ ! -f $bin/$prog ] ; then echo "Didnt find "$prog; exit 2; fi
+
+fail()
+{
+        echo FAILED $0 $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+pass()
+{
+        echo PASSED $0 $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+
+#
+# the input is a two channel signal spanning three fragments
+#
+awk 'BEGIN{print 8000; print 2; print 40003; \
+  for(i=0;i<40003;i++){print (i*7)%65536-32768; print 32767-i}}' > test.asc
+if [ $? -ne 0 ]; then echo "Failed input awk"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.txt << 'EOF'
+Testing de-interleaved read
+Reading 1001 frames from test.asc
+Frames per sec. 8000
+Samples per frame 2
+Frames per fragment 16384
+Frames per stream 40003
+Test de-interleaved read
+Buffers 2
+EndOfSource() 1
+Frames read from stream 40003 : 40003
+Future timestamps 0
+EOF
+if [ $? -ne 0 ]; then echo "Failed output text cat"; fail; fi
+
+#
+# the frames read ahead should match the frames read directly
+#
+args="--read_test --frames 1000 --file test.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > test.out 2> /dev/null
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+for depth in 1 3 ; do
+  args="--read_test --read_ahead $depth --frames 1000 --file test.asc"
+  echo "Running $prog $args"
+  $VALGRIND_CMD $bin/$prog $args > out.$depth 2> txt.$depth
+  if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+  diff out.$depth test.out
+  if [ $? -ne 0 ]; then echo "Failed diff out.$depth"; fail; fi
+  grep -q "^Stalls [0-9][0-9]*$" txt.$depth
+  if [ $? -ne 0 ]; then echo "Failed grep txt.$depth"; fail; fi
+done
+
+#
+# the read-ahead source ends after the last fragment is collected
+#
+args="--read_test --frames 40003 --file test.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > test.all 2> /dev/null
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+args="--deinterleave_test --read_ahead 2 --frames 1001 --file test.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > out 2> txt
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+diff out test.all
+if [ $? -ne 0 ]; then echo "Failed diff out"; fail; fi
+grep -v "^Stalls" txt > txt.nostalls
+diff txt.nostalls test.txt
+if [ $? -ne 0 ]; then echo "Failed diff txt"; fail; fi
+
+#
+# a Clear drops the fragments read ahead, so the first frame read after it
+# is the first frame of the fragment after those in the pool
+#
+awk 'BEGIN{print 8000; print 2; print 70000; \
+  for(i=0;i<70000;i++){print (i*7)%65536-32768; print 32767-i}}' > clear.asc
+if [ $? -ne 0 ]; then echo "Failed clear input awk"; fail; fi
+
+for depth in 1 2 3 ; do
+  args="--frames 10 --clear_test --read_ahead $depth --file clear.asc"
+  echo "Running $prog $args"
+  $VALGRIND_CMD $bin/$prog $args > /dev/null 2> txt.$depth
+  if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+  expr 32767 - 16384 \* $depth > first.$depth
+  grep -A 2 "^Frames read from stream 10 : 10$" txt.$depth | tail -1 | \
+    diff first.$depth -
+  if [ $? -ne 0 ]; then echo "Failed clear read-ahead $depth"; fail; fi
+done
+
+#
+# this much worked
+#
+pass
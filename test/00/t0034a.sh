@@ -0,0 +1,139 @@
+#!/bin/sh
+#
+
+prog="saInputStreamFile_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+
+# Sanity checks
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+if [ ! -f $bin/$prog ] ; then echo "Didnt find "$prog; exit 2; fi
+
+fail()
+{
+        echo FAILED $0 $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+pass()
+{
+        echo PASSED $0 $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+
+#
+# the inputs are one second of a 440Hz sine at 48000Hz and of a 440Hz sine
+# and a 1000Hz cosine at 44100Hz
+#
+awk 'BEGIN{fs=48000; print fs; print 1; print fs; pi=3.14159265358979; \
+  for(i=0;i<fs;i++){printf "%d\n", int(16000*sin(2*pi*440*i/fs))}}' \
+  > mono.asc
+if [ $? -ne 0 ]; then echo "Failed mono input awk"; fail; fi
+awk 'BEGIN{fs=44100; print fs; print 2; print fs; pi=3.14159265358979; \
+  for(i=0;i<fs;i++){printf "%d\n%d\n", int(16000*sin(2*pi*440*i/fs)), \
+                                       int(8000*cos(2*pi*1000*i/fs))}}' \
+  > stereo.asc
+if [ $? -ne 0 ]; then echo "Failed stereo input awk"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.txt << 'EOF'
+Testing acquire and release
+Reading 777 frames from stereo.asc
+Frames per sec. 16000
+Samples per frame 2
+Frames per fragment 5945
+Frames per stream 16000
+Test acquire
+Acquired 16000 frames in 22 views
+EndOfSource() 0
+Frames read from stream 16000
+EOF
+if [ $? -ne 0 ]; then echo "Failed output text cat"; fail; fi
+
+#
+# the resampled sines should be within 3 of the ideal sines delayed by the
+# filter. The delay is (KL-1)/2L input frames for K taps in each of L phases.
+#
+args="--read_test --resample 16000 --frames 16000 --file mono.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > mono.out 2> /dev/null
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+awk 'BEGIN{pi=3.14159265358979; d=95/6; m=0} \
+  NR>100 && NR<15900 {e=$1-16000*sin(2*pi*440*(NR-1-d)/16000); \
+                      if (e<0) e=-e; if (e>m) m=e} \
+  END{print NR, (m<3)}' mono.out > mono.err
+echo "16000 1" | diff - mono.err
+if [ $? -ne 0 ]; then echo "Failed mono resampling"; fail; fi
+
+args="--read_test --resample 16000 --frames 16000 --file stereo.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > stereo.out 2> /dev/null
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+awk 'BEGIN{pi=3.14159265358979; d=(96*160-1)/(2*441); m=0} \
+  NR>200 && NR<31800 {k=int((NR-1)/2); \
+    if (NR%2) e=$1-16000*sin(2*pi*440*(k-d)/16000); \
+    else e=$1-8000*cos(2*pi*1000*(k-d)/16000); \
+    if (e<0) e=-e; if (e>m) m=e} \
+  END{print NR, (m<3)}' stereo.out > stereo.err
+echo "32000 1" | diff - stereo.err
+if [ $? -ne 0 ]; then echo "Failed stereo resampling"; fail; fi
+
+#
+# acquired and de-interleaved frames should match the frames read
+#
+args="--acquire_test --resample 16000 --frames 777 --file stereo.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > out 2> txt
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+diff out stereo.out
+if [ $? -ne 0 ]; then echo "Failed diff acquire out"; fail; fi
+diff txt test.txt
+if [ $? -ne 0 ]; then echo "Failed diff acquire txt"; fail; fi
+
+args="--acquire_test --samples --resample 16000 --frames 777 --file stereo.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > out 2> txt
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+diff out stereo.out
+if [ $? -ne 0 ]; then echo "Failed diff acquire samples out"; fail; fi
+diff txt test.txt
+if [ $? -ne 0 ]; then echo "Failed diff acquire samples txt"; fail; fi
+
+args="--deinterleave_test --resample 16000 --frames 1001 --file stereo.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > out 2> /dev/null
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+diff out stereo.out
+if [ $? -ne 0 ]; then echo "Failed diff de-interleave out"; fail; fi
+
+#
+# a channel read alone should match that channel of the frames read
+#
+for channel in 0 1 ; do
+  args="--read_test --resample 16000 --frames 16000 --channel $channel \
+    --file stereo.asc"
+  echo "Running $prog $args"
+  $VALGRIND_CMD $bin/$prog $args > out 2> /dev/null
+  if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+  awk -v c=$channel '(NR-1)%2==c' stereo.out | diff - out
+  if [ $? -ne 0 ]; then echo "Failed diff channel $channel out"; fail; fi
+done
+
+#
+# this much worked
+#
+pass
@@ -0,0 +1,114 @@
+#!/bin/sh
+#
+
+prog="saInputStreamFile_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+
+# Sanity checks
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+if [ ! -f $bin/$prog ] ; then echo "Didnt find "$prog; exit 2; fi
+
+fail()
+{
+        echo FAILED $0 $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+pass()
+{
+        echo PASSED $0 $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+
+#
+# the input is a two channel signal spanning three fragments
+#
+awk 'BEGIN{print 8000; print 2; print 40003; \
+  for(i=0;i<40003;i++){print (i*7)%65536-32768; print 32767-i}}' > test.asc
+if [ $? -ne 0 ]; then echo "Failed input awk"; fail; fi
+
+#
+# a ring holding the whole file captures every frame
+#
+args="--read_test --frames 1000 --file test.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > test.out 2> /dev/null
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+args="--read_test --frames 40003 --file test.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > test.all 2> /dev/null
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+for ring in 3 4 ; do
+  args="--read_test --capture $ring --frames 1000 --file test.asc"
+  echo "Running $prog $args"
+  $VALGRIND_CMD $bin/$prog $args > out.$ring 2> txt.$ring
+  if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+  diff out.$ring test.out
+  if [ $? -ne 0 ]; then echo "Failed diff out.$ring"; fail; fi
+  grep -q "^OverRun 0$" txt.$ring
+  if [ $? -ne 0 ]; then echo "Failed grep txt.$ring"; fail; fi
+done
+
+args="--deinterleave_test --capture 3 --frames 1001 --file test.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > out 2> txt
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+diff out test.all
+if [ $? -ne 0 ]; then echo "Failed diff de-interleave out"; fail; fi
+grep -q "^EndOfSource() 1$" txt
+if [ $? -ne 0 ]; then echo "Failed grep EndOfSource"; fail; fi
+
+#
+# a ring of one fragment drops frames that do not fit if the reader falls
+# behind. The frames read are whole frames in order.
+#
+args="--deinterleave_test --capture 1 --frames 40003 --file test.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > out.1 2> txt.1
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+grep -q "^OverRun [01]$" txt.1
+if [ $? -ne 0 ]; then echo "Failed grep txt.1"; fail; fi
+awk 'BEGIN{p=-1; e=0} \
+  NR%2 {a=$1} \
+  !(NR%2) {i=32767-$1; if ((a!=(i*7)%65536-32768) || (i<=p)) e++; p=i} \
+  END{print e}' out.1 > err.1
+echo 0 | diff - err.1
+if [ $? -ne 0 ]; then echo "Failed frame order"; fail; fi
+
+#
+# the frames and over-run of a Collect in progress at a Clear are dropped
+#
+cat > clear.ok << 'EOF'
+Testing clear of a capture thread ring
+OverRun before Clear 1
+OverRun after Clear 0
+Frames captured before Clear 0
+EOF
+if [ $? -ne 0 ]; then echo "Failed clear output cat"; fail; fi
+
+args="--capture_clear_test"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > out 2> txt
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+diff clear.ok txt
+if [ $? -ne 0 ]; then echo "Failed diff capture clear"; fail; fi
+
+#
+# this much worked
+#
+pass
@@ -0,0 +1,111 @@
+#!/bin/sh
+#
+
+prog="saInputStreamFile_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+
+# Sanity checks
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+if [ ! -f $bin/$prog ] ; then echo "Didnt find "$prog; exit 2; fi
+
+fail()
+{
+        echo FAILED $0 $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+pass()
+{
+        echo PASSED $0 $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+
+#
+# the input is a two channel signal spanning three fragments
+#
+awk 'BEGIN{print 8000; print 2; print 40003; \
+  for(i=0;i<40003;i++){print (i*7)%65536-32768; print 32767-i}}' > test.asc
+if [ $? -ne 0 ]; then echo "Failed input awk"; fail; fi
+
+args="--read_test --frames 40003 --file test.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > test.all 2> /dev/null
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+#
+# three copies of the file polled on one thread, each with a ring holding
+# the whole file, are all captured completely
+#
+args="--deinterleave_test --poll 3 --capture 4 --frames 1001 --file test.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > out 2> txt
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+diff out test.all
+if [ $? -ne 0 ]; then echo "Failed diff polled out"; fail; fi
+grep -q "^OverRun 0$" txt
+if [ $? -ne 0 ]; then echo "Failed grep OverRun"; fail; fi
+cat > test.ok << 'EOF'
+Polled 1 frames 40003 OverRun 0
+Polled 2 frames 40003 OverRun 0
+EOF
+grep "^Polled" txt | diff - test.ok
+if [ $? -ne 0 ]; then echo "Failed diff polled copies"; fail; fi
+
+#
+# with rings of one fragment the polling thread drops frames that do not
+# fit. The frames read are whole frames in order.
+#
+args="--deinterleave_test --poll 2 --capture 1 --frames 40003 --file test.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > out.1 2> txt.1
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+grep -q "^Polled 1 frames [0-9]* OverRun [01]$" txt.1
+if [ $? -ne 0 ]; then echo "Failed grep txt.1"; fail; fi
+awk 'BEGIN{p=-1; e=0} \
+  NR%2 {a=$1} \
+  !(NR%2) {i=32767-$1; if ((a!=(i*7)%65536-32768) || (i<=p)) e++; p=i} \
+  END{print e}' out.1 > err.1
+echo 0 | diff - err.1
+if [ $? -ne 0 ]; then echo "Failed frame order"; fail; fi
+
+#
+# a read-ahead source waits in Collect, so it is not polled
+#
+args="--deinterleave_test --poll 2 --capture 4 --read_ahead 2 --frames 1001 \
+  --file test.asc"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > out 2> txt
+if [ $? -eq 0 ]; then echo "Failed blocking source polled"; fail; fi
+tail -1 txt > txt.last
+echo "saInputPoll source would block" | diff - txt.last
+if [ $? -ne 0 ]; then echo "Failed diff blocking source"; fail; fi
+
+#
+# the polling thread still sleeps after the reader of a paced source that
+# stays ready is dropped
+#
+args="--poll_drop_test"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > out 2> txt
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+printf "Testing polling after a reader is dropped\nPolling thread sleeps after drop 1\n" | \
+  diff - txt
+if [ $? -ne 0 ]; then echo "Failed diff poll drop"; fail; fi
+
+#
+# this much worked
+#
+pass
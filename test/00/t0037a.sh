@@ -0,0 +1,98 @@
+#!/bin/sh
+#
+
+prog="PitchTracker_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+
+# Sanity checks
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+if [ ! -f $bin/$prog ] ; then echo "Didnt find "$prog; exit 2; fi
+
+fail()
+{
+        echo FAILED $0 $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+pass()
+{
+        echo PASSED $0 $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+
+#
+# a synthetic 440Hz sine is tracked in each sample format
+#
+for format in S16 S24_3LE S32 FLOAT; do
+args="--device synth:sin440,format=$format --sampleRate 8000 \
+  --msDeviceLatency 20 --maxPitchSamples 40"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > out.$format 2> /dev/null
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+awk '($1<430)||($1>450){e++} END{print NR, e+0}' out.$format > err.$format
+echo "40 0" | diff - err.$format
+if [ $? -ne 0 ]; then echo "Failed pitch $format"; fail; fi
+done
+
+#
+# a sine below 16 bit resolution survives into the pitch path in the wide
+# formats and is lost in S16. The AGC gain is limited to 10.
+#
+for format in S16 S32 FLOAT; do
+args="--device synth:sin440,amp=0.00001,format=$format --sampleRate 8000 \
+  --msDeviceLatency 20 --maxPitchSamples 40 --debug"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > out 2> /dev/null
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+awk 'NR>500{v=($1<0)?-$1:$1; if(v>m)m=v} \
+  END{print (m>0.9e-5)&&(m<1.1e-5), (m==0)}' y.txt > peak.$format
+awk 'NR>500{v=($1<0)?-$1:$1; if(v>m)m=v} \
+  END{print (m>0.9e-4)&&(m<1.1e-4), (m==0)}' yagc.txt >> peak.$format
+done
+printf "0 1\n0 1\n" | diff - peak.S16
+if [ $? -ne 0 ]; then echo "Failed low level S16"; fail; fi
+for format in S32 FLOAT; do
+printf "1 0\n1 0\n" | diff - peak.$format
+if [ $? -ne 0 ]; then echo "Failed low level $format"; fail; fi
+done
+
+#
+# injected over-runs reset the stream and the capture latency is reported
+#
+args="--device synth:saw220,overrun=5,jitter=2,stall=10,every=3 \
+  --sampleRate 8000 --msDeviceLatency 20 --maxPitchSamples 40 --debug"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > out 2> txt
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+grep -q "^Stream reset after overrun$" txt
+if [ $? -ne 0 ]; then echo "Failed grep overrun"; fail; fi
+grep -q "^capture to estimate latency ms: p50" txt
+if [ $? -ne 0 ]; then echo "Failed grep latency"; fail; fi
+
+#
+# an unknown signal is an error
+#
+args="--device synth:tri440 --sampleRate 8000 --maxPitchSamples 1"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > out 2> txt
+if [ $? -eq 0 ]; then echo "Failed unknown signal"; fail; fi
+echo "unknown synth signal tri440" | diff - txt
+if [ $? -ne 0 ]; then echo "Failed diff unknown signal"; fail; fi
+
+#
+# this much worked
+#
+pass
@@ -0,0 +1,247 @@
+#!/bin/sh
+#
+
+prog="saInputStreamFile_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+
+# Sanity checks
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+if [ ! -f $bin/$prog ] ; then echo "Didnt find "$prog; exit 2; fi
+
+fail()
+{
+        echo FAILED $0 $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+pass()
+{
+        echo PASSED $0 $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+
+#
+# the inputs are 101 stereo frames at 48000Hz of a 440Hz sine and a 1000Hz
+# cosine, int(16000*sin(2*pi*440*i/48000)) and
+# int(8000*cos(2*pi*1000*i/48000)), written by a python script as
+#  s16.wav  16 bit PCM with the canonical 44 byte header
+#  s24.wav  24 bit PCM, extensible, with LIST and fact chunks before the
+#           data and a JUNK chunk after it
+#  s32.wav  32 bit PCM with a JUNK chunk before the data
+#  f32.wav  32 bit float, extensible
+#  f64.wav  64 bit float with an 18 byte fmt chunk, so that the data is
+#           not aligned for mapping, and a LIST chunk after the data
+#  u8.wav   8 bit PCM, which is not supported
+#
+cat > s16.wav.bz2.b64 << 'EOF'
+begin-base64 644 s16.wav.bz2
+QlpoOTFBWSZTWcZucdYAAG5////979//u///9yVfgWUnNIFjbVQyyYxQS3/7
+9/b+9X+dsAE7WpYqmk9Q9Q0Gg0NqNNAA0NNDQD1AAA0AA00aMgGh6gyDJp5R
+6mh6g02gQP0oaaBFQQDQ0DJiNMmQAaGNJgRoPKAGQAxA0aBkyYBMgaAaGgDQ
+ADaj1CKZU8jU/VGgAGmQDQ0yAAaAaB6QBo0ANMgAANAaaGnqAaAAyAyMmghQ
+ItQQOC02wXPiLNJAFlELGAZOsORde743zhpQDMPVq2vBRfydRSzAAjpimz+A
+B7xsrqEvfvwJqjnH4WFmIL7bwgBL7/wNfnxvviwEIBYvuUoNa9M8IpiqKGIH
+DwQAzGAJgAQna8ra5VsZ3sGFJb85yk/z0jzo9ZBCaFrXUv6ZgZGfgZa2wgEO
+qfalU/akKClcLD3LmupjGCY0ko2KUbnsYKpUAMKa1nG/aKRljXQ0XChY5TBH
+WnM302bXyGR0OQH1NqYhHcIRLEGBEmWZGgyN9sWCNFo4xGLUJkExZTfnOR0M
+AYgn+efQ7x++kDjvwtcOc+w3dYsoldqwnao3x1TRl+TQNXfE/SSR4cobWUvV
+X6RGhPCOe9+ZTrXOMK46QJ+EAgBACFrwAYAJ3voAVOb8vHpVoJ0kdNoWnRqg
+BzKGoFzn9C8BSieMkKi7WLgBaga3skKGWlAG6rJQkD1agcUf+IkSWCQT/xdy
+RThQkMZucdY=
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+uudecode -o s16.wav.bz2 s16.wav.bz2.b64
+if [ $? -ne 0 ]; then echo "Failed input uudecode"; fail; fi
+bunzip2 -f s16.wav.bz2
+if [ $? -ne 0 ]; then echo "Failed input bunzip2"; fail; fi
+
+cat > s24.wav.bz2.b64 << 'EOF'
+begin-base64 644 s24.wav.bz2
+QlpoOTFBWSZTWevJ64YAAO5////979//+///9z3fgX8ndoFjbVA6yZxQC3/7
+9/b+9H+dwAG9uWDRAAaYmjTIwmgaZME00NDJghoNGIMAQ0ZDJkYIAGQNMmQ0
+MQGjTCGgGgdNHqBoAD1NNGQ0Zpqeo00NGj1MmI00AyNAGRkaaDQMhkyANGhk
+ADQ0NDA0QMKhkRGyh6mnqNNpBoBkAABoAaAHqAAAAAAAAAAAAADQ9QPKAlNS
+TJTyh6gDQDTTTQA0GgAPUGg9QAPUAAA0GQNAGgGmg0Box6oeU8ozU0HlJ9VZ
+Vj8EARUUykPS733X2yibAJoyDjI5KDHqbUemTJtJFnnaMgHRBEnVii6aA2F7
+vGz4VFMCjdFtNGewQRCV/jsu4SpStSHN045A4OuhXotmeh3G7xjQDPvIVrAL
+TgRKlngiYhagvUbEBaUxQYMcZKM9gDrinaV+2xScaqBIEsKIdV21Ik1BZpho
+i2K0Y98dG0QFDKXOLhF7A9erQqPBAlv8vGAmAY2SwfnCxYFNMzxtU/LBq1VW
+NlZkcADHvnohEQMBYEAWHV1UCNnJlgWW/gGsEl/kWUqk81jc2td0Qt4BjVaw
+PBYUHyiCC67c6cLM8WAa85AQPBfK/IvJkEVXC1oJjy7oeTS2IkNQFgCVX3mu
+qeKNW3bj78fX4SblYN2oVMTFcq+i40lHgyYgTrlxuambV0H6HYp/pZ5CfKt5
+8fpIh07ghtreH5vwqGHqRZL8a/OjJnhDo7iG4d9U1YpmHcRJicxNpnEee6qj
+OnKgvG9HkRADnIYLlM0u7/t3eP/o0hdhvewiSsj0QgBA0JDrNEDAZaJCNP8m
+PphQATwV36LJHSTSTFYjjA7nEHWkIhC6taHkClB/AQUg0zhr7Ug4KNIzY8zZ
+a2Bw2GCU4xaYtQQ1iv2v+LuSKcKEh15PXDA=
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+uudecode -o s24.wav.bz2 s24.wav.bz2.b64
+if [ $? -ne 0 ]; then echo "Failed input uudecode"; fail; fi
+bunzip2 -f s24.wav.bz2
+if [ $? -ne 0 ]; then echo "Failed input bunzip2"; fail; fi
+
+cat > s32.wav.bz2.b64 << 'EOF'
+begin-base64 644 s32.wav.bz2
+QlpoOTFBWSZTWUMQ6KwAATl////979//+///9z1fgWVnNIFjbVAyyYxQC3/7
+9/b+9H+dsAGQxqhFTyjQgyGgGgAaaaABo0AaNADRoZAA0ZMjTQ0AABoABpo0
+2ptT1NDygVTSemUMnqHqeowgGmyCNGamj1NDIekANGTQBoAAAAAA0ABoDJo9
+EaBoCSSUnqaYEDEYgA9IabU0000aNNDRoDBNGTJgTQaMTQDIxMg0AD0m1A9R
+gCfqahxOuwFkCBQHhtQ/LBHnwQOJmzdb5f6oKk1BD0w3kl15Lw6PdQDDTIPG
+051bCkTwmMU7atZhYQnVgZO1r2gfz1GlsPKNRHANeHx0YErIVoUELRLzCzmw
+i38n4AAkyD6QiDxbENTWhQ/i4DhCoRkQwalGeSJ0wwYBKGmIQzcoSklR69u9
+rkA77zVGo0BaJs+buPcmOSlufYpZeuV0G7vhA0gsB+lmlkNfqgygMF0vmXFX
+bTnDysufJwqGSU8yQt6yAILIRbskgT7AdjDx7gI7G1bkHGpgdc5bh8GDJ78W
+KNqd5AFm3oQHvIwXUEHBNfbkg8jCsR5lWojomzC7BmheNZMCGwqfKcRbT4ev
+2mz68ToTwRwGgtA0YVhuLYHgAl0NfLPKEsgvWknfGmJufImBvBA7EB94cN6I
+0TmyDyvWWPjOCFqnKtamknH6ZRYTgJMYSP6yX8WYX9EPyhxWfBb74j5pSjoA
+mtBxteM4FNtjKu36KDIAFkjp/p5wIw0x59rJkX3UHduIMMN3eKGGEaBnAwRg
+fcKT2gOB+MT48EFid+oOFrQp3GvZHvBhRm/4u5IpwoSCGIdFYA==
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+uudecode -o s32.wav.bz2 s32.wav.bz2.b64
+if [ $? -ne 0 ]; then echo "Failed input uudecode"; fail; fi
+bunzip2 -f s32.wav.bz2
+if [ $? -ne 0 ]; then echo "Failed input bunzip2"; fail; fi
+
+cat > f32.wav.bz2.b64 << 'EOF'
+begin-base64 644 f32.wav.bz2
+QlpoOTFBWSZTWTWtteIAAPD///5FRVRE5GJHZ2B1xWdmZPh0Z1Z8xh2Gb97Y
+yN1l9V/3wAH4cyTgqp+mQU09QNPKBoaHlAGmg0AxB6jT1AGgBp6j1NPU00Bp
+ptRo2oxN6p6QCEmpHplGQMmaIA0DTATTTQaNB6gyMmIyMIxGmjQAaAMjRjUC
+J5EpCaYBMTEwEwIwIwTAACYAjCNoAAAAAAAGmklMmgANA0AAAA0ANAAaaAAB
+oANAA0AAaBZSCAVcgH/+Rc56M8gJ9LF6wQ9XOkAWiHowVkeYRY6KaAGLzBVC
+AgH9KOKMC4ABweXFAsMVJVS5iQAgJAAcUUkBnJHl4ZAA8AAuKBYwIUgFnsrM
+rNMsjBAgRAwCAEoFKFFD1RVKAmGYwsJKkqAqFGgGilkU/o4ALIF2U6CA5KCe
+ABRt9KHhApJS0YHbhUA20A0ZdiYMHDG5VF08MHMahN1hhCaI5EVeWg6yW4Kt
+CGDWCbnR2W6V+duncEBhq+OBUSX1A8+nP5ZcidTRHpEo7U9Sp6zHibmHJ+KJ
+dW4dLbn3RTMOs5k133NomGwQUkbUjMAAxYlAAYgQgwiiDFyVGyQxAQQC2KAP
+XzhzjVyDaIDcWz5ZMiAg7CBAymh7p5EIqARD9QETjAEl3MdRnyzu8VfneL1u
+VTfyRAEF2HvPSE2iyKUEYSIs+XICIFb2IMY/0L5cJZQRMpL6pT1QDzMUV94Q
+hl6U/F2ZiB5yornLu4Tmdwk2+hw03NWJX1lgguT8QNMlNxa9itQMIkx361F/
+emkUsL8AB2AjVTaRbjQzigEN5tZ6JyVXVRPEQRfGDWUGA6Tqtu2fvIycA9za
+6CbYukC0CAJxT7JLJc9NocqIAheXxgqQg3agoYX79GiB5P7/F3JFOFCQNa21
+4g==
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+uudecode -o f32.wav.bz2 f32.wav.bz2.b64
+if [ $? -ne 0 ]; then echo "Failed input uudecode"; fail; fi
+bunzip2 -f f32.wav.bz2
+if [ $? -ne 0 ]; then echo "Failed input bunzip2"; fail; fi
+
+cat > f64.wav.bz2.b64 << 'EOF'
+begin-base64 644 f64.wav.bz2
+QlpoOTFBWSZTWdSNbsUAAnB////qVmJQ3sTp83Xd4H8mRmTKXcAG5RR+/O/f
+//+GWUCKQAIY44uzsIihlNGQAyDQ0NBoaA000yaGIDQGgNAAA0Bpo0MQyY9K
+Y1P9KhFNGjU2ppMMKG1GQA0Gg0A0AAA0ADQaPUNDQAGgGDUAAaeqqAAAAAAA
+AAAAAAAAAAAAAAAANAxUhGmJo0AAAAADQAAAAAAAABkaNAAAADXlBJAwhAyA
+YQAJDCEMACQCQgQhhIBhAACEIQIBhCGYEgBAMJCEgQMAIEDAhIYYBAkEkkgU
+GrIAAAwiIdQdg3mmgAOyiSQRcKCQBABcoGGiGCSIVEC9RJBLpEgG5YDvKYID
+MViGuoEJmQJNNESGqaIJEEJBJIh++fh8tvqZd3mx08HLLZ2vTtll7m6TZs1k
+n+cfnZcKqy5kkbmQI50ROW5d0boBLRzjhGolCADyQ2IRwfMk96zJQSRksyiL
+kmnZy6ibJPCeAc2sqma+CpfmgZAEDEE1hDXiMbCDDVhgYYaJpWkU4DAaHgI8
+8sQaBh9vGjHDKJAQuBbDZ68bPXqbOXDgtyBjoBIFhAoi4ReNHbIw92AGfvtI
+KX3KAAz7UCbMOaABTKphYSKyLhXmIGM6Uu1RGrVAta2Rd0T1a30MxG5wSwSX
+DoYhPR3l0td4V66UnHF+0dykk1V1iuUF3a5DgNOakSKjCIumqoVRSY5yW6WU
+8hT5IfQIQgemhxU+bDAJQgCxG+44oGPxAN94iMchJ30nNks9OgzQLJdsA44Q
+BAOBOSAIVK/LrjoNpKGvA0VOJ+y+Sn2mkBYZWo+Wbf4nwOE7I5tsUo6S4VD2
+DPOYTYD6aIpsF9k2ZTpK6pzhE6a0II5boB0T9ashAqigQClIBCl/xdyRThQk
+NSNbsUA=
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+uudecode -o f64.wav.bz2 f64.wav.bz2.b64
+if [ $? -ne 0 ]; then echo "Failed input uudecode"; fail; fi
+bunzip2 -f f64.wav.bz2
+if [ $? -ne 0 ]; then echo "Failed input bunzip2"; fail; fi
+
+cat > u8.wav.bz2.b64 << 'EOF'
+begin-base64 644 u8.wav.bz2
+QlpoOTFBWSZTWbh5VIsAAA/36HRAQABAQCMgEYAlAgSASAAAAYAIIAAiE9Uw
+jE0bU2hqFAAAGTIhJovMoFEScQUHd01siC6bTrnAwubPNmYvxdyRThQkLh5V
+IsA=
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+uudecode -o u8.wav.bz2 u8.wav.bz2.b64
+if [ $? -ne 0 ]; then echo "Failed input uudecode"; fail; fi
+bunzip2 -f u8.wav.bz2
+if [ $? -ne 0 ]; then echo "Failed input bunzip2"; fail; fi
+
+#
+# the 16 bit file reads like this
+#
+cat > test.asc << 'EOF'
+Testing read
+Reading 101 frames from s16.wav at channel C
+Frames per sec. 48000
+Samples per frame 2
+Frames per fragment 16384
+Frames per stream 101
+Test read
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+for channel in 0 1; do
+  args="--read_test --frames 101 --channel $channel --file s16.wav"
+  echo "Running $prog $args"
+  $VALGRIND_CMD $bin/$prog $args > test$channel.ok 2>test.txt
+  if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+  sed "s/channel C/channel $channel/" test.asc | diff - test.txt
+  if [ $? -ne 0 ]; then echo "Failed diff text"; fail; fi
+done
+
+#
+# the other formats, read and mapped, convert to the same samples
+#
+for file in s24 s32 f32 f64; do
+  for mmap in "" "--mmap"; do
+    for channel in 0 1; do
+      args="--read_test --frames 101 --channel $channel $mmap --file $file.wav"
+      echo "Running $prog $args"
+      $VALGRIND_CMD $bin/$prog $args > test.out 2>test.txt
+      if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+      diff test$channel.ok test.out
+      if [ $? -ne 0 ]; then echo "Failed diff samples"; fail; fi
+      sed "s/s16.wav/$file.wav/;s/channel C/channel $channel/" test.asc | \
+        diff - test.txt
+      if [ $? -ne 0 ]; then echo "Failed diff text"; fail; fi
+    done
+  done
+done
+
+#
+# 8 bit files are rejected
+#
+cat > test.ok << 'EOF'
+Testing read
+source bits per sample not supported
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+args="--read_test --file u8.wav"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > test.out 2>&1
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+#
+# this much worked
+#
+pass
@@ -0,0 +1,415 @@
+#!/bin/sh
+#
+
+prog="PitchTracker_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+
+# Sanity checks
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+if [ ! -f $bin/$prog ] ; then echo "Didnt find "$prog; exit 2; fi
+
+fail()
+{
+        echo FAILED $0 $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+pass()
+{
+        echo PASSED $0 $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input is one second at 4000Hz of a glide from 150Hz to 400Hz with two
+# harmonics and a slow swell in amplitude, written by a python script
+#
+cat > glide.wav.bz2.b64 << 'EOF'
+begin-base64 644 glide.wav.bz2
+QlpoOTFBWSZTWRBJofcABnb/////////////////////////////////////
+////////4BQ/XrloB6+9uptS+3r33y7Lr2ert93vm+vH2ytW19d3d3A45fO9
+u3nnve74b3r3329tvcX2a1p3dz77hyj0dVPwTFPBMJ6aJiYAAATMU2kbTUwD
+QmJtNI2iYNJ5BPTIENTwTCTwEeppkwmjTNACaYmjCYymaATDSYJpgnpNqYmA
+mhlQ6p+SaMIyYAIbRPQm0mDQNDTSGp+hiQxoEwTyBoAmCMjJiamyGGQ9Jpoy
+MmmIBMDKbIpsjQxNTyT1PUxponppiNGJiaT0manlBlU/UMifppPETE9NTFPB
+qYmaaTU8yaZNJsmqeYp6am0E9KflJ6aHlTzExJ5qaNGmp4mqe9TUyMieU9Mp
+6EPyTIyZPVGnkam1GxTMmptMQ1MjJtQYJvVPR6jSA2kMqntGhM0jabVNpkyC
+ntCntNMEFP00NNGTABom0mjAjU9IzTVP0TAEmTyT9Sep4FNlNqeKbFHk0man
+pin6p5J6Jso9Q0eo9QNpDJk0aAek0HoNTI09IdU8pvVP0T0pvEYJiNMU8mnp
+pNGaGp6mnpqZNGlHpPU/VG2E1PSTynhpiho9Se1M0CaTzSTZNqPVN6Kafqn6
+iP1Tymj9U/VMQMhoPSaaPUMTTE00abUZD0jaTT0R6gbUCqqf6Jo0YAjJjQQ0
+NBkJ6aYjU2jQ0MmTTSnkyabImAmZCeUwUzU/UYmmJPFPRgnop6ZDUMTI9T1N
+kmmjZNNE00GyRiYmT000EMTNTRoARCOEggCHIL0/rqkhfeMjHs8NTaUNg+Ej
+UNp4SQ6Gr0sqvuuFywRZqczPo9EGRR+GuK9lo/KkaZ+NfPwCUEYWEG3MrLcH
+whCWPIbTcC+lfp8kc9BwlUnXX29auYNtRbGPhjYw1/sJf+kEmvSAlcrV3j3s
+iKaYTjF+cMnV3+95lLR3hY/qkmBHqCHPf62yBj0YugO8pyCsWuCSRyT9O8kS
+vDC93tWmUQJ/7GryvNpYmC9h0k/GE18L83OxXpng3/rvKrnqLzNzmWyelq45
+sFF8+hbIxF0YJ+jIlB4N19ZgtJd527EnEvp1ZNTn/QBsa4bIv8Z/R3ILEtGL
+8O3Ge90IApGeyA00rNwOZrCKFG17sof07olEQy0hwvXPby8kNqMVNKdGVsgw
+tS6e/+i5hWoxSNZQiRs3uY/H7y7rUCCkH1gbejKcyXDNKcmxlYsMXiClS4Fb
+wCmMiRGxM5hEl1NnsvYmxkTKKxxcpE/44rZhU487SCRKswkbCXudsgsU2t0J
+C7LUdttmE8R3XeahfyS5kP97+T2zC5ppCKkJe1FJFsB4fCsKlMvsQ/bY81nt
+GPj3u4gMRMQELe9Yk+zb3TKnGTCLyqIpk9Mx5X2OSB4sN7sn2p/Qmbc/3xaf
+pkW9n9uTucQH5bllyzXhNKEFyNE/G0eBv+/V2cnPrmCAOEY+Ll/0CjVDP6oL
+lhO+RFozTsMgF4zn79PfVfZo2ur5QsEPYwLjrtlvD1P35pWcv7RZrOqY5qmP
+YL/sIu/b4au0ImK1Zlk42QZ2xHh43oCJURVzRqBYEeqz/xI/+yqa10NPIVeO
+c8jlb1VwkCW2qdMdfIsXbxuGZJKvk1C4wNYbA9YPTVYvd5OyhuY2eLHcAxKj
+WURcexPS/JRyI/UeU5JeKxkrr2wunHHmXC+hW6k8u6uT5XbVUNfpe6VnvbT9
+ToA1VO0E9TW43EvtfNtL2mA9Sb8bZLYdj2WuP7IlVtehsXOhhz9wgRDd8gsy
+TbnuAdDT42echEiDGIlUv9lQQJ9Dy3OLg+SL3y6+2/6LwDmW7i58v7468tQm
+p6HgWChM0lsZWtNLxFnldXrHia/7vDIuIdPjqbSzowAu2lHVVu5kB3rMsrZZ
+v91a5/XQQN4kzz5WPo2TaTNW4VtVszK89FbzC6Wvee9Hs5kdTzRkIoH/TaRU
+30pjOCZGrurKcO0j+Wytj/yTh06QMkwwOvGOz5acgIsgWqQN+CHLZfRIZ3kZ
+5SL1KFhJUQfqbjQAk7nNhZDg10TZszSAULXgvtVKdmFmMyF6F8PVJ/7ScHCx
+v1RldnBHiLOsVI6mXwyTKEMcV9hScJNdjAhSwigteC29ZwgZcGTzEio6hDRw
+5Iog0lqWrxUYh8G6d8gdX5T0LRb1ZsA1Q8SecwwOaRRYQgeVvwIl1CDsuRSp
+5jPNnaCeztfqKllb3sM5axvYnFqQ3od0RjGYhhhoX0g+8iIVk+MGjqD76Woc
+C5a1qfH6AzucPqj6As7qWQT7eRJV2IMv+igg6RfpruutrN+opub+gZZxee3d
+y1K+vXF/plnIEb4P7GyIzWjvMw42v5kSherDtUTSbPAitT8ajc0Z2+ibLEk9
+VUaf+eatduCoDAUZmP3pLMuozDUg3gvsTFINc+V2pDPd5XUsG6ZegK0rhtA2
+YLo253dqK6dilc+GsT6ZyW6NRP5qTHY0SZxu8ceSWu7VuBSjdB0hSb4fxWRl
+d1FMdge26QyLgG/Zv1T52RDPiWjWzcH9okLShlODM2Ujo4rUetBurjxwvs97
+vsRxTh5EJw7bQec7pOWNdK+84mITGTKXvYr0K1Jbrc08d3JS+pMuvlqrVsu5
+96gZBjAdl00y7N29pwvM2UBoCPr6JyckP6fh/V4V8x+kuTtGfotPwuWdJ1N1
+wCEaw/XNcCRU8m6H/H+A2eoM4zp96d7kx1cARj9E9P1PHkcdtWy+aqtpq5iP
+/y8j3LRx2Cdl11uKm1+hHc68l/zayV1pA5e0IAMZ51+1IAnU8fM5U4gig5P4
+H9npKaW66QZwbn8xOz+Xhau05otSupuyIZ8mwhASvTJNWBRVJ4o+Ww3O7+nc
+DnYccJwNX4q/Hz7Kgv8vQcugWW3Fk4jUDG5Q9Q86/D7qKTF8yjdGLKFiKbDd
+Q2DoatBj6U68ACIDOpIcXF0jnSZzquykRaS78CPkG7j2h/u4fYzoUHlMumlo
+mvKTshqF0zQQUXOPce+a8QN/DgM3v432o+9m3njo/eotKDqdtl8/2SbsdhWE
+NQP3fbVPCo0V4eKaRuXhNM7ktOHlesmXmdzXpWTkrZaue0rCSHFBBUx7o3R7
+867Ar4Gk5K1dxeBtzz38slOR0KG9WrMD5y8/HdC/dlMXpeDxwIT+SL6+hKZN
+sg43nG7UQ2Jn1mwZy+nsB3nUjOP2bKhoishI/K37ueR6YvOgKmfRWqVybWnF
+8IVZNLQG3YzleupdLVsaERXblIO5DIm8e40SpGpswLtKBsEeHhUej3aPy4Ka
+enUTpmLQa2JVe9TAWF0mOGYvZwrHZl6ouwy3k9RRGXkdTKEyX/Qh97XWY25b
+OeSbTHHf+c4bl/fmrB6J6X22QWpW4PEOFw0NN/NA47G8tCq/CYWHuRJZpfER
+3VgZpfY3jNSchHvZn701cp9bR2CdM3jSssMzMbTSkvaQnhznVb0grgw3Cm+U
+NVISM5xa238F29AEv8GLVud6hf5BgXBai8n4rXbZCUcyDYhkgLCMdKq04bBz
+/ifyr3Tx/lyhYU+/oz3mpxk7vKxbYrEeFCAo/+oZwrXtqHZ8AfyS2Gh3rPj7
+eTG0dffdTnwA2eYcGUFORRdmg8zRrq950224y9fHHX86uvth1iHmOfxv7rgs
+lg7muMaZHI7xBBJxKgnOYIdVJy4OFEe71YZOKsdz1zwdlUNsuSX1SY7/OEK6
+JiN46BkrXTtBXgQeeoJSjtIBGxpTW7U4t2t4sZkZfgWiFrKdn+AhShNY6B9/
+nkO6jvXOMEB9pxBzAR9+HciHWxZXXyazdnB/Pf+riMTz1qedAh6Bd1r8eNSi
+oPZ86xJ4fxBa1fmeu2Q7xm4/fqcDjU+K+/CKxtfzE7c204ydHJkOIuQeq3Rn
+ODclmq68kUw0Y+JAhR2rEUHS7KuNGQHQ9HqmKV5md9KbqIubts2GwANOOhTQ
+uDhBjxhZRvrKM1FUnTDoAdQ8J1ybbDaWKqdU4CncKAFL7ovU/4pWDMMC/fxv
+Z+RZfe1J8bJ+btrH6cjCL/J6nJMAr3IRNk+lihqI8n8AojAt0XOueAO0mErW
+0a+nvb00gYS0g8Xb+zwUlkmmF+MY3sy4kIsVoFZ/+OJHjTTiEX2ycShWY8Y0
+yA9waUn8X0fuegodSjnzUxmPhcKXlKKp9kbFJTs2QTvMLn9Xin7sJY7Nwu4W
+QIwYH/A1Ai9KmLYGDG3jBJ4e5CRC33SpJeawZD2+IAw36mntBw90Xj/qMvbW
+ifSQbAyw5xAEhrsuey0kTfQOqBbe5SWy9R4Vuccf8DftPwFI9MBc+MnVWChu
+WiMK7f+zFcRRqznMKQTzL0/T5R+AZyE2MZ7ikb6xiqKugY3ZHQsovV83f9rF
+EpYwrpxEJd2r8w4kfGffj1lQ9XmpyEHVWz5bFkk+O14c2GzqE834Hg7EuCQS
+2vVb4YSC7XchrFC4nXQ1pVyoyqWUr/kx6NRkDjjY1Dn6nsJAb2/FcArvNRDd
+VJ3WRmlbPQmleuWbN5I1DjLIjB/PNSVR/BXPt0edxc3A2bHXMGb8yJXyIlAD
+bghD3A57u14PvoIuEcXtPU1gbRawVR/GGScerkxbbMwVwgmVxYzBiYyXP7uF
+BFYuvVu2REkz95hArhC8Glpat+td2OSryVUwpflQst3rDWc0cNK6r6+4Lc8E
+Z2hb3zC8ev4LA96+21vLcXjnjgB9hDU4dPIocaeXANWtBhN9jMXc+uzQ0Dj+
+Bj9DPBEjvIszaQpDadUrbRtyrUo5Uj4vDzd+Xcwmts8s7/cUAj5HejzWyh+N
+maQYPgTbl9VHie90CqrZtPsrUa2Vc6Fcq818ExlH0nWXYFQAfeDR/dDgcsh6
+JY9tA0QeXS8HRqIYMyZPC0xnA8fCXJ07yTbTdHotPLHcnMaaFNfQ75bxgYLs
+QfFPHxAv7JUD3Cld3CLcdWLIWjw69bKJX+0oC+ciQzVbw3bT87ppQmXG62g6
+mz7BjiEzXDwRAdxP1ltiayFdFLnZM1OwGQI5WgWZ7uPxKlOES7ZPYJiRrd9R
+yqkdNyMkHxnz761x6cA2tyEjAmqGtePXZObVcuCzkGlRg3yxKVPw0a/WQD6+
+6/xC/PK6naeNXb9u9JZcQi18azfhzXkHYIZYNub863luzJIlt27uGps/osL6
+huqpWyIAXW/jRau5UvJcgsNQwblw/eG/9W+9+uIR5pGFHrTU+bNVfXNyF8MN
+uCV6LHEFd4O8spJUtI1WDgEzhSAQoQYyntfK9HiyIBd2e7N3QCC2204XZ2Mt
+OEwmG9d9RLYkIvg41jqZ0N5utHRVBEjVXNr83Nvf0lNAAUP8p6J7dPRNEZ28
+FOOKuTX8J+a6wTNaWnBxqRtfwRAuKyDtvIMlujiRxrCbClcVJtR84sf4o6IY
+Tvb5lrJlIc02JxZyRUBrrUXrIQCGtMcXu6cpTmeP9mk1Jv5wAqTGSqYCJTkm
+DBmbojZyBNgmmNTj+8/R0sAbyYgYWDGa1nFbN8VsD9Y/in/3ggSL6neKvLOJ
+KsqG2lB7vEECI83A3Oe6dQVycTebohHQUmPTRLc+0P4vYmgapkdi5P2hZUM9
+BGA01Fg6plCQE7NvJgxXmpuITEBMwJ5yCtVM1G8pjkFgt9dUjRBxDMxxCUFP
+UKTvOvQ561zB0CEWPFk09apUnk1OoddCvZwgiqlmhxiMkwSjIESetFmR7cg2
+griNIBgRF5ekfnou7ULyWYhPMi/YtLPKU8sogCl+Pn5lWMYKRJE0E63aisNm
+z9vyrZg1mI9/ATkoYejjWq1e0JFSVRcPgtJBGh4CwysBBG2TCuVwgo2xuTxn
+lydqFE8Tw7omoQJ0LtPXb2x5pKuxq+pCq0z06kSpT5YvaKDO34u3nnBTaSjG
+YFIlvCYWt/epvQKiudXCrqZHOABAVW6JHOEJvsShKIELaaIL3w4tBjGMk8Hc
+H34ZfOEYYF3mw7GNFXDxsmFcIf4ilrEsPalZ9CTfLdOI4fLDrngjKtTTFmRd
+9cP2pJZN28kvRC6x1UjDg2cwKBug3L3TzEWZgG+6yvaG2CiZdF7ydchJ19mC
+rScl8ytl3q2fo6x6tTvHAAg4FJjNbppVPodBZaYFE0mESNDV7Jf5hx4mllyi
+tg2Z6hDCn4besvMLIC5ahnAG6yAWgB+mARNxUXX4R+DLwbN2gB3QTtRxBVnU
+NLakgxSE3bECB+OT2JOE+FUUoScYUZl1SKMOCYAal2BoRSGx9CFxktSVUnoM
+uAjASI+AfUKqa9vt5bbdbIJWcETNqYQQEB4YyrpCxUTRwouQJhAos6zHHNmt
+HgZS81vyNVaQYJIPADnXenscaXlc+leTQksQwpujCELDxucvZTE33r2zs+oI
+wgoC2lJHnr1aqGQJ9CvVAHw8BAWtDvy2KXIKCad9ewbcoyrAGWqmmOinz1K0
+aZkACS5c3sG1mz2uxUKAElZDX1T2uro16DMOzbCLNZAFZQqgo0q8nam4Rr4g
+IEBsqE7Mk27CLVvxNDMMDTIVwD9nspGNoizmCUR0tbggO3NOgPPzS6Ewkdta
+OYHrJIYgioujcM6KFMmDEeRVpHChA8oHyySKLYFfMONeZU2JAeFNIeDbCzt1
+U0VzhuaKnYBG1M0hVS72tsJUA7e1ikI8ROkVLLvQShCVM94i0rhU5xcK7Qjk
+2Bum/fbFesnrRHYAy5V54R7Xbu08aVYOyZSkBQoCrzwCZQSBj2WrckgLFSLM
+8ygQzC1tr1dbjsX95APuT1KVP21Q9xSzkQnBn9Mx2EqorKkiOh6pG/xbl9pF
+RsJYNMzCrdP9pk2ZsWdMurYza6cAyHqonfuZRtCIYDhoQDchFJx1XcGblQjg
+qQbSbu5V3aMwG9JaMbXvTcdYoCD7clYW2WQMA3umNVS4DrIu0CuokIBOUntw
+1tQBq7BjTCsfgLquzjVodom7pg4UPbds4QVTZTiCTsMC71IgpyoJXk7YLXtO
+nd69YO7tfVmNYdLrtOaMCMFVeUsNTNoily3zOXm1l2gH1YqDTkRQKshmxUTg
+cV1h3YiiRKtxfY1/QSsrT5Jh1d+qY5lAbdPiSF1P7KKDyuoHoIK8y+avOqmw
+zRVYvYnT9r7tbCocIApmztnCXfVZWvT3Lhh29DJkPRBrMrpWLArnXhi5CJ6C
+bzpgHNbBoKv2FrWOTJOhoM/S3gUcGsoL9mTg8luVnHARwwFr/4OpasvJXMc7
+ROqhwH7v0EoHe924wklCWcFnzCvXts4WMV9pYtdXFQB2gDo1Ui9AHAcReEH2
+mmeo/ZvOTI0Yh+LUkF2eWzOQXmGHOnLkGxcgb11qm0oefuOh8lyxtqQ64Kwk
+BSqP3UNNFo7AJFNexEjxb5tISHsfk6WvxMCjVNzo+oCma3WRi+eGu/K5383K
+PUuw4VRtDBxA15GZGN0Y90Zfpn+2ytrsRRVeQHbjYq4M5gdFw3qC+L8+JC42
+CvL05g4EPALOyImH1ISnxz+Nm/f32Li+Z17lPpaa9mYduDW0UkjxaiIX+W+S
+Wt7e5yUg1Vb1ygAJSxHRxfdIpJLgqxGjI6unr2/XJFqtHmSZTVIY8XUxM9f8
+2K1Q6zBZpF+RL+Kxai1yOGsBRHD9lhm2qcCqXK1X/aMJZxC5Giu/Wm4J47hH
+D1d8yaD/PqjYf5rwdDnBK62Wupy3bbaUxt3Z9N88d/0k15leLNvd0mijNQlN
+RwMguyG6GBPmZJLyAB4XCNgvzbQRNCdKnjW7p8SdHL63OLJXkSOb5zxJhI/H
+HqmtNx6OZjYwsYnhiyMUJwuxDYq10crpQsqNkiglmTjjikEm8v8nc8EEWO+1
+uEr3McVheMTVL4K5HSQi9NbktEhQDrLbXc3YMfm0lpclkU9+TyF4SsMgLqbj
+feehZ7C89NXnosO0zQ3V6+LyO+iTRTOLWc8aWSuvTk7/Kie9VeDXDe9PUvLz
+NLqzeuLyTgINsyjQhdQJOyZTDvZm1gc3S+CqKRHk0no+I/fb2XJvBcvavkoo
+36a0oKFRyxfwrBkm9ECM4iLugSj2UKhPxpVVrvzR0kQ04n7aYugf+1HxTCBX
+MC6WBsWjiE1FO4/xIv0nLggl3tVTxi98KpdI9GXjnbi9p9o4oNmJTPMyIyGo
+IPafl9uWcU2x15gY25Li7JMVvi35ZZfr+aRbIgTUGkfDxXyppU+mwSkTW9Rr
+EuG+hHfxYUr6EnxPZbSpnTArg4eR5oTKUVCsmKpF5SFzqqrZXL3BTdhyd4YP
+b3qREBOcsPLi0xSKw32Mjw3IZ0dEPUcMK30xwklEX3/YvZa5MPCpdAZo+QmQ
+gcDyZVxmrdfJLcUtoCx+y/m3OYRkNVDoJyvJb3QGbnwM+Llx1sPOBwJ2um42
+kLKoN+VRkl6QcU5j0yjMD8o58pEqcU3eCfwKpoFGfGZaxNjdcYCB+nJOV/QI
+wj2M15qJ2yNqAADCuU676r4zvLIjTTDw2fde/gnOrmsDvTjAVNRBls2Q/nb4
+vDwEkN2O13dCYXVKMFxHkS9J3rxTk/k0nAgtv2nIkvZW1Q1G3z7PdHnf5P+f
+cqjGMSUWhXu8r0Yyck9aOOfY5DJfLPJx+rIhruQA003EWMdogPDPJmwpXMU1
+PIaMu3pn+UzQzXSbGGkSAJSGlbRQfi1JSNwcjED+HK38ygdnLZjLyEC2k2/X
+lKl0pInplDcLtZt3apKAxr6ekOfhPhh1tRd7j5Mlj0UtQb3WxPRX/WUiYeIA
+daQUD4GDrc+7naEqQal85z54br2QzTRiBjUpMHviORABl4QhpI6LCRz5U+f3
+yUWI19G05+JOVyg6hcXvP3cZXTMBK4x0X0TcS8TmciJ4KM718rQvskcgK2pj
+A3eG9aiRhksKq5QfSYreEs032szyDxUOQRU+xSEHWETh4O9Dju3dMdc4gIWy
+9cL8V8Nm+ahwWvd/qp5h8et7O8yz0+i43DosY11+cPXcU0dSLVm0yfq2sIpw
+rjQFyAv8yo1Lj0TsZB78p0C5rgYM7bBrtrZzfx9/hZZYbNxtnWU/cgINstt5
+Q5D4r8lF7ST6bVFB3kuHKvbHLxPpf7OAzFmVTtlCNobdVNGPgOnE111hePmE
+4dAz3wdQFqzbGCxNJKKsOz+QMuEXvxLYCMVJpLgo6yrULcMMfd52ez/2e/hk
+JxJnf/elP17tW73of5+7Aj4oLKHTihwA6iWhSDOLkgzN8lfZT3TIP+LQbWTX
+BPackD4L/huchicMbSaOgiDdt317e4J6s69zqzJys6AhVLbQdMxOSOxWqfdj
+KTj8ZMnIZACV5P4mKruDPEILN9vxJArPyeAPldjamr5f34mVixz2VfFbbO2f
+mZEelnl7F9/0BJD2ZveHTTeN0c4Urj9ugzySGljzQGI8lq8oxd9v6csEXjwm
+HtVc9JyfcflqHWYtdxiSyz22nL62/6C3WKXqX+3vaWL1yJTEe7Cz7ksjnEDh
+Nw3nKJ4bQs8DurbG/dOo4PG56D4CrmGAc1iCAbwL9eEnargHg2Wsu6qx+i6F
+neBEUHEyFMczfg1yPzk8IgUwLnkpGcKL7Wbj3I9QyngZ6mSVkCP+J6SXXUuY
+BxzxlhGgiC5Rc2Tyt/RW2ioCYer9Z9wy536Qq4w3zee5E2Ub3eBG6cyeQP/E
+LXbFefH7GCvkBEXrE6tdzeihyAhmTC0rSl0C2I7cZMczw6zLA6sMaemblXQQ
+8LzLFVcju5xPomumaXWmne2lTVSwmnRFnTJGwyarkuwgK970mWc1BC1MvL2D
+4J7ntmanhQU6zFqBokIhZw+l/MU6LDo+9luWEkoOTfN7C0XbX+2bW+uKlhtH
+Gh2Z4qfrZu5HWc3lCHLMaF/qEp/FHfcFjGmGwTqYVxHK+kDD7lWC2Rgbj0e3
+fDn6/EG82oD6kKqHSUaHAxQTrMHzX2QIO89E1egCMOGrbVHNhAG1WBroaTzu
+PrZ5Vs3CDbs+zQN49MibC/dGE+G3v7tGcEfOhTIxqq6sE+7adhDb04RxYEkb
+TwndtRS5ptbo9zVWnIhlWxKUN2quk6u/bJ02+XwTCv2+k1jyNWfzOm6ldHxd
+s0TupxnU73DWNkd8hUSJLnYLj5Iq24GyRDqOALNbT3XeyuGD8SrZpUlE2oiL
+rdwNWMBpB0pJLrB0Puts0c02j3LnzactqNi0SghlB0p9cyRO2B2JhJYeq4tR
+hRzBTMmac6pKw8bosgIqzBBHjn6N/JrtK+/814GiEOZe8zBMGr0nBR4FU9IF
+0A9aZd9865jk0HtQybCY8sYrU7Khfz+sqHiFKZsVhe7oF6LrvBzgx1tLDlrI
+3SG2hHDLQyGKiNSgRmuJji9iN8P8x5+oGl3p9pFoSyuHveiGdn4DgUZO3nW9
+WIUKwh88PVGZmJ7wIDxKg8Ic8Bh2+btIvds9HwWHQ5mPlaxLfP3RxHWcSloB
+0TDgjGxy7HASFqPjYYHwLmctOPSdYYlirfjrcz9Ofm99c08V03dZ5aW8i7wZ
+HKMzcFIX14E6BVN8ew9y/vZyT9bQigAE6s/YbR3oyMsvnfA7Vokdutz0w/VK
+ruODFa08wTFWd06yFbrDS645Uu8qI/goK6Uiim+1uQllqWgKhek+UOiPvUM8
+lAsg/ChgsX2YVVWa0issHskO5pxMkO3MtvqwLtlVtB48VJvhO+vEE6zjDk1Z
+YMRX7SwxeEIZ9RmsEZmnIGF9LOD6Vv2O3iI8wgyHDcfVfPnIATsXArZrwXQ6
+I4go6CAFhkRa3qpK3zfG9HeEddYz2zoZO7YZRLVme0Brdl+I59Tu0QCDfKft
+TY4OIrLH4o2LZtYSzbs2baH082A8845ky3XAT8R30oYBuCYU3OJPS2lpdjYc
+LZLljNdZ+/5t6ZW+ByRqocR0WryRSkFv6vHwnf4s2ogqAiEZLz5X8EEO6uBx
+ql4oiHqC+VAz4k4X3Ubb2Isrhmf7eqdqfMPPlWk0TgA+p5gAvm3jqwP3Rysj
+RBdsr7O3QRROt72/wUOieg9TCr7fYmA+w2rXqLwpP5rLMeRhFZsXcAt6hS0l
+tb60B0ZD1sb/RY0l2+K+qnnEmEvdt/h6cP87nXpwFfJG8DeACXYAlq4EuKTY
+7pIDOgeNf7s65pkNqPNfeVRzWSi/G7YC6fSP4O8ephzJbUcRAhLbyelUkquH
+1x6JtzPV9BS2YBMdIfz4Lm/gpQ847TeWXrnPOi/CcpcyaZp+tah5+xmlNw0w
+j2yPumLBibmh7Eobkjez5OvkAA7AWTj/nUosURx6G0XqH42Tjg5feRBQYSVS
+//i7kinChICCTQ+4
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+uudecode -o glide.wav.bz2 glide.wav.bz2.b64
+if [ $? -ne 0 ]; then echo "Failed input uudecode"; fail; fi
+bunzip2 -f glide.wav.bz2
+if [ $? -ne 0 ]; then echo "Failed input bunzip2"; fail; fi
+
+#
+# the serial pitch track looks like this
+#
+cat > test.ok << 'EOF'
+155.1
+156.8
+158.1
+160
+161.1
+162.8
+164.6
+166
+167.7
+169.5
+171.1
+172.8
+174.6
+176.2
+177.9
+179.7
+181.5
+183.4
+184.9
+186.9
+188.9
+190.8
+192.6
+194.5
+196.6
+198.6
+200.5
+202.3
+204.3
+206.5
+208.6
+210.5
+212.4
+214.4
+216.6
+219
+221.2
+223.2
+225.2
+227.5
+229.7
+232.3
+234.7
+236.7
+239.3
+241.3
+243.9
+246.6
+248.8
+251.4
+253.8
+256.1
+258.9
+261.5
+264.5
+266.7
+269
+271.5
+274.1
+277.3
+280.6
+282.9
+285.7
+288.2
+291
+293.7
+296.9
+300.3
+303.4
+306.4
+309.2
+311.9
+314.9
+317.8
+321.1
+324.9
+328.8
+331.6
+334.4
+337.7
+340.6
+343.9
+347.4
+351.6
+355.7
+359
+362.7
+365.4
+369
+372.3
+375.4
+379.3
+383.8
+388.5
+392.7
+396.5
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+args="--file glide.wav"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+#
+# the segments stitch to the serial track, including segments that start
+# past the end of the file
+#
+for args in "--threads 2" "--threads 3 --msWarmUp 200" "--threads 8" \
+            "--threads 8 --maxPitchSamples 500"; do
+  args="$args --file glide.wav"
+  echo "Running $prog $args"
+  $VALGRIND_CMD $bin/$prog $args > test.out
+  if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+  diff test.ok test.out
+  if [ $? -ne 0 ]; then echo "Failed diff segments"; fail; fi
+done
+
+#
+# so do the tracks of the mapped file
+#
+for args in "--mmap" "--threads 3 --mmap"; do
+  args="$args --file glide.wav"
+  echo "Running $prog $args"
+  $VALGRIND_CMD $bin/$prog $args > test.out
+  if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+  diff test.ok test.out
+  if [ $? -ne 0 ]; then echo "Failed diff mapped file"; fail; fi
+done
+
+#
+# the latency of the segments is reported
+#
+args="--threads 4 --debug --file glide.wav"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > test.out 2> txt
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff debug segments"; fail; fi
+grep -q "^capture to estimate latency ms: p50" txt
+if [ $? -ne 0 ]; then echo "Failed grep latency"; fail; fi
+
+#
+# only files are tracked in segments
+#
+args="--threads 2 --device synth:sin440 --maxPitchSamples 1"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > test.out 2> txt
+if [ $? -eq 0 ]; then echo "Failed threads without file"; fail; fi
+echo "--threads requires --file" | diff - txt
+if [ $? -ne 0 ]; then echo "Failed diff threads without file"; fail; fi
+
+#
+# resampled segments are read from the start of the file. The resamplers
+# are built concurrently, so a PORT=thread build checks that they share no
+# unsynchronised state.
+#
+args="--resampleRate 8000 --file glide.wav"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > test.ok
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+for threads in 2 4 8; do
+  echo "Running $prog --threads $threads $args"
+  $VALGRIND_CMD $bin/$prog --threads $threads $args > test.out
+  if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+  diff test.ok test.out
+  if [ $? -ne 0 ]; then echo "Failed diff resampled segments"; fail; fi
+done
+
+#
+# this much worked
+#
+pass
@@ -0,0 +1,152 @@
+#!/bin/sh
+#
+
+prog="PitchTracker_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+
+# Sanity checks
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+if [ ! -f $bin/$prog ] ; then echo "Didnt find "$prog; exit 2; fi
+
+fail()
+{
+        echo FAILED $0 $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+pass()
+{
+        echo PASSED $0 $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the inputs are one second at 8000Hz of a 440Hz sine of amplitude 0.00001,
+# a third of the least significant bit of 16 bit PCM, written by a python
+# script as 16 bit PCM, 24 bit PCM and 32 bit float
+#
+cat > low16.wav.bz2.b64 << 'EOF'
+begin-base64 644 low16.wav.bz2
+QlpoOTFBWSZTWQjtmdMAAIz/2PAAQADAAAABYyARgCUCBABAAAQAAAQACCAA
+VFeoADQaDQSRR6I0aGQ0fCSU4yAAck4AENJ3hkgCbaeemM73tY0OPas55EU6
+iwAB8XckU4UJAI7ZnTA=
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+uudecode -o low16.wav.bz2 low16.wav.bz2.b64
+if [ $? -ne 0 ]; then echo "Failed input uudecode"; fail; fi
+bunzip2 -f low16.wav.bz2
+if [ $? -ne 0 ]; then echo "Failed input bunzip2"; fail; fi
+
+cat > low24.wav.bz2.b64 << 'EOF'
+begin-base64 644 low24.wav.bz2
+QlpoOTFBWSZTWQPtsPsAFt5/n+pKUtTlSqqq9//9giUCBAAAB/9t6qqqVKUp
+SkrQBB4AAAAAcDQGg0aBk0ABoADE0NNA00ANGjQANGhwNAaDRoGTQAGgAMTQ
+00DTQA0aNAA0aHA0BoNGgZNAAaAAxNDTQNNADRo0ADRocDQGg0aBk0ABoADE
+0NNA00ANGjQANGgUpVIQwmgyaYmaaYTDKTCDQ00AAB6mmmgGJiaae1xxOHwI
+nlqMSeiJwvTE5AnJE9QTlCeqJyxOYJzRPWE41RzhPTE54nJE1ROUJ0BOWJrC
+c0TXE5gmwJzxNkToCbQnRE2xNkTcE2BN4TYE0CbAmkTZE6Ym0J64nSE6gm2J
+1RNwTrCbomCbonXE3hME3hPYE3hME3RPZE3RME3BME2xME6QmCbQmBNcTZE4
+YTWE1xOOE1RNYTkBOUJyxOaJzhNUTp9HSJpE0iaRNImkTSJpE0iaROn1MRFx
+cqVJqZEFdXCqXVEyJgmCYJgmCYJgmCdbUE1BMEwTBMEwTImCYE4OVK6/Z1IB
+OxgVdjsdjgAnQwKlw8FS28+93uzxeDue/2u1xBBWcLUAJxsE9ITBOAJgmCYJ
+gmCYJgmCYJgmCYJgmCYJgmCYJgqlXEqO+J4BP8E8IniE8Yn+ieQT/hPKJxN8
+TfE3xN8TfE3wnbE7YnbCdwTuCdwJ3RO6J3Qn6iYJ+wmCfuJgn8CYJ/ImCf0J
+wxP7EwTvCccTviYJ4BOQJ/gmCeETlCeITlieMTmif6JzhPIJqif8JqieUTWE
+6ImsJoE1xNAmuJoE2RNAm0JoE6QmgTbE0CbgmgTdE0CbomgTeE3RN0TcE3BN
+sTpCbQmyJsCa4nRE/8XckU4UJAD7bD7A
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+uudecode -o low24.wav.bz2 low24.wav.bz2.b64
+if [ $? -ne 0 ]; then echo "Failed input uudecode"; fail; fi
+bunzip2 -f low24.wav.bz2
+if [ $? -ne 0 ]; then echo "Failed input bunzip2"; fail; fi
+
+cat > lowf32.wav.bz2.b64 << 'EOF'
+begin-base64 644 lowf32.wav.bz2
+QlpoOTFBWSZTWQdHvE0AGlf///76X////E/+f7v/zW1CTL/GW+H38dV//Xdv
+Y7sXD80vYAk/AAAAAAAAAAPQAQZMRk0yaDQyYhkAaaAwjBGmmCDCYhiNGgDQ
+DCMCaBppoMgDIaZNADTIQZMRk0yaDQyYhkAaaAwjBGmmCDCYhiNGgDQDCMCa
+BppoMgDIaZNADTIQZMRk0yaDQyYhkAaaAwjBGmmCDCYhiNGgDQDCMCaBppoM
+gDIaZNADTIM09RTJ6INGgDTTTQ00GjRoGTENAAMQBggDQAGQADQAaGQ0AADQ
+AQZMRk0yaDQyYhkAaaAwjBGmmCDCYhiNGgDQDCMCaBppoMgDIaZNADTICpSC
+AVP0CCm0AmTT1HpMEybU2UbU2JGT1GxGoyeSD0mCeQ0yepkniJ5MDKTyRp6a
+jJ6aTTCPKbNFPMp1nXVK1LlJ7nc0v3rOx2VTUXburCO8COIEW1hFxcEWiLgi
+4Is3AItEWiLRFojrwR1zKBHIBFwRdEXBF0Rj4fM5QI7TYAintBF/AIoIwCMA
+iwI0VoRYEW7YEbUEVdeCPRerRT0AjoKBGkqwCLojAI6wRV3/nNM5oRSgRbbr
+ukCPf6gI2gI+QEcrsvz70Ecve/F+vi99mbrMzKLn1anyMWHN4O4/t9r2e1/G
+EfJQI4GDgW4Pm9Xe7Xuuj7+//x1ux0/fAjZX97pwRzwjc0CPD+AEfSEYwjtx
+GpEfZEakRaEWhHjiPbCKCO/EfAEc2sRYEUEWCLAjjhHNoEYu2bgRUI/uIxiN
+grqhFAigj5soRWIyhFiSKuJzQjxBH8BHyiNAIsEWCKCKxFgi14wjnCNOIr8I
+RR9Iik7wRSwRT+ojzQirYCOmIqc4RQR2Ai+IviN8I4gjMEXFYijoCMYirAIo
+n0iKeuIplCLwjbCMgRhEWysRT7wi8IyRFeIRohGERXGUIouiMwRU3IjeCNsI
+3YjNEesI9cRYI2wi6I9IR6wi6I3gigjuxG7EZQjwBFQjuBG7EXBFBFojGI3Q
+iwRaIwiKhGaIwCKhGWIxCMoRaIxiL4jJEZAjLEa0I0b1ARwWr7MEfzBHnBH8
+aBF3w6Nwfs93wfLBGpEaoR4IjVCKxFYisRWI6eaCOQCPJx3uP3GdXhEUEYBG
+ERWEVBFAigRWIqEViKxHLCLBGtEWCNcIsCPJnCm5ocMReEbEReEVCKBFAjCI
+qEYRFNmCMIi0RiEWCKxFwRWIuCKgigRbwARwuL11my5l4RWIvCMIj56gRVXR
+6m++jShFFAj0wRi5969wvhBGdzOkCLgjJEXRGQI12sBFPS4313sBFFAjidgI
+wiOxEYRFWIIxBG3BHyAjRtZcEXhF4RfEcbTdqCLJc5gIqVUdl0rvvBFKBGSE
+ZIRpbt749jzM4EW25oI+MEdnX0gRS3EEYgjzFQiwRWIsEfCEZqpZCLRFQi0R
+aEWy3SiKCPrCLgjpgi8IsEXhFgja60Eam0RcEWiLgjtNYCKxFoRQR0+bqva9
+Hz67OrxtRobjafF7PD0N1vPG+jjdAIpQI8/l7Wzn/88Xo77/ux/99zn9Ptvs
+a4EbT0Ln0AjSAjj/UEduEUCKBGrBHOBHud6I70Rj6II+V8zg2dHggisEe3oB
+Hj1VBG8BGcEZ4jIEZ4jkhFgiwRQRWIsEXZxRGrEd2I8ARnCLT7oiwRVniNeI
+oIqT8ojuBHJEViPyCL4jWiMAjfiLcwRYIqOSIxiMAitGcIo0wjKEXhGeIwCM
+gRcrEfgEXhGSIxCMAjRCLsZQi6IzBFc84RxxHlCNeI1gjOEccRYI4oi6IzhH
+IEXRHJEUEZwjTiMsRyRFQjbiM8RcEUEb8R3IjgCNYIviMsRniLwi+IyBFQj0
+xGMRUI0gjJEaMRaIyxF8RohGYI0gjPCOtzKM9UI24jRCNuI8TMBGf0ARdiY3
+S4GOVkB6jigN4KN6LkkjlwGAeVAPYsQYHJKADIhDCNDCEUWMvBAjBQB1tVSy
+qrBiu4b9+llxYpdpVRSkwImWIxCMsRWI2YRXQI0LBFYi0RaEVBFBFKUpyvLB
+Gr8X9AR7wRVQI8rwqXl/G7nyAR7AI0NeCNQCPJBF+/6ZTqAjcgjOvz57RG0E
+XhG0Eeb1WwBHu5oI4PSBGDugRwARViCMIR7AIqEViKxHWCOCCNC0IsCKBFAj
+f7sIpQIuiLBF0RaI31VlOxwhGzoEdQEdQEdUIyAigRQIvXrgI4fE/+LuSKcK
+EgDo94mg
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+uudecode -o lowf32.wav.bz2 lowf32.wav.bz2.b64
+if [ $? -ne 0 ]; then echo "Failed input uudecode"; fail; fi
+bunzip2 -f lowf32.wav.bz2
+if [ $? -ne 0 ]; then echo "Failed input bunzip2"; fail; fi
+
+#
+# the sine survives into the pitch path from the 24 bit and float files. The
+# AGC output peaks at 10 times the input and crosses zero at 440Hz. The 16
+# bit file is silent.
+#
+for file in low16 low24 lowf32; do
+args="--file $file.wav --maxPitchSamples 40 --debug"
+echo "Running $prog $args"
+$VALGRIND_CMD $bin/$prog $args > out 2> /dev/null
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+awk 'NR>500{v=($1<0)?-$1:$1; if(v>m)m=v} \
+  END{print (m>0.9e-5)&&(m<1.1e-5), (m==0)}' y.txt > peak.$file
+awk 'NR>500{v=($1<0)?-$1:$1; if(v>m)m=v; s=($1>0); if(NR>501&&s!=p)z++; p=s} \
+  END{f=z*8000/(2*(NR-501)); print (m>0.9e-4)&&(m<1.1e-4), (f>430)&&(f<450)}' \
+  yagc.txt >> peak.$file
+done
+printf "0 1\n0 0\n" | diff - peak.low16
+if [ $? -ne 0 ]; then echo "Failed low level 16 bit"; fail; fi
+for file in low24 lowf32; do
+printf "1 0\n1 1\n" | diff - peak.$file
+if [ $? -ne 0 ]; then echo "Failed low level $file"; fail; fi
+done
+
+#
+# this much worked
+#
+pass